@@ -126,6 +126,8 @@ class ImageFile(enum.Enum) :
     Jpeg = 6
     ## A BMP (BitMap Picture) image file format.
     Bmp = 7
+    ## A QOI (Quite OK Image) lossless image file format.
+    Qoi = 8
 
 ## @ingroup python
 # Describes pixel format type. It is used in Simd.Image.
@@ -172,6 +174,16 @@ class PixelFormat(enum.Enum) :
 	Argb32 = 19
 	## A 24-bit (3 8-bit channels) LAB (CIELAB) pixel format.
 	Lab24 = 20
+	## A 16-bit gray pixel format.
+	Gray16 = 21
+	## A 48-bit (3 16-bit channels) BGR (Blue, Green, Red) pixel format.
+	Bgr48 = 22
+	## A 64-bit (4 16-bit channels) BGRA (Blue, Green, Red, Alpha) pixel format.
+	Bgra64 = 23
+	## A 48-bit (3 16-bit channels) RGB (Red, Green, Blue) pixel format.
+	Rgb48 = 24
+	## A 64-bit (4 16-bit channels) RGBA (Red, Green, Blue, Alpha) pixel format.
+	Rgba64 = 25
 	
 	## Gets pixel size in bytes.
 	# @return pixel size in bytes.	
@@ -197,6 +209,11 @@ class PixelFormat(enum.Enum) :
 		elif self == Simd.PixelFormat.Uyvy16 : return 2
 		elif self == Simd.PixelFormat.Argb32 : return 4
 		elif self == Simd.PixelFormat.Lab24 : return 3
+		elif self == Simd.PixelFormat.Gray16 : return 2
+		elif self == Simd.PixelFormat.Bgr48 : return 6
+		elif self == Simd.PixelFormat.Bgra64 : return 8
+		elif self == Simd.PixelFormat.Rgb48 : return 6
+		elif self == Simd.PixelFormat.Rgba64 : return 8
 		else : return 0
 		
 	## Gets channel size in bytes.
@@ -223,6 +240,11 @@ class PixelFormat(enum.Enum) :
 		elif self == Simd.PixelFormat.Uyvy16 : return 1
 		elif self == Simd.PixelFormat.Argb32 : return 1
 		elif self == Simd.PixelFormat.Lab24 : return 1
+		elif self == Simd.PixelFormat.Gray16 : return 2
+		elif self == Simd.PixelFormat.Bgr48 : return 2
+		elif self == Simd.PixelFormat.Bgra64 : return 2
+		elif self == Simd.PixelFormat.Rgb48 : return 2
+		elif self == Simd.PixelFormat.Rgba64 : return 2
 		else : return 0
 		
 	## Gets channels count.
@@ -249,6 +271,11 @@ class PixelFormat(enum.Enum) :
 		elif self == Simd.PixelFormat.Uyvy16 : return 2
 		elif self == Simd.PixelFormat.Argb32 : return 4
 		elif self == Simd.PixelFormat.Lab24 : return 3
+		elif self == Simd.PixelFormat.Gray16 : return 1
+		elif self == Simd.PixelFormat.Bgr48 : return 3
+		elif self == Simd.PixelFormat.Bgra64 : return 4
+		elif self == Simd.PixelFormat.Rgb48 : return 3
+		elif self == Simd.PixelFormat.Rgba64 : return 4
 		else : return 0
 
 ## @ingroup python
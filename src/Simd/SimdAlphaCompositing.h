@@ -0,0 +1,102 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdAlphaCompositing_h__
+#define __SimdAlphaCompositing_h__
+
+#include "Simd/SimdAlphaBlending.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<SimdAlphaCompositingModeType mode> SIMD_INLINE int AlphaCompositing(int src, int dst, int srcAlpha, int dstAlpha);
+
+        template<> SIMD_INLINE int AlphaCompositing<SimdAlphaCompositingNormal>(int src, int dst, int srcAlpha, int dstAlpha)
+        {
+            return Min(src + DivideBy255(dst * (0xFF - srcAlpha)), 0xFF);
+        }
+
+        template<> SIMD_INLINE int AlphaCompositing<SimdAlphaCompositingAdd>(int src, int dst, int srcAlpha, int dstAlpha)
+        {
+            return Min(src + dst, 0xFF);
+        }
+
+        template<> SIMD_INLINE int AlphaCompositing<SimdAlphaCompositingMultiply>(int src, int dst, int srcAlpha, int dstAlpha)
+        {
+            return Min(DivideBy255(src * dst) + DivideBy255(src * (0xFF - dstAlpha)) + DivideBy255(dst * (0xFF - srcAlpha)), 0xFF);
+        }
+
+        template<> SIMD_INLINE int AlphaCompositing<SimdAlphaCompositingScreen>(int src, int dst, int srcAlpha, int dstAlpha)
+        {
+            return src + dst - DivideBy255(src * dst);
+        }
+
+        template<SimdAlphaCompositingModeType mode, bool premultiplied> SIMD_INLINE void AlphaCompositing(const uint8_t* src, int alpha, uint8_t* dst)
+        {
+            int s0 = src[0], s1 = src[1], s2 = src[2], s3 = src[3];
+            if (!premultiplied)
+            {
+                s0 = DivideBy255(s0 * s3);
+                s1 = DivideBy255(s1 * s3);
+                s2 = DivideBy255(s2 * s3);
+            }
+            if (alpha < 0xFF)
+            {
+                s0 = DivideBy255(s0 * alpha);
+                s1 = DivideBy255(s1 * alpha);
+                s2 = DivideBy255(s2 * alpha);
+                s3 = DivideBy255(s3 * alpha);
+            }
+            int d3 = dst[3];
+            dst[0] = AlphaCompositing<mode>(s0, dst[0], s3, d3);
+            dst[1] = AlphaCompositing<mode>(s1, dst[1], s3, d3);
+            dst[2] = AlphaCompositing<mode>(s2, dst[2], s3, d3);
+            dst[3] = AlphaCompositing<mode>(s3, d3, s3, d3);
+        }
+
+        typedef void (*AlphaCompositingRowPtr)(const uint8_t* src, size_t width, int alpha, uint8_t* dst);
+
+        typedef AlphaCompositingRowPtr(*AlphaCompositingRowGetter)(SimdAlphaCompositingModeType mode, bool premultiplied, bool global);
+
+        AlphaCompositingRowPtr GetAlphaCompositingRow(SimdAlphaCompositingModeType mode, bool premultiplied, bool global);
+
+        void AlphaCompositing(const SimdAlphaCompositingLayer* layers, size_t count, uint8_t* dst, size_t dstStride, 
+            size_t width, size_t height, AlphaCompositingRowGetter getRow);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        Base::AlphaCompositingRowPtr GetAlphaCompositingRow(SimdAlphaCompositingModeType mode, bool premultiplied, bool global);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        Base::AlphaCompositingRowPtr GetAlphaCompositingRow(SimdAlphaCompositingModeType mode, bool premultiplied, bool global);
+    }
+#endif
+}
+#endif
@@ -66,6 +66,8 @@ namespace Simd
         void AlphaBlendingUniform(const uint8_t* src, size_t srcStride, size_t width, size_t height,
             size_t channelCount, uint8_t alpha, uint8_t* dst, size_t dstStride);
 
+        void AlphaCompositing(const SimdAlphaCompositingLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height);
+
         void AlphaFilling(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * channel,
             size_t channelCount, const uint8_t * alpha, size_t alphaStride);
 
@@ -73,6 +75,8 @@ namespace Simd
 
         void AlphaUnpremultiply(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, SimdBool argb);
 
+        void AnyToBe16u(const uint8_t* src, size_t srcStride, size_t width, size_t height, SimdPixelFormatType srcFormat, uint8_t* dst, size_t dstStride, size_t dstChannels);
+
         void BackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
             uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride);
 
@@ -108,6 +112,11 @@ namespace Simd
 
         void BayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+        void BayerDemosaic(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height, SimdPixelFormatType bayerFormat, size_t bitDepth,
+            size_t blackLevel, const float* gains, SimdBayerDemosaicType method, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat);
+
+        void Be16uToAny(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t srcChannels, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat);
+
         void BgraToBgr(const uint8_t* bgra, size_t width, size_t height, size_t bgraStride, uint8_t* bgr, size_t bgrStride);
 
         void BgraToGray(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride);
@@ -135,6 +144,10 @@ namespace Simd
 
         void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride);
 
+        void BgrToGray16u(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t* gray, size_t grayStride);
+
+        void BgrToGray32f(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t* gray, size_t grayStride);
+
         void BgrToLab(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* lab, size_t labStride);
 
         void BgrToRgb(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgb, size_t rgbStride);
@@ -179,6 +192,12 @@ namespace Simd
 
         void DeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride);
 
+        void Deinterleave16u(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+            uint8_t* dst0, size_t dst0Stride, uint8_t* dst1, size_t dst1Stride, uint8_t* dst2, size_t dst2Stride, uint8_t* dst3, size_t dst3Stride);
+
+        void Deinterleave32f(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+            uint8_t* dst0, size_t dst0Stride, uint8_t* dst1, size_t dst1Stride, uint8_t* dst2, size_t dst2Stride, uint8_t* dst3, size_t dst3Stride);
+
         void DetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
@@ -276,6 +295,12 @@ namespace Simd
 
         void InterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
 
+        void Interleave16u(const uint8_t* src0, size_t src0Stride, const uint8_t* src1, size_t src1Stride, const uint8_t* src2, size_t src2Stride,
+            const uint8_t* src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t* dst, size_t dstStride);
+
+        void Interleave32f(const uint8_t* src0, size_t src0Stride, const uint8_t* src1, size_t src1Stride, const uint8_t* src2, size_t src2Stride,
+            const uint8_t* src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t* dst, size_t dstStride);
+
         void Laplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
         void LaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
@@ -298,6 +323,9 @@ namespace Simd
         void MedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             size_t channelCount, uint8_t * dst, size_t dstStride);
 
+        void Morphology(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels, size_t kernelX, size_t kernelY,
+            SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, uint8_t* dst, size_t dstStride);
+
         void NeuralAdaptiveGradientUpdate(const float* delta, size_t size, size_t batch, const float* alpha, const float* epsilon, float* gradient, float* weight);
 
         void NeuralAddVector(const float* src, size_t size, float* dst);
@@ -354,6 +382,25 @@ namespace Simd
 
         void NeuralUpdateWeights(const float* x, size_t size, const float* a, const float* b, float* d, float* w);
 
+        void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Nv12ToBgrResized(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+            uint8_t* bgr, size_t bgrStride, size_t dstWidth, size_t dstHeight, SimdYuvType yuvType);
+
+        void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void Nv12ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Nv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Nv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Nv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void Nv21ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
         void OperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
             size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
 
@@ -555,6 +602,9 @@ namespace Simd
 
         void SynetUnaryOperation32f(const float* src, size_t size, SimdSynetUnaryOperation32fType type, float* dst);
 
+        void TemplateMatch(const uint8_t* src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t* tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight,
+            SimdTemplateMatchMethodType method, float* dst, size_t dstStride);
+
         void TextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
 
@@ -671,6 +721,9 @@ namespace Simd
         void Yuv444pToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
 
+        void Yuv16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height,
+            SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, uint8_t* dst, size_t dstStride, SimdYuv16OutputType output, SimdBool dither);
+
         void Yuv420pToUyvy422(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             size_t width, size_t height, uint8_t* uyvy, size_t uyvyStride);
     }
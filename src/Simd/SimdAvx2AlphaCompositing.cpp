@@ -0,0 +1,121 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdAlphaCompositing.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K8_SHUFFLE_ALPHA = SIMD_MM256_SETR_EPI8(
+            0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0xE, 0xF, 0xE, 0xF, 0xE, 0xF, 0xE, 0xF,
+            0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0x6, 0x7, 0xE, 0xF, 0xE, 0xF, 0xE, 0xF, 0xE, 0xF);
+
+        template<SimdAlphaCompositingModeType mode> SIMD_INLINE __m256i AlphaCompositing16(__m256i src, __m256i dst, __m256i srcAlpha);
+
+        template<> SIMD_INLINE __m256i AlphaCompositing16<SimdAlphaCompositingNormal>(__m256i src, __m256i dst, __m256i srcAlpha)
+        {
+            return _mm256_add_epi16(src, Divide16uBy255(_mm256_mullo_epi16(dst, _mm256_sub_epi16(K16_00FF, srcAlpha))));
+        }
+
+        template<> SIMD_INLINE __m256i AlphaCompositing16<SimdAlphaCompositingAdd>(__m256i src, __m256i dst, __m256i srcAlpha)
+        {
+            return _mm256_add_epi16(src, dst);
+        }
+
+        template<> SIMD_INLINE __m256i AlphaCompositing16<SimdAlphaCompositingMultiply>(__m256i src, __m256i dst, __m256i srcAlpha)
+        {
+            __m256i dstAlpha = _mm256_shuffle_epi8(dst, K8_SHUFFLE_ALPHA);
+            __m256i sd = Divide16uBy255(_mm256_mullo_epi16(src, dst));
+            __m256i s1 = Divide16uBy255(_mm256_mullo_epi16(src, _mm256_sub_epi16(K16_00FF, dstAlpha)));
+            __m256i d1 = Divide16uBy255(_mm256_mullo_epi16(dst, _mm256_sub_epi16(K16_00FF, srcAlpha)));
+            return _mm256_add_epi16(_mm256_add_epi16(sd, s1), d1);
+        }
+
+        template<> SIMD_INLINE __m256i AlphaCompositing16<SimdAlphaCompositingScreen>(__m256i src, __m256i dst, __m256i srcAlpha)
+        {
+            return _mm256_sub_epi16(_mm256_add_epi16(src, dst), Divide16uBy255(_mm256_mullo_epi16(src, dst)));
+        }
+
+        template<SimdAlphaCompositingModeType mode, bool premultiplied, bool global> SIMD_INLINE __m256i AlphaCompositing16(__m256i src, __m256i dst, __m256i alpha)
+        {
+            if (!premultiplied)
+                src = Divide16uBy255(_mm256_mullo_epi16(src, _mm256_blend_epi16(_mm256_shuffle_epi8(src, K8_SHUFFLE_ALPHA), K16_00FF, 0x88)));
+            if (global)
+                src = Divide16uBy255(_mm256_mullo_epi16(src, alpha));
+            return AlphaCompositing16<mode>(src, dst, _mm256_shuffle_epi8(src, K8_SHUFFLE_ALPHA));
+        }
+
+        template<SimdAlphaCompositingModeType mode, bool premultiplied, bool global> SIMD_INLINE void AlphaCompositing(const uint8_t* src, __m256i alpha, uint8_t* dst)
+        {
+            __m256i _src = _mm256_loadu_si256((__m256i*)src);
+            __m256i _dst = _mm256_loadu_si256((__m256i*)dst);
+            __m256i lo = AlphaCompositing16<mode, premultiplied, global>(_mm256_unpacklo_epi8(_src, K_ZERO), _mm256_unpacklo_epi8(_dst, K_ZERO), alpha);
+            __m256i hi = AlphaCompositing16<mode, premultiplied, global>(_mm256_unpackhi_epi8(_src, K_ZERO), _mm256_unpackhi_epi8(_dst, K_ZERO), alpha);
+            _mm256_storeu_si256((__m256i*)dst, _mm256_packus_epi16(lo, hi));
+        }
+
+        template<SimdAlphaCompositingModeType mode, bool premultiplied, bool global> void AlphaCompositingRow(const uint8_t* src, size_t width, int alpha, uint8_t* dst)
+        {
+            size_t size = width * 4, sizeA = AlignLo(size, A), i = 0;
+            __m256i _alpha = _mm256_set1_epi16(alpha);
+            for (; i < sizeA; i += A)
+                AlphaCompositing<mode, premultiplied, global>(src + i, _alpha, dst + i);
+            for (; i < size; i += 4)
+                Base::AlphaCompositing<mode, premultiplied>(src + i, alpha, dst + i);
+        }
+
+        template<SimdAlphaCompositingModeType mode, bool premultiplied> Base::AlphaCompositingRowPtr GetAlphaCompositingRow(bool global)
+        {
+            return global ? AlphaCompositingRow<mode, premultiplied, true> : AlphaCompositingRow<mode, premultiplied, false>;
+        }
+
+        template<SimdAlphaCompositingModeType mode> Base::AlphaCompositingRowPtr GetAlphaCompositingRow(bool premultiplied, bool global)
+        {
+            return premultiplied ? GetAlphaCompositingRow<mode, true>(global) : GetAlphaCompositingRow<mode, false>(global);
+        }
+
+        Base::AlphaCompositingRowPtr GetAlphaCompositingRow(SimdAlphaCompositingModeType mode, bool premultiplied, bool global)
+        {
+            switch (mode)
+            {
+            case SimdAlphaCompositingNormal: return GetAlphaCompositingRow<SimdAlphaCompositingNormal>(premultiplied, global);
+            case SimdAlphaCompositingAdd: return GetAlphaCompositingRow<SimdAlphaCompositingAdd>(premultiplied, global);
+            case SimdAlphaCompositingMultiply: return GetAlphaCompositingRow<SimdAlphaCompositingMultiply>(premultiplied, global);
+            case SimdAlphaCompositingScreen: return GetAlphaCompositingRow<SimdAlphaCompositingScreen>(premultiplied, global);
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        void AlphaCompositing(const SimdAlphaCompositingLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height)
+        {
+            Base::AlphaCompositing(layers, count, dst, dstStride, width, height, GetAlphaCompositingRow);
+        }
+    }
+#endif
+}
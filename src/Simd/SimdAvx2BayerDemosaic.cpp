@@ -0,0 +1,194 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBayerDemosaic.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K32_BAYER_EVEN = SIMD_MM256_SETR_EPI32(-1, 0, -1, 0, -1, 0, -1, 0);
+        const __m256i K32_BAYER_ODD = SIMD_MM256_SETR_EPI32(0, -1, 0, -1, 0, -1, 0, -1);
+        const __m256i K32_BAYER_ABS = SIMD_MM256_SET1_EPI32(0x7FFFFFFF);
+
+        SIMD_INLINE __m256 BayerColorMask(bool greenFirst)
+        {
+            return _mm256_castsi256_ps(greenFirst ? K32_BAYER_ODD : K32_BAYER_EVEN);
+        }
+
+        SIMD_INLINE __m256 BayerAbs(__m256 value)
+        {
+            return _mm256_and_ps(value, _mm256_castsi256_ps(K32_BAYER_ABS));
+        }
+
+        SIMD_INLINE void BayerShift(const float* const* src, size_t count, size_t x, const float** dst)
+        {
+            for (size_t i = 0; i < count; ++i)
+                dst[i] = src[i] + x;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void BayerNormalizeRow(const uint8_t* src, size_t width, size_t bitDepth, float black, const float* scale, float* dst)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            __m256 _black = _mm256_set1_ps(black), _scale = _mm256_setr_ps(scale[0], scale[1], scale[0], scale[1], scale[0], scale[1], scale[0], scale[1]);
+            if (bitDepth > 8)
+            {
+                const uint16_t* src16 = (const uint16_t*)src;
+                __m256i mask = _mm256_set1_epi32((1 << bitDepth) - 1);
+                for (; x < widthF; x += F)
+                {
+                    __m256i _src = _mm256_and_si256(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)(src16 + x))), mask);
+                    _mm256_storeu_ps(dst + x, _mm256_mul_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_cvtepi32_ps(_src), _black), _mm256_setzero_ps()), _scale));
+                }
+            }
+            else
+            {
+                for (; x < widthF; x += F)
+                {
+                    __m256i _src = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + x)));
+                    _mm256_storeu_ps(dst + x, _mm256_mul_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_cvtepi32_ps(_src), _black), _mm256_setzero_ps()), _scale));
+                }
+            }
+            if (x < width)
+                Sse41::BayerNormalizeRow(src + x * (bitDepth > 8 ? 2 : 1), width - x, bitDepth, black, scale, dst + x);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void BayerMalvarRow(const float* const* src, size_t width, bool greenFirst, float* c, float* g, float* o)
+        {
+            const float* s0 = src[0], * s1 = src[1], * s2 = src[2], * s3 = src[3], * s4 = src[4];
+            __m256 mask = BayerColorMask(greenFirst);
+            __m256 k0125 = _mm256_set1_ps(0.125f), k025 = _mm256_set1_ps(0.25f), k05 = _mm256_set1_ps(0.5f);
+            __m256 k00625 = _mm256_set1_ps(0.0625f), k01875 = _mm256_set1_ps(0.1875f), k0625 = _mm256_set1_ps(0.625f), k075 = _mm256_set1_ps(0.75f);
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+            {
+                __m256 _c = _mm256_loadu_ps(s2 + x);
+                __m256 h1 = _mm256_add_ps(_mm256_loadu_ps(s2 + x - 1), _mm256_loadu_ps(s2 + x + 1));
+                __m256 h2 = _mm256_add_ps(_mm256_loadu_ps(s2 + x - 2), _mm256_loadu_ps(s2 + x + 2));
+                __m256 v1 = _mm256_add_ps(_mm256_loadu_ps(s1 + x), _mm256_loadu_ps(s3 + x));
+                __m256 v2 = _mm256_add_ps(_mm256_loadu_ps(s0 + x), _mm256_loadu_ps(s4 + x));
+                __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_loadu_ps(s1 + x - 1), _mm256_loadu_ps(s1 + x + 1)),
+                    _mm256_add_ps(_mm256_loadu_ps(s3 + x - 1), _mm256_loadu_ps(s3 + x + 1)));
+                __m256 hv2 = _mm256_add_ps(h2, v2);
+                __m256 gAtC = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(_c, k05), _mm256_mul_ps(_mm256_add_ps(h1, v1), k025)), _mm256_mul_ps(hv2, k0125));
+                __m256 oAtC = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(_c, k075), _mm256_mul_ps(d, k025)), _mm256_mul_ps(hv2, k01875));
+                __m256 cAtG = _mm256_add_ps(_mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(_c, k0625), _mm256_mul_ps(h1, k05)),
+                    _mm256_mul_ps(_mm256_add_ps(h2, d), k0125)), _mm256_mul_ps(v2, k00625));
+                __m256 oAtG = _mm256_add_ps(_mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(_c, k0625), _mm256_mul_ps(v1, k05)),
+                    _mm256_mul_ps(_mm256_add_ps(v2, d), k0125)), _mm256_mul_ps(h2, k00625));
+                _mm256_storeu_ps(c + x, _mm256_blendv_ps(cAtG, _c, mask));
+                _mm256_storeu_ps(g + x, _mm256_blendv_ps(_c, gAtC, mask));
+                _mm256_storeu_ps(o + x, _mm256_blendv_ps(oAtG, oAtC, mask));
+            }
+            if (x < width)
+            {
+                const float* tail[5];
+                BayerShift(src, 5, x, tail);
+                Sse41::BayerMalvarRow(tail, width - x, greenFirst, c + x, g + x, o + x);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void BayerGreenRow(const float* const* src, size_t width, bool greenFirst, float* g)
+        {
+            const float* s0 = src[0], * s1 = src[1], * s2 = src[2], * s3 = src[3], * s4 = src[4];
+            __m256 mask = BayerColorMask(greenFirst);
+            __m256 k025 = _mm256_set1_ps(0.25f), k05 = _mm256_set1_ps(0.5f), k2 = _mm256_set1_ps(2.0f);
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+            {
+                __m256 _c = _mm256_loadu_ps(s2 + x), c2 = _mm256_mul_ps(_c, k2);
+                __m256 l = _mm256_loadu_ps(s2 + x - 1), r = _mm256_loadu_ps(s2 + x + 1);
+                __m256 t = _mm256_loadu_ps(s1 + x), b = _mm256_loadu_ps(s3 + x);
+                __m256 lh = _mm256_sub_ps(c2, _mm256_add_ps(_mm256_loadu_ps(s2 + x - 2), _mm256_loadu_ps(s2 + x + 2)));
+                __m256 lv = _mm256_sub_ps(c2, _mm256_add_ps(_mm256_loadu_ps(s0 + x), _mm256_loadu_ps(s4 + x)));
+                __m256 gh = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(l, r), k05), _mm256_mul_ps(lh, k025));
+                __m256 gv = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(t, b), k05), _mm256_mul_ps(lv, k025));
+                __m256 dh = _mm256_add_ps(BayerAbs(_mm256_sub_ps(l, r)), BayerAbs(lh));
+                __m256 dv = _mm256_add_ps(BayerAbs(_mm256_sub_ps(t, b)), BayerAbs(lv));
+                __m256 _g = _mm256_mul_ps(_mm256_add_ps(gh, gv), k05);
+                _g = _mm256_blendv_ps(_g, gv, _mm256_cmp_ps(dv, dh, _CMP_LT_OQ));
+                _g = _mm256_blendv_ps(_g, gh, _mm256_cmp_ps(dh, dv, _CMP_LT_OQ));
+                _mm256_storeu_ps(g + x, _mm256_blendv_ps(_c, _g, mask));
+            }
+            if (x < width)
+            {
+                const float* tail[5];
+                BayerShift(src, 5, x, tail);
+                Sse41::BayerGreenRow(tail, width - x, greenFirst, g + x);
+            }
+        }
+
+        void BayerChromaRow(const float* const* src, const float* const* green, size_t width, bool greenFirst, float* c, float* o)
+        {
+            const float* s0 = src[0], * s1 = src[1], * s2 = src[2];
+            const float* g0 = green[0], * g1 = green[1], * g2 = green[2];
+            __m256 mask = BayerColorMask(greenFirst);
+            __m256 k025 = _mm256_set1_ps(0.25f), k05 = _mm256_set1_ps(0.5f);
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+            {
+                __m256 _g = _mm256_loadu_ps(g1 + x);
+                __m256 d0l = _mm256_sub_ps(_mm256_loadu_ps(s0 + x - 1), _mm256_loadu_ps(g0 + x - 1));
+                __m256 d0r = _mm256_sub_ps(_mm256_loadu_ps(s0 + x + 1), _mm256_loadu_ps(g0 + x + 1));
+                __m256 d2l = _mm256_sub_ps(_mm256_loadu_ps(s2 + x - 1), _mm256_loadu_ps(g2 + x - 1));
+                __m256 d2r = _mm256_sub_ps(_mm256_loadu_ps(s2 + x + 1), _mm256_loadu_ps(g2 + x + 1));
+                __m256 d1l = _mm256_sub_ps(_mm256_loadu_ps(s1 + x - 1), _mm256_loadu_ps(g1 + x - 1));
+                __m256 d1r = _mm256_sub_ps(_mm256_loadu_ps(s1 + x + 1), _mm256_loadu_ps(g1 + x + 1));
+                __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(s0 + x), _mm256_loadu_ps(g0 + x));
+                __m256 d2 = _mm256_sub_ps(_mm256_loadu_ps(s2 + x), _mm256_loadu_ps(g2 + x));
+                __m256 oAtC = _mm256_add_ps(_g, _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(d0l, d0r), _mm256_add_ps(d2l, d2r)), k025));
+                __m256 cAtG = _mm256_add_ps(_g, _mm256_mul_ps(_mm256_add_ps(d1l, d1r), k05));
+                __m256 oAtG = _mm256_add_ps(_g, _mm256_mul_ps(_mm256_add_ps(d0, d2), k05));
+                _mm256_storeu_ps(c + x, _mm256_blendv_ps(cAtG, _mm256_loadu_ps(s1 + x), mask));
+                _mm256_storeu_ps(o + x, _mm256_blendv_ps(oAtG, oAtC, mask));
+            }
+            if (x < width)
+            {
+                const float* tail[3], * tailGreen[3];
+                BayerShift(src, 3, x, tail);
+                BayerShift(green, 3, x, tailGreen);
+                Sse41::BayerChromaRow(tail, tailGreen, width - x, greenFirst, c + x, o + x);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void BayerDemosaic(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height, SimdPixelFormatType bayerFormat, size_t bitDepth,
+            size_t blackLevel, const float* gains, SimdBayerDemosaicType method, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat)
+        {
+            Base::BayerDemosaicApply(bayer, bayerStride, width, height, bayerFormat, bitDepth, blackLevel, gains, method, dst, dstStride, dstFormat,
+                BayerNormalizeRow, BayerMalvarRow, BayerGreenRow, BayerChromaRow, FloatToUint8Row);
+        }
+    }
+#endif
+}
@@ -0,0 +1,150 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBe16u.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdAvx2.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE  
+    namespace Avx2
+    {
+        struct Repack16u
+        {
+            Repack16u(size_t srcC, size_t dstC, const int* map, bool swap)
+                : _srcC(srcC)
+                , _dstC(dstC)
+                , _map(map)
+                , _swap(swap)
+            {
+                SIMD_ALIGNED(16) uint8_t mask[Sse41::A], fill[Sse41::A];
+                _block = Base::Repack16uMask(srcC, dstC, map, swap, mask, fill);
+                _mask = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i*)mask));
+                _fill = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i*)fill));
+            }
+
+            SIMD_INLINE void Run(const uint8_t* src, size_t width, uint8_t* dst) const
+            {
+                size_t srcStep = _block * _srcC * 2, dstStep = _block * _dstC * 2;
+                size_t srcSize = width * _srcC * 2, dstSize = width * _dstC * 2, col = 0, s = 0, d = 0;
+                if (srcStep == Sse41::A && dstStep == Sse41::A)
+                {
+                    for (; s + A <= srcSize; s += A, d += A, col += 2 * _block)
+                        _mm256_storeu_si256((__m256i*)(dst + d), _mm256_or_si256(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)(src + s)), _mask), _fill));
+                }
+                else
+                {
+                    for (; s + srcStep + Sse41::A <= srcSize && d + dstStep + Sse41::A <= dstSize; s += 2 * srcStep, d += 2 * dstStep, col += 2 * _block)
+                    {
+                        __m256i _src = Load<false>((__m128i*)(src + s), (__m128i*)(src + s + srcStep));
+                        __m256i _dst = _mm256_or_si256(_mm256_shuffle_epi8(_src, _mask), _fill);
+                        _mm_storeu_si128((__m128i*)(dst + d), _mm256_castsi256_si128(_dst));
+                        _mm_storeu_si128((__m128i*)(dst + d + dstStep), _mm256_extracti128_si256(_dst, 1));
+                    }
+                }
+                Base::Repack16u(src + col * _srcC * 2, _srcC, width - col, _dstC, _map, _swap, dst + col * _dstC * 2);
+            }
+
+        private:
+            size_t _srcC, _dstC, _block;
+            const int* _map;
+            bool _swap;
+            __m256i _mask, _fill;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Be16uToAny(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t srcChannels, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat)
+        {
+            size_t dstChannels = Base::Channels16u(dstFormat);
+            assert(srcChannels >= 1 && srcChannels <= 4 && dstChannels);
+            if (dstChannels == 1 && srcChannels >= 3)
+            {
+                if (width < HA)
+                {
+                    Base::Be16uToAny(src, srcStride, width, height, srcChannels, dst, dstStride, dstFormat);
+                    return;
+                }
+                int map[4];
+                Base::Repack16uMap(srcChannels, srcChannels, true, map);
+                Repack16u toBgr(srcChannels, srcChannels, map, true);
+                Array16u bgr(width * srcChannels);
+                for (size_t row = 0; row < height; ++row)
+                {
+                    toBgr.Run(src + row * srcStride, width, (uint8_t*)bgr.data);
+                    BgrToGray16u((uint8_t*)bgr.data, 0, width, 1, srcChannels, dst + row * dstStride, 0);
+                }
+            }
+            else
+            {
+                int map[4];
+                Base::Repack16uMap(srcChannels, dstChannels, Base::IsBgr16u(dstFormat), map);
+                Repack16u repack(srcChannels, dstChannels, map, true);
+                for (size_t row = 0; row < height; ++row)
+                    repack.Run(src + row * srcStride, width, dst + row * dstStride);
+            }
+        }
+
+        void AnyToBe16u(const uint8_t* src, size_t srcStride, size_t width, size_t height, SimdPixelFormatType srcFormat, uint8_t* dst, size_t dstStride, size_t dstChannels)
+        {
+            size_t srcChannels = Base::Channels16u(srcFormat);
+            assert(srcChannels && (dstChannels == 1 || dstChannels == 3 || dstChannels == 4));
+            if (dstChannels == 1 && srcChannels >= 3)
+            {
+                if (width < HA)
+                {
+                    Base::AnyToBe16u(src, srcStride, width, height, srcFormat, dst, dstStride, dstChannels);
+                    return;
+                }
+                int toBgrMap[4], swapMap[1] = { 0 };
+                Base::Repack16uMap(srcChannels, srcChannels, true, toBgrMap);
+                Repack16u toBgr(srcChannels, srcChannels, toBgrMap, false), swap(1, 1, swapMap, true);
+                Array16u bgr(Base::IsBgr16u(srcFormat) ? 0 : width * srcChannels);
+                for (size_t row = 0; row < height; ++row)
+                {
+                    const uint8_t* s = src + row * srcStride;
+                    uint8_t* d = dst + row * dstStride;
+                    if (bgr.size)
+                    {
+                        toBgr.Run(s, width, (uint8_t*)bgr.data);
+                        s = (uint8_t*)bgr.data;
+                    }
+                    BgrToGray16u(s, 0, width, 1, srcChannels, d, 0);
+                    swap.Run(d, width, d);
+                }
+            }
+            else
+            {
+                int map[4];
+                Base::Repack16uMap(srcChannels, dstChannels, Base::IsBgr16u(srcFormat), map);
+                Repack16u repack(srcChannels, dstChannels, map, true);
+                for (size_t row = 0; row < height; ++row)
+                    repack.Run(src + row * srcStride, width, dst + row * dstStride);
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,190 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdColorPipeline.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K32_PERMUTE_CP_BGR_TO_BGRA = SIMD_MM256_SETR_EPI32(0, 1, 2, -1, 3, 4, 5, -1);
+        const __m256i K8_SHUFFLE_CP_BGR_TO_BGRA = SIMD_MM256_SETR_EPI8(
+            0x0, 0x1, 0x2, -1, 0x3, 0x4, 0x5, -1, 0x6, 0x7, 0x8, -1, 0x9, 0xA, 0xB, -1,
+            0x0, 0x1, 0x2, -1, 0x3, 0x4, 0x5, -1, 0x6, 0x7, 0x8, -1, 0x9, 0xA, 0xB, -1);
+        const __m256i K8_SHUFFLE_CP_BGRA_TO_BGR = SIMD_MM256_SETR_EPI8(
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+        const __m256i K32_PERMUTE_CP_BGRA_TO_BGR = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 3, 7);
+
+        SIMD_INLINE __m256 Gather(const float* tab, __m256i idx)
+        {
+            return _mm256_i32gather_ps(tab, idx, 4);
+        }
+
+        SIMD_INLINE __m256i Gather(const int32_t* tab, __m256i idx)
+        {
+            return _mm256_i32gather_epi32(tab, idx, 4);
+        }
+
+        SIMD_INLINE __m256 Clamp(__m256 value)
+        {
+            return _mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+        }
+
+        SIMD_INLINE __m256 Curve(const float* curve, __m256 scale, __m256i last, __m256 value)
+        {
+            __m256 s = _mm256_mul_ps(Clamp(value), scale);
+            __m256i i = _mm256_min_epi32(_mm256_cvttps_epi32(s), last);
+            __m256 f = _mm256_sub_ps(s, _mm256_cvtepi32_ps(i));
+            __m256 c0 = Gather(curve, i), c1 = Gather(curve + 1, i);
+            return _mm256_add_ps(c0, _mm256_mul_ps(_mm256_sub_ps(c1, c0), f));
+        }
+
+        SIMD_INLINE __m256 Interpolate(__m256 v0, __m256 v1, __m256 v2, __m256 v3, __m256 w0, __m256 w1, __m256 w2, __m256 w3)
+        {
+            return _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(v0, w0), _mm256_mul_ps(v1, w1)), _mm256_mul_ps(v2, w2)), _mm256_mul_ps(v3, w3));
+        }
+
+        template<bool lut16u> SIMD_INLINE void Lut(const ColorPipelineParam& p, const ColorPipelineTables& t, __m256 v[3])
+        {
+            __m256 k = _mm256_set1_ps(float(p.lutSize - 1));
+            __m256i last = _mm256_set1_epi32(int(p.lutSize) - 2);
+            __m256i o0 = _mm256_set1_epi32(t.offset[0]), o1 = _mm256_set1_epi32(t.offset[1]), o2 = _mm256_set1_epi32(t.offset[2]);
+            __m256 s0 = _mm256_mul_ps(Clamp(v[0]), k), s1 = _mm256_mul_ps(Clamp(v[1]), k), s2 = _mm256_mul_ps(Clamp(v[2]), k);
+            __m256i i0 = _mm256_min_epi32(_mm256_cvttps_epi32(s0), last);
+            __m256i i1 = _mm256_min_epi32(_mm256_cvttps_epi32(s1), last);
+            __m256i i2 = _mm256_min_epi32(_mm256_cvttps_epi32(s2), last);
+            __m256 f0 = _mm256_sub_ps(s0, _mm256_cvtepi32_ps(i0)), f1 = _mm256_sub_ps(s1, _mm256_cvtepi32_ps(i1)), f2 = _mm256_sub_ps(s2, _mm256_cvtepi32_ps(i2));
+            __m256i base = _mm256_add_epi32(_mm256_add_epi32(_mm256_mullo_epi32(i0, o0), _mm256_mullo_epi32(i1, o1)), _mm256_mullo_epi32(i2, o2));
+            __m256 maxIs0 = _mm256_and_ps(_mm256_cmp_ps(f0, f1, _CMP_GE_OQ), _mm256_cmp_ps(f0, f2, _CMP_GE_OQ)), maxIs1 = _mm256_cmp_ps(f1, f2, _CMP_GE_OQ);
+            __m256 minIs2 = _mm256_and_ps(_mm256_cmp_ps(f2, f0, _CMP_LE_OQ), _mm256_cmp_ps(f2, f1, _CMP_LE_OQ)), minIs1 = _mm256_cmp_ps(f1, f0, _CMP_LE_OQ);
+            __m256i oMax = _mm256_blendv_epi8(_mm256_blendv_epi8(o2, o1, _mm256_castps_si256(maxIs1)), o0, _mm256_castps_si256(maxIs0));
+            __m256i oMin = _mm256_blendv_epi8(_mm256_blendv_epi8(o0, o1, _mm256_castps_si256(minIs1)), o2, _mm256_castps_si256(minIs2));
+            __m256i oAll = _mm256_add_epi32(_mm256_add_epi32(o0, o1), o2);
+            __m256 fMax = _mm256_max_ps(f0, _mm256_max_ps(f1, f2));
+            __m256 fMin = _mm256_min_ps(f0, _mm256_min_ps(f1, f2));
+            __m256 fMid = _mm256_max_ps(_mm256_min_ps(f0, f1), _mm256_min_ps(_mm256_max_ps(f0, f1), f2));
+            __m256 w0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), fMax), w1 = _mm256_sub_ps(fMax, fMid), w2 = _mm256_sub_ps(fMid, fMin), w3 = fMin;
+            __m256i n0 = base, n1 = _mm256_add_epi32(base, oMax), n3 = _mm256_add_epi32(base, oAll), n2 = _mm256_sub_epi32(n3, oMin);
+            if (lut16u)
+            {
+                const int32_t* lut = (const int32_t*)t.lut16u.data;
+                n0 = _mm256_slli_epi32(n0, 1), n1 = _mm256_slli_epi32(n1, 1), n2 = _mm256_slli_epi32(n2, 1), n3 = _mm256_slli_epi32(n3, 1);
+                __m256i a0 = Gather(lut, n0), a1 = Gather(lut, n1), a2 = Gather(lut, n2), a3 = Gather(lut, n3);
+                __m256i b0 = Gather(lut + 1, n0), b1 = Gather(lut + 1, n1), b2 = Gather(lut + 1, n2), b3 = Gather(lut + 1, n3);
+                __m256i lo = _mm256_set1_epi32(0xFFFF);
+                __m256 scale = _mm256_set1_ps(1.0f / 65535.0f);
+                v[0] = _mm256_mul_ps(Interpolate(_mm256_cvtepi32_ps(_mm256_and_si256(a0, lo)), _mm256_cvtepi32_ps(_mm256_and_si256(a1, lo)),
+                    _mm256_cvtepi32_ps(_mm256_and_si256(a2, lo)), _mm256_cvtepi32_ps(_mm256_and_si256(a3, lo)), w0, w1, w2, w3), scale);
+                v[1] = _mm256_mul_ps(Interpolate(_mm256_cvtepi32_ps(_mm256_srli_epi32(a0, 16)), _mm256_cvtepi32_ps(_mm256_srli_epi32(a1, 16)),
+                    _mm256_cvtepi32_ps(_mm256_srli_epi32(a2, 16)), _mm256_cvtepi32_ps(_mm256_srli_epi32(a3, 16)), w0, w1, w2, w3), scale);
+                v[2] = _mm256_mul_ps(Interpolate(_mm256_cvtepi32_ps(_mm256_and_si256(b0, lo)), _mm256_cvtepi32_ps(_mm256_and_si256(b1, lo)),
+                    _mm256_cvtepi32_ps(_mm256_and_si256(b2, lo)), _mm256_cvtepi32_ps(_mm256_and_si256(b3, lo)), w0, w1, w2, w3), scale);
+            }
+            else
+            {
+                const float* lut = t.lut32f.data;
+                n0 = _mm256_slli_epi32(n0, 2), n1 = _mm256_slli_epi32(n1, 2), n2 = _mm256_slli_epi32(n2, 2), n3 = _mm256_slli_epi32(n3, 2);
+                for (size_t c = 0; c < 3; ++c)
+                    v[c] = Interpolate(Gather(lut + c, n0), Gather(lut + c, n1), Gather(lut + c, n2), Gather(lut + c, n3), w0, w1, w2, w3);
+            }
+        }
+
+        template<size_t N, bool lut16u> void ColorPipelineRow(const ColorPipelineParam& p, const ColorPipelineTables& t, const uint8_t* src, size_t width, uint8_t* dst)
+        {
+            const float* in0 = t.input.data, * in1 = in0 + 256, * in2 = in1 + 256, * m = t.matrix;
+            size_t widthF = N == 4 ? AlignLo(width, F) : AlignLo(width > 3 ? width - 3 : 0, F), x = 0;
+            __m256i byte = _mm256_set1_epi32(0xFF), alpha = _mm256_set1_epi32(0xFF000000);
+            __m256 k255 = _mm256_set1_ps(255.0f), curveScale = _mm256_set1_ps(float(p.curveSize - 1));
+            __m256i curveLast = _mm256_set1_epi32(int(p.curveSize) - 2);
+            for (; x < widthF; x += F)
+            {
+                __m256i px = _mm256_loadu_si256((__m256i*)(src + x * N));
+                if (N == 3)
+                    px = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(px, K32_PERMUTE_CP_BGR_TO_BGRA), K8_SHUFFLE_CP_BGR_TO_BGRA);
+                __m256 v[3];
+                v[0] = Gather(in0, _mm256_and_si256(px, byte));
+                v[1] = Gather(in1, _mm256_and_si256(_mm256_srli_epi32(px, 8), byte));
+                v[2] = Gather(in2, _mm256_and_si256(_mm256_srli_epi32(px, 16), byte));
+                if (p.matrix)
+                {
+                    __m256 v0 = Clamp(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(m[0]), v[0]), _mm256_mul_ps(_mm256_set1_ps(m[1]), v[1])), _mm256_mul_ps(_mm256_set1_ps(m[2]), v[2])));
+                    __m256 v1 = Clamp(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(m[3]), v[0]), _mm256_mul_ps(_mm256_set1_ps(m[4]), v[1])), _mm256_mul_ps(_mm256_set1_ps(m[5]), v[2])));
+                    __m256 v2 = Clamp(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(m[6]), v[0]), _mm256_mul_ps(_mm256_set1_ps(m[7]), v[1])), _mm256_mul_ps(_mm256_set1_ps(m[8]), v[2])));
+                    v[0] = v0, v[1] = v1, v[2] = v2;
+                }
+                if (p.CurvesAfterMatrix())
+                {
+                    for (size_t c = 0; c < 3; ++c)
+                        v[c] = Curve(t.curves.data + c * p.curveSize, curveScale, curveLast, v[c]);
+                }
+                if (p.lut)
+                    Lut<lut16u>(p, t, v);
+                __m256i d0 = _mm256_cvtps_epi32(_mm256_mul_ps(Clamp(v[0]), k255));
+                __m256i d1 = _mm256_cvtps_epi32(_mm256_mul_ps(Clamp(v[1]), k255));
+                __m256i d2 = _mm256_cvtps_epi32(_mm256_mul_ps(Clamp(v[2]), k255));
+                __m256i out = _mm256_or_si256(_mm256_or_si256(d0, _mm256_slli_epi32(d1, 8)), _mm256_slli_epi32(d2, 16));
+                if (N == 4)
+                    _mm256_storeu_si256((__m256i*)(dst + x * N), _mm256_or_si256(out, _mm256_and_si256(px, alpha)));
+                else
+                {
+                    out = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(out, K8_SHUFFLE_CP_BGRA_TO_BGR), K32_PERMUTE_CP_BGRA_TO_BGR);
+                    _mm_storeu_si128((__m128i*)(dst + x * N), _mm256_castsi256_si128(out));
+                    _mm_storel_epi64((__m128i*)(dst + x * N + 16), _mm256_extracti128_si256(out, 1));
+                }
+            }
+            if (x < width)
+                Sse41::ColorPipelineRow(p, t, src + x * N, width - x, dst + x * N);
+        }
+
+        void ColorPipelineRow(const ColorPipelineParam& p, const ColorPipelineTables& t, const uint8_t* src, size_t width, uint8_t* dst)
+        {
+            if (p.channels == 4)
+                p.Lut16u() ? ColorPipelineRow<4, true>(p, t, src, width, dst) : ColorPipelineRow<4, false>(p, t, src, width, dst);
+            else
+                p.Lut16u() ? ColorPipelineRow<3, true>(p, t, src, width, dst) : ColorPipelineRow<3, false>(p, t, src, width, dst);
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        ColorPipeline::ColorPipeline(const ColorPipelineParam& param, const float* matrix, const float* curves, const float* lut)
+            : Sse41::ColorPipeline(param, matrix, curves, lut)
+        {
+            _row = ColorPipelineRow;
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        void* ColorPipelineInit(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags)
+        {
+            ColorPipelineParam param(format, matrix, curves, curveSize, lut, lutSize, flags);
+            if (!param.Valid())
+                return NULL;
+            return new ColorPipeline(param, matrix, curves, lut);
+        }
+    }
+#endif
+}
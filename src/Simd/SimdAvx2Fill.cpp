@@ -163,10 +163,48 @@ namespace Simd
             }
         }
 
+        template <bool align> void FillPixel(uint8_t* dst, size_t stride, size_t width, size_t height, const __m256i pixel[3])
+        {
+            assert(width >= 3 * A);
+            if (align)
+                assert(Aligned(dst) && Aligned(stride));
+
+            size_t step = 3 * A;
+            size_t alignedWidth = width / step * step;
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += step)
+                {
+                    Store<align>((__m256i*)(dst + col) + 0, pixel[0]);
+                    Store<align>((__m256i*)(dst + col) + 1, pixel[1]);
+                    Store<align>((__m256i*)(dst + col) + 2, pixel[2]);
+                }
+                if (col < width)
+                {
+                    col = width - step;
+                    Store<false>((__m256i*)(dst + col) + 0, pixel[0]);
+                    Store<false>((__m256i*)(dst + col) + 1, pixel[1]);
+                    Store<false>((__m256i*)(dst + col) + 2, pixel[2]);
+                }
+                dst += stride;
+            }
+        }
+
         template <bool align> void FillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize)
         {
             if (pixelSize == 3)
                 FillBgr<align>(dst, stride, width, height, pixel[0], pixel[1], pixel[2]);
+            else if (pixelSize == 6 || pixelSize == 12)
+            {
+                uint8_t buffer[3 * A];
+                for (size_t i = 0; i < 3 * A; ++i)
+                    buffer[i] = pixel[i % pixelSize];
+                __m256i _pixel[3];
+                for (size_t i = 0; i < 3; ++i)
+                    _pixel[i] = _mm256_loadu_si256((__m256i*)buffer + i);
+                FillPixel<align>(dst, stride, width * pixelSize, height, _pixel);
+            }
             else
             {
                 __m256i _pixel;
@@ -181,6 +219,12 @@ namespace Simd
                 case 4:
                     _pixel = _mm256_set1_epi32(*(uint32_t*)pixel);
                     break;
+                case 8:
+                    _pixel = _mm256_set1_epi64x(*(int64_t*)pixel);
+                    break;
+                case 16:
+                    _pixel = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i*)pixel));
+                    break;
                 default:
                     assert(0);
                 }
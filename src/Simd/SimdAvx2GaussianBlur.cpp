@@ -25,6 +25,7 @@
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdTranspose.h"
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdUnpack.h"
 
@@ -337,11 +338,187 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
+        SIMD_INLINE __m256 BlurRecursive(const __m256& x, const __m256& p1, const __m256& p2, const __m256& p3, const __m256* k)
         {
-            BlurParam param(width, height, channels, sigma, epsilon, A);
+            __m256 w = _mm256_add_ps(p1, _mm256_mul_ps(k[0], _mm256_sub_ps(x, p1)));
+            w = _mm256_add_ps(w, _mm256_mul_ps(k[1], _mm256_sub_ps(p2, p1)));
+            return _mm256_add_ps(w, _mm256_mul_ps(k[2], _mm256_sub_ps(p3, p1)));
+        }
+
+        SIMD_INLINE __m256 BlurRecursiveTail(const __m256& u, const __m256& d1, const __m256& d2, const __m256& d3, const __m256* m)
+        {
+            return _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(u, _mm256_mul_ps(m[0], d1)), _mm256_mul_ps(m[1], d2)), _mm256_mul_ps(m[2], d3));
+        }
+
+        template<bool is32f> void BlurRecursiveCols(const BlurParam& p, const Base::AlgRecursive& a, float* buf, size_t colBeg, size_t colEnd, uint8_t* dst, size_t dstStride)
+        {
+            size_t colEndF = colBeg + AlignLo(colEnd - colBeg, F);
+            if (colEndF < colEnd)
+                Base::BlurRecursiveCols(p, a, buf, colEndF, colEnd, dst, dstStride);
+            if (colBeg == colEndF)
+                return;
+            const size_t height = p.height, stride = a.stride;
+            __m256 k[3], m[9];
+            k[0] = _mm256_set1_ps(a.b);
+            k[1] = _mm256_set1_ps(a.a[1]);
+            k[2] = _mm256_set1_ps(a.a[2]);
+            for (size_t i = 0; i < 9; ++i)
+                m[i] = _mm256_set1_ps(a.m[i]);
+            float* last = buf + (height + 3) * stride;
+            for (size_t i = colBeg; i < colEndF; i += F)
+                _mm256_storeu_ps(last + i, _mm256_loadu_ps(buf + (height - 1) * stride + i));
+            for (size_t row = 1; row < height; ++row)
+            {
+                float* pw = buf + row * stride;
+                const float* p1 = buf + (row - 1) * stride;
+                const float* p2 = buf + (row > 1 ? row - 2 : 0) * stride;
+                const float* p3 = buf + (row > 2 ? row - 3 : 0) * stride;
+                for (size_t i = colBeg; i < colEndF; i += F)
+                    _mm256_storeu_ps(pw + i, BlurRecursive(_mm256_loadu_ps(pw + i), _mm256_loadu_ps(p1 + i), _mm256_loadu_ps(p2 + i), _mm256_loadu_ps(p3 + i), k));
+            }
+            {
+                const float* p1 = buf + (height - 1) * stride;
+                const float* p2 = buf + (height > 1 ? height - 2 : 0) * stride;
+                const float* p3 = buf + (height > 2 ? height - 3 : 0) * stride;
+                float* t = buf + height * stride;
+                for (size_t i = colBeg; i < colEndF; i += F)
+                {
+                    __m256 u = _mm256_loadu_ps(last + i);
+                    __m256 w1 = _mm256_loadu_ps(p1 + i);
+                    __m256 d1 = _mm256_sub_ps(w1, u);
+                    __m256 d2 = _mm256_sub_ps(_mm256_loadu_ps(p2 + i), w1);
+                    __m256 d3 = _mm256_sub_ps(_mm256_loadu_ps(p3 + i), w1);
+                    _mm256_storeu_ps(t + 0 * stride + i, BlurRecursiveTail(u, d1, d2, d3, m + 0));
+                    _mm256_storeu_ps(t + 1 * stride + i, BlurRecursiveTail(u, d1, d2, d3, m + 3));
+                    _mm256_storeu_ps(t + 2 * stride + i, BlurRecursiveTail(u, d1, d2, d3, m + 6));
+                }
+            }
+            for (size_t row = height - 1; row < height; --row)
+            {
+                float* py = buf + row * stride;
+                const float* p1 = py + 1 * stride;
+                const float* p2 = py + 2 * stride;
+                const float* p3 = py + 3 * stride;
+                uint8_t* pd = dst + row * dstStride;
+                for (size_t i = colBeg; i < colEndF; i += F)
+                {
+                    __m256 y = BlurRecursive(_mm256_loadu_ps(py + i), _mm256_loadu_ps(p1 + i), _mm256_loadu_ps(p2 + i), _mm256_loadu_ps(p3 + i), k);
+                    _mm256_storeu_ps(py + i, y);
+                    if (is32f)
+                        _mm256_storeu_ps((float*)pd + i, y);
+                    else
+                        StoreAs8u(pd + i, y);
+                }
+            }
+        }
+
+        SIMD_INLINE __m256 BlurRecursiveGather(const float* src, size_t stride)
+        {
+            return _mm256_setr_ps(src[0 * stride], src[1 * stride], src[2 * stride], src[3 * stride],
+                src[4 * stride], src[5 * stride], src[6 * stride], src[7 * stride]);
+        }
+
+        SIMD_INLINE void BlurRecursiveLoad(const BlurParam& p, const uint8_t* src, size_t size, float* dst)
+        {
+            if (p.Is32f())
+                memcpy(dst, src, size * sizeof(float));
+            else
+            {
+                size_t sizeF = AlignLo(size, F), i = 0;
+                for (; i < sizeF; i += F)
+                    _mm256_storeu_ps(dst + i, LoadAs32f(src + i));
+                for (; i < size; ++i)
+                    dst[i] = float(src[i]);
+            }
+        }
+
+        template<int channels> void BlurRecursiveRows(const BlurParam& p, const Base::AlgRecursive& a, const uint8_t* src, size_t srcStride, size_t rowBeg, size_t rowEnd, float* buf)
+        {
+            size_t rowEndF = rowBeg + AlignLo(rowEnd - rowBeg, F);
+            if (rowEndF < rowEnd)
+                Base::BlurRecursiveRows(p, a, src, srcStride, rowEndF, rowEnd, buf);
+            const size_t size = a.size, stride = a.stride, last = size - channels;
+            __m256 k[3], m[9], s1[channels], s2[channels], s3[channels], u[channels];
+            k[0] = _mm256_set1_ps(a.b);
+            k[1] = _mm256_set1_ps(a.a[1]);
+            k[2] = _mm256_set1_ps(a.a[2]);
+            for (size_t i = 0; i < 9; ++i)
+                m[i] = _mm256_set1_ps(a.m[i]);
+            float tmp[F * F];
+            for (size_t row = rowBeg; row < rowEndF; row += F)
+            {
+                float* pb = buf + row * stride;
+                for (size_t j = 0; j < F; ++j)
+                    BlurRecursiveLoad(p, src + (row + j) * srcStride, size, pb + j * stride);
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    s1[c] = BlurRecursiveGather(pb + c, stride);
+                    s2[c] = s1[c], s3[c] = s1[c];
+                    u[c] = BlurRecursiveGather(pb + last + c, stride);
+                }
+                for (size_t i = 0, c = 0; i < size; i += F)
+                {
+                    Transpose8x8<false>(pb + i, stride, tmp, F);
+                    for (size_t j = 0, n = Min(F, size - i); j < n; ++j)
+                    {
+                        if (i + j >= channels)
+                        {
+                            __m256 w = BlurRecursive(_mm256_loadu_ps(tmp + j * F), s1[c], s2[c], s3[c], k);
+                            s3[c] = s2[c], s2[c] = s1[c], s1[c] = w;
+                            _mm256_storeu_ps(tmp + j * F, w);
+                        }
+                        if (++c == channels)
+                            c = 0;
+                    }
+                    Transpose8x8<false>(tmp, F, pb + i, stride);
+                }
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m256 d1 = _mm256_sub_ps(s1[c], u[c]);
+                    __m256 d2 = _mm256_sub_ps(s2[c], s1[c]);
+                    __m256 d3 = _mm256_sub_ps(s3[c], s1[c]);
+                    s1[c] = BlurRecursiveTail(u[c], d1, d2, d3, m + 0);
+                    s2[c] = BlurRecursiveTail(u[c], d1, d2, d3, m + 3);
+                    s3[c] = BlurRecursiveTail(u[c], d1, d2, d3, m + 6);
+                }
+                for (size_t i = AlignLo(size - 1, F) + F, c = channels - 1; i > 0;)
+                {
+                    i -= F;
+                    Transpose8x8<false>(pb + i, stride, tmp, F);
+                    for (size_t j = Min(F, size - i) - 1; j < F; --j)
+                    {
+                        __m256 y = BlurRecursive(_mm256_loadu_ps(tmp + j * F), s1[c], s2[c], s3[c], k);
+                        s3[c] = s2[c], s2[c] = s1[c], s1[c] = y;
+                        _mm256_storeu_ps(tmp + j * F, y);
+                        c = c ? c - 1 : channels - 1;
+                    }
+                    Transpose8x8<false>(tmp, F, pb + i, stride);
+                }
+            }
+        }
+
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Sse41::GaussianBlurRecursive(param)
+        {
+            switch (_param.channels)
+            {
+            case 1: _rows = BlurRecursiveRows<1>; break;
+            case 2: _rows = BlurRecursiveRows<2>; break;
+            case 3: _rows = BlurRecursiveRows<3>; break;
+            case 4: _rows = BlurRecursiveRows<4>; break;
+            }
+            _cols = _param.Is32f() ? BlurRecursiveCols<true> : BlurRecursiveCols<false>;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags)
+        {
+            BlurParam param(width, height, channels, sigma, epsilon, flags, A);
             if (!param.Valid())
                 return NULL;
+            if (param.IsRecursive())
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
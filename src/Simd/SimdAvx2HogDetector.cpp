@@ -0,0 +1,96 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdHogDetector.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void HogDetectorScore(const float* features, size_t stride, size_t width, const float* weights, size_t size, size_t rows, float bias, float* dst)
+        {
+            assert(size % F == 0);
+            size_t width4 = AlignLo(width, 4), x = 0;
+            __m128 _bias = _mm_set1_ps(bias);
+            for (; x < width4; x += 4, features += 4 * HOG_FEATURES)
+            {
+                __m256 sums[4] = { _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps() };
+                for (size_t y = 0; y < rows; ++y)
+                {
+                    const float* f0 = features + y * stride;
+                    const float* f1 = f0 + 1 * HOG_FEATURES;
+                    const float* f2 = f0 + 2 * HOG_FEATURES;
+                    const float* f3 = f0 + 3 * HOG_FEATURES;
+                    const float* w = weights + y * size;
+                    for (size_t i = 0; i < size; i += F)
+                    {
+                        __m256 _w = _mm256_loadu_ps(w + i);
+                        sums[0] = _mm256_fmadd_ps(_mm256_loadu_ps(f0 + i), _w, sums[0]);
+                        sums[1] = _mm256_fmadd_ps(_mm256_loadu_ps(f1 + i), _w, sums[1]);
+                        sums[2] = _mm256_fmadd_ps(_mm256_loadu_ps(f2 + i), _w, sums[2]);
+                        sums[3] = _mm256_fmadd_ps(_mm256_loadu_ps(f3 + i), _w, sums[3]);
+                    }
+                }
+                _mm_storeu_ps(dst + x, _mm_add_ps(_bias, Extract4Sums(sums)));
+            }
+            for (; x < width; x += 1, features += HOG_FEATURES)
+            {
+                __m256 sum = _mm256_setzero_ps();
+                for (size_t y = 0; y < rows; ++y)
+                {
+                    const float* f = features + y * stride;
+                    const float* w = weights + y * size;
+                    for (size_t i = 0; i < size; i += F)
+                        sum = _mm256_fmadd_ps(_mm256_loadu_ps(f + i), _mm256_loadu_ps(w + i), sum);
+                }
+                dst[x] = bias + ExtractSum(sum);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        HogDetector::HogDetector(const HogDetectorParam& param, const float* weights)
+            : Sse41::HogDetector(param, weights)
+        {
+            _extract = Avx2::HogExtractFeatures;
+            _score = Avx2::HogDetectorScore;
+            _resizerInit = Avx2::ResizerInit;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* HogDetectorInit(size_t width, size_t height, const float* weights, size_t windowX, size_t windowY, float bias, float scaleFactor, size_t levelsMax)
+        {
+            HogDetectorParam param(width, height, windowX, windowY, bias, scaleFactor, levelsMax, F);
+            if (!param.Valid())
+                return NULL;
+            return new HogDetector(param, weights);
+        }
+    }
+#endif
+}
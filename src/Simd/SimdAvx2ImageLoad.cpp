@@ -58,6 +58,7 @@ namespace Simd
         ImagePgmBinLoader::ImagePgmBinLoader(const ImageLoaderParam& param)
             : Sse41::ImagePgmBinLoader(param)
         {
+            _be16uToAny = Avx2::Be16uToAny;
         }
 
         void ImagePgmBinLoader::SetConverters()
@@ -104,6 +105,7 @@ namespace Simd
         ImagePpmBinLoader::ImagePpmBinLoader(const ImageLoaderParam& param)
             : Sse41::ImagePpmBinLoader(param)
         {
+            _be16uToAny = Avx2::Be16uToAny;
         }
 
         void ImagePpmBinLoader::SetConverters()
@@ -149,6 +151,37 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        ImagePngLoader::ImagePngLoader(const ImageLoaderParam& param)
+            : Sse41::ImagePngLoader(param)
+        {
+            _be16uToAny = Avx2::Be16uToAny;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : Sse41::ImageQoiLoader(param)
+        {
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            Sse41::ImageQoiLoader::SetConverters();
+            if (_image.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toAny = Avx2::RgbaToGray; break;
+                case SimdPixelFormatBgr24: _toAny = Avx2::BgraToRgb; break;
+                case SimdPixelFormatBgra32: _toAny = Avx2::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toAny = Avx2::BgraToBgr; break;
+                default: break;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         ImageLoader* CreateImageLoader(const ImageLoaderParam& param)
         {
             switch (param.file)
@@ -157,9 +190,10 @@ namespace Simd
             case SimdImageFilePgmBin: return new ImagePgmBinLoader(param);
             case SimdImageFilePpmTxt: return new ImagePpmTxtLoader(param);
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
-            case SimdImageFilePng: return new Sse41::ImagePngLoader(param);
+            case SimdImageFilePng: return new ImagePngLoader(param);
             case SimdImageFileJpeg: return new Avx2::ImageJpegLoader(param);
             case SimdImageFileBmp: return new ImageBmpLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
             default:
                 return NULL;
             }
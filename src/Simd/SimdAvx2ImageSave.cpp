@@ -53,6 +53,7 @@ namespace Simd
         ImagePgmBinSaver::ImagePgmBinSaver(const ImageSaverParam& param)
             : Sse41::ImagePgmBinSaver(param)
         {
+            _anyToBe16u = Avx2::AnyToBe16u;
             if (_param.width >= A)
             {
                 switch (_param.format)
@@ -89,6 +90,7 @@ namespace Simd
         ImagePpmBinSaver::ImagePpmBinSaver(const ImageSaverParam& param)
             : Sse41::ImagePpmBinSaver(param)
         {
+            _anyToBe16u = Avx2::AnyToBe16u;
             if (_param.width >= A)
             {
                 switch (_param.format)
@@ -129,6 +131,7 @@ namespace Simd
             case SimdImageFilePng: return new ImagePngSaver(param);
             case SimdImageFileJpeg: return new ImageJpegSaver(param);
             case SimdImageFileBmp: return new ImageBmpSaver(param);
+            case SimdImageFileQoi: return new ImageQoiSaver(param);
             default:
                 return NULL;
             }
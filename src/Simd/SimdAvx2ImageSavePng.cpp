@@ -364,6 +364,7 @@ namespace Simd
             _encode[5] = Avx2::EncodeLine5;
             _encode[6] = Avx2::EncodeLine6;
             _compress = Avx2::ZlibCompress;
+            _anyToBe16u = Avx2::AnyToBe16u;
         }
     }
 #endif// SIMD_AVX2_ENABLE
@@ -0,0 +1,108 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{        
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K8_QOI_HASH = SIMD_MM256_SET1_EPI32(0x0B070503);
+        const __m256i K16_QOI_MASK = SIMD_MM256_SET1_EPI16(0x003F);
+        const __m256i K32_QOI_PERM = SIMD_MM256_SETR_EPI32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        SIMD_INLINE __m256i QoiHash8(const uint8_t* rgba)
+        {
+            return _mm256_madd_epi16(_mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)rgba), K8_QOI_HASH), K16_0001);
+        }
+
+        SIMD_INLINE void QoiHash(const uint8_t* rgba, size_t size, uint8_t* hash)
+        {
+            size_t size32 = AlignLo(size, 32), i = 0;
+            for (; i < size32; i += 32, rgba += 128)
+            {
+                __m256i lo = _mm256_and_si256(_mm256_packs_epi32(QoiHash8(rgba + 0), QoiHash8(rgba + 32)), K16_QOI_MASK);
+                __m256i hi = _mm256_and_si256(_mm256_packs_epi32(QoiHash8(rgba + 64), QoiHash8(rgba + 96)), K16_QOI_MASK);
+                _mm256_storeu_si256((__m256i*)(hash + i), _mm256_permutevar8x32_epi32(_mm256_packus_epi16(lo, hi), K32_QOI_PERM));
+            }
+            for (; i < size; ++i, rgba += 4)
+                hash[i] = (uint8_t)Base::QoiHash(*(uint32_t*)rgba);
+        }
+
+        uint8_t* QoiEncode(const uint8_t* rgba, size_t size, QoiState& state, uint8_t* dst)
+        {
+            const size_t BLOCK = 256;
+            uint8_t hash[BLOCK];
+            for (size_t blk = 0; blk < size; blk += BLOCK)
+            {
+                size_t n = Simd::Min(size - blk, BLOCK);
+                const uint32_t* src = (const uint32_t*)rgba + blk;
+                QoiHash(rgba + blk * 4, n, hash);
+                for (size_t i = 0; i < n;)
+                {
+                    uint32_t px = src[i];
+                    if (px == state.prev)
+                    {
+                        __m256i _px = _mm256_set1_epi32(px);
+                        size_t j = i + 1;
+                        for (; j + 8 <= n; j += 8)
+                            if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_loadu_si256((__m256i*)(src + j)), _px)) != -1)
+                                break;
+                        for (; j < n && src[j] == px; ++j);
+                        state.run += j - i;
+                        dst = Base::QoiEncodeRun(state, dst);
+                        i = j;
+                    }
+                    else
+                        dst = Base::QoiEncodePixel(px, hash[i++], state, dst);
+                }
+            }
+            return dst;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : Sse41::ImageQoiSaver(param)
+        {
+            _encode = Avx2::QoiEncode;
+            if (_param.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toBgra = Avx2::GrayToBgra; break;
+                case SimdPixelFormatBgr24: _toBgra = Avx2::RgbToBgra; break;
+                case SimdPixelFormatBgra32: _convert = Avx2::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toBgra = Avx2::BgrToBgra; break;
+                default: break;
+                }
+            }
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
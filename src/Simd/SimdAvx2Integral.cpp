@@ -29,99 +29,88 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE
     namespace Avx2
     {
-        const __m256i K8_SUM_MASK = SIMD_MM256_SETR_EPI8(
-            0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00);
+        template<bool square> SIMD_INLINE __m256i IntegralPrefix(const uint8_t* src, __m256i& carry)
+        {
+            __m256i value = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src));
+            if (square)
+                value = _mm256_mullo_epi32(value, value);
+            value = _mm256_add_epi32(value, _mm256_slli_si256(value, 4));
+            value = _mm256_add_epi32(value, _mm256_slli_si256(value, 8));
+            __m256i top = _mm256_shuffle_epi32(value, 0xFF);
+            value = _mm256_add_epi32(value, _mm256_permute2x128_si256(top, top, 0x08));
+            value = _mm256_add_epi32(value, carry);
+            carry = _mm256_permutevar8x32_epi32(value, _mm256_set1_epi32(7));
+            return value;
+        }
 
-        const __m256i K32_PACK_64_TO_32 = SIMD_MM256_SETR_EPI32(0, 2, 4, 6, 1, 3, 5, 7);
+        template<class T> SIMD_INLINE void IntegralStore(const T* prev, __m256i sum, T* dst);
 
-        void IntegralSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint32_t * sum, size_t sumStride)
+        template<> SIMD_INLINE void IntegralStore(const uint32_t* prev, __m256i sum, uint32_t* dst)
         {
-            memset(sum, 0, (width + 1) * sizeof(uint32_t));
-            sum += sumStride + 1;
-            size_t alignedWidth = AlignLo(width, 4);
+            _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi32(sum, _mm256_loadu_si256((__m256i*)prev)));
+        }
 
-            for (size_t row = 0; row < height; row++)
-            {
-                sum[-1] = 0;
-                size_t col = 0;
-                __m256i _rowSums = K_ZERO;
-                for (; col < alignedWidth; col += 4)
-                {
-                    __m256i _src = _mm256_and_si256(_mm256_set1_epi32(*(uint32_t*)(src + col)), K8_SUM_MASK);
-                    _rowSums = _mm256_add_epi32(_rowSums, _mm256_sad_epu8(_src, K_ZERO));
-                    _mm_storeu_si128((__m128i*)(sum + col), _mm_add_epi32(_mm256_castsi256_si128(_mm256_permutevar8x32_epi32(_rowSums, K32_PACK_64_TO_32)), _mm_loadu_si128((__m128i*)(sum + col - sumStride))));
-                    _rowSums = _mm256_permute4x64_epi64(_rowSums, 0xFF);
-                }
-                uint32_t rowSum = sum[col - 1] - sum[col - sumStride - 1];
-                for (; col < width; col++)
-                {
-                    rowSum += src[col];
-                    sum[col] = rowSum + sum[col - sumStride];
-                }
-                src += srcStride;
-                sum += sumStride;
-            }
+        template<> SIMD_INLINE void IntegralStore(const uint64_t* prev, __m256i sum, uint64_t* dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst + 0, _mm256_add_epi64(_mm256_cvtepu32_epi64(_mm256_castsi256_si128(sum)), _mm256_loadu_si256((__m256i*)prev + 0)));
+            _mm256_storeu_si256((__m256i*)dst + 1, _mm256_add_epi64(_mm256_cvtepu32_epi64(_mm256_extracti128_si256(sum, 1)), _mm256_loadu_si256((__m256i*)prev + 1)));
         }
 
-        void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-            uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
-            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+        template<> SIMD_INLINE void IntegralStore(const float* prev, __m256i sum, float* dst)
         {
-            assert(sumFormat == SimdPixelFormatInt32 && sumStride % sizeof(uint32_t) == 0);
-            if (tilted)
-                assert(tiltedStride % sizeof(uint32_t) == 0);
+            _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_cvtepi32_ps(sum), _mm256_loadu_ps(prev)));
+        }
+
+        template<> SIMD_INLINE void IntegralStore(const double* prev, __m256i sum, double* dst)
+        {
+            _mm256_storeu_pd(dst + 0, _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(sum)), _mm256_loadu_pd(prev + 0)));
+            _mm256_storeu_pd(dst + 4, _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(sum, 1)), _mm256_loadu_pd(prev + 4)));
+        }
 
-            if (sqsum)
+        template<class T, bool square> void IntegralRow(const uint8_t* src, size_t width, const uint8_t* prev, uint8_t* dst)
+        {
+            const T* p = (const T*)prev + 1;
+            T* d = (T*)dst;
+            size_t width8 = AlignLo(width, 8), col = 0;
+            __m256i carry = _mm256_setzero_si256();
+            d[0] = 0, d += 1;
+            for (; col < width8; col += 8)
+                IntegralStore<T>(p + col, IntegralPrefix<square>(src + col, carry), d + col);
+            uint32_t rowSum = _mm_cvtsi128_si32(_mm256_castsi256_si128(carry));
+            for (; col < width; ++col)
             {
-                if (tilted)
-                {
-                    switch (sqsumFormat)
-                    {
-                    case SimdPixelFormatInt32:
-                        IntegralSumSqsumTilted<uint32_t, uint32_t>(src, srcStride, width, height,
-                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
-                        break;
-                    case SimdPixelFormatDouble:
-                        IntegralSumSqsumTilted<uint32_t, double>(src, srcStride, width, height,
-                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
-                        break;
-                    default:
-                        assert(0);
-                    }
-                }
-                else
-                {
-                    switch (sqsumFormat)
-                    {
-                    case SimdPixelFormatInt32:
-                        IntegralSumSqsum<uint32_t, uint32_t>(src, srcStride, width, height,
-                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t));
-                        break;
-                    case SimdPixelFormatDouble:
-                        IntegralSumSqsum<uint32_t, double>(src, srcStride, width, height,
-                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double));
-                        break;
-                    default:
-                        assert(0);
-                    }
-                }
+                uint32_t value = src[col];
+                rowSum += square ? value * value : value;
+                d[col] = p[col] + T(rowSum);
             }
-            else
+        }
+
+        Base::IntegralRowPtr GetIntegralRow(SimdPixelFormatType format, bool square, size_t width)
+        {
+            if (width > INTEGRAL_WIDTH_MAX)
+                return Base::GetIntegralRow(format, square);
+            switch (format)
             {
-                if (tilted)
-                {
-                    IntegralSumTilted<uint32_t>(src, srcStride, width, height,
-                        (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
-                }
-                else
-                {
-                    Avx2::IntegralSum(src, srcStride, width, height, (uint32_t*)sum, sumStride / sizeof(uint32_t));
-                }
+            case SimdPixelFormatInt32: return square ? IntegralRow<uint32_t, true> : IntegralRow<uint32_t, false>;
+            case SimdPixelFormatInt64: return square ? IntegralRow<uint64_t, true> : IntegralRow<uint64_t, false>;
+            case SimdPixelFormatFloat: return square ? IntegralRow<float, true> : IntegralRow<float, false>;
+            case SimdPixelFormatDouble: return square ? IntegralRow<double, true> : IntegralRow<double, false>;
+            default: assert(0); return NULL;
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Integral(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            uint8_t* sum, size_t sumStride, uint8_t* sqsum, size_t sqsumStride, uint8_t* tilted, size_t tiltedStride,
+            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+        {
+            if (tilted)
+                IntegralTilted(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+            else
+                Base::IntegralParallel(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, sumFormat, sqsumFormat,
+                    GetIntegralRow(sumFormat, false, width), sqsum ? GetIntegralRow(sqsumFormat, true, width) : NULL);
+        }
     }
 #endif//SIMD_AVX2_ENABLE
 }
@@ -167,6 +167,64 @@ namespace Simd
             else
                 InterleaveBgra<false>(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<class T, size_t C> SIMD_INLINE void Interleave(const uint8_t* const* src, size_t col, uint8_t* dst)
+        {
+            __m256i s[C];
+            for (size_t c = 0; c < C; ++c)
+                s[c] = _mm256_loadu_si256((const __m256i*)(src[c] + col * sizeof(T)));
+            if (sizeof(T) == 2)
+                InterleaveStore16u<C>(s, dst + col * 2 * C);
+            else
+                InterleaveStore32f<C>(s, dst + col * 4 * C);
+        }
+
+        template<class T, size_t C> void Interleave(const uint8_t* const* src, const size_t* srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
+        {
+            const size_t step = A / sizeof(T);
+            assert(width >= step);
+            size_t widthA = AlignLo(width, step);
+            const uint8_t* s[C];
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t c = 0; c < C; ++c)
+                    s[c] = src[c] + row * srcStride[c];
+                for (size_t col = 0; col < widthA; col += step)
+                    Interleave<T, C>(s, col, dst);
+                if (widthA < width)
+                    Interleave<T, C>(s, width - step, dst);
+                dst += dstStride;
+            }
+        }
+
+        template<class T> void Interleave(const uint8_t* src0, size_t src0Stride, const uint8_t* src1, size_t src1Stride, const uint8_t* src2, size_t src2Stride,
+            const uint8_t* src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t* dst, size_t dstStride)
+        {
+            const uint8_t* src[4] = { src0, src1, src2, src3 };
+            size_t srcStride[4] = { src0Stride, src1Stride, src2Stride, src3Stride };
+            switch (channels)
+            {
+            case 2: Interleave<T, 2>(src, srcStride, width, height, dst, dstStride); break;
+            case 3: Interleave<T, 3>(src, srcStride, width, height, dst, dstStride); break;
+            case 4: Interleave<T, 4>(src, srcStride, width, height, dst, dstStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Interleave16u(const uint8_t* src0, size_t src0Stride, const uint8_t* src1, size_t src1Stride, const uint8_t* src2, size_t src2Stride,
+            const uint8_t* src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t* dst, size_t dstStride)
+        {
+            Interleave<uint16_t>(src0, src0Stride, src1, src1Stride, src2, src2Stride, src3, src3Stride, width, height, channels, dst, dstStride);
+        }
+
+        void Interleave32f(const uint8_t* src0, size_t src0Stride, const uint8_t* src1, size_t src1Stride, const uint8_t* src2, size_t src2Stride,
+            const uint8_t* src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t* dst, size_t dstStride)
+        {
+            Interleave<float>(src0, src0Stride, src1, src1Stride, src2, src2Stride, src3, src3Stride, width, height, channels, dst, dstStride);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
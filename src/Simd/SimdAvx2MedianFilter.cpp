@@ -25,6 +25,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -648,6 +649,94 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void MedianAdd16(const uint16_t* src, uint16_t* dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)src)));
+        }
+
+        SIMD_INLINE void MedianSub16(const uint16_t* src, uint16_t* dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst, _mm256_sub_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)src)));
+        }
+
+        SIMD_INLINE void MedianAddSub16(const uint16_t* add, const uint16_t* sub, uint16_t* dst)
+        {
+            __m256i _dst = _mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)add));
+            _mm256_storeu_si256((__m256i*)dst, _mm256_sub_epi16(_dst, _mm256_loadu_si256((__m256i*)sub)));
+        }
+
+        SIMD_INLINE size_t MedianFind16(__m256i hist, size_t rank, size_t& sum)
+        {
+            return Sse41::MedianFind16(_mm256_castsi256_si128(hist), _mm256_extracti128_si256(hist, 1), rank, sum);
+        }
+
+        void MedianStrip8u(const MedParam& p, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint16_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t width = end - begin, window = 2 * p.radius + 1, size = width + window - 1, rank = p.Rank();
+            uint16_t* fine = buf, * coarse = fine + p.channels * size * 256, * kFine = coarse + p.channels * size * 16;
+            memset(buf, 0, p.channels * size * 272 * sizeof(uint16_t));
+            for (size_t dy = 0; dy < window; ++dy)
+                Base::MedianUpdate8u(p, src + Base::MedianRow(p, dy - p.radius) * srcStride, begin, size, fine, coarse, 1);
+            for (size_t y = 0; y < p.height; ++y)
+            {
+                if (y)
+                {
+                    Base::MedianUpdate8u(p, src + Base::MedianRow(p, y - p.radius - 1) * srcStride, begin, size, fine, coarse, -1);
+                    Base::MedianUpdate8u(p, src + Base::MedianRow(p, y + p.radius) * srcStride, begin, size, fine, coarse, 1);
+                }
+                uint8_t* pd = dst + y * dstStride + begin * p.channels;
+                for (size_t c = 0; c < p.channels; ++c)
+                {
+                    const uint16_t* cFine = fine + c * 16 * size * 16, * cCoarse = coarse + c * size * 16;
+                    size_t last[16] = { 0 };
+                    __m256i kc = _mm256_setzero_si256();
+                    for (size_t col = 0; col < window - 1; ++col)
+                        kc = _mm256_add_epi16(kc, _mm256_loadu_si256((__m256i*)(cCoarse + col * 16)));
+                    for (size_t x = 0; x < width; ++x)
+                    {
+                        kc = _mm256_add_epi16(kc, _mm256_loadu_si256((__m256i*)(cCoarse + (x + window - 1) * 16)));
+                        size_t sum = 0, k = MedianFind16(kc, rank, sum);
+                        const uint16_t* cf = cFine + k * size * 16;
+                        uint16_t* kf = kFine + k * 16;
+                        if (last[k] <= x)
+                        {
+                            memset(kf, 0, 16 * sizeof(uint16_t));
+                            for (last[k] = x; last[k] < x + window; ++last[k])
+                                MedianAdd16(cf + last[k] * 16, kf);
+                        }
+                        else
+                        {
+                            for (; last[k] < x + window; ++last[k])
+                                MedianAddSub16(cf + last[k] * 16, cf + (last[k] - window) * 16, kf);
+                        }
+                        kc = _mm256_sub_epi16(kc, _mm256_loadu_si256((__m256i*)(cCoarse + x * 16)));
+                        pd[x * p.channels + c] = uint8_t(k * 16 + MedianFind16(_mm256_loadu_si256((__m256i*)kf), rank, sum));
+                    }
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        MedianFilterHist::MedianFilterHist(const MedParam& param)
+            : Sse41::MedianFilterHist(param)
+        {
+            if (!_param.Is16u())
+                _run = MedianStrip8u;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags)
+        {
+            MedParam param(width, height, channels, radius, flags, A);
+            if (!param.Valid())
+                return NULL;
+            return new MedianFilterHist(param);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
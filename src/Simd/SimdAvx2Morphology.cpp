@@ -0,0 +1,154 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdTranspose.h"
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdSse41.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        template<bool dilate> SIMD_INLINE __m256i MorphologyOp(__m256i a, __m256i b)
+        {
+            return dilate ? _mm256_max_epu8(a, b) : _mm256_min_epu8(a, b);
+        }
+
+        template<bool dilate> SIMD_INLINE void MorphologyOp(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+                _mm256_storeu_si256((__m256i*)(dst + i), MorphologyOp<dilate>(_mm256_loadu_si256((__m256i*)(a + i)), _mm256_loadu_si256((__m256i*)(b + i))));
+            if (i < size)
+            {
+                i = size - A;
+                _mm256_storeu_si256((__m256i*)(dst + i), MorphologyOp<dilate>(_mm256_loadu_si256((__m256i*)(a + i)), _mm256_loadu_si256((__m256i*)(b + i))));
+            }
+        }
+
+        template<bool dilate> void MorphologyVhgw(const uint8_t* src, size_t srcStep, size_t size, size_t count, size_t kernel, uint8_t* buf, uint8_t* dst, size_t dstStep)
+        {
+            uint8_t* g = buf + kernel * size;
+            for (size_t b = 0; b < count; b += kernel)
+            {
+                const uint8_t* s = src + b * srcStep;
+                uint8_t* h = buf + (kernel - 1) * size;
+                memcpy(h, s + (kernel - 1) * srcStep, size);
+                for (size_t j = kernel - 1; j > 0; --j, h -= size)
+                    MorphologyOp<dilate>(h, s + (j - 1) * srcStep, size, h - size);
+                memcpy(dst + b * dstStep, buf, size);
+                size_t end = Min(kernel, count - b);
+                s += kernel * srcStep;
+                if (end > 1)
+                {
+                    memcpy(g, s, size);
+                    MorphologyOp<dilate>(buf + size, g, size, dst + (b + 1) * dstStep);
+                }
+                for (size_t j = 2; j < end; ++j)
+                {
+                    MorphologyOp<dilate>(g, s + (j - 1) * srcStep, size, g);
+                    MorphologyOp<dilate>(buf + j * size, g, size, dst + (b + j) * dstStep);
+                }
+            }
+        }
+
+        SIMD_INLINE void MorphologyLoadT(const uint8_t* const* src, size_t x, uint8_t* dst)
+        {
+            __m128i v[16];
+            for (size_t h = 0; h < A; h += 16)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    v[i] = _mm_loadu_si128((__m128i*)(src[h + i] + x));
+                Sse41::Transpose8u16x16(v);
+                for (size_t i = 0; i < 16; ++i)
+                    _mm_storeu_si128((__m128i*)(dst + (x + i) * A + h), v[i]);
+            }
+        }
+
+        SIMD_INLINE void MorphologyStoreT(const uint8_t* src, size_t x, size_t rows, uint8_t* dst, size_t dstStride)
+        {
+            __m128i v[16];
+            for (size_t h = 0; h < rows; h += 16)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    v[i] = _mm_loadu_si128((__m128i*)(src + (x + i) * A + h));
+                Sse41::Transpose8u16x16(v);
+                for (size_t i = 0, n = Min<size_t>(16, rows - h); i < n; ++i)
+                    _mm_storeu_si128((__m128i*)(dst + (h + i) * dstStride + x), v[i]);
+            }
+        }
+
+        void MorphologyHor(const uint8_t* const* src, size_t rows, size_t width, size_t channels, size_t kernel, bool dilate, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t size = width * channels, sizeH = AlignLo(size, HA), item = channels * A, anchor = kernel / 2, tail = kernel - 1 - anchor;
+            uint8_t* pad = buf, * body = pad + anchor * item, * out = pad + (width + kernel - 1) * item, * tmp = out + width * item;
+            const uint8_t* s[A];
+            for (size_t r = 0; r < rows; r += A, dst += A * dstStride)
+            {
+                size_t n = Min(A, rows - r);
+                for (size_t i = 0; i < A; ++i)
+                    s[i] = src[r + Min(i, n - 1)];
+                for (size_t x = 0; x < sizeH; x += HA)
+                    MorphologyLoadT(s, x, body);
+                if (sizeH < size)
+                    MorphologyLoadT(s, size - HA, body);
+                for (size_t i = 0; i < anchor; ++i)
+                    memcpy(pad + i * item, body, item);
+                for (size_t i = 0; i < tail; ++i)
+                    memcpy(body + (width + i) * item, body + (width - 1) * item, item);
+                if (dilate)
+                    MorphologyVhgw<true>(pad, item, item, width, kernel, tmp, out, item);
+                else
+                    MorphologyVhgw<false>(pad, item, item, width, kernel, tmp, out, item);
+                for (size_t x = 0; x < sizeH; x += HA)
+                    MorphologyStoreT(out, x, n, dst, dstStride);
+                if (sizeH < size)
+                    MorphologyStoreT(out, size - HA, n, dst, dstStride);
+            }
+        }
+
+        void MorphologyVer(const uint8_t* src, size_t srcStride, size_t size, size_t rows, size_t kernel, bool dilate, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            if (dilate)
+                MorphologyVhgw<true>(src, srcStride, size, rows, kernel, buf, dst, dstStride);
+            else
+                MorphologyVhgw<false>(src, srcStride, size, rows, kernel, buf, dst, dstStride);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Morphology(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels, size_t kernelX, size_t kernelY,
+            SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, uint8_t* dst, size_t dstStride)
+        {
+            if (width * channels < A)
+                Sse41::Morphology(src, srcStride, width, height, channels, kernelX, kernelY, shape, operation, dst, dstStride);
+            else
+                Base::MorphologyApply(src, srcStride, width, height, channels, kernelX, kernelY, shape, operation, dst, dstStride,
+                    MorphologyHor, MorphologyVer, OperationBinary8u, A);
+        }
+    }
+#endif
+}
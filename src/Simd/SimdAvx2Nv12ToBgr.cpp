@@ -0,0 +1,232 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdNv12ToBgr.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K8_SHUFFLE_UV_TO_U_V = SIMD_MM256_SETR_EPI8(
+            0x0, 0x2, 0x4, 0x6, 0x8, 0xA, 0xC, 0xE, 0x1, 0x3, 0x5, 0x7, 0x9, 0xB, 0xD, 0xF,
+            0x0, 0x2, 0x4, 0x6, 0x8, 0xA, 0xC, 0xE, 0x1, 0x3, 0x5, 0x7, 0x9, 0xB, 0xD, 0xF);
+
+        template <bool nv21> SIMD_INLINE void LoadUv(const uint8_t* uv, __m256i& u, __m256i& v)
+        {
+            __m256i uv0 = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)uv + 0), K8_SHUFFLE_UV_TO_U_V);
+            __m256i uv1 = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)uv + 1), K8_SHUFFLE_UV_TO_U_V);
+            u = nv21 ? _mm256_unpackhi_epi64(uv0, uv1) : _mm256_unpacklo_epi64(uv0, uv1);
+            v = nv21 ? _mm256_unpacklo_epi64(uv0, uv1) : _mm256_unpackhi_epi64(uv0, uv1);
+        }
+
+        template <class T, int format> SIMD_INLINE void YuvToAny(__m256i y, __m256i u, __m256i v, __m256i a, uint8_t* dst)
+        {
+            __m256i blue = YuvToBlue<T>(y, u);
+            __m256i green = YuvToGreen<T>(y, u, v);
+            __m256i red = YuvToRed<T>(y, v);
+            if (format == 0 || format == 2)
+            {
+                __m256i c0 = format == 0 ? blue : red;
+                __m256i c2 = format == 0 ? red : blue;
+                _mm256_storeu_si256((__m256i*)dst + 0, InterleaveBgr<0>(c0, green, c2));
+                _mm256_storeu_si256((__m256i*)dst + 1, InterleaveBgr<1>(c0, green, c2));
+                _mm256_storeu_si256((__m256i*)dst + 2, InterleaveBgr<2>(c0, green, c2));
+            }
+            else
+            {
+                __m256i c0 = format == 1 ? blue : red;
+                __m256i c2 = format == 1 ? red : blue;
+                __m256i c01lo = _mm256_unpacklo_epi8(c0, green), c01hi = _mm256_unpackhi_epi8(c0, green);
+                __m256i c23lo = _mm256_unpacklo_epi8(c2, a), c23hi = _mm256_unpackhi_epi8(c2, a);
+                __m256i d0 = _mm256_unpacklo_epi16(c01lo, c23lo), d1 = _mm256_unpackhi_epi16(c01lo, c23lo);
+                __m256i d2 = _mm256_unpacklo_epi16(c01hi, c23hi), d3 = _mm256_unpackhi_epi16(c01hi, c23hi);
+                _mm256_storeu_si256((__m256i*)dst + 0, _mm256_permute2x128_si256(d0, d1, 0x20));
+                _mm256_storeu_si256((__m256i*)dst + 1, _mm256_permute2x128_si256(d2, d3, 0x20));
+                _mm256_storeu_si256((__m256i*)dst + 2, _mm256_permute2x128_si256(d0, d1, 0x31));
+                _mm256_storeu_si256((__m256i*)dst + 3, _mm256_permute2x128_si256(d2, d3, 0x31));
+            }
+        }
+
+        template <class T, int format, bool nv21> SIMD_INLINE void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, __m256i a, uint8_t* dst, size_t dstStride)
+        {
+            const size_t step = A * (format & 1 ? 4 : 3);
+            __m256i u, v;
+            LoadUv<nv21>(uv, u, v);
+            __m256i u0 = _mm256_unpacklo_epi8(u, u), u1 = _mm256_unpackhi_epi8(u, u);
+            __m256i v0 = _mm256_unpacklo_epi8(v, v), v1 = _mm256_unpackhi_epi8(v, v);
+            YuvToAny<T, format>(_mm256_loadu_si256((__m256i*)y + 0), u0, v0, a, dst + 0 * step);
+            YuvToAny<T, format>(_mm256_loadu_si256((__m256i*)y + 1), u1, v1, a, dst + 1 * step);
+            YuvToAny<T, format>(_mm256_loadu_si256((__m256i*)(y + yStride) + 0), u0, v0, a, dst + dstStride + 0 * step);
+            YuvToAny<T, format>(_mm256_loadu_si256((__m256i*)(y + yStride) + 1), u1, v1, a, dst + dstStride + 1 * step);
+        }
+
+        template <class T, int format, bool nv21> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+
+            const size_t channels = format & 1 ? 4 : 3;
+            size_t widthDA = AlignLo(width, DA);
+            __m256i _alpha = _mm256_set1_epi8(alpha);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthDA; col += DA)
+                    Nv12ToAny<T, format, nv21>(y + col, yStride, uv + col, _alpha, dst + col * channels, dstStride);
+                if (widthDA < width)
+                {
+                    size_t col = width - DA;
+                    Nv12ToAny<T, format, nv21>(y + col, yStride, uv + col, _alpha, dst + col * channels, dstStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <int format, bool nv21> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToAny<Base::Bt601, format, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Nv12ToAny<Base::Bt709, format, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToAny<Base::Bt2020, format, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToAny<Base::Trect871, format, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            if (width >= DA)
+                Nv12ToAny<0, false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+            else
+                Sse41::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (width >= DA)
+                Nv12ToAny<1, false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+            else
+                Sse41::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            if (width >= DA)
+                Nv12ToAny<2, false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+            else
+                Sse41::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+        }
+
+        void Nv12ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (width >= DA)
+                Nv12ToAny<3, false>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+            else
+                Sse41::Nv12ToRgbaV2(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+        }
+
+        void Nv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            if (width >= DA)
+                Nv12ToAny<0, true>(y, yStride, vu, vuStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+            else
+                Sse41::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        void Nv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (width >= DA)
+                Nv12ToAny<1, true>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+            else
+                Sse41::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            if (width >= DA)
+                Nv12ToAny<2, true>(y, yStride, vu, vuStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+            else
+                Sse41::Nv21ToRgbV2(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+        }
+
+        void Nv21ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (width >= DA)
+                Nv12ToAny<3, true>(y, yStride, vu, vuStride, width, height, rgba, rgbaStride, alpha, yuvType);
+            else
+                Sse41::Nv21ToRgbaV2(y, yStride, vu, vuStride, width, height, rgba, rgbaStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m256i Nv12ResizedRowV(const uint16_t* src0, const uint16_t* src1, __m256i k0, __m256i k1, __m256i round)
+        {
+            __m256i s0 = _mm256_loadu_si256((__m256i*)src0);
+            __m256i s1 = _mm256_loadu_si256((__m256i*)src1);
+            __m256i lo = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_unpacklo_epi16(s0, K_ZERO), k0), _mm256_mullo_epi32(_mm256_unpacklo_epi16(s1, K_ZERO), k1));
+            __m256i hi = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_unpackhi_epi16(s0, K_ZERO), k0), _mm256_mullo_epi32(_mm256_unpackhi_epi16(s1, K_ZERO), k1));
+            return _mm256_packus_epi32(_mm256_srli_epi32(_mm256_add_epi32(lo, round), 16), _mm256_srli_epi32(_mm256_add_epi32(hi, round), 16));
+        }
+
+        SIMD_INLINE void Nv12ResizedRowV(const uint16_t* src0, const uint16_t* src1, __m256i k0, __m256i k1, __m256i round, uint8_t* dst)
+        {
+            __m256i lo = Nv12ResizedRowV(src0 + 0, src1 + 0, k0, k1, round);
+            __m256i hi = Nv12ResizedRowV(src0 + HA, src1 + HA, k0, k1, round);
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(lo, hi));
+        }
+
+        void Nv12ResizedRowV(const uint16_t* src0, const uint16_t* src1, int fy, size_t width, uint8_t* dst)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A);
+            __m256i k0 = _mm256_set1_epi32(256 - fy), k1 = _mm256_set1_epi32(fy), round = _mm256_set1_epi32(0x8000);
+            for (size_t dx = 0; dx < widthA; dx += A)
+                Nv12ResizedRowV(src0 + dx, src1 + dx, k0, k1, round, dst + dx);
+            if (widthA != width)
+                Nv12ResizedRowV(src0 + width - A, src1 + width - A, k0, k1, round, dst + width - A);
+        }
+
+        void Nv12ToBgrResized(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+            uint8_t* bgr, size_t bgrStride, size_t dstWidth, size_t dstHeight, SimdYuvType yuvType)
+        {
+            if (dstWidth >= A)
+                Base::Nv12ToBgrResizedApply(y, yStride, uv, uvStride, srcWidth, srcHeight, bgr, bgrStride, dstWidth, dstHeight, yuvType, Yuv444pToBgrV2, Nv12ResizedRowV);
+            else
+                Sse41::Nv12ToBgrResized(y, yStride, uv, uvStride, srcWidth, srcHeight, bgr, bgrStride, dstWidth, dstHeight, yuvType);
+        }
+    }
+#endif
+}
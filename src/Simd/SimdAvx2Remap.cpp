@@ -0,0 +1,168 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+#include "Simd/SimdEnable.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        SIMD_INLINE bool RemapBilinearInside(const int16_t* xy, int w, int h)
+        {
+            return xy[0] >= 0 && xy[0] <= w && xy[1] >= 0 && xy[1] <= h;
+        }
+
+        template<int N, bool soft> void RemapByteBilinearRow(const RemapParam& p, const int16_t* xy, const uint8_t* fxy, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2, n = A / M;
+            size_t wa = p.RowMapSize();
+            uint32_t* offs = (uint32_t*)buf;
+            uint8_t* fx = (uint8_t*)(offs + wa);
+            uint16_t* fy = (uint16_t*)(fx + wa * 2);
+            uint8_t* rb0 = (uint8_t*)(fy + wa * 2);
+            uint8_t* rb1 = (uint8_t*)(rb0 + wa * M * 2);
+            const uint8_t* brd = p.NeedFill() ? p.border : NULL;
+            __m256i _n = _mm256_set1_epi32(N);
+            __m256i _s = _mm256_set1_epi32(s);
+            for (int x = 0; x < width;)
+            {
+                for (; x < width && !RemapBilinearInside(xy + 2 * x, w, h); ++x)
+                    Base::ByteBilinearInterpEdge<N>(xy[2 * x + 0], xy[2 * x + 1], fxy[2 * x + 0], fxy[2 * x + 1],
+                        w, h, s, src, brd ? brd : dst + x * N, dst + x * N);
+                int beg = x;
+                for (; x < width && RemapBilinearInside(xy + 2 * x, w, h); ++x);
+                int i = beg, end8 = beg + (int)AlignLo(x - beg, 8), endN = beg + (int)AlignLo(x - beg, n);
+                for (; i < end8; i += 8)
+                    RemapBilinearPrep8(xy + 2 * i, fxy + 2 * i, _n, _s, offs + i, fx + 2 * i, fy + 2 * i);
+                for (; i < x; ++i)
+                    Base::RemapBilinearPrep<N>(xy + 2 * i, fxy + 2 * i, s, offs + i, fx + 2 * i, fy + 2 * i);
+                ByteBilinearGather<M, soft>(src, src + s, offs + beg, x - beg, rb0 + 2 * M * beg, rb1 + 2 * M * beg);
+                for (i = beg; i < endN; i += n)
+                    ByteBilinearInterpMainN<N>(rb0 + i * M * 2, rb1 + i * M * 2, fx + 2 * i, fy + 2 * i, dst + i * N);
+                for (; i < x; ++i)
+                    Base::ByteBilinearInterpMain<N>(rb0 + i * M * 2, rb1 + i * M * 2, fx + 2 * i, fy + 2 * i, dst + i * N);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static Remap::RunPtr GetByteBilinearRunPtr(const RemapParam& p)
+        {
+            bool soft = SlowGather;
+            switch (p.channels)
+            {
+            case 1: return soft ? RemapByteBilinearRow<1, true> : RemapByteBilinearRow<1, false>;
+            case 2: return soft ? RemapByteBilinearRow<2, true> : RemapByteBilinearRow<2, false>;
+            case 3: return soft ? RemapByteBilinearRow<3, true> : RemapByteBilinearRow<3, false>;
+            case 4: return soft ? RemapByteBilinearRow<4, true> : RemapByteBilinearRow<4, false>;
+            }
+            return NULL;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        RemapMap::RemapMap(const RemapParam& param, const float* map)
+            : Sse41::RemapMap(param, map)
+        {
+            if (_param.IsByteBilinear())
+                _run = GetByteBilinearRunPtr(_param);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        WarpPerspective::WarpPerspective(const RemapParam& param, const float* mat)
+            : Sse41::WarpPerspective(param, mat)
+        {
+            if (_param.IsByteBilinear())
+                _run = GetByteBilinearRunPtr(_param);
+        }
+
+        void WarpPerspective::SetRow(int y, int16_t* xy, uint8_t* fxy)
+        {
+            const RemapParam& p = _param;
+            const float* m = _inv;
+            bool nearest = p.IsNearest();
+            int width = (int)p.dstW, width8 = (int)AlignLo(p.dstW, 8);
+            float w = (float)p.srcW, h = (float)p.srcH;
+            double fy = (double)y, bx = fy * m[1] + m[2], by = fy * m[4] + m[5], bz = fy * m[7] + m[8];
+            __m256 _w = _mm256_set1_ps(w), _h = _mm256_set1_ps(h);
+            __m256d _m0 = _mm256_set1_pd(m[0]), _m3 = _mm256_set1_pd(m[3]), _m6 = _mm256_set1_pd(m[6]);
+            __m256d _bx = _mm256_set1_pd(bx), _by = _mm256_set1_pd(by), _bz = _mm256_set1_pd(bz);
+            __m256d _x0 = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0), _x1 = _mm256_setr_pd(4.0, 5.0, 6.0, 7.0), _8 = _mm256_set1_pd(8.0);
+            int x = 0;
+            for (; x < width8; x += 8)
+            {
+                __m256 sx, sy;
+                WarpPerspectivePoint8(_x0, _x1, _m0, _m3, _m6, _bx, _by, _bz, sx, sy);
+                if (nearest)
+                    RemapNearestPoint8(sx, sy, _w, _h, xy + 2 * x);
+                else
+                    RemapBilinearPoint8(sx, sy, _w, _h, xy + 2 * x, fxy + 2 * x);
+                _x0 = _mm256_add_pd(_x0, _8);
+                _x1 = _mm256_add_pd(_x1, _8);
+            }
+            for (; x < width; ++x)
+            {
+                float sx, sy;
+                Base::WarpPerspectivePoint(x, m, bx, by, bz, sx, sy);
+                if (nearest)
+                    Base::RemapNearestPoint(sx, sy, w, h, xy + 2 * x);
+                else
+                    Base::RemapBilinearPoint(sx, sy, w, h, xy + 2 * x, fxy + 2 * x);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, A);
+            if (!param.Valid() || map == NULL)
+                return NULL;
+            if (param.IsNearest() || param.IsByteBilinear())
+                return new RemapMap(param, map);
+            else
+                return NULL;
+        }
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, A);
+            if (!param.Valid() || mat == NULL || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            WarpPerspective* context = new WarpPerspective(param, mat);
+            if (!context->Valid())
+            {
+                delete context;
+                return NULL;
+            }
+            return context;
+        }
+    }
+#endif
+}
@@ -0,0 +1,103 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdTemplateMatch.h"
+#include "Simd/SimdSse41.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        SIMD_INLINE void TemplateMatchCorr16(const uint8_t* s, const __m256i& w, __m256i& s0, __m256i& s1)
+        {
+            __m256i a = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s + 0)));
+            __m256i b = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s + 1)));
+            s0 = _mm256_add_epi32(s0, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), w));
+            s1 = _mm256_add_epi32(s1, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), w));
+        }
+
+        SIMD_INLINE void TemplateMatchCorr16Tail(const uint8_t* s, const __m256i& w, __m256i& s0, __m256i& s1)
+        {
+            __m256i a = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)s));
+            s0 = _mm256_add_epi32(s0, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, K_ZERO), w));
+            s1 = _mm256_add_epi32(s1, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, K_ZERO), w));
+        }
+
+        template<int blocks> void TemplateMatchCorr(const uint8_t* src, size_t srcStride, const int32_t* tmpl, size_t tmplWidth, size_t rows, int32_t* dst)
+        {
+            size_t pairs = DivHi(tmplWidth, 2), even = AlignLo(tmplWidth, 2);
+            __m256i sums[2 * blocks];
+            for (int b = 0; b < 2 * blocks; ++b)
+                sums[b] = _mm256_setzero_si256();
+            for (size_t j = 0; j < rows; ++j, src += srcStride, tmpl += pairs)
+            {
+                for (size_t i = 0; i < even; i += 2)
+                {
+                    __m256i w = _mm256_set1_epi32(tmpl[i / 2]);
+                    for (int b = 0; b < blocks; ++b)
+                        TemplateMatchCorr16(src + b * 16 + i, w, sums[2 * b + 0], sums[2 * b + 1]);
+                }
+                if (even < tmplWidth)
+                {
+                    __m256i w = _mm256_set1_epi32(tmpl[pairs - 1]);
+                    for (int b = 0; b < blocks; ++b)
+                        TemplateMatchCorr16Tail(src + b * 16 + even, w, sums[2 * b + 0], sums[2 * b + 1]);
+                }
+            }
+            for (int b = 0; b < blocks; ++b)
+            {
+                _mm256_storeu_si256((__m256i*)dst + 2 * b + 0, _mm256_permute2x128_si256(sums[2 * b + 0], sums[2 * b + 1], 0x20));
+                _mm256_storeu_si256((__m256i*)dst + 2 * b + 1, _mm256_permute2x128_si256(sums[2 * b + 0], sums[2 * b + 1], 0x31));
+            }
+        }
+
+        void TemplateMatchCorr(const uint8_t* src, size_t srcStride, size_t width, const int32_t* tmpl, size_t tmplWidth, size_t rows, int32_t* dst)
+        {
+            if (width < 16)
+            {
+                Sse41::TemplateMatchCorr(src, srcStride, width, tmpl, tmplWidth, rows, dst);
+                return;
+            }
+            size_t width32 = AlignLo(width, 32), x = 0;
+            for (; x < width32; x += 32)
+                TemplateMatchCorr<2>(src + x, srcStride, tmpl, tmplWidth, rows, dst + x);
+            for (; x < width; x += 16)
+            {
+                x = Simd::Min(x, width - 16);
+                TemplateMatchCorr<1>(src + x, srcStride, tmpl, tmplWidth, rows, dst + x);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void TemplateMatch(const uint8_t* src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t* tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight,
+            SimdTemplateMatchMethodType method, float* dst, size_t dstStride)
+        {
+            Base::TemplateMatchApply(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, method, dst, dstStride, TemplateMatchCorr, A);
+        }
+    }
+#endif
+}
@@ -0,0 +1,190 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdYuv16ToBgr.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        const __m128i K8_SHUFFLE_UV16_TO_U = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD);
+        const __m128i K8_SHUFFLE_UV16_TO_V = SIMD_MM_SETR_EPI8(0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF);
+
+        template<int mode> SIMD_INLINE void LoadYuv16Uv(const uint16_t* u, const uint16_t* v, size_t x, __m128i mask, __m256i& _u, __m256i& _v)
+        {
+            __m128i u8, v8;
+            if (mode == 0)
+            {
+                u8 = _mm_loadu_si128((__m128i*)(u + x));
+                v8 = _mm_loadu_si128((__m128i*)(v + x));
+            }
+            else if (mode == 1)
+            {
+                __m128i u4 = _mm_loadl_epi64((__m128i*)(u + x / 2));
+                __m128i v4 = _mm_loadl_epi64((__m128i*)(v + x / 2));
+                u8 = _mm_unpacklo_epi16(u4, u4);
+                v8 = _mm_unpacklo_epi16(v4, v4);
+            }
+            else
+            {
+                __m128i uv = _mm_loadu_si128((__m128i*)(u + x));
+                u8 = _mm_shuffle_epi8(uv, K8_SHUFFLE_UV16_TO_U);
+                v8 = _mm_shuffle_epi8(uv, K8_SHUFFLE_UV16_TO_V);
+            }
+            _u = _mm256_cvtepu16_epi32(_mm_and_si128(u8, mask));
+            _v = _mm256_cvtepu16_epi32(_mm_and_si128(v8, mask));
+        }
+
+        SIMD_INLINE __m256 Yuv16ToFloat(__m256i value, __m256 lo)
+        {
+            return _mm256_sub_ps(_mm256_cvtepi32_ps(value), lo);
+        }
+
+        template<int mode> void Yuv16ToFloatRow(const Base::Yuv16ToBgrParam& p, const uint16_t* y, const uint16_t* u, const uint16_t* v, size_t width, float* b, float* g, float* r)
+        {
+            __m128i mask = _mm_set1_epi16(p.mask);
+            __m256 yLo = _mm256_set1_ps(p.yLo), uvLo = _mm256_set1_ps(p.uvLo), _y = _mm256_set1_ps(p.y);
+            __m256 ub = _mm256_set1_ps(p.ub), ug = _mm256_set1_ps(p.ug), vg = _mm256_set1_ps(p.vg), vr = _mm256_set1_ps(p.vr);
+            size_t width8 = AlignLo(width, 8), x = 0;
+            for (; x < width8; x += 8)
+            {
+                __m256i y32 = _mm256_cvtepu16_epi32(_mm_and_si128(_mm_loadu_si128((__m128i*)(y + x)), mask)), u32, v32;
+                LoadYuv16Uv<mode>(u, v, x, mask, u32, v32);
+                __m256 _yf = _mm256_mul_ps(Yuv16ToFloat(y32, yLo), _y);
+                __m256 _uf = Yuv16ToFloat(u32, uvLo);
+                __m256 _vf = Yuv16ToFloat(v32, uvLo);
+                _mm256_storeu_ps(b + x, _mm256_add_ps(_yf, _mm256_mul_ps(_uf, ub)));
+                _mm256_storeu_ps(g + x, _mm256_add_ps(_mm256_add_ps(_yf, _mm256_mul_ps(_uf, ug)), _mm256_mul_ps(_vf, vg)));
+                _mm256_storeu_ps(r + x, _mm256_add_ps(_yf, _mm256_mul_ps(_vf, vr)));
+            }
+            if (x < width)
+                Base::Yuv16ToFloatRow(p, y + x, u + (mode == 1 ? x / 2 : x), v ? v + (mode == 1 ? x / 2 : x) : v, width - x, b + x, g + x, r + x);
+        }
+
+        void Yuv16ToFloatRow(const Base::Yuv16ToBgrParam& p, const uint16_t* y, const uint16_t* u, const uint16_t* v, size_t width, float* b, float* g, float* r)
+        {
+            if (g == NULL)
+            {
+                __m128i mask = _mm_set1_epi16(p.mask);
+                __m256 yLo = _mm256_set1_ps(p.yLo), _y = _mm256_set1_ps(p.y);
+                size_t width8 = AlignLo(width, 8), x = 0;
+                for (; x < width8; x += 8)
+                {
+                    __m256i y32 = _mm256_cvtepu16_epi32(_mm_and_si128(_mm_loadu_si128((__m128i*)(y + x)), mask));
+                    _mm256_storeu_ps(b + x, _mm256_mul_ps(Yuv16ToFloat(y32, yLo), _y));
+                }
+                if (x < width)
+                    Base::Yuv16ToFloatRow(p, y + x, NULL, NULL, width - x, b + x, NULL, NULL);
+            }
+            else if (Base::Yuv16SemiPlanar(p.layout))
+                Yuv16ToFloatRow<2>(p, y, u, v, width, b, g, r);
+            else if (Base::Yuv16HalfWidth(p.layout))
+                Yuv16ToFloatRow<1>(p, y, u, v, width, b, g, r);
+            else
+                Yuv16ToFloatRow<0>(p, y, u, v, width, b, g, r);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m256i K32_PERMUTE_FLOAT_TO_UINT8 = SIMD_MM256_SETR_EPI32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        SIMD_INLINE __m256i FloatToUint8(const float* src, __m256 bias)
+        {
+            __m256i i0 = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_loadu_ps(src + 0 * F), bias));
+            __m256i i1 = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_loadu_ps(src + 1 * F), bias));
+            __m256i i2 = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_loadu_ps(src + 2 * F), bias));
+            __m256i i3 = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_loadu_ps(src + 3 * F), bias));
+            __m256i u8 = _mm256_packus_epi16(_mm256_packs_epi32(i0, i1), _mm256_packs_epi32(i2, i3));
+            return _mm256_permutevar8x32_epi32(u8, K32_PERMUTE_FLOAT_TO_UINT8);
+        }
+
+        void FloatToUint8Row(const float* b, const float* g, const float* r, const float* bias, size_t width, size_t channels, uint8_t* dst)
+        {
+            __m256 _bias = _mm256_broadcast_ps((__m128*)bias);
+            size_t widthA = AlignLo(width, A), x = 0;
+            for (; x < widthA; x += A)
+            {
+                __m256i _b = FloatToUint8(b + x, _bias);
+                if (channels == 1)
+                {
+                    _mm256_storeu_si256((__m256i*)(dst + x), _b);
+                    continue;
+                }
+                __m256i _g = FloatToUint8(g + x, _bias);
+                __m256i _r = FloatToUint8(r + x, _bias);
+                if (channels == 3)
+                {
+                    uint8_t* d = dst + 3 * x;
+                    _mm256_storeu_si256((__m256i*)d + 0, InterleaveBgr<0>(_b, _g, _r));
+                    _mm256_storeu_si256((__m256i*)d + 1, InterleaveBgr<1>(_b, _g, _r));
+                    _mm256_storeu_si256((__m256i*)d + 2, InterleaveBgr<2>(_b, _g, _r));
+                }
+                else
+                {
+                    uint8_t* d = dst + 4 * x;
+                    __m256i bgLo = _mm256_unpacklo_epi8(_b, _g), bgHi = _mm256_unpackhi_epi8(_b, _g);
+                    __m256i raLo = _mm256_unpacklo_epi8(_r, K_INV_ZERO), raHi = _mm256_unpackhi_epi8(_r, K_INV_ZERO);
+                    __m256i p0 = _mm256_unpacklo_epi16(bgLo, raLo), p1 = _mm256_unpackhi_epi16(bgLo, raLo);
+                    __m256i p2 = _mm256_unpacklo_epi16(bgHi, raHi), p3 = _mm256_unpackhi_epi16(bgHi, raHi);
+                    _mm256_storeu_si256((__m256i*)d + 0, _mm256_permute2x128_si256(p0, p1, 0x20));
+                    _mm256_storeu_si256((__m256i*)d + 1, _mm256_permute2x128_si256(p2, p3, 0x20));
+                    _mm256_storeu_si256((__m256i*)d + 2, _mm256_permute2x128_si256(p0, p1, 0x31));
+                    _mm256_storeu_si256((__m256i*)d + 3, _mm256_permute2x128_si256(p2, p3, 0x31));
+                }
+            }
+            if (x < width)
+                Sse41::FloatToUint8Row(b + x, channels > 1 ? g + x : g, channels > 1 ? r + x : r, bias, width - x, channels, dst + x * channels);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128i FloatToUint16(const float* src)
+        {
+            __m256i i32 = _mm256_cvtps_epi32(_mm256_loadu_ps(src));
+            return _mm_packus_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+        }
+
+        void FloatToUint16Row(const float* b, const float* g, const float* r, size_t width, uint16_t* dst)
+        {
+            size_t width8 = AlignLo(width, 8), x = 0;
+            for (; x < width8; x += 8)
+                Sse41::InterleaveBgr48(FloatToUint16(b + x), FloatToUint16(g + x), FloatToUint16(r + x), dst + 3 * x);
+            if (x < width)
+                Base::FloatToUint16Row(b + x, g + x, r + x, width - x, dst + 3 * x);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Yuv16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height,
+            SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, uint8_t* dst, size_t dstStride, SimdYuv16OutputType output, SimdBool dither)
+        {
+            Base::Yuv16ToBgrApply(y, yStride, u, uStride, v, vStride, width, height, layout, bitDepth, yuvType, dst, dstStride, output, dither,
+                Yuv16ToFloatRow, FloatToUint8Row, FloatToUint16Row, Float32ToBFloat16);
+        }
+    }
+#endif
+}
@@ -25,6 +25,8 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdStream.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
 
 namespace Simd
 {
@@ -219,6 +221,12 @@ namespace Simd
                 case 4:
                     _pixel = _mm512_set1_epi32(*(uint32_t*)pixel);
                     break;
+                case 8:
+                    _pixel = _mm512_set1_epi64(*(int64_t*)pixel);
+                    break;
+                case 16:
+                    _pixel = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i*)pixel));
+                    break;
                 default:
                     assert(0);
                 }
@@ -228,7 +236,14 @@ namespace Simd
 
         void FillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize)
         {
-            if (Aligned(dst) && Aligned(stride))
+            if (pixelSize == 6 || pixelSize == 12)
+            {
+                if (width >= Avx2::A)
+                    Avx2::FillPixel(dst, stride, width, height, pixel, pixelSize);
+                else
+                    Base::FillPixel(dst, stride, width, height, pixel, pixelSize);
+            }
+            else if (Aligned(dst) && Aligned(stride))
                 FillPixel<true>(dst, stride, width, height, pixel, pixelSize);
             else
                 FillPixel<false>(dst, stride, width, height, pixel, pixelSize);
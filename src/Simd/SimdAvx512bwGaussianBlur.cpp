@@ -340,11 +340,114 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
+        SIMD_INLINE __m512 BlurRecursive(const __m512& x, const __m512& p1, const __m512& p2, const __m512& p3, const __m512* k)
         {
-            BlurParam param(width, height, channels, sigma, epsilon, A);
+            __m512 w = _mm512_add_ps(p1, _mm512_mul_ps(k[0], _mm512_sub_ps(x, p1)));
+            w = _mm512_add_ps(w, _mm512_mul_ps(k[1], _mm512_sub_ps(p2, p1)));
+            return _mm512_add_ps(w, _mm512_mul_ps(k[2], _mm512_sub_ps(p3, p1)));
+        }
+
+        SIMD_INLINE __m512 BlurRecursiveTail(const __m512& u, const __m512& d1, const __m512& d2, const __m512& d3, const __m512* m)
+        {
+            return _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(u, _mm512_mul_ps(m[0], d1)), _mm512_mul_ps(m[1], d2)), _mm512_mul_ps(m[2], d3));
+        }
+
+        template<bool is32f> SIMD_INLINE void BlurRecursiveStore(uint8_t* dst, const __m512& y, __mmask16 tail)
+        {
+            if (is32f)
+                _mm512_mask_storeu_ps((float*)dst, tail, y);
+            else
+                _mm_mask_storeu_epi8(dst, tail, _mm512_cvtusepi32_epi8(_mm512_max_epi32(_mm512_cvtps_epi32(y), _mm512_setzero_si512())));
+        }
+
+        template<bool is32f> void BlurRecursiveCols(const BlurParam& p, const Base::AlgRecursive& a, float* buf, size_t colBeg, size_t colEnd, uint8_t* dst, size_t dstStride)
+        {
+            const size_t height = p.height, stride = a.stride, size = colEnd - colBeg, sizeF = AlignLo(size, F);
+            const size_t elem = is32f ? sizeof(float) : 1;
+            __mmask16 tail = TailMask16(size - sizeF);
+            __m512 k[3], m[9];
+            k[0] = _mm512_set1_ps(a.b);
+            k[1] = _mm512_set1_ps(a.a[1]);
+            k[2] = _mm512_set1_ps(a.a[2]);
+            for (size_t i = 0; i < 9; ++i)
+                m[i] = _mm512_set1_ps(a.m[i]);
+            buf += colBeg, dst += colBeg * elem;
+            float* last = buf + (height + 3) * stride;
+            for (size_t i = 0; i < size; i += F)
+            {
+                __mmask16 mask = i < sizeF ? __mmask16(-1) : tail;
+                _mm512_mask_storeu_ps(last + i, mask, _mm512_maskz_loadu_ps(mask, buf + (height - 1) * stride + i));
+            }
+            for (size_t row = 1; row < height; ++row)
+            {
+                float* pw = buf + row * stride;
+                const float* p1 = buf + (row - 1) * stride;
+                const float* p2 = buf + (row > 1 ? row - 2 : 0) * stride;
+                const float* p3 = buf + (row > 2 ? row - 3 : 0) * stride;
+                size_t i = 0;
+                for (; i < sizeF; i += F)
+                    _mm512_storeu_ps(pw + i, BlurRecursive(_mm512_loadu_ps(pw + i), _mm512_loadu_ps(p1 + i), _mm512_loadu_ps(p2 + i), _mm512_loadu_ps(p3 + i), k));
+                if (i < size)
+                    _mm512_mask_storeu_ps(pw + i, tail, BlurRecursive(_mm512_maskz_loadu_ps(tail, pw + i), _mm512_maskz_loadu_ps(tail, p1 + i), 
+                        _mm512_maskz_loadu_ps(tail, p2 + i), _mm512_maskz_loadu_ps(tail, p3 + i), k));
+            }
+            {
+                const float* p1 = buf + (height - 1) * stride;
+                const float* p2 = buf + (height > 1 ? height - 2 : 0) * stride;
+                const float* p3 = buf + (height > 2 ? height - 3 : 0) * stride;
+                float* t = buf + height * stride;
+                for (size_t i = 0; i < size; i += F)
+                {
+                    __mmask16 mask = i < sizeF ? __mmask16(-1) : tail;
+                    __m512 u = _mm512_maskz_loadu_ps(mask, last + i);
+                    __m512 w1 = _mm512_maskz_loadu_ps(mask, p1 + i);
+                    __m512 d1 = _mm512_sub_ps(w1, u);
+                    __m512 d2 = _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, p2 + i), w1);
+                    __m512 d3 = _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, p3 + i), w1);
+                    _mm512_mask_storeu_ps(t + 0 * stride + i, mask, BlurRecursiveTail(u, d1, d2, d3, m + 0));
+                    _mm512_mask_storeu_ps(t + 1 * stride + i, mask, BlurRecursiveTail(u, d1, d2, d3, m + 3));
+                    _mm512_mask_storeu_ps(t + 2 * stride + i, mask, BlurRecursiveTail(u, d1, d2, d3, m + 6));
+                }
+            }
+            for (size_t row = height - 1; row < height; --row)
+            {
+                float* py = buf + row * stride;
+                const float* p1 = py + 1 * stride;
+                const float* p2 = py + 2 * stride;
+                const float* p3 = py + 3 * stride;
+                uint8_t* pd = dst + row * dstStride;
+                size_t i = 0;
+                for (; i < sizeF; i += F)
+                {
+                    __m512 y = BlurRecursive(_mm512_loadu_ps(py + i), _mm512_loadu_ps(p1 + i), _mm512_loadu_ps(p2 + i), _mm512_loadu_ps(p3 + i), k);
+                    _mm512_storeu_ps(py + i, y);
+                    BlurRecursiveStore<is32f>(pd + i * elem, y, __mmask16(-1));
+                }
+                if (i < size)
+                {
+                    __m512 y = BlurRecursive(_mm512_maskz_loadu_ps(tail, py + i), _mm512_maskz_loadu_ps(tail, p1 + i), 
+                        _mm512_maskz_loadu_ps(tail, p2 + i), _mm512_maskz_loadu_ps(tail, p3 + i), k);
+                    _mm512_mask_storeu_ps(py + i, tail, y);
+                    BlurRecursiveStore<is32f>(pd + i * elem, y, tail);
+                }
+            }
+        }
+
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Avx2::GaussianBlurRecursive(param)
+        {
+            _cols = _param.Is32f() ? BlurRecursiveCols<true> : BlurRecursiveCols<false>;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags)
+        {
+            BlurParam param(width, height, channels, sigma, epsilon, flags, A);
             if (!param.Valid())
                 return NULL;
+            if (param.IsRecursive())
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
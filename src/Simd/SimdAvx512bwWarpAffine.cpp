@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdWarpAffine.h"
 #include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdAvx512bw.h"
 #include "Simd/SimdCopy.h"
 #include "Simd/SimdUnpack.h"
 #include "Simd/SimdStore.h"
@@ -372,14 +373,14 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        template<int N> SIMD_INLINE void ByteBilinearInterpEdge(int x, __m128 sy, const __m128* me, __m128i wh, __m128i ns, int s, const uint8_t* src, const uint8_t* brd, uint8_t* dst)
+        template<int N> SIMD_INLINE void ByteBilinearInterpEdge(int x, __m256d sy, const __m256d* me, __m128i wh, __m128i ns, int s, const uint8_t* src, const uint8_t* brd, uint8_t* dst)
         {
             static const __m128i FX = SIMD_MM_SETR_EPI8(0x4, 0x0, 0x4, 0x0, 0x4, 0x0, 0x4, 0x0, 0x4, 0x0, 0x4, 0x0, 0x4, 0x0, 0x4, 0x0);
             static const __m128i FY = SIMD_MM_SETR_EPI8(0xC, -1, 0x8, -1, 0xC, -1, 0x8, -1, 0xC, -1, 0x8, -1, 0xC, -1, 0x8, -1);
             static const __m128i SRC = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF);
 
-            __m128 sx = _mm_cvtepi32_ps(_mm_set1_epi32(x));
-            __m128 dxy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, me[0]), _mm_mul_ps(sy, me[1])), me[2]);
+            __m256d sx = _mm256_set1_pd(x);
+            __m128 dxy = _mm256_cvtpd_ps(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(sx, me[0]), _mm256_mul_pd(sy, me[1])), me[2]));
             __m128 fixy = _mm_floor_ps(dxy);
             __m128 range = _mm_cvtepi32_ps(_mm512_castsi512_si128(K32_WA_FRACTION_RANGE));
             __m128i fxy = _mm_cvtps_epi32(_mm_mul_ps(_mm_sub_ps(dxy, fixy), range));
@@ -639,9 +640,9 @@ namespace Simd
             __m512i _n = _mm512_set1_epi32(N);
             __m512i _s = _mm512_set1_epi32(s);
             __m512i _border = InitBorder<N>(p.border);
-            __m128 _me[3];
+            __m256d _me[3];
             for (int i = 0; i < 3; ++i)
-                _me[i] = Sse41::SetFloat(p.inv[i + 0], p.inv[i + 3]);
+                _me[i] = _mm256_setr_pd(p.inv[i + 0], p.inv[i + 3], p.inv[i + 0], p.inv[i + 3]);
             __m128i _wh = Sse41::SetInt32(w, h);
             __m128i _ns = _mm_setr_epi32(0, N, s, s + N);
             dst += yBeg * p.dstS;
@@ -649,16 +650,17 @@ namespace Simd
             {
                 int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
                 __m512 _y = _mm512_cvtepi32_ps(_mm512_set1_epi32(y));
+                __m256d _ey = _mm256_set1_pd(y);
                 if (fill)
                 {
                     FillBorder<N>(dst, oB, _border, p.border);
                    for (int x = oB; x < iB; ++x)
-                       ByteBilinearInterpEdge<N>(x, _mm512_castps512_ps128(_y), _me, _wh, _ns, s, src, p.border, dst + x * N);
+                       ByteBilinearInterpEdge<N>(x, _ey, _me, _wh, _ns, s, src, p.border, dst + x * N);
                 }
                 else
                 {
                     for (int x = oB; x < iB; ++x)
-                        ByteBilinearInterpEdge<N>(x, _mm512_castps512_ps128(_y), _me, _wh, _ns, s, src, dst + x * N, dst + x * N);
+                        ByteBilinearInterpEdge<N>(x, _ey, _me, _wh, _ns, s, src, dst + x * N, dst + x * N);
                 }
                 {
                     int x = iB, iEn = (int)AlignLo(iE - iB, n) + iB;
@@ -677,13 +679,13 @@ namespace Simd
                 if (fill)
                 {
                     for (int x = iE; x < oE; ++x)
-                        ByteBilinearInterpEdge<N>(x, _mm512_castps512_ps128(_y), _me, _wh, _ns, s, src, p.border, dst + x * N);
+                        ByteBilinearInterpEdge<N>(x, _ey, _me, _wh, _ns, s, src, p.border, dst + x * N);
                     FillBorder<N>(dst + oE * N, width - oE, _border, p.border);
                 }
                 else
                 {
                     for (int x = iE; x < oE; ++x)
-                        ByteBilinearInterpEdge<N>(x, _mm512_castps512_ps128(_y), _me, _wh, _ns, s, src, dst + x * N, dst + x * N);
+                        ByteBilinearInterpEdge<N>(x, _ey, _me, _wh, _ns, s, src, dst + x * N, dst + x * N);
                 }
                 dst += p.dstS;
             }
@@ -820,6 +822,23 @@ namespace Simd
                 return NULL;
         }
 #endif
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper)
+        {
+            WarpAffBatchParam param(srcW, srcH, srcS, channels, dstW, dstH, flags, border, format, type, lower, upper);
+            if (!param.Valid())
+                return NULL;
+            WarpAffineBatch* batch = new WarpAffineBatch(param, Avx512bw::WarpAffineInit, Avx512bw::Float32ToBFloat16);
+            if (!batch->Valid())
+            {
+                delete batch;
+                return NULL;
+            }
+            return batch;
+        }
     }
 #endif
 }
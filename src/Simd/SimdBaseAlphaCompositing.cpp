@@ -0,0 +1,124 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdAlphaCompositing.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<SimdAlphaCompositingModeType mode, bool premultiplied> void AlphaCompositingRow(const uint8_t* src, size_t width, int alpha, uint8_t* dst)
+        {
+            for (size_t i = 0, size = width * 4; i < size; i += 4)
+                AlphaCompositing<mode, premultiplied>(src + i, alpha, dst + i);
+        }
+
+        template<SimdAlphaCompositingModeType mode> AlphaCompositingRowPtr GetAlphaCompositingRow(bool premultiplied)
+        {
+            return premultiplied ? AlphaCompositingRow<mode, true> : AlphaCompositingRow<mode, false>;
+        }
+
+        AlphaCompositingRowPtr GetAlphaCompositingRow(SimdAlphaCompositingModeType mode, bool premultiplied, bool global)
+        {
+            switch (mode)
+            {
+            case SimdAlphaCompositingNormal: return GetAlphaCompositingRow<SimdAlphaCompositingNormal>(premultiplied);
+            case SimdAlphaCompositingAdd: return GetAlphaCompositingRow<SimdAlphaCompositingAdd>(premultiplied);
+            case SimdAlphaCompositingMultiply: return GetAlphaCompositingRow<SimdAlphaCompositingMultiply>(premultiplied);
+            case SimdAlphaCompositingScreen: return GetAlphaCompositingRow<SimdAlphaCompositingScreen>(premultiplied);
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        const size_t ALPHA_COMPOSITING_TILE = 256;
+
+        void AlphaCompositing(const SimdAlphaCompositingLayer* layers, size_t count, uint8_t* dst, size_t dstStride,
+            size_t width, size_t height, AlphaCompositingRowGetter getRow)
+        {
+            struct Layer
+            {
+                const uint8_t* src;
+                size_t stride;
+                ptrdiff_t x, y, left, top, right, bottom;
+                int alpha;
+                AlphaCompositingRowPtr row;
+            };
+            std::vector<Layer> active;
+            active.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const SimdAlphaCompositingLayer& layer = layers[i];
+                Layer a;
+                a.left = Simd::Max<ptrdiff_t>(layer.left, 0);
+                a.top = Simd::Max<ptrdiff_t>(layer.top, 0);
+                a.right = Simd::Min<ptrdiff_t>(layer.left + layer.width, width);
+                a.bottom = Simd::Min<ptrdiff_t>(layer.top + layer.height, height);
+                if (layer.src == NULL || layer.alpha == 0 || a.left >= a.right || a.top >= a.bottom)
+                    continue;
+                a.src = layer.src;
+                a.x = layer.left;
+                a.y = layer.top;
+                a.stride = layer.srcStride;
+                a.alpha = layer.alpha;
+                a.row = getRow(layer.mode, layer.premultiplied != SimdFalse, layer.alpha < 0xFF);
+                active.push_back(a);
+            }
+            if (active.empty())
+                return;
+
+            size_t threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), height));
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t y = begin; y < end; ++y)
+                {
+                    uint8_t* row = dst + y * dstStride;
+                    for (size_t x = 0; x < width; x += ALPHA_COMPOSITING_TILE)
+                    {
+                        ptrdiff_t tileL = x, tileR = Simd::Min(x + ALPHA_COMPOSITING_TILE, width);
+                        for (size_t l = 0; l < active.size(); ++l)
+                        {
+                            const Layer& a = active[l];
+                            if ((ptrdiff_t)y < a.top || (ptrdiff_t)y >= a.bottom)
+                                continue;
+                            ptrdiff_t spanL = Simd::Max(tileL, a.left), spanR = Simd::Min(tileR, a.right);
+                            if (spanL < spanR)
+                                a.row(a.src + (y - a.y) * a.stride + (spanL - a.x) * 4, spanR - spanL, a.alpha, row + spanL * 4);
+                        }
+                    }
+                }
+            }, threads, 1);
+        }
+
+        void AlphaCompositing(const SimdAlphaCompositingLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height)
+        {
+            AlphaCompositing(layers, count, dst, dstStride, width, height, GetAlphaCompositingRow);
+        }
+    }
+}
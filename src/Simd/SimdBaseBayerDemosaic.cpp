@@ -0,0 +1,218 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBayerDemosaic.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void BayerNormalizeRow(const uint8_t* src, size_t width, size_t bitDepth, float black, const float* scale, float* dst)
+        {
+            if (bitDepth > 8)
+            {
+                const uint16_t* src16 = (const uint16_t*)src;
+                uint16_t mask = uint16_t((1 << bitDepth) - 1);
+                for (size_t x = 0; x < width; ++x)
+                    dst[x] = Simd::Max(float(src16[x] & mask) - black, 0.0f) * scale[x & 1];
+            }
+            else
+            {
+                for (size_t x = 0; x < width; ++x)
+                    dst[x] = Simd::Max(float(src[x]) - black, 0.0f) * scale[x & 1];
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void BayerMalvarRow(const float* const* src, size_t width, bool greenFirst, float* c, float* g, float* o)
+        {
+            const float* s0 = src[0], * s1 = src[1], * s2 = src[2], * s3 = src[3], * s4 = src[4];
+            for (size_t x = 0; x < width; ++x)
+            {
+                float _c = s2[x];
+                float h1 = s2[x - 1] + s2[x + 1], h2 = s2[x - 2] + s2[x + 2];
+                float v1 = s1[x] + s3[x], v2 = s0[x] + s4[x];
+                float d = (s1[x - 1] + s1[x + 1]) + (s3[x - 1] + s3[x + 1]);
+                if (((x & 1) == 0) != greenFirst)
+                {
+                    c[x] = _c;
+                    g[x] = (_c * 0.5f + (h1 + v1) * 0.25f) - (h2 + v2) * 0.125f;
+                    o[x] = (_c * 0.75f + d * 0.25f) - (h2 + v2) * 0.1875f;
+                }
+                else
+                {
+                    c[x] = ((_c * 0.625f + h1 * 0.5f) - (h2 + d) * 0.125f) + v2 * 0.0625f;
+                    g[x] = _c;
+                    o[x] = ((_c * 0.625f + v1 * 0.5f) - (v2 + d) * 0.125f) + h2 * 0.0625f;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void BayerGreenRow(const float* const* src, size_t width, bool greenFirst, float* g)
+        {
+            const float* s0 = src[0], * s1 = src[1], * s2 = src[2], * s3 = src[3], * s4 = src[4];
+            for (size_t x = 0; x < width; ++x)
+            {
+                float _c = s2[x];
+                if (((x & 1) == 0) != greenFirst)
+                {
+                    float lh = _c * 2.0f - (s2[x - 2] + s2[x + 2]);
+                    float lv = _c * 2.0f - (s0[x] + s4[x]);
+                    float gh = (s2[x - 1] + s2[x + 1]) * 0.5f + lh * 0.25f;
+                    float gv = (s1[x] + s3[x]) * 0.5f + lv * 0.25f;
+                    float dh = Simd::Abs(s2[x - 1] - s2[x + 1]) + Simd::Abs(lh);
+                    float dv = Simd::Abs(s1[x] - s3[x]) + Simd::Abs(lv);
+                    g[x] = dh < dv ? gh : (dv < dh ? gv : (gh + gv) * 0.5f);
+                }
+                else
+                    g[x] = _c;
+            }
+        }
+
+        void BayerChromaRow(const float* const* src, const float* const* green, size_t width, bool greenFirst, float* c, float* o)
+        {
+            const float* s0 = src[0], * s1 = src[1], * s2 = src[2];
+            const float* g0 = green[0], * g1 = green[1], * g2 = green[2];
+            for (size_t x = 0; x < width; ++x)
+            {
+                if (((x & 1) == 0) != greenFirst)
+                {
+                    c[x] = s1[x];
+                    o[x] = g1[x] + ((s0[x - 1] - g0[x - 1]) + (s0[x + 1] - g0[x + 1]) + ((s2[x - 1] - g2[x - 1]) + (s2[x + 1] - g2[x + 1]))) * 0.25f;
+                }
+                else
+                {
+                    c[x] = g1[x] + ((s1[x - 1] - g1[x - 1]) + (s1[x + 1] - g1[x + 1])) * 0.5f;
+                    o[x] = g1[x] + ((s0[x] - g0[x]) + (s2[x] - g2[x])) * 0.5f;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void BayerDemosaicPad(float* row, size_t width)
+        {
+            for (size_t i = 1; i <= BAYER_DEMOSAIC_PAD; ++i)
+            {
+                row[-ptrdiff_t(i)] = row[i];
+                row[width - 1 + i] = row[width - 1 - i];
+            }
+        }
+
+        SIMD_INLINE size_t BayerDemosaicReflect(ptrdiff_t y, size_t height)
+        {
+            return y < 0 ? size_t(-y) : (y >= (ptrdiff_t)height ? 2 * height - 2 - y : y);
+        }
+
+        void BayerDemosaicApply(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height, SimdPixelFormatType bayerFormat, size_t bitDepth,
+            size_t blackLevel, const float* gains, SimdBayerDemosaicType method, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat,
+            BayerNormalizeRowPtr normalize, BayerMalvarRowPtr malvar, BayerGreenRowPtr green, BayerChromaRowPtr chroma, FloatToUint8RowPtr toUint8)
+        {
+            assert(width >= 4 && height >= 4 && bitDepth >= 8 && bitDepth <= 16 && blackLevel < (size_t(1) << bitDepth) - 1);
+
+            bool edge = method == SimdBayerDemosaicEdgeDirected;
+            bool redRow0 = bayerFormat == SimdPixelFormatBayerGrbg || bayerFormat == SimdPixelFormatBayerRggb;
+            bool greenFirst0 = bayerFormat == SimdPixelFormatBayerGrbg || bayerFormat == SimdPixelFormatBayerGbrg;
+            size_t channels = (dstFormat == SimdPixelFormatBgra32 || dstFormat == SimdPixelFormatRgba32) ? 4 : 3;
+            bool rgb = dstFormat == SimdPixelFormatRgb24 || dstFormat == SimdPixelFormatRgba32;
+
+            float range = 255.0f / float((size_t(1) << bitDepth) - 1 - blackLevel);
+            float gainB = gains ? gains[0] : 1.0f, gainG = gains ? gains[1] : 1.0f, gainR = gains ? gains[2] : 1.0f;
+            float scale[2][2];
+            for (size_t p = 0; p < 2; ++p)
+            {
+                float color = (redRow0 == (p == 0) ? gainR : gainB) * range;
+                bool greenFirst = greenFirst0 == (p == 0);
+                scale[p][0] = greenFirst ? gainG * range : color;
+                scale[p][1] = greenFirst ? color : gainG * range;
+            }
+            const float bias[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float black = float(blackLevel);
+
+            const size_t halo = edge ? 3 : 2, rawRows = 2 * halo + 1, greenRows = edge ? 3 : 0;
+            const size_t stride = AlignHi(width + 2 * BAYER_DEMOSAIC_PAD, 16);
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32f buf(stride * (rawRows + greenRows) + width * 3);
+                float* raw = buf.data + BAYER_DEMOSAIC_PAD, * grn = raw + rawRows * stride, * out = buf.data + stride * (rawRows + greenRows);
+                float* b = out, * g = out + width, * r = out + 2 * width;
+                const float* rows[5];
+                const float* greens[3];
+                for (ptrdiff_t y = (ptrdiff_t)begin - halo, y1 = (ptrdiff_t)end + halo; y < y1; ++y)
+                {
+                    float* row = raw + (y - begin + halo) % rawRows * stride;
+                    normalize(bayer + BayerDemosaicReflect(y, height) * bayerStride, width, bitDepth, black, scale[y & 1], row);
+                    BayerDemosaicPad(row, width);
+                    if (edge)
+                    {
+                        if (y < (ptrdiff_t)begin + 1)
+                            continue;
+                        ptrdiff_t gy = y - 2;
+                        for (size_t i = 0; i < 5; ++i)
+                            rows[i] = raw + (gy - 2 + i - begin + halo) % rawRows * stride;
+                        float* grow = grn + (gy - begin + 1) % greenRows * stride;
+                        green(rows, width, greenFirst0 == ((gy & 1) == 0), grow);
+                        BayerDemosaicPad(grow, width);
+                        if (gy < (ptrdiff_t)begin + 1)
+                            continue;
+                        ptrdiff_t cy = gy - 1;
+                        for (size_t i = 0; i < 3; ++i)
+                        {
+                            rows[i] = raw + (cy - 1 + i - begin + halo) % rawRows * stride;
+                            greens[i] = grn + (cy - 1 + i - begin + 1) % greenRows * stride;
+                        }
+                        bool redRow = redRow0 == ((cy & 1) == 0);
+                        chroma(rows, greens, width, greenFirst0 == ((cy & 1) == 0), redRow ? r : b, redRow ? b : r);
+                        toUint8(rgb ? r : b, greens[1], rgb ? b : r, bias, width, channels, dst + cy * dstStride);
+                    }
+                    else
+                    {
+                        if (y < (ptrdiff_t)begin + 2)
+                            continue;
+                        ptrdiff_t cy = y - 2;
+                        for (size_t i = 0; i < 5; ++i)
+                            rows[i] = raw + (cy - 2 + i - begin + halo) % rawRows * stride;
+                        bool redRow = redRow0 == ((cy & 1) == 0);
+                        malvar(rows, width, greenFirst0 == ((cy & 1) == 0), redRow ? r : b, g, redRow ? b : r);
+                        toUint8(rgb ? r : b, g, rgb ? b : r, bias, width, channels, dst + cy * dstStride);
+                    }
+                }
+            }, Base::GetThreadNumber(), 32);
+        }
+
+        void BayerDemosaic(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height, SimdPixelFormatType bayerFormat, size_t bitDepth,
+            size_t blackLevel, const float* gains, SimdBayerDemosaicType method, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat)
+        {
+            BayerDemosaicApply(bayer, bayerStride, width, height, bayerFormat, bitDepth, blackLevel, gains, method, dst, dstStride, dstFormat,
+                BayerNormalizeRow, BayerMalvarRow, BayerGreenRow, BayerChromaRow, FloatToUint8Row);
+        }
+    }
+}
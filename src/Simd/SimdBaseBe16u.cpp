@@ -0,0 +1,78 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBe16u.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void Be16uToAny(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t srcChannels, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat)
+        {
+            size_t dstChannels = Channels16u(dstFormat);
+            assert(srcChannels >= 1 && srcChannels <= 4 && dstChannels);
+            if (dstChannels == 1 && srcChannels >= 3)
+            {
+                for (size_t row = 0; row < height; ++row)
+                {
+                    const uint16_t* s = (const uint16_t*)(src + row * srcStride);
+                    uint16_t* d = (uint16_t*)(dst + row * dstStride);
+                    for (size_t col = 0; col < width; ++col, s += srcChannels)
+                        d[col] = (uint16_t)BgrToGray(SwapBytes16u(s[2]), SwapBytes16u(s[1]), SwapBytes16u(s[0]));
+                }
+            }
+            else
+            {
+                int map[4];
+                Repack16uMap(srcChannels, dstChannels, IsBgr16u(dstFormat), map);
+                for (size_t row = 0; row < height; ++row)
+                    Repack16u(src + row * srcStride, srcChannels, width, dstChannels, map, true, dst + row * dstStride);
+            }
+        }
+
+        void AnyToBe16u(const uint8_t* src, size_t srcStride, size_t width, size_t height, SimdPixelFormatType srcFormat, uint8_t* dst, size_t dstStride, size_t dstChannels)
+        {
+            size_t srcChannels = Channels16u(srcFormat);
+            assert(srcChannels && (dstChannels == 1 || dstChannels == 3 || dstChannels == 4));
+            if (dstChannels == 1 && srcChannels >= 3)
+            {
+                size_t b = IsBgr16u(srcFormat) ? 0 : 2, r = 2 - b;
+                for (size_t row = 0; row < height; ++row)
+                {
+                    const uint16_t* s = (const uint16_t*)(src + row * srcStride);
+                    uint16_t* d = (uint16_t*)(dst + row * dstStride);
+                    for (size_t col = 0; col < width; ++col, s += srcChannels)
+                        d[col] = SwapBytes16u((uint16_t)BgrToGray(s[b], s[1], s[r]));
+                }
+            }
+            else
+            {
+                int map[4];
+                Repack16uMap(srcChannels, dstChannels, IsBgr16u(srcFormat), map);
+                for (size_t row = 0; row < height; ++row)
+                    Repack16u(src + row * srcStride, srcChannels, width, dstChannels, map, true, dst + row * dstStride);
+            }
+        }
+    }
+}
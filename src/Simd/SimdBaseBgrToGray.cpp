@@ -52,5 +52,47 @@ namespace Simd
                 }
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<size_t C> void BgrToGray16u(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* gray, size_t grayStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t* pBgr = (const uint16_t*)(bgr + row * bgrStride);
+                uint16_t* pGray = (uint16_t*)(gray + row * grayStride);
+                for (size_t col = 0; col < width; ++col, pBgr += C)
+                    pGray[col] = (uint16_t)BgrToGray(pBgr[0], pBgr[1], pBgr[2]);
+            }
+        }
+
+        void BgrToGray16u(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t* gray, size_t grayStride)
+        {
+            assert(channels == 3 || channels == 4);
+            if (channels == 3)
+                BgrToGray16u<3>(bgr, bgrStride, width, height, gray, grayStride);
+            else
+                BgrToGray16u<4>(bgr, bgrStride, width, height, gray, grayStride);
+        }
+
+        template<size_t C> void BgrToGray32f(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* gray, size_t grayStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const float* pBgr = (const float*)(bgr + row * bgrStride);
+                float* pGray = (float*)(gray + row * grayStride);
+                for (size_t col = 0; col < width; ++col, pBgr += C)
+                    pGray[col] = BgrToGray32f(pBgr[0], pBgr[1], pBgr[2]);
+            }
+        }
+
+        void BgrToGray32f(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t* gray, size_t grayStride)
+        {
+            assert(channels == 3 || channels == 4);
+            if (channels == 3)
+                BgrToGray32f<3>(bgr, bgrStride, width, height, gray, grayStride);
+            else
+                BgrToGray32f<4>(bgr, bgrStride, width, height, gray, grayStride);
+        }
     }
 }
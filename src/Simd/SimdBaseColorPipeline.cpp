@@ -0,0 +1,208 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdColorPipeline.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    ColorPipelineParam::ColorPipelineParam(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags)
+    {
+        this->format = format;
+        this->flags = flags;
+        this->channels = (format == SimdPixelFormatBgra32 || format == SimdPixelFormatRgba32) ? 4 : 3;
+        this->curveSize = curves ? curveSize : 0;
+        this->lutSize = lut ? lutSize : 0;
+        this->matrix = matrix != NULL;
+        this->curves = curves != NULL;
+        this->lut = lut != NULL;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        SIMD_INLINE float ColorPipelineClamp(float value)
+        {
+            return Simd::Min(Simd::Max(value, 0.0f), 1.0f);
+        }
+
+        SIMD_INLINE float ColorPipelineCurve(const float* curve, size_t size, float value)
+        {
+            float s = ColorPipelineClamp(value) * float(size - 1);
+            int i = Simd::Min((int)s, (int)size - 2);
+            float f = s - float(i);
+            return curve[i] + (curve[i + 1] - curve[i]) * f;
+        }
+    }
+
+    ColorPipeline::ColorPipeline(const ColorPipelineParam& param, const float* matrix, const float* curves, const float* lut)
+        : _param(param)
+        , _row(NULL)
+    {
+        size_t order[3];
+        for (size_t c = 0; c < 3; ++c)
+            order[c] = _param.IsRgb() ? c : 2 - c;
+
+        _tables.input.Resize(3 * 256);
+        for (size_t c = 0; c < 3; ++c)
+        {
+            for (size_t v = 0; v < 256; ++v)
+            {
+                float value = float(v) / 255.0f;
+                if (_param.curves && !_param.matrix)
+                    value = Base::ColorPipelineCurve(curves + order[c] * _param.curveSize, _param.curveSize, value);
+                _tables.input[c * 256 + v] = value;
+            }
+        }
+
+        for (size_t r = 0; r < 3; ++r)
+            for (size_t c = 0; c < 3; ++c)
+                _tables.matrix[r * 3 + c] = matrix ? matrix[order[r] * 3 + order[c]] : (r == c ? 1.0f : 0.0f);
+
+        if (_param.CurvesAfterMatrix())
+        {
+            _tables.curves.Resize(3 * _param.curveSize);
+            for (size_t c = 0; c < 3; ++c)
+                memcpy(_tables.curves.data + c * _param.curveSize, curves + order[c] * _param.curveSize, _param.curveSize * sizeof(float));
+        }
+
+        if (_param.lut)
+        {
+            size_t size = _param.lutSize, nodes = size * size * size;
+            int axis[3] = { 1, int(size), int(size * size) };
+            for (size_t c = 0; c < 3; ++c)
+                _tables.offset[c] = axis[order[c]];
+            if (_param.Lut16u())
+            {
+                _tables.lut16u.Resize(nodes * 4, true);
+                for (size_t n = 0; n < nodes; ++n)
+                    for (size_t c = 0; c < 3; ++c)
+                        _tables.lut16u[n * 4 + c] = (uint16_t)Round(Base::ColorPipelineClamp(lut[n * 3 + order[c]]) * 65535.0f);
+            }
+            else
+            {
+                _tables.lut32f.Resize(nodes * 4, true);
+                for (size_t n = 0; n < nodes; ++n)
+                    for (size_t c = 0; c < 3; ++c)
+                        _tables.lut32f[n * 4 + c] = lut[n * 3 + order[c]];
+            }
+        }
+        else
+        {
+            for (size_t c = 0; c < 3; ++c)
+                _tables.offset[c] = 0;
+        }
+    }
+
+    void ColorPipeline::Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride) const
+    {
+        size_t threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), height));
+        Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t y = begin; y < end; ++y)
+                _row(_param, _tables, src + y * srcStride, width, dst + y * dstStride);
+        }, threads, 1);
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<class T> SIMD_INLINE void ColorPipelineLut(const ColorPipelineParam& p, const ColorPipelineTables& t, const T* lut, float scale, float* v)
+        {
+            float k = float(p.lutSize - 1), f[3];
+            int last = (int)p.lutSize - 2, base = 0;
+            for (size_t c = 0; c < 3; ++c)
+            {
+                float s = ColorPipelineClamp(v[c]) * k;
+                int i = Simd::Min((int)s, last);
+                f[c] = s - float(i);
+                base += i * t.offset[c];
+            }
+            int oMax = (f[0] >= f[1] && f[0] >= f[2]) ? t.offset[0] : (f[1] >= f[2] ? t.offset[1] : t.offset[2]);
+            int oMin = (f[2] <= f[0] && f[2] <= f[1]) ? t.offset[2] : (f[1] <= f[0] ? t.offset[1] : t.offset[0]);
+            int oAll = t.offset[0] + t.offset[1] + t.offset[2];
+            float fMax = Simd::Max(f[0], Simd::Max(f[1], f[2]));
+            float fMin = Simd::Min(f[0], Simd::Min(f[1], f[2]));
+            float fMid = Simd::Max(Simd::Min(f[0], f[1]), Simd::Min(Simd::Max(f[0], f[1]), f[2]));
+            float w0 = 1.0f - fMax, w1 = fMax - fMid, w2 = fMid - fMin, w3 = fMin;
+            const T* n0 = lut + base * 4;
+            const T* n1 = lut + (base + oMax) * 4;
+            const T* n2 = lut + (base + oAll - oMin) * 4;
+            const T* n3 = lut + (base + oAll) * 4;
+            for (size_t c = 0; c < 3; ++c)
+                v[c] = (((float(n0[c]) * w0 + float(n1[c]) * w1) + float(n2[c]) * w2) + float(n3[c]) * w3) * scale;
+        }
+
+        void ColorPipelineRow(const ColorPipelineParam& p, const ColorPipelineTables& t, const uint8_t* src, size_t width, uint8_t* dst)
+        {
+            const float* in0 = t.input.data, * in1 = in0 + 256, * in2 = in1 + 256, * m = t.matrix;
+            size_t N = p.channels;
+            for (size_t x = 0; x < width; ++x, src += N, dst += N)
+            {
+                float v[3] = { in0[src[0]], in1[src[1]], in2[src[2]] };
+                if (p.matrix)
+                {
+                    float v0 = ColorPipelineClamp((m[0] * v[0] + m[1] * v[1]) + m[2] * v[2]);
+                    float v1 = ColorPipelineClamp((m[3] * v[0] + m[4] * v[1]) + m[5] * v[2]);
+                    float v2 = ColorPipelineClamp((m[6] * v[0] + m[7] * v[1]) + m[8] * v[2]);
+                    v[0] = v0, v[1] = v1, v[2] = v2;
+                }
+                if (p.CurvesAfterMatrix())
+                {
+                    for (size_t c = 0; c < 3; ++c)
+                        v[c] = ColorPipelineCurve(t.curves.data + c * p.curveSize, p.curveSize, v[c]);
+                }
+                if (p.Lut16u())
+                    ColorPipelineLut(p, t, t.lut16u.data, 1.0f / 65535.0f, v);
+                else if (p.lut)
+                    ColorPipelineLut(p, t, t.lut32f.data, 1.0f, v);
+                for (size_t c = 0; c < 3; ++c)
+                    dst[c] = (uint8_t)Round(ColorPipelineClamp(v[c]) * 255.0f);
+                if (N == 4)
+                    dst[3] = src[3];
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        ColorPipeline::ColorPipeline(const ColorPipelineParam& param, const float* matrix, const float* curves, const float* lut)
+            : Simd::ColorPipeline(param, matrix, curves, lut)
+        {
+            _row = ColorPipelineRow;
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        void* ColorPipelineInit(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags)
+        {
+            ColorPipelineParam param(format, matrix, curves, curveSize, lut, lutSize, flags);
+            if (!param.Valid())
+                return NULL;
+            return new ColorPipeline(param, matrix, curves, lut);
+        }
+    }
+}
@@ -99,5 +99,48 @@ namespace Simd
                 }
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<class T, size_t C> void Deinterleave(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* const* dst, const size_t* dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const T* s = (const T*)(src + row * srcStride);
+                for (size_t c = 0; c < C; ++c)
+                {
+                    T* d = (T*)(dst[c] + row * dstStride[c]);
+                    for (size_t col = 0, offset = c; col < width; ++col, offset += C)
+                        d[col] = s[offset];
+                }
+            }
+        }
+
+        template<class T> void Deinterleave(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+            uint8_t* dst0, size_t dst0Stride, uint8_t* dst1, size_t dst1Stride, uint8_t* dst2, size_t dst2Stride, uint8_t* dst3, size_t dst3Stride)
+        {
+            uint8_t* dst[4] = { dst0, dst1, dst2, dst3 };
+            size_t dstStride[4] = { dst0Stride, dst1Stride, dst2Stride, dst3Stride };
+            switch (channels)
+            {
+            case 2: Deinterleave<T, 2>(src, srcStride, width, height, dst, dstStride); break;
+            case 3: Deinterleave<T, 3>(src, srcStride, width, height, dst, dstStride); break;
+            case 4: Deinterleave<T, 4>(src, srcStride, width, height, dst, dstStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Deinterleave16u(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+            uint8_t* dst0, size_t dst0Stride, uint8_t* dst1, size_t dst1Stride, uint8_t* dst2, size_t dst2Stride, uint8_t* dst3, size_t dst3Stride)
+        {
+            Deinterleave<uint16_t>(src, srcStride, width, height, channels, dst0, dst0Stride, dst1, dst1Stride, dst2, dst2Stride, dst3, dst3Stride);
+        }
+
+        void Deinterleave32f(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+            uint8_t* dst0, size_t dst0Stride, uint8_t* dst1, size_t dst1Stride, uint8_t* dst2, size_t dst2Stride, uint8_t* dst3, size_t dst3Stride)
+        {
+            Deinterleave<float>(src, srcStride, width, height, channels, dst0, dst0Stride, dst1, dst1Stride, dst2, dst2Stride, dst3, dst3Stride);
+        }
     }
 }
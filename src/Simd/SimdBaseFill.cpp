@@ -23,6 +23,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdCopy.h"
 
 namespace Simd
 {
@@ -209,6 +210,14 @@ namespace Simd
 #pragma GCC pop_options
 #endif
 
+        template<size_t N> void FillPixel(uint8_t* dst, size_t stride, size_t width, size_t height, const uint8_t* pixel)
+        {
+            for (size_t col = 0; col < width; ++col)
+                CopyPixel<N>(pixel, dst + col * N);
+            for (size_t row = 1; row < height; ++row)
+                memcpy(dst + row * stride, dst, width * N);
+        }
+
         void FillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize)
         {
             switch (pixelSize)
@@ -225,6 +234,18 @@ namespace Simd
             case 4: 
                 FillBgra(dst, stride, width, height, pixel[0], pixel[1], pixel[2], pixel[3]);
                 break;
+            case 6:
+                FillPixel<6>(dst, stride, width, height, pixel);
+                break;
+            case 8:
+                FillPixel<8>(dst, stride, width, height, pixel);
+                break;
+            case 12:
+                FillPixel<12>(dst, stride, width, height, pixel);
+                break;
+            case 16:
+                FillPixel<16>(dst, stride, width, height, pixel);
+                break;
             default:
                 assert(0);
             }
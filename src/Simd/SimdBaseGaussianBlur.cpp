@@ -24,15 +24,17 @@
 #include "Simd/SimdDefs.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
-    BlurParam::BlurParam(size_t w, size_t h, size_t c, const float* s, const float* e, size_t a)
+    BlurParam::BlurParam(size_t w, size_t h, size_t c, const float* s, const float* e, SimdGaussianBlurFlags f, size_t a)
         : width(w)
         , height(h)
         , channels(c)
         , sigma(*s)
         , epsilon(e ? *e : 0.001f)
+        , flags(f)
         , align(a)
     {
     }
@@ -45,6 +47,7 @@ namespace Simd
             channels > 0 && channels <= 4 &&
             sigma >= 0.000001f &&
             epsilon >= 0.000001f && epsilon <= 1.0f &&
+            (IsRecursive() ? sigma >= 0.5f : !Is32f()) &&
             align >= sizeof(float);
     }
 
@@ -249,11 +252,188 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
+        template<int channels> void BlurRecursiveRows(const BlurParam& p, const AlgRecursive& a, const uint8_t* src, size_t srcStride, size_t rowBeg, size_t rowEnd, float* buf)
         {
-            BlurParam param(width, height, channels, sigma, epsilon, sizeof(void*));
+            const float b = a.b, a2 = a.a[1], a3 = a.a[2];
+            const size_t width = p.width, last = (width - 1) * channels;
+            for (size_t row = rowBeg; row < rowEnd; ++row)
+            {
+                const uint8_t* ps = src + row * srcStride;
+                float* pb = buf + row * a.stride;
+                if (p.Is32f())
+                    memcpy(pb, ps, a.size * sizeof(float));
+                else
+                {
+                    for (size_t i = 0; i < a.size; ++i)
+                        pb[i] = float(ps[i]);
+                }
+                float u[channels], s1[channels], s2[channels], s3[channels];
+                for (size_t c = 0; c < channels; ++c)
+                    u[c] = pb[last + c], s1[c] = pb[c], s2[c] = pb[c], s3[c] = pb[c];
+                for (size_t x = 1; x < width; ++x)
+                {
+                    float* pw = pb + x * channels;
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        float w = s1[c] + b * (pw[c] - s1[c]) + a2 * (s2[c] - s1[c]) + a3 * (s3[c] - s1[c]);
+                        s3[c] = s2[c], s2[c] = s1[c], s1[c] = w, pw[c] = w;
+                    }
+                }
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float d1 = s1[c] - u[c], d2 = s2[c] - s1[c], d3 = s3[c] - s1[c];
+                    s1[c] = u[c] + a.m[0] * d1 + a.m[1] * d2 + a.m[2] * d3;
+                    s2[c] = u[c] + a.m[3] * d1 + a.m[4] * d2 + a.m[5] * d3;
+                    s3[c] = u[c] + a.m[6] * d1 + a.m[7] * d2 + a.m[8] * d3;
+                }
+                for (size_t x = width - 1; x < width; --x)
+                {
+                    float* pw = pb + x * channels;
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        float y = s1[c] + b * (pw[c] - s1[c]) + a2 * (s2[c] - s1[c]) + a3 * (s3[c] - s1[c]);
+                        s3[c] = s2[c], s2[c] = s1[c], s1[c] = y, pw[c] = y;
+                    }
+                }
+            }
+        }
+
+        void BlurRecursiveRows(const BlurParam& p, const AlgRecursive& a, const uint8_t* src, size_t srcStride, size_t rowBeg, size_t rowEnd, float* buf)
+        {
+            switch (p.channels)
+            {
+            case 1: BlurRecursiveRows<1>(p, a, src, srcStride, rowBeg, rowEnd, buf); break;
+            case 2: BlurRecursiveRows<2>(p, a, src, srcStride, rowBeg, rowEnd, buf); break;
+            case 3: BlurRecursiveRows<3>(p, a, src, srcStride, rowBeg, rowEnd, buf); break;
+            case 4: BlurRecursiveRows<4>(p, a, src, srcStride, rowBeg, rowEnd, buf); break;
+            }
+        }
+
+        void BlurRecursiveCols(const BlurParam& p, const AlgRecursive& a, float* buf, size_t colBeg, size_t colEnd, uint8_t* dst, size_t dstStride)
+        {
+            const float b = a.b, a2 = a.a[1], a3 = a.a[2];
+            const size_t height = p.height, stride = a.stride;
+            float* last = buf + (height + 3) * stride;
+            memcpy(last + colBeg, buf + (height - 1) * stride + colBeg, (colEnd - colBeg) * sizeof(float));
+            for (size_t row = 1; row < height; ++row)
+            {
+                float* pw = buf + row * stride;
+                const float* p1 = buf + (row - 1) * stride;
+                const float* p2 = buf + (row > 1 ? row - 2 : 0) * stride;
+                const float* p3 = buf + (row > 2 ? row - 3 : 0) * stride;
+                for (size_t i = colBeg; i < colEnd; ++i)
+                    pw[i] = p1[i] + b * (pw[i] - p1[i]) + a2 * (p2[i] - p1[i]) + a3 * (p3[i] - p1[i]);
+            }
+            {
+                const float* p1 = buf + (height - 1) * stride;
+                const float* p2 = buf + (height > 1 ? height - 2 : 0) * stride;
+                const float* p3 = buf + (height > 2 ? height - 3 : 0) * stride;
+                float* t0 = buf + (height + 0) * stride;
+                float* t1 = buf + (height + 1) * stride;
+                float* t2 = buf + (height + 2) * stride;
+                for (size_t i = colBeg; i < colEnd; ++i)
+                {
+                    float d1 = p1[i] - last[i], d2 = p2[i] - p1[i], d3 = p3[i] - p1[i];
+                    t0[i] = last[i] + a.m[0] * d1 + a.m[1] * d2 + a.m[2] * d3;
+                    t1[i] = last[i] + a.m[3] * d1 + a.m[4] * d2 + a.m[5] * d3;
+                    t2[i] = last[i] + a.m[6] * d1 + a.m[7] * d2 + a.m[8] * d3;
+                }
+            }
+            for (size_t row = height - 1; row < height; --row)
+            {
+                float* py = buf + row * stride;
+                const float* p1 = py + 1 * stride;
+                const float* p2 = py + 2 * stride;
+                const float* p3 = py + 3 * stride;
+                for (size_t i = colBeg; i < colEnd; ++i)
+                    py[i] = p1[i] + b * (py[i] - p1[i]) + a2 * (p2[i] - p1[i]) + a3 * (p3[i] - p1[i]);
+                if (p.Is32f())
+                    memcpy((float*)(dst + row * dstStride) + colBeg, py + colBeg, (colEnd - colBeg) * sizeof(float));
+                else
+                {
+                    uint8_t* pd = dst + row * dstStride;
+                    for (size_t i = colBeg; i < colEnd; ++i)
+                        pd[i] = (uint8_t)RestrictRange(Round(py[i]), 0, 255);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurRecursive::GaussianBlurRecursive(const BlurParam& param)
+            : Simd::GaussianBlur(param)
+        {
+            double sigma = _param.sigma;
+            double q = sigma >= 2.5 ? 0.98711 * sigma - 0.96330 : 3.97156 - 4.14554 * ::sqrt(1.0 - 0.26891 * sigma);
+            double b0 = 1.57825 + 2.44413 * q + 1.4281 * q * q + 0.422205 * q * q * q;
+            double b1 = 2.44413 * q + 2.85619 * q * q + 1.26661 * q * q * q;
+            double b2 = -(1.4281 * q * q + 1.26661 * q * q * q);
+            double b3 = 0.422205 * q * q * q;
+            _alg.a[0] = float(b1 / b0);
+            _alg.a[1] = float(b2 / b0);
+            _alg.a[2] = float(b3 / b0);
+            _alg.b = 1.0f - _alg.a[0] - _alg.a[1] - _alg.a[2];
+
+            size_t tail = size_t(40.0 * sigma) + 64;
+            std::vector<double> w(tail);
+            double m[3][3];
+            for (size_t j = 0; j < 3; ++j)
+            {
+                double s[3] = { 0.0, 0.0, 0.0 };
+                s[j] = 1.0;
+                for (size_t n = 0; n < tail; ++n)
+                {
+                    w[n] = _alg.a[0] * s[0] + _alg.a[1] * s[1] + _alg.a[2] * s[2];
+                    s[2] = s[1], s[1] = s[0], s[0] = w[n];
+                }
+                s[0] = s[1] = s[2] = 0.0;
+                for (size_t n = tail - 1; n < tail; --n)
+                {
+                    w[n] = _alg.b * w[n] + _alg.a[0] * s[0] + _alg.a[1] * s[1] + _alg.a[2] * s[2];
+                    s[2] = s[1], s[1] = s[0], s[0] = w[n];
+                }
+                for (size_t k = 0; k < 3; ++k)
+                    m[k][j] = w[k];
+            }
+            for (size_t k = 0; k < 3; ++k)
+            {
+                _alg.m[k * 3 + 0] = float(m[k][0] + m[k][1] + m[k][2]);
+                _alg.m[k * 3 + 1] = float(m[k][1]);
+                _alg.m[k * 3 + 2] = float(m[k][2]);
+            }
+
+            _alg.size = _param.width * _param.channels;
+            _alg.stride = AlignHi(_alg.size, _param.align / sizeof(float));
+            _buf.Resize((_param.height + 4) * _alg.stride);
+            _threads = Base::GetThreadNumber();
+            _rows = BlurRecursiveRows;
+            _cols = BlurRecursiveCols;
+        }
+
+        void GaussianBlurRecursive::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const BlurParam& p = _param;
+            const AlgRecursive& a = _alg;
+            float* buf = _buf.data;
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                _rows(p, a, src, srcStride, begin, end, buf);
+            }, _threads, 8);
+            Simd::Parallel(0, a.size, [&](size_t thread, size_t begin, size_t end)
+            {
+                _cols(p, a, buf, begin, end, dst, dstStride);
+            }, _threads, 64);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags)
+        {
+            BlurParam param(width, height, channels, sigma, epsilon, flags, sizeof(void*));
             if (!param.Valid())
                 return NULL;
+            if (param.IsRecursive())
+                return new GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
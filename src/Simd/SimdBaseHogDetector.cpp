@@ -0,0 +1,276 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdHogDetector.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <algorithm>
+
+namespace Simd
+{
+    HogDetectorParam::HogDetectorParam(size_t w, size_t h, size_t wx, size_t wy, float b, float sf, size_t lm, size_t a)
+        : width(w)
+        , height(h)
+        , windowX(wx)
+        , windowY(wy)
+        , bias(b)
+        , scaleFactor(sf)
+        , levelsMax(lm)
+        , align(a)
+    {
+    }
+
+    bool HogDetectorParam::Valid() const
+    {
+        return
+            windowX > 0 && windowY > 0 &&
+            width / HOG_CELL >= Max<size_t>(windowX, 3) &&
+            height / HOG_CELL >= Max<size_t>(windowY, 2) &&
+            (scaleFactor > 1.0f || levelsMax == 1) &&
+            align > 0;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    SIMD_INLINE bool HogDetectionGreater(const SimdHogDetection& a, const SimdHogDetection& b)
+    {
+        if (a.score != b.score)
+            return a.score > b.score;
+        if (a.level != b.level)
+            return a.level < b.level;
+        return a.y < b.y || (a.y == b.y && a.x < b.x);
+    }
+
+    SIMD_INLINE float HogDetectionOverlap(const SimdHogDetection& a, const SimdHogDetection& b)
+    {
+        size_t left = Max(a.x, b.x), right = Min(a.x + a.width, b.x + b.width);
+        size_t top = Max(a.y, b.y), bottom = Min(a.y + a.height, b.y + b.height);
+        if (left >= right || top >= bottom)
+            return 0.0f;
+        float intersection = float((right - left) * (bottom - top));
+        return intersection / (float(a.width * a.height + b.width * b.height) - intersection);
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    HogDetector::HogDetector(const HogDetectorParam& param, const float* weights)
+        : _param(param)
+        , _extract(NULL)
+        , _score(NULL)
+        , _resizerInit(NULL)
+    {
+        const HogDetectorParam& p = _param;
+        size_t rowSize = p.windowX * HOG_FEATURES;
+        _size = AlignHi(rowSize, p.align);
+        _weights.Resize(_size * p.windowY, true);
+        for (size_t y = 0; y < p.windowY; ++y)
+            memcpy(_weights.data + y * _size, weights + y * rowSize, rowSize * sizeof(float));
+
+        size_t image = 0, features = 0, scores = 0;
+        float scale = 1.0f;
+        for (size_t i = 0; p.levelsMax == 0 || i < p.levelsMax; ++i, scale *= p.scaleFactor)
+        {
+            Level level;
+            level.width = i ? Round(p.width / scale) : p.width;
+            level.height = i ? Round(p.height / scale) : p.height;
+            level.cellsX = level.width / HOG_CELL;
+            level.cellsY = level.height / HOG_CELL;
+            if (level.cellsX < Max<size_t>(p.windowX, 3) || level.cellsY < Max<size_t>(p.windowY, 2))
+                break;
+            level.scaleX = float(p.width) / float(level.width);
+            level.scaleY = float(p.height) / float(level.height);
+            level.image = image;
+            level.features = features;
+            level.scores = scores;
+            level.resizer = NULL;
+            if (i)
+                image += level.width * level.height;
+            features += AlignHi(level.cellsX * level.cellsY * HOG_FEATURES, p.align) + p.align;
+            scores += (level.cellsX - p.windowX + 1) * (level.cellsY - p.windowY + 1);
+            _levels.push_back(level);
+        }
+        _images.Resize(image);
+        _features.Resize(features, true);
+        _scores.Resize(scores);
+        _found.resize(_levels.size());
+
+        _gridCell = Min(p.windowX, p.windowY) * HOG_CELL;
+        _gridX = DivHi(p.width, _gridCell);
+        _gridY = DivHi(p.height, _gridCell);
+        _grid.resize(_gridX * _gridY);
+
+        _threads = Base::GetThreadNumber();
+        _groups.resize(Min(_threads, _levels.size()));
+        std::vector<size_t> loads(_groups.size(), 0);
+        for (size_t i = 0; i < _levels.size(); ++i)
+        {
+            const Level& level = _levels[i];
+            size_t g = std::min_element(loads.begin(), loads.end()) - loads.begin();
+            _groups[g].push_back(i);
+            loads[g] += level.width * level.height + (level.cellsX - p.windowX + 1) * (level.cellsY - p.windowY + 1) * _size * p.windowY;
+        }
+    }
+
+    HogDetector::~HogDetector()
+    {
+        for (size_t i = 0; i < _levels.size(); ++i)
+            if (_levels[i].resizer)
+                delete (Deletable*)_levels[i].resizer;
+    }
+
+    void HogDetector::RunLevel(const uint8_t* src, size_t stride, size_t index, float threshold)
+    {
+        const HogDetectorParam& p = _param;
+        Level& level = _levels[index];
+        if (index)
+        {
+            if (level.resizer == NULL)
+                level.resizer = _resizerInit(p.width, p.height, level.width, level.height, 1, SimdResizeChannelByte, SimdResizeMethodBilinear);
+            uint8_t* image = _images.data + level.image;
+            ((Resizer*)level.resizer)->Run(src, stride, image, level.width);
+            src = image;
+            stride = level.width;
+        }
+        float* features = _features.data + level.features;
+        _extract(src, stride, level.cellsX * HOG_CELL, level.cellsY * HOG_CELL, features);
+
+        size_t featuresStride = level.cellsX * HOG_FEATURES;
+        size_t width = level.cellsX - p.windowX + 1, height = level.cellsY - p.windowY + 1;
+        float cellX = level.scaleX * HOG_CELL, cellY = level.scaleY * HOG_CELL;
+        SimdHogDetection detection;
+        detection.width = Round(p.windowX * cellX);
+        detection.height = Round(p.windowY * cellY);
+        detection.level = index;
+        Detections& found = _found[index];
+        found.clear();
+        float* scores = _scores.data + level.scores;
+        for (size_t y = 0; y < height; ++y, scores += width)
+        {
+            _score(features + y * featuresStride, featuresStride, width, _weights.data, _size, p.windowY, p.bias, scores);
+            for (size_t x = 0; x < width; ++x)
+            {
+                if (scores[x] >= threshold)
+                {
+                    detection.x = Round(x * cellX);
+                    detection.y = Round(y * cellY);
+                    detection.score = scores[x];
+                    found.push_back(detection);
+                }
+            }
+        }
+    }
+
+    size_t HogDetector::Run(const uint8_t* src, size_t stride, float threshold, float overlap, SimdHogDetection* detections, size_t capacity)
+    {
+        Simd::Parallel(0, _groups.size(), [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t g = begin; g < end; ++g)
+                for (size_t i = 0; i < _groups[g].size(); ++i)
+                    RunLevel(src, stride, _groups[g][i], threshold);
+        }, _groups.size(), 1);
+
+        _all.clear();
+        for (size_t i = 0; i < _found.size(); ++i)
+            _all.insert(_all.end(), _found[i].begin(), _found[i].end());
+        std::sort(_all.begin(), _all.end(), HogDetectionGreater);
+
+        size_t count = _all.size();
+        if (overlap < 1.0f)
+        {
+            for (size_t i = 0; i < _grid.size(); ++i)
+                _grid[i].clear();
+            count = 0;
+            for (size_t i = 0; i < _all.size(); ++i)
+            {
+                const SimdHogDetection& d = _all[i];
+                size_t x0 = Min(d.x / _gridCell, _gridX - 1), x1 = Min((d.x + d.width - 1) / _gridCell, _gridX - 1);
+                size_t y0 = Min(d.y / _gridCell, _gridY - 1), y1 = Min((d.y + d.height - 1) / _gridCell, _gridY - 1);
+                bool keep = true;
+                for (size_t y = y0; y <= y1 && keep; ++y)
+                {
+                    for (size_t x = x0; x <= x1 && keep; ++x)
+                    {
+                        const Indices& kept = _grid[y * _gridX + x];
+                        for (size_t k = 0; k < kept.size() && keep; ++k)
+                            keep = HogDetectionOverlap(d, _all[kept[k]]) <= overlap;
+                    }
+                }
+                if (keep)
+                {
+                    _all[count] = d;
+                    for (size_t y = y0; y <= y1; ++y)
+                        for (size_t x = x0; x <= x1; ++x)
+                            _grid[y * _gridX + x].push_back(count);
+                    count++;
+                }
+            }
+        }
+        for (size_t i = 0, n = Min(count, capacity); i < n; ++i)
+            detections[i] = _all[i];
+        return count;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        void HogDetectorScore(const float* features, size_t stride, size_t width, const float* weights, size_t size, size_t rows, float bias, float* dst)
+        {
+            for (size_t x = 0; x < width; ++x, features += HOG_FEATURES)
+            {
+                float sum = bias;
+                for (size_t y = 0; y < rows; ++y)
+                {
+                    const float* f = features + y * stride;
+                    const float* w = weights + y * size;
+                    for (size_t i = 0; i < size; ++i)
+                        sum += f[i] * w[i];
+                }
+                dst[x] = sum;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        HogDetector::HogDetector(const HogDetectorParam& param, const float* weights)
+            : Simd::HogDetector(param, weights)
+        {
+            _extract = Base::HogExtractFeatures;
+            _score = Base::HogDetectorScore;
+            _resizerInit = Base::ResizerInit;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* HogDetectorInit(size_t width, size_t height, const float* weights, size_t windowX, size_t windowY, float bias, float scaleFactor, size_t levelsMax)
+        {
+            HogDetectorParam param(width, height, windowX, windowY, bias, scaleFactor, levelsMax, 1);
+            if (!param.Valid())
+                return NULL;
+            return new HogDetector(param, weights);
+        }
+    }
+}
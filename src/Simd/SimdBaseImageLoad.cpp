@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageQoi.h"
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
@@ -90,6 +91,14 @@ namespace Simd
             if (data[0] == 'B' && data[1] == 'M')
                 file = SimdImageFileBmp;
         }
+        if (size >= 4)
+        {
+            if (QoiSignature(data))
+                file = SimdImageFileQoi;
+        }
+        if (format == SimdPixelFormatGray16 || format == SimdPixelFormatBgr48 || format == SimdPixelFormatBgra64 || 
+            format == SimdPixelFormatRgb48 || format == SimdPixelFormatRgba64)
+            return file == SimdImageFilePgmBin || file == SimdImageFilePpmBin || file == SimdImageFilePng;
         return
             file != SimdImageFileUndefined && 
                 (format == SimdPixelFormatNone || format == SimdPixelFormatGray8 || 
@@ -112,6 +121,7 @@ namespace Simd
             case SimdImageFilePng: return new ImagePngLoader(param);
             case SimdImageFileJpeg: return new ImageJpegLoader(param);
             case SimdImageFileBmp: return new ImageBmpLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
             default:
                 return NULL;
             }
@@ -29,6 +29,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdBe16u.h"
 
 namespace Simd
 {
@@ -789,6 +790,7 @@ namespace Simd
         ImagePngLoader::ImagePngLoader(const ImageLoaderParam& param)
             : ImageLoader(param)
             , _converter(NULL)
+            , _be16uToAny(Base::Be16uToAny)
         {
             if (_param.format == SimdPixelFormatNone)
                 _param.format = SimdPixelFormatRgba32;
@@ -833,7 +835,12 @@ namespace Simd
 
             if (_hasTrans) 
             {
-                if (_depth == 16)
+                if (_depth == 16 && Channels16u(_param.format))
+                {
+                    uint16_t tc16[3] = { SwapBytes16u(_tc16[0]), SwapBytes16u(_tc16[1]), SwapBytes16u(_tc16[2]) };
+                    ComputeTransparency((uint16_t*)_buffer.data, _width * _height, _outN, tc16);
+                }
+                else if (_depth == 16)
                     ComputeTransparency((uint16_t*)_buffer.data, _width * _height, _outN, _tc16);
                 else
                     ComputeTransparency(_buffer.data, _width * _height, _outN, _tc);
@@ -898,7 +905,7 @@ namespace Simd
                     return false;
             }
             int reqN = 4;
-            if (Image::ChannelCount((Image::Format)_param.format) == _channels && _depth != 16)
+            if (Image::ChannelCount((Image::Format)_param.format) == _channels && (_depth != 16 || Channels16u(_param.format)))
                 reqN = _channels;
             else
                 reqN = 4;
@@ -1219,7 +1226,7 @@ namespace Simd
                     }
                 }
             }
-            else if (_depth == 16)
+            else if (_depth == 16 && !Channels16u(_param.format))
             {
                 uint8_t* cur = _buffer.data;
                 uint16_t* cur16 = (uint16_t*)cur;
@@ -1243,8 +1250,22 @@ namespace Simd
         void ImagePngLoader::ConvertImage()
         {
             SIMD_PERF_FUNC();
-            SetConverter();
             _image.Recreate(_width, _height, (Image::Format)_param.format);
+            if (Channels16u(_param.format))
+            {
+                if (_depth != 16)
+                {
+                    size_t size = _width * _height * _outN;
+                    Array8u buf(size * 2);
+                    uint16_t* dst = (uint16_t*)buf.data;
+                    for (size_t i = 0; i < size; ++i)
+                        dst[i] = uint16_t(_buffer.data[i] * 0x101);
+                    _buffer.Swap(buf);
+                }
+                _be16uToAny(_buffer.data, _width * _outN * 2, _width, _height, _outN, _image.data, _image.stride, _param.format);
+                return;
+            }
+            SetConverter();
             _converter(_buffer.data, _width, _height, _width * _outN, _image.data, _image.stride);
         }
     }
@@ -25,6 +25,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdBe16u.h"
 
 namespace Simd
 {
@@ -34,6 +35,9 @@ namespace Simd
             : ImageLoader(param)
             , _toAny(NULL)
             , _toBgra(NULL)
+            , _be16uToAny(Base::Be16uToAny)
+            , _depth(8)
+            , _max(255)
         {
         }
 
@@ -48,37 +52,94 @@ namespace Simd
             uint32_t width, height, max;
             if (!(_stream.ReadUnsigned(width) && _stream.ReadUnsigned(height) && _stream.ReadUnsigned(max)))
                 return false;
-            if (!(width > 0 && height > 0 && max == 255))
+            if (!(width > 0 && height > 0 && (max == 255 || (max > 255 && max <= 0xFFFF && (version == 5 || version == 6)))))
                 return false;
             uint8_t byte;
             if (!(_stream.Read(byte) && byte == '\n'))
                 return false;
+            _max = max;
+            _depth = max > 255 ? 16 : 8;
             _image.Recreate(width, height, (Image::Format)_param.format);
             _block = height;
+            SimdPixelFormatType native;
             if (_param.file == SimdImageFilePgmTxt || _param.file == SimdImageFilePgmBin)
             {
                 _size = width * 1;
-                if (_param.format != SimdPixelFormatGray8)
-                {
-                    _block = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / _size, 1, height);
-                    _buffer.Resize(_block * _size);
-                }
+                native = SimdPixelFormatGray8;
             }
             else if (_param.file == SimdImageFilePpmTxt || _param.file == SimdImageFilePpmBin)
             {
                 _size = width * 3;
-                if (_param.format != SimdPixelFormatRgb24)
-                {
-                    _block = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / _size, 1, height);
-                    _buffer.Resize(_block * _size);
-                }
+                native = SimdPixelFormatRgb24;
             }
             else
                 return false;
+            if (_depth == 16 || Channels16u(_param.format))
+            {
+                _block = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / _size / 2, 1, height);
+                _buffer.Resize(_block * _size * 2);
+            }
+            else if (_param.format != native)
+            {
+                _block = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / _size, 1, height);
+                _buffer.Resize(_block * _size);
+            }
             SetConverters();
             return true;
         }
 
+        bool ImagePxmLoader::FromStream16()
+        {
+            size_t channels = _size / _image.width;
+            for (size_t row = 0; row < _image.height;)
+            {
+                size_t block = Simd::Min(row + _block, _image.height) - row, size = _size * block;
+                if (_depth == 16)
+                {
+                    if (_stream.Read(size * 2, _buffer.data) != size * 2)
+                        return false;
+                    if (Channels16u(_param.format) && _max != 0xFFFF)
+                    {
+                        uint32_t max = (uint32_t)_max;
+                        for (size_t i = 0; i < size; ++i)
+                        {
+                            uint32_t value = Simd::Min<uint32_t>((_buffer.data[2 * i] << 8) | _buffer.data[2 * i + 1], max);
+                            value = (value * 0xFFFF + max / 2) / max;
+                            _buffer.data[2 * i + 0] = uint8_t(value >> 8);
+                            _buffer.data[2 * i + 1] = uint8_t(value);
+                        }
+                    }
+                }
+                else
+                {
+                    uint8_t* src = _buffer.data + size;
+                    if (_stream.Read(size, src) != size)
+                        return false;
+                    uint16_t* dst = (uint16_t*)_buffer.data;
+                    for (size_t i = 0; i < size; ++i)
+                        dst[i] = uint16_t(src[i] * 0x101);
+                }
+                if (Channels16u(_param.format))
+                    _be16uToAny(_buffer.data, _size * 2, _image.width, block, channels, _image.Row<uint8_t>(row), _image.stride, _param.format);
+                else
+                {
+                    for (size_t i = 0; i < size; ++i)
+                    {
+                        int value = Simd::Min<int>((_buffer.data[2 * i] << 8) | _buffer.data[2 * i + 1], (int)_max);
+                        _buffer.data[i] = uint8_t((value * 255 + (int)_max / 2) / (int)_max);
+                    }
+                    if (_toAny)
+                        _toAny(_buffer.data, _image.width, block, _size, _image.Row<uint8_t>(row), _image.stride);
+                    else if (_toBgra)
+                        _toBgra(_buffer.data, _image.width, block, _size, _image.Row<uint8_t>(row), _image.stride, 0xFF);
+                    else
+                        Base::Copy(_buffer.data, _size, _image.width, block, channels, _image.Row<uint8_t>(row), _image.stride);
+                }
+                row += block;
+            }
+            return true;
+        }
+
         //-------------------------------------------------------------------------------------------------
 
         ImagePgmTxtLoader::ImagePgmTxtLoader(const ImageLoaderParam& param)
@@ -140,6 +201,8 @@ namespace Simd
         {
             if (!ReadHeader(5))
                 return false;
+            if (_depth == 16 || Channels16u(_param.format))
+                return FromStream16();
             size_t grayStride = _param.format == SimdPixelFormatGray8 ? _image.stride : _size;
             for (size_t row = 0; row < _image.height;)
             {
@@ -233,6 +296,8 @@ namespace Simd
         {
             if (!ReadHeader(6))
                 return false;
+            if (_depth == 16 || Channels16u(_param.format))
+                return FromStream16();
             size_t rgbStride = _param.format == SimdPixelFormatRgb24 ? _image.stride : _size;
             for (size_t row = 0; row < _image.height;)
             {
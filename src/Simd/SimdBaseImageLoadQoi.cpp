@@ -0,0 +1,140 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const uint8_t* QoiDecode(const uint8_t* src, const uint8_t* end, size_t size, QoiState& state, uint8_t* rgba)
+        {
+            uint32_t px = state.prev;
+            uint32_t* dst = (uint32_t*)rgba;
+            for (size_t i = 0; i < size; ++i)
+            {
+                if (state.run)
+                    state.run--;
+                else if (src < end)
+                {
+                    int op = *src++;
+                    if (op == QoiOpRgb)
+                    {
+                        px = (px & 0xFF000000) | src[0] | (src[1] << 8) | (src[2] << 16);
+                        src += 3;
+                    }
+                    else if (op == QoiOpRgba)
+                    {
+                        px = *(uint32_t*)src;
+                        src += 4;
+                    }
+                    else if ((op & QoiMask2) == QoiOpIndex)
+                        px = state.index[op];
+                    else if ((op & QoiMask2) == QoiOpDiff)
+                    {
+                        uint32_t r = (px + ((op >> 4) & 3) - 2) & 0xFF;
+                        uint32_t g = ((px >> 8) + ((op >> 2) & 3) - 2) & 0xFF;
+                        uint32_t b = ((px >> 16) + (op & 3) - 2) & 0xFF;
+                        px = (px & 0xFF000000) | r | (g << 8) | (b << 16);
+                    }
+                    else if ((op & QoiMask2) == QoiOpLuma)
+                    {
+                        int next = *src++;
+                        int vg = (op & 0x3F) - 32;
+                        uint32_t r = (px + vg - 8 + ((next >> 4) & 0x0F)) & 0xFF;
+                        uint32_t g = ((px >> 8) + vg) & 0xFF;
+                        uint32_t b = ((px >> 16) + vg - 8 + (next & 0x0F)) & 0xFF;
+                        px = (px & 0xFF000000) | r | (g << 8) | (b << 16);
+                    }
+                    else
+                        state.run = op & 0x3F;
+                    state.index[QoiHash(px)] = px;
+                }
+                dst[i] = px;
+            }
+            state.prev = px;
+            return src;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : ImageLoader(param)
+            , _toAny(NULL)
+        {
+        }
+
+        bool ImageQoiLoader::FromStream()
+        {
+            if (_stream.Size() < QoiHeaderSize + QoiPaddingSize || !QoiSignature(_stream.Data()))
+                return false;
+            _stream.Seek(4);
+            uint32_t width, height;
+            uint8_t channels, colorspace;
+            if (!(_stream.ReadBe32u(width) && _stream.ReadBe32u(height) && _stream.Read8u(channels) && _stream.Read8u(colorspace)))
+                return false;
+            if (width == 0 || height == 0 || (channels != 3 && channels != 4) || colorspace > 1 || height >= QoiPixelsMax / width)
+                return false;
+            if (_param.format == SimdPixelFormatNone)
+                _param.format = channels == 4 ? SimdPixelFormatRgba32 : SimdPixelFormatRgb24;
+            _image.Recreate(width, height, (Image::Format)_param.format);
+            SetConverters();
+            size_t size = width * 4;
+            _block = _toAny ? Simd::RestrictRange<size_t>(Base::AlgCacheL1() / size, 1, height) : 1;
+            if (_toAny)
+                _buffer.Resize(_block * size);
+            const uint8_t* src = _stream.Current(), * end = _stream.Data() + _stream.Size() - QoiPaddingSize;
+            QoiState state;
+            for (size_t row = 0; row < height;)
+            {
+                size_t block = Simd::Min<size_t>(row + _block, height) - row;
+                if (_toAny)
+                {
+                    for (size_t b = 0; b < block; ++b)
+                        src = QoiDecode(src, end, width, state, _buffer.data + b * size);
+                    _toAny(_buffer.data, width, block, size, _image.Row<uint8_t>(row), _image.stride);
+                }
+                else
+                    src = QoiDecode(src, end, width, state, _image.Row<uint8_t>(row));
+                row += block;
+            }
+            return true;
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            switch (_param.format)
+            {
+            case SimdPixelFormatGray8: _toAny = Base::RgbaToGray; break;
+            case SimdPixelFormatBgr24: _toAny = Base::BgraToRgb; break;
+            case SimdPixelFormatBgra32: _toAny = Base::BgraToRgba; break;
+            case SimdPixelFormatRgb24: _toAny = Base::BgraToBgr; break;
+            default: break;
+            }
+        }
+    }
+}
@@ -73,6 +73,8 @@ namespace Simd
                 }
                 else if (ext == "bmp")
                     file = SimdImageFileBmp;
+                else if (ext == "qoi")
+                    file = SimdImageFileQoi;
             }
         }
         size_t size;
@@ -106,6 +108,7 @@ namespace Simd
             case SimdImageFilePng:    return new ImagePngSaver(param);
             case SimdImageFileJpeg:   return new ImageJpegSaver(param);
             case SimdImageFileBmp:   return new ImageBmpSaver(param);
+            case SimdImageFileQoi:   return new ImageQoiSaver(param);
             default:
                 return NULL;
             }
@@ -25,6 +25,7 @@
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdImageSavePng.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdBe16u.h"
 #include "Simd/SimdCpu.h"
 
 namespace Simd
@@ -270,7 +271,9 @@ namespace Simd
             : ImageSaver(param)
             , _channels(0)
             , _size(0)
+            , _depth(8)
             , _convert(NULL)
+            , _anyToBe16u(Base::AnyToBe16u)
         {
             switch (_param.format)
             {
@@ -290,10 +293,14 @@ namespace Simd
                 _channels = 4;
                 break;
             default: 
+                _channels = Channels16u(_param.format);
+                _depth = 16;
                 break;
             }
-            _size = _param.width * _channels;
-            if (_param.format == SimdPixelFormatBgr24)
+            _size = _param.width * _channels * _depth / 8;
+            if (_depth == 16)
+                _buff.Resize(_param.height * _size);
+            else if (_param.format == SimdPixelFormatBgr24)
             {
                 _convert = Base::BgrToRgb;
                 _buff.Resize(_param.height * _size);
@@ -317,12 +324,19 @@ namespace Simd
 
         bool ImagePngSaver::ToStream(const uint8_t* src, size_t stride)
         {
-            if (_convert)
+            if (_depth == 16)
+            {
+                _anyToBe16u(src, stride, _param.width, _param.height, _param.format, _buff.data, _size, _channels);
+                src = _buff.data;
+                stride = _size;
+            }
+            else if (_convert)
             {
                 _convert(src, _param.width, _param.height, stride, _buff.data, _size);
                 src = _buff.data;
                 stride = _size;
             }
+            size_t bpp = _channels * _depth / 8;
             for (size_t row = 0; row < _param.height; ++row)
             {
                 int bestFilter = 0, bestSum = INT_MAX;
@@ -330,7 +344,7 @@ namespace Simd
                 {
                     static const int TYPES[] = { 0, 1, 0, 5, 6, 0, 1, 2, 3, 4 };
                     int type = TYPES[filter + (row ? 1 : 0) * FILTERS];
-                    int sum = _encode[type](src + stride * row, stride, _channels, _size, _line.data + _size * filter);
+                    int sum = _encode[type](src + stride * row, stride, bpp, _size, _line.data + _size * filter);
                     if (sum < bestSum)
                     {
                         bestSum = sum;
@@ -361,7 +375,7 @@ namespace Simd
             _stream.Write("IHDR", 4);
             _stream.WriteBe32u((uint32_t)_param.width);
             _stream.WriteBe32u((uint32_t)_param.height);
-            _stream.Write8u(8);
+            _stream.Write8u((uint8_t)_depth);
             _stream.Write8u(CTYPE[_channels]);
             _stream.Write8u(0);
             _stream.Write8u(0);
@@ -25,6 +25,7 @@
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdBe16u.h"
 
 namespace Simd
 { 
@@ -33,9 +34,17 @@ namespace Simd
         ImagePxmSaver::ImagePxmSaver(const ImageSaverParam& param)
             : ImageSaver(param)
             , _convert(NULL)
+            , _anyToBe16u(Base::AnyToBe16u)
+            , _depth(Channels16u(param.format) ? 16 : 8)
         {
             _block = _param.height;
-            if (_param.file == SimdImageFilePgmTxt || _param.file == SimdImageFilePgmBin)
+            if (_depth == 16)
+            {
+                _size = _param.width * (_param.file == SimdImageFilePgmBin ? 1 : 3) * 2;
+                _block = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / _size, 1, _param.height);
+                _buffer.Resize(_block * _size);
+            }
+            else if (_param.file == SimdImageFilePgmTxt || _param.file == SimdImageFilePgmBin)
             {
                 _size = _param.width * 1;
                 if (_param.format != SimdPixelFormatGray8)
@@ -60,10 +69,24 @@ namespace Simd
         void ImagePxmSaver::WriteHeader(size_t version)
         {
             std::stringstream header;
-            header << "P" << version << "\n" << _param.width << " " << _param.height << "\n255\n";
+            header << "P" << version << "\n" << _param.width << " " << _param.height << "\n" << (_depth == 16 ? 65535 : 255) << "\n";
             _stream.Write(header.str().c_str(), header.str().size());
         }
 
+        bool ImagePxmSaver::WriteBody16(const uint8_t* src, size_t stride)
+        {
+            size_t channels = _param.file == SimdImageFilePgmBin ? 1 : 3;
+            for (size_t row = 0; row < _param.height;)
+            {
+                size_t block = Simd::Min(row + _block, _param.height) - row;
+                _anyToBe16u(src, stride, _param.width, block, _param.format, _buffer.data, _size, channels);
+                _stream.Write(_buffer.data, _size * block);
+                src += stride * block;
+                row += block;
+            }
+            return true;
+        }
+
         uint8_t g_pxmPrint[256][4];
         bool PxmPrintInit()
         {
@@ -152,6 +175,8 @@ namespace Simd
             size_t grayStride = _param.format == SimdPixelFormatGray8 ? stride : _size;
             _stream.Reserve(32 + _param.height * _size);
             WriteHeader(5);
+            if (_depth == 16)
+                return WriteBody16(src, stride);
             for (size_t row = 0; row < _param.height;)
             {
                 size_t block = Simd::Min(row + _block, _param.height) - row;
@@ -250,6 +275,8 @@ namespace Simd
             size_t rgbStride = _param.format == SimdPixelFormatRgb24 ? stride : _size;
             _stream.Reserve(32 + _param.height * _size);
             WriteHeader(6);
+            if (_depth == 16)
+                return WriteBody16(src, stride);
             for (size_t row = 0; row < _param.height;)
             {
                 size_t block = Simd::Min(row + _block, _param.height) - row;
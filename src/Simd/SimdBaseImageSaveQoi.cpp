@@ -0,0 +1,114 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{ 
+    namespace Base
+    {
+        uint8_t* QoiEncode(const uint8_t* rgba, size_t size, QoiState& state, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i, rgba += 4)
+            {
+                uint32_t px = *(uint32_t*)rgba;
+                if (px == state.prev)
+                {
+                    if (++state.run == QoiRunMax)
+                        dst = QoiEncodeRun(state, dst);
+                }
+                else
+                    dst = QoiEncodePixel(px, QoiHash(px), state, dst);
+            }
+            return dst;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : ImageSaver(param)
+            , _convert(NULL)
+            , _toBgra(NULL)
+            , _encode(Base::QoiEncode)
+        {
+            switch (_param.format)
+            {
+            case SimdPixelFormatGray8: _toBgra = Base::GrayToBgra; _channels = 3; break;
+            case SimdPixelFormatBgr24: _toBgra = Base::RgbToBgra; _channels = 3; break;
+            case SimdPixelFormatBgra32: _convert = Base::BgraToRgba; _channels = 4; break;
+            case SimdPixelFormatRgb24: _toBgra = Base::BgrToBgra; _channels = 3; break;
+            case SimdPixelFormatRgba32: _channels = 4; break;
+            default: _channels = 0; break;
+            }
+            _size = _param.width * 4;
+            _block = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / _size, 1, _param.height);
+            if (_param.format != SimdPixelFormatRgba32)
+                _buffer.Resize(_block * _size);
+        }
+
+        bool ImageQoiSaver::ToStream(const uint8_t* src, size_t stride)
+        {
+            size_t rowMax = _param.width * (_channels + 1) + 1;
+            _stream.Reserve(QoiHeaderSize + _param.height * _size / 2 + QoiPaddingSize);
+            _stream.Write("qoif", 4);
+            _stream.WriteBe32u((uint32_t)_param.width);
+            _stream.WriteBe32u((uint32_t)_param.height);
+            _stream.Write8u((uint8_t)_channels);
+            _stream.Write8u(0);
+            QoiState state;
+            for (size_t row = 0; row < _param.height;)
+            {
+                size_t block = Simd::Min(row + _block, _param.height) - row;
+                const uint8_t* rgba = src;
+                size_t rgbaStride = stride;
+                if (_convert || _toBgra)
+                {
+                    if (_convert)
+                        _convert(src, _param.width, block, stride, _buffer.data, _size);
+                    else
+                        _toBgra(src, _param.width, block, stride, _buffer.data, _size, 0xFF);
+                    rgba = _buffer.data;
+                    rgbaStride = _size;
+                }
+                for (size_t b = 0; b < block; ++b)
+                {
+                    _stream.Reserve(_stream.Pos() + rowMax);
+                    uint8_t* dst = _stream.Current();
+                    _stream.Seek(_stream.Pos() + (_encode(rgba, _param.width, state, dst) - dst));
+                    rgba += rgbaStride;
+                }
+                src += stride * block;
+                row += block;
+            }
+            if (state.run)
+                _stream.Write8u(QoiOpRun | uint8_t(state.run - 1));
+            const uint8_t padding[QoiPaddingSize] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+            _stream.Write(padding, QoiPaddingSize);
+            return true;
+        }
+    }
+}
@@ -22,66 +22,168 @@
 * SOFTWARE.
 */
 #include "Simd/SimdIntegral.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
     namespace Base
     {
-        void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-            uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
-            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+        template<class T, bool square> void IntegralRow(const uint8_t* src, size_t width, const uint8_t* prev, uint8_t* dst)
         {
-            assert(sumFormat == SimdPixelFormatInt32 && sumStride % sizeof(uint32_t) == 0);
-            if (tilted)
-                assert(tiltedStride % sizeof(uint32_t) == 0);
+            const T* p = (const T*)prev;
+            T* d = (T*)dst;
+            uint64_t rowSum = 0;
+            d[0] = 0;
+            for (size_t col = 0; col < width; ++col)
+            {
+                uint32_t value = src[col];
+                rowSum += square ? value * value : value;
+                d[col + 1] = p[col + 1] + T(rowSum);
+            }
+        }
 
-            if (sqsum)
+        IntegralRowPtr GetIntegralRow(SimdPixelFormatType format, bool square)
+        {
+            switch (format)
             {
-                if (tilted)
+            case SimdPixelFormatInt32: return square ? IntegralRow<uint32_t, true> : IntegralRow<uint32_t, false>;
+            case SimdPixelFormatInt64: return square ? IntegralRow<uint64_t, true> : IntegralRow<uint64_t, false>;
+            case SimdPixelFormatFloat: return square ? IntegralRow<float, true> : IntegralRow<float, false>;
+            case SimdPixelFormatDouble: return square ? IntegralRow<double, true> : IntegralRow<double, false>;
+            default: assert(0); return NULL;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const size_t INTEGRAL_BAND = 64;
+
+        SIMD_INLINE size_t IntegralBand(size_t height, SimdPixelFormatType sumFormat, size_t threads)
+        {
+            if (sumFormat == SimdPixelFormatFloat)
+                return INTEGRAL_BAND;
+            return Simd::Max<size_t>(AlignHi(DivHi(height, threads), INTEGRAL_BAND), INTEGRAL_BAND);
+        }
+
+        template<bool square> void IntegralBandTotal(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint32_t* buf, uint64_t* dst)
+        {
+            memset(buf, 0, width * sizeof(uint32_t));
+            for (size_t row = 0; row < height; ++row, src += srcStride)
+            {
+                for (size_t col = 0; col < width; ++col)
                 {
-                    switch (sqsumFormat)
-                    {
-                    case SimdPixelFormatInt32:
-                        IntegralSumSqsumTilted<uint32_t, uint32_t>(src, srcStride, width, height,
-                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
-                        break;
-                    case SimdPixelFormatDouble:
-                        IntegralSumSqsumTilted<uint32_t, double>(src, srcStride, width, height,
-                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
-                        break;
-                    default:
-                        assert(0);
-                    }
+                    uint32_t value = src[col];
+                    buf[col] += square ? value * value : value;
+                }
+            }
+            uint64_t sum = 0;
+            dst[0] = 0;
+            for (size_t col = 0; col < width; ++col)
+            {
+                sum += buf[col];
+                dst[col + 1] = sum;
+            }
+        }
+
+        static void IntegralConvert(const uint64_t* src, size_t size, SimdPixelFormatType format, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                switch (format)
+                {
+                case SimdPixelFormatInt32: ((uint32_t*)dst)[i] = (uint32_t)src[i]; break;
+                case SimdPixelFormatInt64: ((uint64_t*)dst)[i] = src[i]; break;
+                case SimdPixelFormatFloat: ((float*)dst)[i] = (float)src[i]; break;
+                case SimdPixelFormatDouble: ((double*)dst)[i] = (double)src[i]; break;
+                default: assert(0);
                 }
-                else
+            }
+        }
+
+        void IntegralParallel(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* sum, size_t sumStride, uint8_t* sqsum, size_t sqsumStride,
+            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat, IntegralRowPtr sumRow, IntegralRowPtr sqsumRow)
+        {
+            size_t size = width + 1, threads = Base::GetThreadNumber();
+            size_t band = IntegralBand(height, sumFormat, threads), bands = Simd::Max<size_t>(DivHi(height, band), 1);
+            Array64u offset(bands * size * 2);
+            uint64_t* sumOffset = offset.data, * sqsumOffset = sumOffset + bands * size;
+            memset(sumOffset, 0, size * sizeof(uint64_t));
+            memset(sqsumOffset, 0, size * sizeof(uint64_t));
+            if (bands > 1)
+            {
+                Simd::Parallel(0, bands - 1, [&](size_t thread, size_t begin, size_t end)
                 {
-                    switch (sqsumFormat)
+                    Array32u buf(width);
+                    for (size_t b = begin; b < end; ++b)
                     {
-                    case SimdPixelFormatInt32:
-                        IntegralSumSqsum<uint32_t, uint32_t>(src, srcStride, width, height,
-                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t));
-                        break;
-                    case SimdPixelFormatDouble:
-                        IntegralSumSqsum<uint32_t, double>(src, srcStride, width, height,
-                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double));
-                        break;
-                    default:
-                        assert(0);
+                        const uint8_t* s = src + b * band * srcStride;
+                        IntegralBandTotal<false>(s, srcStride, width, band, buf.data, sumOffset + (b + 1) * size);
+                        if (sqsum)
+                            IntegralBandTotal<true>(s, srcStride, width, band, buf.data, sqsumOffset + (b + 1) * size);
                     }
-                }
+                }, threads);
             }
-            else
+            for (size_t b = 1; b < bands; ++b)
             {
-                if (tilted)
+                for (size_t i = 0, o = b * size; i < size; ++i, ++o)
                 {
-                    IntegralSumTilted<uint32_t>(src, srcStride, width, height,
-                        (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
+                    sumOffset[o] += sumOffset[o - size];
+                    sqsumOffset[o] += sqsumOffset[o - size];
                 }
-                else
+            }
+            Simd::Parallel(0, bands, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array64u buf(size * 2);
+                uint8_t* sumPrev = (uint8_t*)buf.data, * sqsumPrev = sumPrev + size * 8;
+                for (size_t b = begin; b < end; ++b)
                 {
-                    IntegralSum<uint32_t>(src, srcStride, width, height, (uint32_t*)sum, sumStride / sizeof(uint32_t));
+                    size_t rowBeg = b * band, rowEnd = Min(rowBeg + band, height);
+                    const uint8_t* sp = sumPrev, * qp = sqsumPrev;
+                    if (b)
+                    {
+                        IntegralConvert(sumOffset + b * size, size, sumFormat, sumPrev);
+                        if (sqsum)
+                            IntegralConvert(sqsumOffset + b * size, size, sqsumFormat, sqsumPrev);
+                    }
+                    else
+                    {
+                        IntegralConvert(sumOffset, size, sumFormat, sum);
+                        sp = sum;
+                        if (sqsum)
+                        {
+                            IntegralConvert(sqsumOffset, size, sqsumFormat, sqsum);
+                            qp = sqsum;
+                        }
+                    }
+                    for (size_t row = rowBeg; row < rowEnd; ++row)
+                    {
+                        uint8_t* sd = sum + (row + 1) * sumStride;
+                        sumRow(src + row * srcStride, width, sp, sd);
+                        sp = sd;
+                        if (sqsum)
+                        {
+                            uint8_t* qd = sqsum + (row + 1) * sqsumStride;
+                            sqsumRow(src + row * srcStride, width, qp, qd);
+                            qp = qd;
+                        }
+                    }
                 }
-            }
+            }, threads);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
+            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+        {
+            if (tilted)
+                IntegralTilted(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+            else
+                IntegralParallel(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, sumFormat, sqsumFormat,
+                    GetIntegralRow(sumFormat, false), sqsum ? GetIntegralRow(sqsumFormat, true) : NULL);
         }
     }
 }
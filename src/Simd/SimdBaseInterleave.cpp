@@ -77,5 +77,48 @@ namespace Simd
                 bgra += bgraStride;
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<class T, size_t C> void Interleave(const uint8_t* const* src, const size_t* srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                T* d = (T*)(dst + row * dstStride);
+                for (size_t c = 0; c < C; ++c)
+                {
+                    const T* s = (const T*)(src[c] + row * srcStride[c]);
+                    for (size_t col = 0, offset = c; col < width; ++col, offset += C)
+                        d[offset] = s[col];
+                }
+            }
+        }
+
+        template<class T> void Interleave(const uint8_t* src0, size_t src0Stride, const uint8_t* src1, size_t src1Stride, const uint8_t* src2, size_t src2Stride,
+            const uint8_t* src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t* dst, size_t dstStride)
+        {
+            const uint8_t* src[4] = { src0, src1, src2, src3 };
+            size_t srcStride[4] = { src0Stride, src1Stride, src2Stride, src3Stride };
+            switch (channels)
+            {
+            case 2: Interleave<T, 2>(src, srcStride, width, height, dst, dstStride); break;
+            case 3: Interleave<T, 3>(src, srcStride, width, height, dst, dstStride); break;
+            case 4: Interleave<T, 4>(src, srcStride, width, height, dst, dstStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Interleave16u(const uint8_t* src0, size_t src0Stride, const uint8_t* src1, size_t src1Stride, const uint8_t* src2, size_t src2Stride,
+            const uint8_t* src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t* dst, size_t dstStride)
+        {
+            Interleave<uint16_t>(src0, src0Stride, src1, src1Stride, src2, src2Stride, src3, src3Stride, width, height, channels, dst, dstStride);
+        }
+
+        void Interleave32f(const uint8_t* src0, size_t src0Stride, const uint8_t* src1, size_t src1Stride, const uint8_t* src2, size_t src2Stride,
+            const uint8_t* src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t* dst, size_t dstStride)
+        {
+            Interleave<float>(src0, src0Stride, src1, src1Stride, src2, src2Stride, src3, src3Stride, width, height, channels, dst, dstStride);
+        }
     }
 }
@@ -22,6 +22,10 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMath.h"
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -390,5 +394,265 @@ namespace Simd
                 }
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void MedianAdd16(const uint16_t* src, uint16_t* dst)
+        {
+            for (size_t i = 0; i < 16; ++i)
+                dst[i] += src[i];
+        }
+
+        SIMD_INLINE void MedianSub16(const uint16_t* src, uint16_t* dst)
+        {
+            for (size_t i = 0; i < 16; ++i)
+                dst[i] -= src[i];
+        }
+
+        SIMD_INLINE void MedianAddSub16(const uint16_t* add, const uint16_t* sub, uint16_t* dst)
+        {
+            for (size_t i = 0; i < 16; ++i)
+                dst[i] += add[i] - sub[i];
+        }
+
+        SIMD_INLINE size_t MedianFind16(const uint16_t* hist, size_t rank, size_t& sum)
+        {
+            size_t i = 0;
+            for (; i < 15 && sum + hist[i] <= rank; ++i)
+                sum += hist[i];
+            return i;
+        }
+
+        void MedianStrip8u(const MedParam& p, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint16_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t width = end - begin, window = 2 * p.radius + 1, size = width + window - 1, rank = p.Rank();
+            uint16_t* fine = buf, * coarse = fine + p.channels * size * 256, * kFine = coarse + p.channels * size * 16, * kCoarse = kFine + 256;
+            memset(buf, 0, p.channels * size * 272 * sizeof(uint16_t));
+            for (size_t dy = 0; dy < window; ++dy)
+                MedianUpdate8u(p, src + MedianRow(p, dy - p.radius) * srcStride, begin, size, fine, coarse, 1);
+            for (size_t y = 0; y < p.height; ++y)
+            {
+                if (y)
+                {
+                    MedianUpdate8u(p, src + MedianRow(p, y - p.radius - 1) * srcStride, begin, size, fine, coarse, -1);
+                    MedianUpdate8u(p, src + MedianRow(p, y + p.radius) * srcStride, begin, size, fine, coarse, 1);
+                }
+                uint8_t* pd = dst + y * dstStride + begin * p.channels;
+                for (size_t c = 0; c < p.channels; ++c)
+                {
+                    const uint16_t* cFine = fine + c * 16 * size * 16, * cCoarse = coarse + c * size * 16;
+                    size_t last[16] = { 0 };
+                    memset(kCoarse, 0, 16 * sizeof(uint16_t));
+                    for (size_t col = 0; col < window - 1; ++col)
+                        MedianAdd16(cCoarse + col * 16, kCoarse);
+                    for (size_t x = 0; x < width; ++x)
+                    {
+                        MedianAdd16(cCoarse + (x + window - 1) * 16, kCoarse);
+                        size_t sum = 0, k = MedianFind16(kCoarse, rank, sum);
+                        const uint16_t* cf = cFine + k * size * 16;
+                        uint16_t* kf = kFine + k * 16;
+                        if (last[k] <= x)
+                        {
+                            memset(kf, 0, 16 * sizeof(uint16_t));
+                            for (last[k] = x; last[k] < x + window; ++last[k])
+                                MedianAdd16(cf + last[k] * 16, kf);
+                        }
+                        else
+                        {
+                            for (; last[k] < x + window; ++last[k])
+                                MedianAddSub16(cf + last[k] * 16, cf + (last[k] - window) * 16, kf);
+                        }
+                        MedianSub16(cCoarse + x * 16, kCoarse);
+                        pd[x * p.channels + c] = uint8_t(k * 16 + MedianFind16(kf, rank, sum));
+                    }
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        class MedianHist16u
+        {
+        public:
+            MedianHist16u(uint16_t* buf)
+                : _fine(buf)
+                , _coarse(buf + 65536)
+                , _median(0)
+                , _less(0)
+            {
+                memset(buf, 0, (65536 + 256) * sizeof(uint16_t));
+            }
+
+            SIMD_INLINE void Update(size_t value, int delta)
+            {
+                _fine[value] += delta;
+                _coarse[value >> 8] += delta;
+                if (value < _median)
+                    _less += delta;
+            }
+
+            SIMD_INLINE uint16_t Median(size_t rank)
+            {
+                while (_less > rank)
+                {
+                    if ((_median & 255) == 0 && _less - _coarse[(_median >> 8) - 1] > rank)
+                    {
+                        _median -= 256;
+                        _less -= _coarse[_median >> 8];
+                    }
+                    else
+                        _less -= _fine[--_median];
+                }
+                while (_less + _fine[_median] <= rank)
+                {
+                    if ((_median & 255) == 0 && _less + _coarse[_median >> 8] <= rank)
+                    {
+                        _less += _coarse[_median >> 8];
+                        _median += 256;
+                    }
+                    else
+                        _less += _fine[_median++];
+                }
+                return uint16_t(_median);
+            }
+
+        private:
+            uint16_t* _fine, * _coarse;
+            size_t _median, _less;
+        };
+
+        SIMD_INLINE size_t MedianValue16u(const MedParam& p, const uint8_t* src, size_t stride, size_t row, size_t col)
+        {
+            return ((uint16_t*)(src + MedianRow(p, row) * stride))[Simd::RestrictRange<ptrdiff_t>(col, 0, p.width - 1) * p.channels];
+        }
+
+        SIMD_INLINE void MedianRow16u(const MedParam& p, const uint8_t* src, size_t stride, size_t row, size_t col, int delta, MedianHist16u& hist)
+        {
+            for (size_t dx = 0, window = 2 * p.radius + 1; dx < window; ++dx)
+                hist.Update(MedianValue16u(p, src, stride, row, col + dx - p.radius), delta);
+        }
+
+        SIMD_INLINE void MedianCol16u(const MedParam& p, const uint8_t* src, size_t stride, size_t row, size_t col, int delta, MedianHist16u& hist)
+        {
+            for (size_t dy = 0, window = 2 * p.radius + 1; dy < window; ++dy)
+                hist.Update(MedianValue16u(p, src, stride, row + dy - p.radius, col), delta);
+        }
+
+        void MedianStrip16u(const MedParam& p, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint16_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t rank = p.Rank(), r = p.radius;
+            for (size_t c = 0; c < p.channels; ++c)
+            {
+                MedianHist16u hist(buf);
+                for (size_t dy = 0; dy < 2 * r + 1; ++dy)
+                    MedianRow16u(p, src + c * 2, srcStride, dy - r, begin, 1, hist);
+                for (size_t y = 0; y < p.height; ++y)
+                {
+                    uint16_t* pd = (uint16_t*)(dst + y * dstStride) + c;
+                    if (y & 1)
+                    {
+                        MedianRow16u(p, src + c * 2, srcStride, y - r - 1, end - 1, -1, hist);
+                        MedianRow16u(p, src + c * 2, srcStride, y + r, end - 1, 1, hist);
+                        for (size_t x = end - 1;; --x)
+                        {
+                            pd[x * p.channels] = hist.Median(rank);
+                            if (x == begin)
+                                break;
+                            MedianCol16u(p, src + c * 2, srcStride, y, x + r, -1, hist);
+                            MedianCol16u(p, src + c * 2, srcStride, y, x - r - 1, 1, hist);
+                        }
+                    }
+                    else
+                    {
+                        if (y)
+                        {
+                            MedianRow16u(p, src + c * 2, srcStride, y - r - 1, begin, -1, hist);
+                            MedianRow16u(p, src + c * 2, srcStride, y + r, begin, 1, hist);
+                        }
+                        for (size_t x = begin;; ++x)
+                        {
+                            pd[x * p.channels] = hist.Median(rank);
+                            if (x == end - 1)
+                                break;
+                            MedianCol16u(p, src + c * 2, srcStride, y, x - r, -1, hist);
+                            MedianCol16u(p, src + c * 2, srcStride, y, x + r + 1, 1, hist);
+                        }
+                    }
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        MedianFilterHist::MedianFilterHist(const MedParam& param)
+            : Simd::MedianFilter(param)
+        {
+            const MedParam& p = _param;
+            _threads = Base::GetThreadNumber();
+            if (p.Is16u())
+            {
+                _strip = DivHi(p.width, _threads);
+                _run = MedianStrip16u;
+            }
+            else
+            {
+                _strip = Max(Base::AlgCacheL2() / (p.channels * 272 * sizeof(uint16_t)), 4 * p.radius) - 2 * p.radius;
+                _strip = Simd::Max<size_t>(Min(_strip, DivHi(p.width, _threads)), 16);
+                _run = MedianStrip8u;
+            }
+            _strip = Min(_strip, p.width);
+            _strips = DivHi(p.width, _strip);
+            _size = p.Is16u() ? 65536 + 256 : (p.channels * (_strip + 2 * p.radius) + 1) * 272;
+            _buffer.Resize(_size * Min(_threads, _strips));
+        }
+
+        void MedianFilterHist::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const MedParam& p = _param;
+            uint16_t* buf = _buffer.data;
+            Simd::Parallel(0, _strips, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t s = begin; s < end; ++s)
+                    _run(p, src, srcStride, s * _strip, Min(s * _strip + _strip, p.width), buf + thread * _size, dst, dstStride);
+            }, _threads, 1);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags)
+        {
+            MedParam param(width, height, channels, radius, flags, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            return new MedianFilterHist(param);
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    MedParam::MedParam(size_t w, size_t h, size_t c, size_t r, SimdMedianFilterFlags f, size_t a)
+        : width(w)
+        , height(h)
+        , channels(c)
+        , radius(r)
+        , flags(f)
+        , align(a)
+    {
+    }
+
+    bool MedParam::Valid() const
+    {
+        return
+            width > 0 &&
+            height > 0 &&
+            channels > 0 && channels <= 4 &&
+            radius > 0 && radius <= 127;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    MedianFilter::MedianFilter(const MedParam& param)
+        : _param(param)
+    {
     }
 }
@@ -0,0 +1,199 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<bool dilate> SIMD_INLINE void MorphologyOp(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = dilate ? Max(a[i], b[i]) : Min(a[i], b[i]);
+        }
+
+        template<bool dilate> void MorphologyVhgw(const uint8_t* src, size_t srcStep, size_t size, size_t count, size_t kernel, uint8_t* buf, uint8_t* dst, size_t dstStep)
+        {
+            uint8_t* g = buf + kernel * size;
+            for (size_t b = 0; b < count; b += kernel)
+            {
+                const uint8_t* s = src + b * srcStep;
+                uint8_t* h = buf + (kernel - 1) * size;
+                memcpy(h, s + (kernel - 1) * srcStep, size);
+                for (size_t j = kernel - 1; j > 0; --j, h -= size)
+                    MorphologyOp<dilate>(h, s + (j - 1) * srcStep, size, h - size);
+                memcpy(dst + b * dstStep, buf, size);
+                size_t end = Min(kernel, count - b);
+                s += kernel * srcStep;
+                if (end > 1)
+                {
+                    memcpy(g, s, size);
+                    MorphologyOp<dilate>(buf + size, g, size, dst + (b + 1) * dstStep);
+                }
+                for (size_t j = 2; j < end; ++j)
+                {
+                    MorphologyOp<dilate>(g, s + (j - 1) * srcStep, size, g);
+                    MorphologyOp<dilate>(buf + j * size, g, size, dst + (b + j) * dstStep);
+                }
+            }
+        }
+
+        void MorphologyHor(const uint8_t* const* src, size_t rows, size_t width, size_t channels, size_t kernel, bool dilate, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t size = width * channels, anchor = kernel / 2, tail = kernel - 1 - anchor;
+            uint8_t* pad = buf, * body = pad + anchor * channels, * tmp = pad + (width + kernel - 1) * channels;
+            for (size_t r = 0; r < rows; ++r, dst += dstStride)
+            {
+                memcpy(body, src[r], size);
+                for (size_t i = 0; i < anchor; ++i)
+                    memcpy(pad + i * channels, body, channels);
+                for (size_t i = 0; i < tail; ++i)
+                    memcpy(body + size + i * channels, body + size - channels, channels);
+                if (dilate)
+                    MorphologyVhgw<true>(pad, channels, channels, width, kernel, tmp, dst, channels);
+                else
+                    MorphologyVhgw<false>(pad, channels, channels, width, kernel, tmp, dst, channels);
+            }
+        }
+
+        void MorphologyVer(const uint8_t* src, size_t srcStride, size_t size, size_t rows, size_t kernel, bool dilate, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            if (dilate)
+                MorphologyVhgw<true>(src, srcStride, size, rows, kernel, buf, dst, dstStride);
+            else
+                MorphologyVhgw<false>(src, srcStride, size, rows, kernel, buf, dst, dstStride);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void MorphologyBasic(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels, size_t kernelX, size_t kernelY,
+            SimdMorphologyShapeType shape, bool dilate, uint8_t* dst, size_t dstStride, MorphologyHorPtr hor, MorphologyVerPtr ver, OperationBinary8uPtr binary, size_t align)
+        {
+            size_t size = width * channels, anchor = kernelY / 2;
+            if (kernelX == 1 && kernelY == 1)
+            {
+                for (size_t row = 0; row < height; ++row)
+                    memcpy(dst + row * dstStride, src + row * srcStride, size);
+                return;
+            }
+            bool cross = shape == SimdMorphologyShapeCross && kernelX > 1 && kernelY > 1;
+            size_t band = AlignHi(Simd::Max<size_t>(Base::AlgCacheL2() / (2 * size), 2 * kernelY), align);
+            size_t rows = band + kernelY - 1, sizeH = (2 * width + 2 * kernelX) * channels * align, sizeV = (kernelY + 1) * size;
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array8u buf(sizeH + sizeV + rows * size + (cross ? band * size : 0));
+                uint8_t* bufH = buf.data, * bufV = bufH + sizeH, * bufR = bufV + sizeV, * bufC = bufR + rows * size;
+                std::vector<const uint8_t*> ptr(rows);
+                for (size_t y0 = begin; y0 < end; y0 += band)
+                {
+                    size_t y1 = Min(y0 + band, end), n = y1 - y0;
+                    uint8_t* d = dst + y0 * dstStride;
+                    for (size_t i = 0, m = n + kernelY - 1; i < m; ++i)
+                        ptr[i] = src + Simd::RestrictRange<ptrdiff_t>(y0 + i - anchor, 0, height - 1) * srcStride;
+                    if (kernelY == 1)
+                        hor(ptr.data(), n, width, channels, kernelX, dilate, bufH, d, dstStride);
+                    else if (kernelX == 1 || cross)
+                    {
+                        const uint8_t* s = ptr[0];
+                        size_t sStride = srcStride;
+                        if (y0 < anchor || y1 + kernelY - 1 - anchor > height)
+                        {
+                            for (size_t i = 0, m = n + kernelY - 1; i < m; ++i)
+                                memcpy(bufR + i * size, ptr[i], size);
+                            s = bufR, sStride = size;
+                        }
+                        if (cross)
+                        {
+                            ver(s, sStride, size, n, kernelY, dilate, bufV, bufC, size);
+                            hor(ptr.data() + anchor, n, width, channels, kernelX, dilate, bufH, d, dstStride);
+                            binary(d, dstStride, bufC, size, width, n, channels, d, dstStride,
+                                dilate ? SimdOperationBinary8uMaximum : SimdOperationBinary8uMinimum);
+                        }
+                        else
+                            ver(s, sStride, size, n, kernelY, dilate, bufV, d, dstStride);
+                    }
+                    else
+                    {
+                        hor(ptr.data(), n + kernelY - 1, width, channels, kernelX, dilate, bufH, bufR, size);
+                        ver(bufR, size, size, n, kernelY, dilate, bufV, d, dstStride);
+                    }
+                }
+            }, Base::GetThreadNumber(), align);
+        }
+
+        void MorphologyApply(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels, size_t kernelX, size_t kernelY,
+            SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, uint8_t* dst, size_t dstStride,
+            MorphologyHorPtr hor, MorphologyVerPtr ver, OperationBinary8uPtr binary, size_t align)
+        {
+            assert(src != dst);
+            if (kernelX == 0 || kernelY == 0)
+                return;
+            size_t size = width * channels;
+            switch (operation)
+            {
+            case SimdMorphologyErode:
+                MorphologyBasic(src, srcStride, width, height, channels, kernelX, kernelY, shape, false, dst, dstStride, hor, ver, binary, align);
+                break;
+            case SimdMorphologyDilate:
+                MorphologyBasic(src, srcStride, width, height, channels, kernelX, kernelY, shape, true, dst, dstStride, hor, ver, binary, align);
+                break;
+            case SimdMorphologyOpen:
+            case SimdMorphologyClose:
+            {
+                Array8u tmp(size * height);
+                bool open = operation == SimdMorphologyOpen;
+                MorphologyBasic(src, srcStride, width, height, channels, kernelX, kernelY, shape, !open, tmp.data, size, hor, ver, binary, align);
+                MorphologyBasic(tmp.data, size, width, height, channels, kernelX, kernelY, shape, open, dst, dstStride, hor, ver, binary, align);
+                break;
+            }
+            case SimdMorphologyGradient:
+            {
+                Array8u tmp(2 * size * height);
+                uint8_t* max = tmp.data, * min = max + size * height;
+                MorphologyBasic(src, srcStride, width, height, channels, kernelX, kernelY, shape, true, max, size, hor, ver, binary, align);
+                MorphologyBasic(src, srcStride, width, height, channels, kernelX, kernelY, shape, false, min, size, hor, ver, binary, align);
+                binary(max, size, min, size, width, height, channels, dst, dstStride, SimdOperationBinary8uSaturatedSubtraction);
+                break;
+            }
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Morphology(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels, size_t kernelX, size_t kernelY,
+            SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, uint8_t* dst, size_t dstStride)
+        {
+            MorphologyApply(src, srcStride, width, height, channels, kernelX, kernelY, shape, operation, dst, dstStride,
+                MorphologyHor, MorphologyVer, OperationBinary8u, 1);
+        }
+    }
+}
@@ -0,0 +1,321 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdNv12ToBgr.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template <class T, bool nv21> void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgr = 0; colY < width; colY += 2, colBgr += 6)
+                {
+                    int _u = uv[colY + (nv21 ? 1 : 0)];
+                    int _v = uv[colY + (nv21 ? 0 : 1)];
+                    YuvToBgr<T>(y[colY + 0], _u, _v, bgr + colBgr + 0);
+                    YuvToBgr<T>(y[colY + 1], _u, _v, bgr + colBgr + 3);
+                    YuvToBgr<T>(y[colY + yStride + 0], _u, _v, bgr + colBgr + bgrStride + 0);
+                    YuvToBgr<T>(y[colY + yStride + 1], _u, _v, bgr + colBgr + bgrStride + 3);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool nv21> void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgrV2<Bt601, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgrV2<Bt709, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgrV2<Bt2020, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Nv12ToBgrV2<Trect871, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToBgrV2<false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        void Nv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToBgrV2<true>(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool nv21> void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgra = 0; colY < width; colY += 2, colBgra += 8)
+                {
+                    int _u = uv[colY + (nv21 ? 1 : 0)];
+                    int _v = uv[colY + (nv21 ? 0 : 1)];
+                    YuvToBgra<T>(y[colY + 0], _u, _v, alpha, bgra + colBgra + 0);
+                    YuvToBgra<T>(y[colY + 1], _u, _v, alpha, bgra + colBgra + 4);
+                    YuvToBgra<T>(y[colY + yStride + 0], _u, _v, alpha, bgra + colBgra + bgraStride + 0);
+                    YuvToBgra<T>(y[colY + yStride + 1], _u, _v, alpha, bgra + colBgra + bgraStride + 4);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <bool nv21> void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgraV2<Bt601, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Nv12ToBgraV2<Bt709, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToBgraV2<Bt2020, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToBgraV2<Trect871, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToBgraV2<false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToBgraV2<true>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool nv21> void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colRgb = 0; colY < width; colY += 2, colRgb += 6)
+                {
+                    int _u = uv[colY + (nv21 ? 1 : 0)];
+                    int _v = uv[colY + (nv21 ? 0 : 1)];
+                    YuvToRgb<T>(y[colY + 0], _u, _v, rgb + colRgb + 0);
+                    YuvToRgb<T>(y[colY + 1], _u, _v, rgb + colRgb + 3);
+                    YuvToRgb<T>(y[colY + yStride + 0], _u, _v, rgb + colRgb + rgbStride + 0);
+                    YuvToRgb<T>(y[colY + yStride + 1], _u, _v, rgb + colRgb + rgbStride + 3);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                rgb += 2 * rgbStride;
+            }
+        }
+
+        template <bool nv21> void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToRgbV2<Bt601, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Nv12ToRgbV2<Bt709, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Nv12ToRgbV2<Bt2020, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvTrect871: Nv12ToRgbV2<Trect871, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToRgbV2<false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+        }
+
+        void Nv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToRgbV2<true>(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool nv21> void Nv12ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colRgba = 0; colY < width; colY += 2, colRgba += 8)
+                {
+                    int _u = uv[colY + (nv21 ? 1 : 0)];
+                    int _v = uv[colY + (nv21 ? 0 : 1)];
+                    YuvToRgba<T>(y[colY + 0], _u, _v, alpha, rgba + colRgba + 0);
+                    YuvToRgba<T>(y[colY + 1], _u, _v, alpha, rgba + colRgba + 4);
+                    YuvToRgba<T>(y[colY + yStride + 0], _u, _v, alpha, rgba + colRgba + rgbaStride + 0);
+                    YuvToRgba<T>(y[colY + yStride + 1], _u, _v, alpha, rgba + colRgba + rgbaStride + 4);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                rgba += 2 * rgbaStride;
+            }
+        }
+
+        template <bool nv21> void Nv12ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToRgbaV2<Bt601, nv21>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha); break;
+            case SimdYuvBt709: Nv12ToRgbaV2<Bt709, nv21>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToRgbaV2<Bt2020, nv21>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToRgbaV2<Trect871, nv21>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToRgbaV2<false>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+        }
+
+        void Nv21ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToRgbaV2<true>(y, yStride, vu, vuStride, width, height, rgba, rgbaStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void Nv12ResizedIndex(size_t srcSize, size_t dstSize, size_t dst, int& index, int& weight)
+        {
+            float pos = (float(dst) + 0.5f) * float(srcSize) / float(dstSize) - 0.5f;
+            int lo = (int)::floor(pos);
+            weight = Round((pos - float(lo)) * 256.0f);
+            if (weight == 256)
+                lo++, weight = 0;
+            if (lo < 0)
+                lo = 0, weight = 0;
+            if (lo >= (int)srcSize - 1)
+                lo = (int)srcSize - 1, weight = 0;
+            index = lo;
+        }
+
+        SIMD_INLINE void Nv12ResizedRowY(const uint8_t* src, const int* idx, const int* wgt, size_t width, uint16_t* dst)
+        {
+            for (size_t dx = 0; dx < width; ++dx)
+            {
+                int ix = idx[dx], fx = wgt[dx], nx = fx ? 1 : 0;
+                dst[dx] = uint16_t(src[ix] * (256 - fx) + src[ix + nx] * fx);
+            }
+        }
+
+        SIMD_INLINE void Nv12ResizedRowUv(const uint8_t* src, const int* idx, const int* wgt, size_t width, uint16_t* dst)
+        {
+            uint16_t* u = dst, * v = dst + width;
+            for (size_t dx = 0; dx < width; ++dx)
+            {
+                int ix = idx[dx], fx = wgt[dx], nx = fx ? 2 : 0;
+                u[dx] = uint16_t(src[ix + 0] * (256 - fx) + src[ix + nx + 0] * fx);
+                v[dx] = uint16_t(src[ix + 1] * (256 - fx) + src[ix + nx + 1] * fx);
+            }
+        }
+
+        void Nv12ResizedRowV(const uint16_t* src0, const uint16_t* src1, int fy, size_t width, uint8_t* dst)
+        {
+            for (size_t dx = 0; dx < width; ++dx)
+                dst[dx] = (src0[dx] * (256 - fy) + src1[dx] * fy + 0x8000) >> 16;
+        }
+
+        void Nv12ToBgrResizedApply(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+            uint8_t* bgr, size_t bgrStride, size_t dstWidth, size_t dstHeight, SimdYuvType yuvType, Yuv444pToBgrV2Ptr yuv444pToBgr, Nv12ResizedRowVPtr rowV)
+        {
+            assert((srcWidth % 2 == 0) && (srcHeight % 2 == 0) && (srcWidth >= 2) && (srcHeight >= 2));
+
+            size_t uvWidth = srcWidth / 2, uvHeight = srcHeight / 2;
+            Array32i yIdx(dstWidth), yWgt(dstWidth), uvIdx(dstWidth), uvWgt(dstWidth);
+            for (size_t dx = 0; dx < dstWidth; ++dx)
+            {
+                Nv12ResizedIndex(srcWidth, dstWidth, dx, yIdx[dx], yWgt[dx]);
+                Nv12ResizedIndex(uvWidth, dstWidth, dx, uvIdx[dx], uvWgt[dx]);
+                uvIdx[dx] *= 2;
+            }
+            Array16u rows(dstWidth * 6);
+            uint16_t* yRows[2] = { rows.data, rows.data + dstWidth }, * uvRows[2] = { rows.data + 2 * dstWidth, rows.data + 4 * dstWidth };
+            Array8u buf(dstWidth * 3);
+            uint8_t* yRow = buf.data, * uRow = yRow + dstWidth, * vRow = uRow + dstWidth;
+            int ySy = -2, uvSy = -2;
+            for (size_t dy = 0; dy < dstHeight; ++dy)
+            {
+                int sy, fy, suv, fuv;
+                Nv12ResizedIndex(srcHeight, dstHeight, dy, sy, fy);
+                Nv12ResizedIndex(uvHeight, dstHeight, dy, suv, fuv);
+                if (sy != ySy)
+                {
+                    int sy1 = Min(sy + 1, (int)srcHeight - 1);
+                    if (sy == ySy + 1)
+                        Swap(yRows[0], yRows[1]);
+                    else
+                        Nv12ResizedRowY(y + sy * yStride, yIdx.data, yWgt.data, dstWidth, yRows[0]);
+                    Nv12ResizedRowY(y + sy1 * yStride, yIdx.data, yWgt.data, dstWidth, yRows[1]);
+                    ySy = sy;
+                }
+                if (suv != uvSy)
+                {
+                    int suv1 = Min(suv + 1, (int)uvHeight - 1);
+                    if (suv == uvSy + 1)
+                        Swap(uvRows[0], uvRows[1]);
+                    else
+                        Nv12ResizedRowUv(uv + suv * uvStride, uvIdx.data, uvWgt.data, dstWidth, uvRows[0]);
+                    Nv12ResizedRowUv(uv + suv1 * uvStride, uvIdx.data, uvWgt.data, dstWidth, uvRows[1]);
+                    uvSy = suv;
+                }
+                rowV(yRows[0], yRows[1], fy, dstWidth, yRow);
+                rowV(uvRows[0], uvRows[1], fuv, dstWidth, uRow);
+                rowV(uvRows[0] + dstWidth, uvRows[1] + dstWidth, fuv, dstWidth, vRow);
+                yuv444pToBgr(yRow, dstWidth, uRow, dstWidth, vRow, dstWidth, dstWidth, 1, bgr + dy * bgrStride, bgrStride, yuvType);
+            }
+        }
+
+        void Nv12ToBgrResized(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+            uint8_t* bgr, size_t bgrStride, size_t dstWidth, size_t dstHeight, SimdYuvType yuvType)
+        {
+            Nv12ToBgrResizedApply(y, yStride, uv, uvStride, srcWidth, srcHeight, bgr, bgrStride, dstWidth, dstHeight, yuvType, Yuv444pToBgrV2, Nv12ResizedRowV);
+        }
+    }
+}
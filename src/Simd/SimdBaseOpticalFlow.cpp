@@ -0,0 +1,321 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdOpticalFlow.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <float.h>
+
+namespace Simd
+{
+    LkParam::LkParam(size_t w, size_t h, size_t l, size_t r, size_t i, float e, float m, size_t a)
+        : width(w)
+        , height(h)
+        , levels(l)
+        , radius(r)
+        , iterations(i)
+        , epsilon(e)
+        , minEigen(m)
+        , align(a)
+    {
+    }
+
+    bool LkParam::Valid() const
+    {
+        return
+            width > 0 && height > 0 &&
+            levels > 0 && (width >> (levels - 1)) > 0 && (height >> (levels - 1)) > 0 &&
+            radius > 0 && radius <= LK_RADIUS_MAX &&
+            iterations > 0 && epsilon >= 0.0f && 
+            align > 0;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    SIMD_INLINE void LkWeights(float x, float y, int& ix, int& iy, int16_t* weights)
+    {
+        float fx = ::floor(x), fy = ::floor(y);
+        float a = x - fx, b = y - fy;
+        ix = (int)fx;
+        iy = (int)fy;
+        weights[0] = (int16_t)Round((1.0f - a) * (1.0f - b) * (1 << LK_WEIGHT_BITS));
+        weights[1] = (int16_t)Round(a * (1.0f - b) * (1 << LK_WEIGHT_BITS));
+        weights[2] = (int16_t)Round((1.0f - a) * b * (1 << LK_WEIGHT_BITS));
+        weights[3] = (int16_t)((1 << LK_WEIGHT_BITS) - weights[0] - weights[1] - weights[2]);
+    }
+
+    SIMD_INLINE const uint8_t* LkRegion(const uint8_t* src, size_t stride, size_t width, size_t height,
+        ptrdiff_t x, ptrdiff_t y, size_t cols, size_t rows, uint8_t* buf, size_t& bufStride)
+    {
+        if (x >= 0 && y >= 0 && x + cols <= width && y + rows <= height)
+        {
+            bufStride = stride;
+            return src + y * stride + x;
+        }
+        bufStride = cols;
+        ptrdiff_t left = Simd::RestrictRange<ptrdiff_t>(-x, 0, cols);
+        ptrdiff_t right = Simd::RestrictRange<ptrdiff_t>(x + cols - width, 0, cols - left);
+        ptrdiff_t middle = cols - left - right;
+        for (size_t row = 0; row < rows; ++row)
+        {
+            ptrdiff_t sy = Simd::RestrictRange<ptrdiff_t>(y + row, 0, height - 1);
+            const uint8_t* ps = src + sy * stride;
+            uint8_t* pb = buf + row * cols;
+            if (middle > 0)
+            {
+                memset(pb, ps[0], left);
+                memcpy(pb + left, ps + x + left, middle);
+                memset(pb + left + middle, ps[width - 1], right);
+            }
+            else
+                memset(pb, x < 0 ? ps[0] : ps[width - 1], cols);
+        }
+        return buf;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    OpticalFlowPyrLk::OpticalFlowPyrLk(const LkParam& param)
+        : _param(param)
+        , _prepare(NULL)
+        , _residual(NULL)
+    {
+        const LkParam& p = _param;
+        _widths.resize(p.levels);
+        _heights.resize(p.levels);
+        _widths[0] = p.width;
+        _heights[0] = p.height;
+        for (size_t l = 1; l < p.levels; ++l)
+        {
+            _widths[l] = (_widths[l - 1] + 1) >> 1;
+            _heights[l] = (_heights[l - 1] + 1) >> 1;
+        }
+        _size = 2 * p.radius + 1;
+        _pStride = AlignHi(_size, p.align);
+        _eStride = AlignHi(_size + 2, p.align);
+        _mask.Resize(_pStride, true);
+        for (size_t i = 0; i < _size; ++i)
+            _mask[i] = -1;
+        size_t ext = AlignHi((_eStride * (_size + 2) + 2 * p.align) * sizeof(int16_t), SIMD_ALIGN);
+        size_t patch = AlignHi(_pStride * _size * sizeof(int16_t), SIMD_ALIGN);
+        size_t region = AlignHi((_eStride + 1) * (_size + 3), SIMD_ALIGN);
+        _scratch = ext + 3 * patch + region;
+        _threads = Base::GetThreadNumber();
+        _buffer.Resize(_scratch * _threads);
+    }
+
+    void OpticalFlowPyrLk::Run(const uint8_t* const* prev, const size_t* prevStrides, const uint8_t* const* next, const size_t* nextStrides,
+        const float* prevPoints, size_t count, float* nextPoints, uint8_t* status, float* errors)
+    {
+        Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+        {
+            uint8_t* buffer = _buffer.data + thread * _scratch;
+            for (size_t i = begin; i < end; ++i)
+                Track(prev, prevStrides, next, nextStrides, prevPoints + 2 * i, nextPoints + 2 * i,
+                    status ? status + i : NULL, errors ? errors + i : NULL, buffer);
+        }, _threads, 16);
+    }
+
+    void OpticalFlowPyrLk::Track(const uint8_t* const* prev, const size_t* prevStrides, const uint8_t* const* next, const size_t* nextStrides,
+        const float* prevPoint, float* nextPoint, uint8_t* status, float* error, uint8_t* buffer)
+    {
+        const LkParam& p = _param;
+        size_t ext = AlignHi((_eStride * (_size + 2) + 2 * p.align) * sizeof(int16_t), SIMD_ALIGN);
+        size_t patch = AlignHi(_pStride * _size * sizeof(int16_t), SIMD_ALIGN);
+        int16_t* e = (int16_t*)buffer;
+        int16_t* val = (int16_t*)(buffer + ext);
+        int16_t* dx = (int16_t*)(buffer + ext + patch);
+        int16_t* dy = (int16_t*)(buffer + ext + 2 * patch);
+        uint8_t* reg = buffer + ext + 3 * patch;
+
+        float px = prevPoint[0], py = prevPoint[1], gx = 0.0f, gy = 0.0f;
+        ptrdiff_t r = p.radius;
+        bool ok = px >= 0.0f && py >= 0.0f && px <= float(p.width - 1) && py <= float(p.height - 1);
+        float norm = 1.0f / float(_size * _size * 1024), eps = p.epsilon * p.epsilon;
+        float gradient[4], residual[4];
+        int16_t weights[4];
+        int ix, iy;
+        size_t regStride;
+        for (ptrdiff_t level = p.levels - 1; level >= 0 && ok; --level)
+        {
+            size_t width = _widths[level], height = _heights[level];
+            float scale = 1.0f / float(1 << level);
+            float x = px * scale, y = py * scale, vx = gx, vy = gy;
+
+            LkWeights(x, y, ix, iy, weights);
+            const uint8_t* src = LkRegion(prev[level], prevStrides[level], width, height,
+                ix - r - 1, iy - r - 1, _eStride + 1, _size + 3, reg, regStride);
+            gradient[0] = 0.0f, gradient[1] = 0.0f, gradient[2] = 0.0f, gradient[3] = 0.0f;
+            _prepare(src, regStride, weights, _size, _pStride, e, val, dx, dy, _mask.data, gradient);
+
+            float gxx = gradient[0], gxy = gradient[1], gyy = gradient[2];
+            float det = gxx * gyy - gxy * gxy;
+            float minEigen = (gxx + gyy - ::sqrt((gxx - gyy) * (gxx - gyy) + 4.0f * gxy * gxy)) * 0.5f * norm;
+            if (minEigen < p.minEigen || det < FLT_EPSILON)
+            {
+                if (level == 0)
+                    ok = false;
+            }
+            else
+            {
+                float idet = 2.0f / det, pdx = 0.0f, pdy = 0.0f;
+                for (size_t i = 0; i < p.iterations; ++i)
+                {
+                    float qx = x + vx, qy = y + vy;
+                    if (qx < -r || qy < -r || qx >= float(width + r) || qy >= float(height + r))
+                    {
+                        if (level == 0)
+                            ok = false;
+                        break;
+                    }
+                    LkWeights(qx, qy, ix, iy, weights);
+                    src = LkRegion(next[level], nextStrides[level], width, height,
+                        ix - r, iy - r, _pStride + 1, _size + 1, reg, regStride);
+                    residual[0] = 0.0f, residual[1] = 0.0f, residual[2] = 0.0f, residual[3] = 0.0f;
+                    _residual(src, regStride, weights, _size, _pStride, val, dx, dy, _mask.data, residual);
+                    float dvx = (gyy * residual[0] - gxy * residual[1]) * idet;
+                    float dvy = (gxx * residual[1] - gxy * residual[0]) * idet;
+                    if (i && Simd::Abs(dvx + pdx) < p.epsilon && Simd::Abs(dvy + pdy) < p.epsilon)
+                    {
+                        vx += dvx * 0.5f;
+                        vy += dvy * 0.5f;
+                        break;
+                    }
+                    vx += dvx;
+                    vy += dvy;
+                    if (dvx * dvx + dvy * dvy < eps)
+                        break;
+                    pdx = dvx;
+                    pdy = dvy;
+                }
+            }
+            gx = level ? vx * 2.0f : vx;
+            gy = level ? vy * 2.0f : vy;
+        }
+
+        float nx = px + gx, ny = py + gy;
+        ok = ok && nx >= 0.0f && ny >= 0.0f && nx <= float(p.width - 1) && ny <= float(p.height - 1);
+        nextPoint[0] = ok ? nx : px;
+        nextPoint[1] = ok ? ny : py;
+        if (status)
+            *status = ok ? 1 : 0;
+        if (error)
+        {
+            *error = 0.0f;
+            if (ok)
+            {
+                LkWeights(nx, ny, ix, iy, weights);
+                const uint8_t* src = LkRegion(next[0], nextStrides[0], p.width, p.height,
+                    ix - r, iy - r, _pStride + 1, _size + 1, reg, regStride);
+                residual[0] = 0.0f, residual[1] = 0.0f, residual[2] = 0.0f, residual[3] = 0.0f;
+                _residual(src, regStride, weights, _size, _pStride, val, dx, dy, _mask.data, residual);
+                *error = residual[2] / float(_size * _size * 16);
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        SIMD_INLINE int LkValue(const uint8_t* s0, const uint8_t* s1, const int16_t* w)
+        {
+            return (s0[0] * w[0] + s0[1] * w[1] + s1[0] * w[2] + s1[1] * w[3] + LK_VALUE_ROUND) >> LK_VALUE_SHIFT;
+        }
+
+        void LkPrepare(const uint8_t* src, size_t stride, const int16_t* weights, size_t size, size_t pStride,
+            int16_t* ext, int16_t* val, int16_t* dx, int16_t* dy, const int16_t* mask, float* gradient)
+        {
+            size_t eSize = size + 2, eStride = size + 2;
+            for (size_t y = 0; y < eSize; ++y)
+            {
+                const uint8_t* s0 = src + y * stride, * s1 = s0 + stride;
+                int16_t* e = ext + y * eStride;
+                for (size_t x = 0; x < eSize; ++x)
+                    e[x] = (int16_t)LkValue(s0 + x, s1 + x, weights);
+            }
+            for (size_t y = 0; y < size; ++y)
+            {
+                const int16_t* e0 = ext + y * eStride + 1;
+                const int16_t* e1 = e0 + eStride;
+                const int16_t* e2 = e1 + eStride;
+                int16_t* v = val + y * pStride, * ix = dx + y * pStride, * iy = dy + y * pStride;
+                int32_t xx = 0, xy = 0, yy = 0;
+                for (size_t x = 0; x < size; ++x)
+                {
+                    v[x] = e1[x];
+                    ix[x] = int16_t(e1[x + 1] - e1[x - 1]);
+                    iy[x] = int16_t(e2[x] - e0[x]);
+                    xx += ix[x] * ix[x];
+                    xy += ix[x] * iy[x];
+                    yy += iy[x] * iy[x];
+                }
+                gradient[0] += (float)xx;
+                gradient[1] += (float)xy;
+                gradient[2] += (float)yy;
+            }
+        }
+
+        void LkResidual(const uint8_t* src, size_t stride, const int16_t* weights, size_t size, size_t pStride,
+            const int16_t* val, const int16_t* dx, const int16_t* dy, const int16_t* mask, float* residual)
+        {
+            for (size_t y = 0; y < size; ++y)
+            {
+                const uint8_t* s0 = src + y * stride, * s1 = s0 + stride;
+                const int16_t* v = val + y * pStride, * ix = dx + y * pStride, * iy = dy + y * pStride;
+                int32_t bx = 0, by = 0, sad = 0;
+                for (size_t x = 0; x < size; ++x)
+                {
+                    int d = v[x] - LkValue(s0 + x, s1 + x, weights);
+                    bx += d * ix[x];
+                    by += d * iy[x];
+                    sad += Simd::Abs(d);
+                }
+                residual[0] += (float)bx;
+                residual[1] += (float)by;
+                residual[2] += (float)sad;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        OpticalFlowPyrLk::OpticalFlowPyrLk(const LkParam& param)
+            : Simd::OpticalFlowPyrLk(param)
+        {
+            _prepare = LkPrepare;
+            _residual = LkResidual;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* OpticalFlowPyrLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigen)
+        {
+            LkParam param(width, height, levels, radius, iterations, epsilon, minEigen, 1);
+            if (!param.Valid())
+                return NULL;
+            return new OpticalFlowPyrLk(param);
+        }
+    }
+}
@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -64,6 +66,15 @@ namespace Simd
         , _vFilter(NULL)
     {
         _param.Init();
+        SetThreadNumber(Base::GetThreadNumber());
+    }
+
+    void RecursiveBilateralFilter::SetThreadNumber(size_t threadNumber)
+    {
+        _threads = Max<size_t>(1, threadNumber);
+        _strips = Max<size_t>(1, Min(_threads, _param.width / 256));
+        _strip = _strips > 1 ? AlignLo(_param.width / _strips, 16) : _param.width;
+        _buffer.Resize(0);
     }
 
     //---------------------------------------------------------------------------------------------
@@ -238,19 +249,33 @@ namespace Simd
             if (_buffer.Empty())
             {
                 const RbfParam& p = _param;
-                size_t size = 0;
-                size += p.height * p.width * (p.channels + 1);
-                size += p.width * (p.channels * 2 + 3);
-                _buffer.Resize(size * sizeof(float));
+                size_t strip = StripWidth(_strips - 1);
+                _size = Max(p.width * (p.channels * 2 + 3), strip * (p.height * (p.channels + 1) + p.channels * 2 + 3));
+                _buffer.Resize(_size * _threads * sizeof(float));
             }
             return (float*)_buffer.data;
         }
 
         void RecursiveBilateralFilterPrecize::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
+            const RbfParam& p = _param;
             float* buf = GetBuffer();
-            _hFilter(_param, buf, src, srcStride, dst, dstStride);
-            _vFilter(_param, buf, src, srcStride, dst, dstStride);
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                RbfParam band = p;
+                band.height = end - begin;
+                _hFilter(band, buf + thread * _size, src + begin * srcStride, srcStride, dst + begin * dstStride, dstStride);
+            }, _threads, 8);
+            Simd::Parallel(0, _strips, [&](size_t thread, size_t begin, size_t end)
+            {
+                RbfParam strip = p;
+                for (size_t s = begin; s < end; ++s)
+                {
+                    size_t offs = s * _strip * p.channels;
+                    strip.width = StripWidth(s);
+                    _vFilter(strip, buf + thread * _size, src + offs, srcStride, dst + offs, dstStride);
+                }
+            }, _threads, 1);
         }
 
         //-----------------------------------------------------------------------------------------
@@ -401,20 +426,32 @@ namespace Simd
                 const RbfParam& p = _param;
                 _stride = AlignHi(p.width * p.channels, p.align);
                 _size = _stride * p.height;
-                size_t size = 0;
-                size += _size;
-                size += _stride * 2 * sizeof(float);
-                size += 4 * _stride;
-                _buffer.Resize(size);
+                _scratch = _stride * 2 * sizeof(float) + _stride * 4;
+                _buffer.Resize(_size + _scratch * _threads);
             }
             return _buffer.data;
         }
 
         void RecursiveBilateralFilterFast::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
+            const RbfParam& p = _param;
             uint8_t* buf = GetBuffer();
-            _hFilter(_param, (float*)(buf + _size), src, srcStride, buf, _stride);
-            _vFilter(_param, (float*)(buf + _size), buf, _stride, dst, dstStride);
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                RbfParam band = p;
+                band.height = end - begin;
+                _hFilter(band, (float*)(buf + _size + thread * _scratch), src + begin * srcStride, srcStride, buf + begin * _stride, _stride);
+            }, _threads, 8);
+            Simd::Parallel(0, _strips, [&](size_t thread, size_t begin, size_t end)
+            {
+                RbfParam strip = p;
+                for (size_t s = begin; s < end; ++s)
+                {
+                    size_t offs = s * _strip * p.channels;
+                    strip.width = StripWidth(s);
+                    _vFilter(strip, (float*)(buf + _size + thread * _scratch), buf + offs, _stride, dst + offs, dstStride);
+                }
+            }, _threads, 1);
         }
 
         //-----------------------------------------------------------------------------------------
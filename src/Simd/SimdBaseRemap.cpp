@@ -0,0 +1,273 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+#include "Simd/SimdBase.h"
+
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    RemapParam::RemapParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, size_t align)
+    {
+        this->srcW = srcW;
+        this->srcH = srcH;
+        this->srcS = srcS;
+        this->dstW = dstW;
+        this->dstH = dstH;
+        this->dstS = dstS;
+        this->channels = channels;
+        this->flags = flags;
+        memset(this->border, 0, BorderSizeMax);
+        if (border && (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant)
+            memcpy(this->border, border, this->PixelSize());
+        this->align = align;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    Remap::Remap(const RemapParam& param, bool rowMap)
+        : _param(param)
+        , _threads(Base::GetThreadNumber())
+        , _run(NULL)
+    {
+        size_t wa = _param.RowMapSize(), na = (_param.channels == 3 ? 4 : _param.channels);
+        _map = rowMap ? AlignHi(wa * 6, SIMD_ALIGN) : 0;
+        _size = _map + (_param.IsNearest() ? 0 : wa * 10 + wa * na * 4);
+        _threads = Simd::Max<size_t>(1, Simd::Min(_threads, _param.dstH));
+        _buf.Resize(_size * _threads);
+    }
+
+    void Remap::Run(const uint8_t* src, uint8_t* dst)
+    {
+        Simd::Parallel(0, _param.dstH, [&](size_t thread, size_t begin, size_t end)
+        {
+            uint8_t* buf = _buf.data + thread * _size;
+            const int16_t* xy;
+            const uint8_t* fxy;
+            for (size_t y = begin; y < end; ++y)
+            {
+                GetRow((int)y, buf, xy, fxy);
+                _run(_param, xy, fxy, src, dst + y * _param.dstS, buf + _map);
+            }
+        }, _threads, 1);
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<int N> void RemapNearestRow(const RemapParam& p, const int16_t* xy, const uint8_t* fxy, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW, h = (int)p.srcH;
+            for (int x = 0; x < width; ++x, xy += 2, dst += N)
+            {
+                int ix = xy[0], iy = xy[1];
+                if (ix >= 0 && ix < w && iy >= 0 && iy < h)
+                    CopyPixel<N>(src + iy * s + ix * N, dst);
+                else if (fill)
+                    CopyPixel<N>(p.border, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        SIMD_INLINE bool RemapBilinearInside(const int16_t* xy, int w, int h)
+        {
+            return xy[0] >= 0 && xy[0] <= w && xy[1] >= 0 && xy[1] <= h;
+        }
+
+        template<int N> void RemapByteBilinearRow(const RemapParam& p, const int16_t* xy, const uint8_t* fxy, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2;
+            size_t wa = p.RowMapSize();
+            uint32_t* offs = (uint32_t*)buf;
+            uint8_t* fx = (uint8_t*)(offs + wa);
+            uint16_t* fy = (uint16_t*)(fx + wa * 2);
+            uint8_t* rb0 = (uint8_t*)(fy + wa * 2);
+            uint8_t* rb1 = (uint8_t*)(rb0 + wa * M * 2);
+            const uint8_t* brd = p.NeedFill() ? p.border : NULL;
+            for (int x = 0; x < width;)
+            {
+                for (; x < width && !RemapBilinearInside(xy + 2 * x, w, h); ++x)
+                    ByteBilinearInterpEdge<N>(xy[2 * x + 0], xy[2 * x + 1], fxy[2 * x + 0], fxy[2 * x + 1], 
+                        w, h, s, src, brd ? brd : dst + x * N, dst + x * N);
+                int beg = x;
+                for (; x < width && RemapBilinearInside(xy + 2 * x, w, h); ++x)
+                    RemapBilinearPrep<N>(xy + 2 * x, fxy + 2 * x, s, offs + x, fx + 2 * x, fy + 2 * x);
+                ByteBilinearGather<M>(src, src + s, offs + beg, x - beg, rb0 + 2 * M * beg, rb1 + 2 * M * beg);
+                for (int i = beg; i < x; ++i)
+                    ByteBilinearInterpMain<N>(rb0 + i * M * 2, rb1 + i * M * 2, fx + 2 * i, fy + 2 * i, dst + i * N);
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        static Remap::RunPtr GetRunPtr(const RemapParam& p)
+        {
+            if (p.IsNearest())
+            {
+                switch (p.channels)
+                {
+                case 1: return RemapNearestRow<1>;
+                case 2: return RemapNearestRow<2>;
+                case 3: return RemapNearestRow<3>;
+                case 4: return RemapNearestRow<4>;
+                }
+            }
+            else if (p.IsByteBilinear())
+            {
+                switch (p.channels)
+                {
+                case 1: return RemapByteBilinearRow<1>;
+                case 2: return RemapByteBilinearRow<2>;
+                case 3: return RemapByteBilinearRow<3>;
+                case 4: return RemapByteBilinearRow<4>;
+                }
+            }
+            return NULL;
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        RemapMap::RemapMap(const RemapParam& param, const float* map)
+            : Remap(param, false)
+        {
+            const RemapParam& p = _param;
+            size_t size = p.dstW * p.dstH;
+            bool nearest = p.IsNearest();
+            float w = (float)p.srcW, h = (float)p.srcH;
+            _xy.Resize(size * 2);
+            if (!nearest)
+                _fxy.Resize(size * 2);
+            for (size_t i = 0; i < size; ++i, map += 2)
+            {
+                if (nearest)
+                    RemapNearestPoint(map[0], map[1], w, h, _xy.data + i * 2);
+                else
+                    RemapBilinearPoint(map[0], map[1], w, h, _xy.data + i * 2, _fxy.data + i * 2);
+            }
+            _run = GetRunPtr(p);
+        }
+
+        void RemapMap::GetRow(int y, uint8_t* buf, const int16_t*& xy, const uint8_t*& fxy)
+        {
+            size_t offset = y * _param.dstW * 2;
+            xy = _xy.data + offset;
+            fxy = _fxy.data ? _fxy.data + offset : NULL;
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        static bool SetInv(const float* mat, float* inv)
+        {
+            double a = mat[0], b = mat[1], c = mat[2];
+            double d = mat[3], e = mat[4], f = mat[5];
+            double g = mat[6], h = mat[7], i = mat[8];
+            double A = e * i - f * h, B = f * g - d * i, C = d * h - e * g;
+            double D = a * A + b * B + c * C;
+            if (D == 0.0)
+            {
+                memset(inv, 0, 9 * sizeof(float));
+                return false;
+            }
+            D = 1.0 / D;
+            inv[0] = float(A * D);
+            inv[1] = float((c * h - b * i) * D);
+            inv[2] = float((b * f - c * e) * D);
+            inv[3] = float(B * D);
+            inv[4] = float((a * i - c * g) * D);
+            inv[5] = float((c * d - a * f) * D);
+            inv[6] = float(C * D);
+            inv[7] = float((b * g - a * h) * D);
+            inv[8] = float((a * e - b * d) * D);
+            return true;
+        }
+
+        WarpPerspective::WarpPerspective(const RemapParam& param, const float* mat)
+            : Remap(param, true)
+        {
+            memcpy(_mat, mat, 9 * sizeof(float));
+            _valid = SetInv(_mat, _inv);
+            _run = GetRunPtr(_param);
+        }
+
+        void WarpPerspective::GetRow(int y, uint8_t* buf, const int16_t*& xy, const uint8_t*& fxy)
+        {
+            int16_t* _xy = (int16_t*)buf;
+            uint8_t* _fxy = (uint8_t*)(_xy + _param.RowMapSize() * 2);
+            SetRow(y, _xy, _fxy);
+            xy = _xy;
+            fxy = _fxy;
+        }
+
+        void WarpPerspective::SetRow(int y, int16_t* xy, uint8_t* fxy)
+        {
+            const RemapParam& p = _param;
+            const float* m = _inv;
+            bool nearest = p.IsNearest();
+            float w = (float)p.srcW, h = (float)p.srcH;
+            double fy = (double)y, bx = fy * m[1] + m[2], by = fy * m[4] + m[5], bz = fy * m[7] + m[8];
+            for (size_t x = 0; x < p.dstW; ++x, xy += 2, fxy += 2)
+            {
+                float sx, sy;
+                WarpPerspectivePoint(x, m, bx, by, bz, sx, sy);
+                if (nearest)
+                    RemapNearestPoint(sx, sy, w, h, xy);
+                else
+                    RemapBilinearPoint(sx, sy, w, h, xy, fxy);
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, 1);
+            if (!param.Valid() || map == NULL)
+                return NULL;
+            if (param.IsNearest() || param.IsByteBilinear())
+                return new RemapMap(param, map);
+            else
+                return NULL;
+        }
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, 1);
+            if (!param.Valid() || mat == NULL || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            WarpPerspective* context = new WarpPerspective(param, mat);
+            if (!context->Valid())
+            {
+                delete context;
+                return NULL;
+            }
+            return context;
+        }
+    }
+}
@@ -0,0 +1,245 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdTemplateMatch.h"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void TemplateMatchCorr(const uint8_t* src, size_t srcStride, size_t width, const int32_t* tmpl, size_t tmplWidth, size_t rows, int32_t* dst)
+        {
+            size_t pairs = DivHi(tmplWidth, 2), even = AlignLo(tmplWidth, 2);
+            for (size_t x = 0; x < width; ++x)
+            {
+                const uint8_t* s = src + x;
+                const int32_t* t = tmpl;
+                int32_t sum = 0;
+                for (size_t j = 0; j < rows; ++j, s += srcStride, t += pairs)
+                {
+                    for (size_t i = 0; i < even; i += 2)
+                        sum += int16_t(t[i / 2]) * s[i] + (t[i / 2] >> 16) * s[i + 1];
+                    if (even < tmplWidth)
+                        sum += int16_t(t[pairs - 1]) * s[even];
+                }
+                dst[x] = sum;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE float TemplateMatchScore(SimdTemplateMatchMethodType method, int64_t n, int64_t corr, int64_t sum, int64_t sqsum, int64_t tSum, int64_t tSqsum)
+        {
+            switch (method)
+            {
+            case SimdTemplateMatchSqDiff:
+                return float(sqsum - 2 * corr + tSqsum);
+            case SimdTemplateMatchSqDiffNormed:
+            {
+                int64_t num = sqsum - 2 * corr + tSqsum;
+                double den = ::sqrt(double(sqsum) * double(tSqsum));
+                return den > 0 ? float(double(num) / den) : (num ? 1.0f : 0.0f);
+            }
+            case SimdTemplateMatchCCorr:
+                return float(corr);
+            case SimdTemplateMatchCCorrNormed:
+            {
+                double den = ::sqrt(double(sqsum) * double(tSqsum));
+                return den > 0 ? float(Simd::Min(double(corr) / den, 1.0)) : 0.0f;
+            }
+            case SimdTemplateMatchCCoeff:
+                return float(double(n * corr - sum * tSum) / double(n));
+            case SimdTemplateMatchCCoeffNormed:
+            {
+                int64_t num = n * corr - sum * tSum;
+                double den = ::sqrt(double(n * sqsum - sum * sum) * double(n * tSqsum - tSum * tSum));
+                return den > 0 ? float(Simd::RestrictRange(double(num) / den, -1.0, 1.0)) : 0.0f;
+            }
+            default:
+                assert(0);
+                return 0;
+            }
+        }
+
+        void TemplateMatchApply(const uint8_t* src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t* tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight,
+            SimdTemplateMatchMethodType method, float* dst, size_t dstStride, TemplateMatchCorrPtr corr, size_t align)
+        {
+            assert(tmplWidth > 0 && tmplHeight > 0 && tmplWidth <= srcWidth && tmplHeight <= srcHeight);
+            size_t width = srcWidth - tmplWidth + 1, height = srcHeight - tmplHeight + 1, pairs = DivHi(tmplWidth, 2);
+            int64_t n = tmplWidth * tmplHeight, tSum = 0, tSqsum = 0;
+            Array32i packed(pairs * tmplHeight);
+            for (size_t j = 0; j < tmplHeight; ++j)
+            {
+                const uint8_t* t = tmpl + j * tmplStride;
+                for (size_t i = 0; i < tmplWidth; ++i)
+                {
+                    tSum += t[i];
+                    tSqsum += t[i] * t[i];
+                }
+                for (size_t i = 0; i < pairs; ++i)
+                    packed[j * pairs + i] = t[2 * i] | (2 * i + 1 < tmplWidth ? t[2 * i + 1] << 16 : 0);
+            }
+
+            bool energy = method != SimdTemplateMatchCCorr;
+            size_t iStride = srcWidth + 1;
+            Array32u sum(energy ? iStride * (srcHeight + 1) : 0);
+            Array64u sqsum(energy ? iStride * (srcHeight + 1) : 0);
+            if (energy)
+            {
+                memset(sum.data, 0, iStride * sizeof(uint32_t));
+                memset(sqsum.data, 0, iStride * sizeof(uint64_t));
+                for (size_t y = 0; y < srcHeight; ++y)
+                {
+                    const uint8_t* s = src + y * srcStride;
+                    const uint32_t* ps = sum.data + y * iStride;
+                    const uint64_t* pq = sqsum.data + y * iStride;
+                    uint32_t* ds = sum.data + (y + 1) * iStride;
+                    uint64_t* dq = sqsum.data + (y + 1) * iStride;
+                    uint32_t rs = 0;
+                    uint64_t rq = 0;
+                    ds[0] = 0, dq[0] = 0;
+                    for (size_t x = 0; x < srcWidth; ++x)
+                    {
+                        rs += s[x];
+                        rq += s[x] * s[x];
+                        ds[x + 1] = ps[x + 1] + rs;
+                        dq[x + 1] = pq[x + 1] + rq;
+                    }
+                }
+            }
+
+            size_t block = Simd::RestrictRange<size_t>(0x7FFFFFFF / (255 * 255 * tmplWidth), 1, tmplHeight);
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32i buf(AlignHi(width, align));
+                std::vector<int64_t> acc(block < tmplHeight ? width : 0);
+                for (size_t y = begin; y < end; ++y)
+                {
+                    const uint8_t* s = src + y * srcStride;
+                    if (block < tmplHeight)
+                    {
+                        std::fill(acc.begin(), acc.end(), 0);
+                        for (size_t j = 0; j < tmplHeight; j += block)
+                        {
+                            size_t rows = Simd::Min(block, tmplHeight - j);
+                            corr(s + j * srcStride, srcStride, width, packed.data + j * pairs, tmplWidth, rows, buf.data);
+                            for (size_t x = 0; x < width; ++x)
+                                acc[x] += buf[x];
+                        }
+                    }
+                    else
+                        corr(s, srcStride, width, packed.data, tmplWidth, tmplHeight, buf.data);
+                    float* d = (float*)((uint8_t*)dst + y * dstStride);
+                    if (energy)
+                    {
+                        const uint32_t* s0 = sum.data + y * iStride, * s1 = s0 + tmplHeight * iStride;
+                        const uint64_t* q0 = sqsum.data + y * iStride, * q1 = q0 + tmplHeight * iStride;
+                        for (size_t x = 0, w = tmplWidth; x < width; ++x)
+                        {
+                            int64_t c = block < tmplHeight ? acc[x] : buf[x];
+                            int64_t ws = uint32_t(s1[x + w] - s1[x] - s0[x + w] + s0[x]);
+                            int64_t wq = int64_t(q1[x + w] - q1[x] - q0[x + w] + q0[x]);
+                            d[x] = TemplateMatchScore(method, n, c, ws, wq, tSum, tSqsum);
+                        }
+                    }
+                    else
+                    {
+                        for (size_t x = 0; x < width; ++x)
+                            d[x] = float(block < tmplHeight ? acc[x] : buf[x]);
+                    }
+                }
+            }, Base::GetThreadNumber());
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void TemplateMatch(const uint8_t* src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t* tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight,
+            SimdTemplateMatchMethodType method, float* dst, size_t dstStride)
+        {
+            TemplateMatchApply(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, method, dst, dstStride, TemplateMatchCorr, 1);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t TemplateMatchPeaks(const float* map, size_t stride, size_t width, size_t height, SimdTemplateMatchMethodType method,
+            size_t radius, SimdTemplateMatchPeak* peaks, size_t count)
+        {
+            if (count == 0 || width == 0 || height == 0)
+                return 0;
+            float sign = (method == SimdTemplateMatchSqDiff || method == SimdTemplateMatchSqDiffNormed) ? -1.0f : 1.0f;
+            std::vector<SimdTemplateMatchPeak> candidates;
+            for (size_t y = 0; y < height; ++y)
+            {
+                const float* m = (const float*)((const uint8_t*)map + y * stride);
+                for (size_t x = 0; x < width; ++x)
+                {
+                    float value = m[x] * sign;
+                    bool extremum = true;
+                    for (size_t dy = y ? y - 1 : 0, ey = Simd::Min(y + 2, height); dy < ey && extremum; ++dy)
+                    {
+                        const float* n = (const float*)((const uint8_t*)map + dy * stride);
+                        for (size_t dx = x ? x - 1 : 0, ex = Simd::Min(x + 2, width); dx < ex; ++dx)
+                        {
+                            if (n[dx] * sign > value)
+                            {
+                                extremum = false;
+                                break;
+                            }
+                        }
+                    }
+                    if (extremum)
+                    {
+                        SimdTemplateMatchPeak peak;
+                        peak.x = x;
+                        peak.y = y;
+                        peak.score = m[x];
+                        candidates.push_back(peak);
+                    }
+                }
+            }
+            std::stable_sort(candidates.begin(), candidates.end(), [sign](const SimdTemplateMatchPeak& a, const SimdTemplateMatchPeak& b)
+            {
+                return a.score * sign > b.score * sign;
+            });
+            size_t found = 0;
+            for (size_t i = 0; i < candidates.size() && found < count; ++i)
+            {
+                const SimdTemplateMatchPeak& c = candidates[i];
+                bool suppressed = false;
+                for (size_t j = 0; j < found && !suppressed; ++j)
+                    suppressed = (c.x > peaks[j].x ? c.x - peaks[j].x : peaks[j].x - c.x) <= radius &&
+                        (c.y > peaks[j].y ? c.y - peaks[j].y : peaks[j].y - c.y) <= radius;
+                if (!suppressed)
+                    peaks[found++] = c;
+            }
+            return found;
+        }
+    }
+}
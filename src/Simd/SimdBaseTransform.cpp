@@ -142,6 +142,10 @@ namespace Simd
             Init<2>(transforms[1]);
             Init<3>(transforms[2]);
             Init<4>(transforms[3]);
+            Init<6>(transforms[4]);
+            Init<8>(transforms[5]);
+            Init<12>(transforms[6]);
+            Init<16>(transforms[7]);
         }
 
         //-----------------------------------------------------------------------------------------
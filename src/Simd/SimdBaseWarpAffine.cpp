@@ -76,6 +76,132 @@ namespace Simd
     {
     }
 
+    bool WarpAffine::SetMatrix(const float* mat)
+    {
+        memcpy(_param.mat, mat, 6 * sizeof(float));
+        SetInv(_param.mat, _param.inv);
+        _first = true;
+        return _param.Valid();
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    WarpAffBatchParam::WarpAffBatchParam(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+        SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper)
+    {
+        this->srcW = srcW;
+        this->srcH = srcH;
+        this->srcS = srcS;
+        this->channels = channels;
+        this->dstW = dstW;
+        this->dstH = dstH;
+        this->flags = flags;
+        memset(this->border, 0, ChannelsMax);
+        if (border && channels <= ChannelsMax)
+            memcpy(this->border, border, channels);
+        this->format = format;
+        this->type = type;
+        for (size_t c = 0; c < ChannelsMax; ++c)
+        {
+            float lo = lower ? lower[Min(c, DstChannels() - 1)] : 0.0f;
+            float up = upper ? upper[Min(c, DstChannels() - 1)] : 1.0f;
+            scale[c] = (up - lo) / 255.0f;
+            shift[c] = lo;
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    WarpAffineBatch::WarpAffineBatch(const WarpAffBatchParam& param, InitPtr init, ToBf16Ptr toBf16)
+        : _param(param)
+        , _threads(Base::GetThreadNumber())
+        , _toBf16(toBf16)
+    {
+        const WarpAffBatchParam& p = _param;
+        const float identity[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+        _engines.resize(_threads, NULL);
+        for (size_t t = 0; t < _threads; ++t)
+        {
+            _engines[t] = (WarpAffine*)init(p.srcW, p.srcH, p.srcS, p.dstW, p.dstH, p.dstW * p.channels, p.channels, identity, p.flags, p.border);
+            if (_engines[t])
+                _engines[t]->SetThreads(1);
+        }
+        _size = AlignHi(p.dstW * p.dstH * p.channels, SIMD_ALIGN);
+        if (p.type != SimdTensorData8u)
+            _size += AlignHi(p.dstW * p.dstH * p.DstChannels() * sizeof(float), SIMD_ALIGN);
+        _buf.Resize(_size * _threads);
+    }
+
+    WarpAffineBatch::~WarpAffineBatch()
+    {
+        for (size_t t = 0; t < _engines.size(); ++t)
+            delete _engines[t];
+    }
+
+    bool WarpAffineBatch::Valid() const
+    {
+        for (size_t t = 0; t < _engines.size(); ++t)
+            if (_engines[t] == NULL)
+                return false;
+        return _engines.size() > 0;
+    }
+
+    void WarpAffineBatch::Run(const uint8_t* src, const float* mats, size_t count, uint8_t* dst)
+    {
+        const WarpAffBatchParam& p = _param;
+        size_t dstSize = p.DstSize(), cropS = p.dstW * p.channels;
+        bool direct = p.type == SimdTensorData8u && (p.format == SimdTensorFormatNhwc || p.channels == 1);
+        Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+        {
+            WarpAffine* engine = _engines[thread];
+            uint8_t* crop = _buf.data + thread * _size;
+            float* buf = (float*)(crop + AlignHi(cropS * p.dstH, SIMD_ALIGN));
+            for (size_t i = begin; i < end; ++i)
+            {
+                uint8_t* out = dst + i * dstSize;
+                uint8_t* warp = direct ? out : crop;
+                if (engine->SetMatrix(mats + i * 6))
+                    engine->Run(src, warp);
+                else
+                    Base::FillPixel(warp, cropS, p.dstW, p.dstH, p.border, p.channels);
+                if (!direct)
+                    SetOutput(crop, buf, out);
+            }
+        }, _threads, 1);
+    }
+
+    void WarpAffineBatch::SetOutput(const uint8_t* src, float* buf, uint8_t* dst) const
+    {
+        const WarpAffBatchParam& p = _param;
+        size_t size = p.dstW * p.dstH, channels = p.channels, dstC = p.DstChannels();
+        if (p.type == SimdTensorData8u)
+        {
+            for (size_t c = 0; c < channels; ++c, dst += size)
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = src[i * channels + c];
+            return;
+        }
+        float* out = p.type == SimdTensorData32f ? (float*)dst : buf;
+        if (p.format == SimdTensorFormatNchw)
+        {
+            for (size_t c = 0; c < dstC; ++c)
+            {
+                float scale = p.scale[c], shift = p.shift[c];
+                float* pOut = out + c * size;
+                for (size_t i = 0; i < size; ++i)
+                    pOut[i] = float(src[i * channels + c]) * scale + shift;
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < size; ++i, src += channels, out += dstC)
+                for (size_t c = 0; c < dstC; ++c)
+                    out[c] = float(src[c]) * p.scale[c] + p.shift[c];
+        }
+        if (p.type == SimdTensorData16b)
+            _toBf16(buf, size * dstC, (uint16_t*)dst);
+    }
+
     //---------------------------------------------------------------------------------------------
 
     namespace Base
@@ -384,5 +510,22 @@ namespace Simd
             else
                 return NULL;
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper)
+        {
+            WarpAffBatchParam param(srcW, srcH, srcS, channels, dstW, dstH, flags, border, format, type, lower, upper);
+            if (!param.Valid())
+                return NULL;
+            WarpAffineBatch* batch = new WarpAffineBatch(param, Base::WarpAffineInit, Base::Float32ToBFloat16);
+            if (!batch->Valid())
+            {
+                delete batch;
+                return NULL;
+            }
+            return batch;
+        }
     }
 }
@@ -0,0 +1,202 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdYuv16ToBgr.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        Yuv16ToBgrParam::Yuv16ToBgrParam(SimdYuv16LayoutType layout_, size_t bitDepth, SimdYuvType yuvType, float range, bool dither_)
+            : layout(layout_)
+        {
+            assert(bitDepth >= 9 && bitDepth <= 16);
+            bool msb = Yuv16SemiPlanar(layout);
+            float unit = float(msb ? 1 << (16 - bitDepth) : 1);
+            mask = uint16_t(msb ? 0xFFFF << (16 - bitDepth) : 0xFFFF >> (16 - bitDepth));
+            float kr, kb, yRange, uvRange;
+            switch (yuvType)
+            {
+            case SimdYuvBt709: kr = 0.2126f, kb = 0.0722f; break;
+            case SimdYuvBt2020: kr = 0.2627f, kb = 0.0593f; break;
+            default: kr = 0.299f, kb = 0.114f;
+            }
+            if (yuvType == SimdYuvTrect871)
+            {
+                yLo = 0.0f;
+                uvLo = float(1 << (bitDepth - 1)) * unit;
+                yRange = float((1 << bitDepth) - 1) * unit;
+                uvRange = yRange;
+            }
+            else
+            {
+                yLo = float(16 << (bitDepth - 8)) * unit;
+                uvLo = float(128 << (bitDepth - 8)) * unit;
+                yRange = float(219 << (bitDepth - 8)) * unit;
+                uvRange = float(224 << (bitDepth - 8)) * unit;
+            }
+            float kg = 1.0f - kr - kb;
+            y = range / yRange;
+            vr = range / uvRange * 2.0f * (1.0f - kr);
+            ug = -range / uvRange * 2.0f * kb * (1.0f - kb) / kg;
+            vg = -range / uvRange * 2.0f * kr * (1.0f - kr) / kg;
+            ub = range / uvRange * 2.0f * (1.0f - kb);
+            static const int bayer[4][4] = { {0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5} };
+            for (size_t row = 0; row < 4; ++row)
+                for (size_t col = 0; col < 4; ++col)
+                    dither[row][col] = dither_ ? (float(bayer[row][col]) + 0.5f) / 16.0f - 0.5f : 0.0f;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Yuv16ToFloatRow(const Yuv16ToBgrParam& p, const uint16_t* y, const uint16_t* u, const uint16_t* v, size_t width, float* b, float* g, float* r)
+        {
+            if (g == NULL)
+            {
+                for (size_t x = 0; x < width; ++x)
+                    b[x] = (float(y[x] & p.mask) - p.yLo) * p.y;
+                return;
+            }
+            bool semi = Yuv16SemiPlanar(p.layout), half = Yuv16HalfWidth(p.layout);
+            for (size_t x = 0; x < width; ++x)
+            {
+                size_t c = half ? x / 2 : x;
+                float _y = (float(y[x] & p.mask) - p.yLo) * p.y;
+                float _u = float((semi ? u[2 * c + 0] : u[c]) & p.mask) - p.uvLo;
+                float _v = float((semi ? u[2 * c + 1] : v[c]) & p.mask) - p.uvLo;
+                b[x] = _y + _u * p.ub;
+                g[x] = _y + _u * p.ug + _v * p.vg;
+                r[x] = _y + _v * p.vr;
+            }
+        }
+
+        SIMD_INLINE uint8_t FloatToUint8(float value, float bias)
+        {
+            return (uint8_t)RestrictRange(Round(value + bias), 0, 255);
+        }
+
+        void FloatToUint8Row(const float* b, const float* g, const float* r, const float* bias, size_t width, size_t channels, uint8_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x, dst += channels)
+            {
+                float d = bias[x & 3];
+                dst[0] = FloatToUint8(b[x], d);
+                if (channels > 1)
+                {
+                    dst[1] = FloatToUint8(g[x], d);
+                    dst[2] = FloatToUint8(r[x], d);
+                    if (channels > 3)
+                        dst[3] = 0xFF;
+                }
+            }
+        }
+
+        SIMD_INLINE uint16_t FloatToUint16(float value)
+        {
+            return (uint16_t)RestrictRange(Round(value), 0, 0xFFFF);
+        }
+
+        void FloatToUint16Row(const float* b, const float* g, const float* r, size_t width, uint16_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x, dst += 3)
+            {
+                dst[0] = FloatToUint16(b[x]);
+                dst[1] = FloatToUint16(g[x]);
+                dst[2] = FloatToUint16(r[x]);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Yuv16ToBgrApply(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height,
+            SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, uint8_t* dst, size_t dstStride, SimdYuv16OutputType output, SimdBool dither,
+            Yuv16ToFloatRowPtr toFloat, FloatToUint8RowPtr toUint8, FloatToUint16RowPtr toUint16, Float32ToBFloat16Ptr toBFloat16)
+        {
+            assert((!Yuv16HalfWidth(layout) || width % 2 == 0) && (!Yuv16HalfHeight(layout) || height % 2 == 0));
+            bool gray = output == SimdYuv16OutputGray8, swap = false;
+            size_t channels = 3;
+            float range = 255.0f;
+            switch (output)
+            {
+            case SimdYuv16OutputGray8: channels = 1; break;
+            case SimdYuv16OutputBgr24: break;
+            case SimdYuv16OutputBgra32: channels = 4; break;
+            case SimdYuv16OutputRgb24: swap = true; break;
+            case SimdYuv16OutputRgba32: channels = 4, swap = true; break;
+            case SimdYuv16OutputBgr48: range = 65535.0f; break;
+            case SimdYuv16OutputRgb48: range = 65535.0f, swap = true; break;
+            case SimdYuv16OutputBgr32f: case SimdYuv16OutputBgr16b: range = 1.0f; break;
+            case SimdYuv16OutputRgb32f: case SimdYuv16OutputRgb16b: range = 1.0f, swap = true; break;
+            default:
+                assert(0);
+            }
+            bool isFloat = output == SimdYuv16OutputBgr32f || output == SimdYuv16OutputRgb32f;
+            bool isBFloat16 = output == SimdYuv16OutputBgr16b || output == SimdYuv16OutputRgb16b;
+            Yuv16ToBgrParam param(layout, bitDepth, yuvType, range, dither && range == 255.0f);
+            size_t rowShift = Yuv16HalfHeight(layout) ? 1 : 0, planeSize = dstStride * height;
+            Array32f buf(isFloat ? 0 : 3 * width);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t* _y = (const uint16_t*)(y + row * yStride);
+                const uint16_t* _u = (const uint16_t*)(u + (row >> rowShift) * uStride);
+                const uint16_t* _v = Yuv16SemiPlanar(layout) ? NULL : (const uint16_t*)(v + (row >> rowShift) * vStride);
+                float* b, * g, * r;
+                if (isFloat)
+                {
+                    b = (float*)(dst + row * dstStride);
+                    g = (float*)(dst + planeSize + row * dstStride);
+                    r = (float*)(dst + 2 * planeSize + row * dstStride);
+                }
+                else
+                    b = buf.data, g = b + width, r = g + width;
+                if (swap)
+                    Swap(b, r);
+                toFloat(param, _y, _u, _v, width, b, gray ? NULL : g, gray ? NULL : r);
+                if (swap)
+                    Swap(b, r);
+                if (isBFloat16)
+                {
+                    toBFloat16(b, width, (uint16_t*)(dst + row * dstStride));
+                    toBFloat16(g, width, (uint16_t*)(dst + planeSize + row * dstStride));
+                    toBFloat16(r, width, (uint16_t*)(dst + 2 * planeSize + row * dstStride));
+                }
+                else if (range == 65535.0f)
+                    toUint16(b, g, r, width, (uint16_t*)(dst + row * dstStride));
+                else if (!isFloat)
+                    toUint8(b, g, r, param.dither[row & 3], width, channels, dst + row * dstStride);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Yuv16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height,
+            SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, uint8_t* dst, size_t dstStride, SimdYuv16OutputType output, SimdBool dither)
+        {
+            Yuv16ToBgrApply(y, yStride, u, uStride, v, vStride, width, height, layout, bitDepth, yuvType, dst, dstStride, output, dither,
+                Yuv16ToFloatRow, FloatToUint8Row, FloatToUint16Row, Float32ToBFloat16);
+        }
+    }
+}
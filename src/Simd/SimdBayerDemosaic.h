@@ -0,0 +1,71 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBayerDemosaic_h__
+#define __SimdBayerDemosaic_h__
+
+#include "Simd/SimdYuv16ToBgr.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t BAYER_DEMOSAIC_PAD = 2;
+
+        /*
+        * Converts one row of raw Bayer samples to float: dst[x] = Max(src[x] - black, 0) * scale[x & 1].
+        * For bitDepth > 8 the source row consists of 16-bit samples.
+        */
+        typedef void(*BayerNormalizeRowPtr)(const uint8_t* src, size_t width, size_t bitDepth, float black, const float* scale, float* dst);
+
+        /*
+        * Row kernels of demosaicing. Every input row is padded by BAYER_DEMOSAIC_PAD elements at the both sides.
+        * Output row c corresponds to the color (red or blue) of current row, row o to the other color (blue or red).
+        * If greenFirst is true then green samples are placed at even positions of current row.
+        */
+        typedef void(*BayerMalvarRowPtr)(const float* const* src, size_t width, bool greenFirst, float* c, float* g, float* o);
+        typedef void(*BayerGreenRowPtr)(const float* const* src, size_t width, bool greenFirst, float* g);
+        typedef void(*BayerChromaRowPtr)(const float* const* src, const float* const* green, size_t width, bool greenFirst, float* c, float* o);
+
+        void BayerNormalizeRow(const uint8_t* src, size_t width, size_t bitDepth, float black, const float* scale, float* dst);
+        void BayerMalvarRow(const float* const* src, size_t width, bool greenFirst, float* c, float* g, float* o);
+        void BayerGreenRow(const float* const* src, size_t width, bool greenFirst, float* g);
+        void BayerChromaRow(const float* const* src, const float* const* green, size_t width, bool greenFirst, float* c, float* o);
+
+        void BayerDemosaicApply(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height, SimdPixelFormatType bayerFormat, size_t bitDepth,
+            size_t blackLevel, const float* gains, SimdBayerDemosaicType method, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat,
+            BayerNormalizeRowPtr normalize, BayerMalvarRowPtr malvar, BayerGreenRowPtr green, BayerChromaRowPtr chroma, FloatToUint8RowPtr toUint8);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void BayerNormalizeRow(const uint8_t* src, size_t width, size_t bitDepth, float black, const float* scale, float* dst);
+        void BayerMalvarRow(const float* const* src, size_t width, bool greenFirst, float* c, float* g, float* o);
+        void BayerGreenRow(const float* const* src, size_t width, bool greenFirst, float* g);
+        void BayerChromaRow(const float* const* src, const float* const* green, size_t width, bool greenFirst, float* c, float* o);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,108 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBe16u_h__
+#define __SimdBe16u_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE size_t Channels16u(SimdPixelFormatType format)
+        {
+            switch (format)
+            {
+            case SimdPixelFormatGray16: return 1;
+            case SimdPixelFormatBgr48: return 3;
+            case SimdPixelFormatBgra64: return 4;
+            case SimdPixelFormatRgb48: return 3;
+            case SimdPixelFormatRgba64: return 4;
+            default: return 0;
+            }
+        }
+
+        SIMD_INLINE bool IsBgr16u(SimdPixelFormatType format)
+        {
+            return format == SimdPixelFormatBgr48 || format == SimdPixelFormatBgra64;
+        }
+
+        SIMD_INLINE uint16_t SwapBytes16u(uint16_t value)
+        {
+            return uint16_t((value >> 8) | (value << 8));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        /* Source channel for every destination channel: gray is replicated, extra alpha is dropped, missing alpha is -1 (opaque). */
+        SIMD_INLINE void Repack16uMap(size_t srcC, size_t dstC, bool swapRb, int map[4])
+        {
+            for (size_t d = 0; d < dstC; ++d)
+            {
+                if (srcC <= 2)
+                    map[d] = d < 3 ? 0 : (srcC == 2 ? 1 : -1);
+                else
+                    map[d] = d < 3 ? int(swapRb ? 2 - d : d) : (srcC == 4 ? 3 : -1);
+            }
+        }
+
+        /* Shuffle mask for one 16-byte block of pixels, returns number of pixels in the block. */
+        SIMD_INLINE size_t Repack16uMask(size_t srcC, size_t dstC, const int* map, bool swap, uint8_t mask[16], uint8_t fill[16])
+        {
+            size_t block = 8 / Max(srcC, dstC);
+            for (size_t i = 0; i < 16; ++i)
+                mask[i] = 0x80, fill[i] = 0x00;
+            for (size_t p = 0; p < block; ++p)
+            {
+                for (size_t d = 0; d < dstC; ++d)
+                {
+                    for (size_t b = 0; b < 2; ++b)
+                    {
+                        size_t o = (p * dstC + d) * 2 + b;
+                        if (map[d] < 0)
+                            fill[o] = 0xFF;
+                        else
+                            mask[o] = uint8_t((p * srcC + map[d]) * 2 + (swap ? 1 - b : b));
+                    }
+                }
+            }
+            return block;
+        }
+
+        SIMD_INLINE void Repack16u(const uint8_t* src, size_t srcC, size_t width, size_t dstC, const int* map, bool swap, uint8_t* dst)
+        {
+            const uint16_t* s = (const uint16_t*)src;
+            uint16_t* d = (uint16_t*)dst;
+            for (size_t x = 0; x < width; ++x, s += srcC, d += dstC)
+            {
+                for (size_t c = 0; c < dstC; ++c)
+                {
+                    uint16_t value = map[c] < 0 ? 0xFFFF : s[map[c]];
+                    d[c] = swap ? SwapBytes16u(value) : value;
+                }
+            }
+        }
+    }
+}
+#endif
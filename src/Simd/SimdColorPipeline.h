@@ -0,0 +1,138 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdColorPipeline_h__
+#define __SimdColorPipeline_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct ColorPipelineParam
+    {
+        SimdPixelFormatType format;
+        SimdColorPipelineFlags flags;
+        size_t channels, curveSize, lutSize;
+        bool matrix, curves, lut;
+
+        ColorPipelineParam(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags);
+
+        bool Valid() const
+        {
+            return (format == SimdPixelFormatBgr24 || format == SimdPixelFormatBgra32 || format == SimdPixelFormatRgb24 || format == SimdPixelFormatRgba32) &&
+                (!curves || (curveSize >= 2 && curveSize <= 0x10000)) && (!lut || (lutSize >= 2 && lutSize <= 256));
+        }
+
+        bool IsRgb() const
+        {
+            return format == SimdPixelFormatRgb24 || format == SimdPixelFormatRgba32;
+        }
+
+        bool CurvesAfterMatrix() const
+        {
+            return curves && matrix;
+        }
+
+        bool Lut16u() const
+        {
+            return lut && (flags & SimdColorPipelineLut16u);
+        }
+    };
+
+    /*
+    * All tables are stored in memory order of channels (B, G, R for BGR formats and R, G, B for RGB formats).
+    * input - 3 x 256 tables which convert 8-bit values to [0..1] range (with applied curves if there is no matrix).
+    * matrix - 3 x 3 matrix (row-major).
+    * curves - 3 x curveSize tables of curves which are applied after matrix.
+    * lut32f, lut16u - 3D LUT nodes: 4 values (3 channels and padding) per node.
+    * offset - node offset of the next LUT node along an axis of the channel.
+    */
+    struct ColorPipelineTables
+    {
+        Array32f input, curves, lut32f;
+        Array16u lut16u;
+        float matrix[9];
+        int offset[3];
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class ColorPipeline : Deletable
+    {
+    public:
+        typedef void(*RowPtr)(const ColorPipelineParam& p, const ColorPipelineTables& t, const uint8_t* src, size_t width, uint8_t* dst);
+
+        ColorPipeline(const ColorPipelineParam& param, const float* matrix, const float* curves, const float* lut);
+
+        void Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride) const;
+
+    protected:
+        ColorPipelineParam _param;
+        ColorPipelineTables _tables;
+        RowPtr _row;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class ColorPipeline : public Simd::ColorPipeline
+        {
+        public:
+            ColorPipeline(const ColorPipelineParam& param, const float* matrix, const float* curves, const float* lut);
+        };
+
+        void ColorPipelineRow(const ColorPipelineParam& p, const ColorPipelineTables& t, const uint8_t* src, size_t width, uint8_t* dst);
+
+        void* ColorPipelineInit(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        class ColorPipeline : public Base::ColorPipeline
+        {
+        public:
+            ColorPipeline(const ColorPipelineParam& param, const float* matrix, const float* curves, const float* lut);
+        };
+
+        void ColorPipelineRow(const ColorPipelineParam& p, const ColorPipelineTables& t, const uint8_t* src, size_t width, uint8_t* dst);
+
+        void* ColorPipelineInit(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class ColorPipeline : public Sse41::ColorPipeline
+        {
+        public:
+            ColorPipeline(const ColorPipelineParam& param, const float* matrix, const float* curves, const float* lut);
+        };
+
+        void* ColorPipelineInit(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags);
+    }
+#endif
+}
+#endif//__SimdColorPipeline_h__
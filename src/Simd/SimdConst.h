@@ -50,6 +50,10 @@ namespace Simd
         const int GREEN_TO_GRAY_WEIGHT = int(0.587*(1 << BGR_TO_GRAY_AVERAGING_SHIFT) + 0.5);
         const int RED_TO_GRAY_WEIGHT = int(0.299*(1 << BGR_TO_GRAY_AVERAGING_SHIFT) + 0.5);
 
+        const float BLUE_TO_GRAY_WEIGHT_32F = 0.114f;
+        const float GREEN_TO_GRAY_WEIGHT_32F = 0.587f;
+        const float RED_TO_GRAY_WEIGHT_32F = 0.299f;
+
         const int Y_ADJUST = 16;
         const int UV_ADJUST = 128;
         const int YUV_TO_BGR_AVERAGING_SHIFT = 13;
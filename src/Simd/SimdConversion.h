@@ -39,6 +39,11 @@ namespace Simd
                 RED_TO_GRAY_WEIGHT * red + BGR_TO_GRAY_ROUND_TERM) >> BGR_TO_GRAY_AVERAGING_SHIFT;
         }
 
+        SIMD_INLINE float BgrToGray32f(float blue, float green, float red)
+        {
+            return BLUE_TO_GRAY_WEIGHT_32F * blue + GREEN_TO_GRAY_WEIGHT_32F * green + RED_TO_GRAY_WEIGHT_32F * red;
+        }
+
         SIMD_INLINE int YuvToBlue(int y, int u)
         {
             return RestrictRange((Y_TO_RGB_WEIGHT*(y - Y_ADJUST) + U_TO_BLUE_WEIGHT * (u - UV_ADJUST) +
@@ -73,6 +73,12 @@ namespace Simd
             ((uint64_t*)dst)[0] = ((uint64_t*)src)[0];
             ((uint32_t*)dst)[2] = ((uint32_t*)src)[2];
         }
+
+        template<> SIMD_INLINE void CopyPixel<16>(const uint8_t* src, uint8_t* dst)
+        {
+            ((uint64_t*)dst)[0] = ((uint64_t*)src)[0];
+            ((uint64_t*)dst)[1] = ((uint64_t*)src)[1];
+        }
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -64,6 +64,90 @@ namespace Simd
         {
             return _mm_unpackhi_epi64(ab0, ab1);
         }
+
+        const __m128i K8_SHUFFLE_DEINTERLEAVE_16_2 = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, 0x2, 0x3, 0x6, 0x7, 0xA, 0xB, 0xE, 0xF);
+        const __m128i K8_SHUFFLE_DEINTERLEAVE_16_4 = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x8, 0x9, 0x2, 0x3, 0xA, 0xB, 0x4, 0x5, 0xC, 0xD, 0x6, 0x7, 0xE, 0xF);
+        const __m128i K8_SHUFFLE_DEINTERLEAVE_16_3[9] = {
+            SIMD_MM_SETR_EPI8(0x0, 0x1, 0x6, 0x7, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, 0x2, 0x3, 0x8, 0x9, 0xE, 0xF, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x4, 0x5, 0xA, 0xB),
+            SIMD_MM_SETR_EPI8(0x2, 0x3, 0x8, 0x9, 0xE, 0xF, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, 0x4, 0x5, 0xA, 0xB, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x0, 0x1, 0x6, 0x7, 0xC, 0xD),
+            SIMD_MM_SETR_EPI8(0x4, 0x5, 0xA, 0xB, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0x0, 0x1, 0x6, 0x7, 0xC, 0xD, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x2, 0x3, 0x8, 0x9, 0xE, 0xF) };
+        const __m128i K8_SHUFFLE_DEINTERLEAVE_32_3[9] = {
+            SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x3, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7),
+            SIMD_MM_SETR_EPI8(0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB),
+            SIMD_MM_SETR_EPI8(0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, 0xC, 0xD, 0xE, 0xF) };
+
+        template<size_t C> SIMD_INLINE void LoadDeinterleave16u(const uint8_t* src, __m128i* dst);
+
+        template<> SIMD_INLINE void LoadDeinterleave16u<2>(const uint8_t* src, __m128i* dst)
+        {
+            __m128i s0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src + 0), K8_SHUFFLE_DEINTERLEAVE_16_2);
+            __m128i s1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src + 1), K8_SHUFFLE_DEINTERLEAVE_16_2);
+            dst[0] = _mm_unpacklo_epi64(s0, s1);
+            dst[1] = _mm_unpackhi_epi64(s0, s1);
+        }
+
+        template<> SIMD_INLINE void LoadDeinterleave16u<3>(const uint8_t* src, __m128i* dst)
+        {
+            __m128i s0 = _mm_loadu_si128((const __m128i*)src + 0), s1 = _mm_loadu_si128((const __m128i*)src + 1), s2 = _mm_loadu_si128((const __m128i*)src + 2);
+            for (size_t c = 0; c < 3; ++c)
+                dst[c] = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(s0, K8_SHUFFLE_DEINTERLEAVE_16_3[c * 3 + 0]),
+                    _mm_shuffle_epi8(s1, K8_SHUFFLE_DEINTERLEAVE_16_3[c * 3 + 1])), _mm_shuffle_epi8(s2, K8_SHUFFLE_DEINTERLEAVE_16_3[c * 3 + 2]));
+        }
+
+        template<> SIMD_INLINE void LoadDeinterleave16u<4>(const uint8_t* src, __m128i* dst)
+        {
+            __m128i s0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src + 0), K8_SHUFFLE_DEINTERLEAVE_16_4);
+            __m128i s1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src + 1), K8_SHUFFLE_DEINTERLEAVE_16_4);
+            __m128i s2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src + 2), K8_SHUFFLE_DEINTERLEAVE_16_4);
+            __m128i s3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src + 3), K8_SHUFFLE_DEINTERLEAVE_16_4);
+            __m128i t0 = _mm_unpacklo_epi32(s0, s1), t1 = _mm_unpackhi_epi32(s0, s1);
+            __m128i t2 = _mm_unpacklo_epi32(s2, s3), t3 = _mm_unpackhi_epi32(s2, s3);
+            dst[0] = _mm_unpacklo_epi64(t0, t2);
+            dst[1] = _mm_unpackhi_epi64(t0, t2);
+            dst[2] = _mm_unpacklo_epi64(t1, t3);
+            dst[3] = _mm_unpackhi_epi64(t1, t3);
+        }
+
+        template<size_t C> SIMD_INLINE void LoadDeinterleave32f(const uint8_t* src, __m128i* dst);
+
+        template<> SIMD_INLINE void LoadDeinterleave32f<2>(const uint8_t* src, __m128i* dst)
+        {
+            __m128i s0 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)src + 0), 0xD8);
+            __m128i s1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)src + 1), 0xD8);
+            dst[0] = _mm_unpacklo_epi64(s0, s1);
+            dst[1] = _mm_unpackhi_epi64(s0, s1);
+        }
+
+        template<> SIMD_INLINE void LoadDeinterleave32f<3>(const uint8_t* src, __m128i* dst)
+        {
+            __m128i s0 = _mm_loadu_si128((const __m128i*)src + 0), s1 = _mm_loadu_si128((const __m128i*)src + 1), s2 = _mm_loadu_si128((const __m128i*)src + 2);
+            for (size_t c = 0; c < 3; ++c)
+                dst[c] = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(s0, K8_SHUFFLE_DEINTERLEAVE_32_3[c * 3 + 0]),
+                    _mm_shuffle_epi8(s1, K8_SHUFFLE_DEINTERLEAVE_32_3[c * 3 + 1])), _mm_shuffle_epi8(s2, K8_SHUFFLE_DEINTERLEAVE_32_3[c * 3 + 2]));
+        }
+
+        template<> SIMD_INLINE void LoadDeinterleave32f<4>(const uint8_t* src, __m128i* dst)
+        {
+            __m128i s0 = _mm_loadu_si128((const __m128i*)src + 0), s1 = _mm_loadu_si128((const __m128i*)src + 1), s2 = _mm_loadu_si128((const __m128i*)src + 2), s3 = _mm_loadu_si128((const __m128i*)src + 3);
+            __m128i t0 = _mm_unpacklo_epi32(s0, s1), t1 = _mm_unpacklo_epi32(s2, s3);
+            __m128i t2 = _mm_unpackhi_epi32(s0, s1), t3 = _mm_unpackhi_epi32(s2, s3);
+            dst[0] = _mm_unpacklo_epi64(t0, t1);
+            dst[1] = _mm_unpackhi_epi64(t0, t1);
+            dst[2] = _mm_unpacklo_epi64(t2, t3);
+            dst[3] = _mm_unpackhi_epi64(t2, t3);
+        }
     }
 #endif
 
@@ -124,6 +208,119 @@ namespace Simd
         {
             return _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(ab0, ab1), 0xD8);
         }
+
+        const __m256i K8_SHUFFLE_DEINTERLEAVE_16_2 = SIMD_MM256_SETR_EPI8(
+            0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, 0x2, 0x3, 0x6, 0x7, 0xA, 0xB, 0xE, 0xF,
+            0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, 0x2, 0x3, 0x6, 0x7, 0xA, 0xB, 0xE, 0xF);
+        const __m256i K8_SHUFFLE_DEINTERLEAVE_16_4 = SIMD_MM256_SETR_EPI8(
+            0x0, 0x1, 0x8, 0x9, 0x2, 0x3, 0xA, 0xB, 0x4, 0x5, 0xC, 0xD, 0x6, 0x7, 0xE, 0xF,
+            0x0, 0x1, 0x8, 0x9, 0x2, 0x3, 0xA, 0xB, 0x4, 0x5, 0xC, 0xD, 0x6, 0x7, 0xE, 0xF);
+        const __m256i K8_SHUFFLE_DEINTERLEAVE_16_3[9] = {
+            SIMD_MM256_SETR_EPI8(0x0, 0x1, 0x6, 0x7, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x6, 0x7, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, 0x2, 0x3, 0x8, 0x9, 0xE, 0xF, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, 0x2, 0x3, 0x8, 0x9, 0xE, 0xF, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x4, 0x5, 0xA, 0xB,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x4, 0x5, 0xA, 0xB),
+            SIMD_MM256_SETR_EPI8(0x2, 0x3, 0x8, 0x9, 0xE, 0xF, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x2, 0x3, 0x8, 0x9, 0xE, 0xF, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, 0x4, 0x5, 0xA, 0xB, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, 0x4, 0x5, 0xA, 0xB, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x0, 0x1, 0x6, 0x7, 0xC, 0xD,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x0, 0x1, 0x6, 0x7, 0xC, 0xD),
+            SIMD_MM256_SETR_EPI8(0x4, 0x5, 0xA, 0xB, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x4, 0x5, 0xA, 0xB, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, 0x0, 0x1, 0x6, 0x7, 0xC, 0xD, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, 0x0, 0x1, 0x6, 0x7, 0xC, 0xD, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x2, 0x3, 0x8, 0x9, 0xE, 0xF,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x2, 0x3, 0x8, 0x9, 0xE, 0xF) };
+        const __m256i K8_SHUFFLE_DEINTERLEAVE_32_3[9] = {
+            SIMD_MM256_SETR_EPI8(0x0, 0x1, 0x2, 0x3, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x3, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7),
+            SIMD_MM256_SETR_EPI8(0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1,
+                -1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB),
+            SIMD_MM256_SETR_EPI8(0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, 0xC, 0xD, 0xE, 0xF,
+                -1, -1, -1, -1, -1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, 0xC, 0xD, 0xE, 0xF) };
+
+        template<size_t C> SIMD_INLINE void LoadDeinterleave16u(const uint8_t* src, __m256i* dst);
+
+        template<> SIMD_INLINE void LoadDeinterleave16u<2>(const uint8_t* src, __m256i* dst)
+        {
+            __m256i s0 = _mm256_shuffle_epi8(Load<false>((const __m128i*)(src + 0), (const __m128i*)(src + 32)), K8_SHUFFLE_DEINTERLEAVE_16_2);
+            __m256i s1 = _mm256_shuffle_epi8(Load<false>((const __m128i*)(src + 16), (const __m128i*)(src + 48)), K8_SHUFFLE_DEINTERLEAVE_16_2);
+            dst[0] = _mm256_unpacklo_epi64(s0, s1);
+            dst[1] = _mm256_unpackhi_epi64(s0, s1);
+        }
+
+        template<> SIMD_INLINE void LoadDeinterleave16u<3>(const uint8_t* src, __m256i* dst)
+        {
+            __m256i s0 = Load<false>((const __m128i*)(src + 0), (const __m128i*)(src + 48));
+            __m256i s1 = Load<false>((const __m128i*)(src + 16), (const __m128i*)(src + 64));
+            __m256i s2 = Load<false>((const __m128i*)(src + 32), (const __m128i*)(src + 80));
+            for (size_t c = 0; c < 3; ++c)
+                dst[c] = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(s0, K8_SHUFFLE_DEINTERLEAVE_16_3[c * 3 + 0]),
+                    _mm256_shuffle_epi8(s1, K8_SHUFFLE_DEINTERLEAVE_16_3[c * 3 + 1])), _mm256_shuffle_epi8(s2, K8_SHUFFLE_DEINTERLEAVE_16_3[c * 3 + 2]));
+        }
+
+        template<> SIMD_INLINE void LoadDeinterleave16u<4>(const uint8_t* src, __m256i* dst)
+        {
+            __m256i s0 = _mm256_shuffle_epi8(Load<false>((const __m128i*)(src + 0), (const __m128i*)(src + 64)), K8_SHUFFLE_DEINTERLEAVE_16_4);
+            __m256i s1 = _mm256_shuffle_epi8(Load<false>((const __m128i*)(src + 16), (const __m128i*)(src + 80)), K8_SHUFFLE_DEINTERLEAVE_16_4);
+            __m256i s2 = _mm256_shuffle_epi8(Load<false>((const __m128i*)(src + 32), (const __m128i*)(src + 96)), K8_SHUFFLE_DEINTERLEAVE_16_4);
+            __m256i s3 = _mm256_shuffle_epi8(Load<false>((const __m128i*)(src + 48), (const __m128i*)(src + 112)), K8_SHUFFLE_DEINTERLEAVE_16_4);
+            __m256i t0 = _mm256_unpacklo_epi32(s0, s1), t1 = _mm256_unpackhi_epi32(s0, s1);
+            __m256i t2 = _mm256_unpacklo_epi32(s2, s3), t3 = _mm256_unpackhi_epi32(s2, s3);
+            dst[0] = _mm256_unpacklo_epi64(t0, t2);
+            dst[1] = _mm256_unpackhi_epi64(t0, t2);
+            dst[2] = _mm256_unpacklo_epi64(t1, t3);
+            dst[3] = _mm256_unpackhi_epi64(t1, t3);
+        }
+
+        template<size_t C> SIMD_INLINE void LoadDeinterleave32f(const uint8_t* src, __m256i* dst);
+
+        template<> SIMD_INLINE void LoadDeinterleave32f<2>(const uint8_t* src, __m256i* dst)
+        {
+            __m256i s0 = _mm256_shuffle_epi32(Load<false>((const __m128i*)(src + 0), (const __m128i*)(src + 32)), 0xD8);
+            __m256i s1 = _mm256_shuffle_epi32(Load<false>((const __m128i*)(src + 16), (const __m128i*)(src + 48)), 0xD8);
+            dst[0] = _mm256_unpacklo_epi64(s0, s1);
+            dst[1] = _mm256_unpackhi_epi64(s0, s1);
+        }
+
+        template<> SIMD_INLINE void LoadDeinterleave32f<3>(const uint8_t* src, __m256i* dst)
+        {
+            __m256i s0 = Load<false>((const __m128i*)(src + 0), (const __m128i*)(src + 48));
+            __m256i s1 = Load<false>((const __m128i*)(src + 16), (const __m128i*)(src + 64));
+            __m256i s2 = Load<false>((const __m128i*)(src + 32), (const __m128i*)(src + 80));
+            for (size_t c = 0; c < 3; ++c)
+                dst[c] = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(s0, K8_SHUFFLE_DEINTERLEAVE_32_3[c * 3 + 0]),
+                    _mm256_shuffle_epi8(s1, K8_SHUFFLE_DEINTERLEAVE_32_3[c * 3 + 1])), _mm256_shuffle_epi8(s2, K8_SHUFFLE_DEINTERLEAVE_32_3[c * 3 + 2]));
+        }
+
+        template<> SIMD_INLINE void LoadDeinterleave32f<4>(const uint8_t* src, __m256i* dst)
+        {
+            __m256i s0 = Load<false>((const __m128i*)(src + 0), (const __m128i*)(src + 64));
+            __m256i s1 = Load<false>((const __m128i*)(src + 16), (const __m128i*)(src + 80));
+            __m256i s2 = Load<false>((const __m128i*)(src + 32), (const __m128i*)(src + 96));
+            __m256i s3 = Load<false>((const __m128i*)(src + 48), (const __m128i*)(src + 112));
+            __m256i t0 = _mm256_unpacklo_epi32(s0, s1), t1 = _mm256_unpacklo_epi32(s2, s3);
+            __m256i t2 = _mm256_unpackhi_epi32(s0, s1), t3 = _mm256_unpackhi_epi32(s2, s3);
+            dst[0] = _mm256_unpacklo_epi64(t0, t1);
+            dst[1] = _mm256_unpackhi_epi64(t0, t1);
+            dst[2] = _mm256_unpacklo_epi64(t2, t3);
+            dst[3] = _mm256_unpackhi_epi64(t2, t3);
+        }
     }
 #endif
 
@@ -31,6 +31,10 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <limits.h>
 
@@ -152,6 +156,8 @@ namespace Simd
         \endcode
 
         \note This is wrapper around low-level \ref object_detection API.
+        Integral images of all scale levels and row tiles of all cascades are processed by common task queue 
+        with using of several threads, so integral images of the next level are estimated while current level is scanned.
     */
     template <template<class> class A>
     struct Detection
@@ -204,6 +210,9 @@ namespace Simd
             }
         };
         typedef std::vector<Object> Objects; /*!< A vector of objects type defenition. */
+        typedef std::vector<Objects> ObjectsList; /*!< A list of vectors of objects (one vector per image in batch detection). */
+        typedef std::vector<View> Views; /*!< A vector of images type definition. */
+        typedef std::vector<Rects> RectsList; /*!< A list of vectors of rectangles (one vector per image in batch detection). */
 
         /*!
             Creates a new empty Detection structure.
@@ -285,6 +294,7 @@ namespace Simd
             \param [in] roi - a 8-bit image mask which defines Region Of Interest. User can restricts detection region with using this mask.
                               The mask affects to the center of detected object.
             \param [in] threadNumber - a number of work threads. It useful for multi core CPU. Use value -1 to auto choose of thread number.
+                                       It also limits the number of images processed at once in batch detection.
             \return a result of this operation.
         */
         bool Init(const Size & imageSize, double scaleFactor = 1.1, const Size & sizeMin = Size(0, 0),
@@ -293,9 +303,18 @@ namespace Simd
             if (_data.empty())
                 return false;
             _imageSize = imageSize;
-            ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
-            _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
-            return InitLevels(scaleFactor, sizeMin, sizeMax, roi);
+            _threadNumber = threadNumber > 0 ? threadNumber : std::max<ptrdiff_t>(std::thread::hardware_concurrency(), 1);
+            _scaleFactor = scaleFactor;
+            _sizeMin = sizeMin;
+            _sizeMax = sizeMax;
+            _roi.Clear();
+            if (roi.format != View::None)
+            {
+                _roi.Recreate(roi.Size(), roi.format);
+                Simd::Copy(roi, _roi);
+            }
+            _pool.clear();
+            return InitLevels(_levels);
         }
 
         /*!
@@ -318,37 +337,68 @@ namespace Simd
             if (_levels.empty() || src.Size() != _imageSize)
                 return false;
 
-            FillLevels(src);
+            Tasks tasks;
+            BuildTasks(_levels, src, motionMask, motionRegions, tasks);
+            RunTasks(tasks);
+            CollectObjects(tasks, 0, tasks.size(), objects, groupSizeMin, sizeDifferenceMax);
 
-            typedef std::map<Tag, Objects> Candidates;
-            Candidates candidates;
+            return true;
+        }
 
-            for (size_t i = 0; i < _levels.size(); ++i)
-            {
-                Level & level = *_levels[i];
-                View mask = level.roi;
-                Rect rect = level.rect;
-                if (motionMask)
-                {
-                    FillMotionMask(motionRegions, level, rect);
-                    mask = level.mask;
-                }
-                if (rect.Empty())
-                    continue;
-                for (size_t j = 0; j < level.hids.size(); ++j)
-                {
-                    Hid & hid = level.hids[j];
+        /*!
+            Detects objects at several images (for example, at frames of several video streams) at once.
+            All images must have size given in method Detection::Init. Images are processed in groups of up to thread number images.
+            Loaded cascade data are shared between images, but every image of a group has its own scale levels in internal pool: 
+            their integral images and detector contexts (created by ::SimdDetectionInit, which binds a cascade to given integral images). 
+            The pool is created once and reused by later calls. All levels of all images of a group are processed 
+            by common task queue with using of several threads.
+
+            \param [in] src - a list of input images.
+            \param [out] objects - a list of detected objects (one vector per input image).
+            \param [in] groupSizeMin - a minimal weight (number of elementary detections) of detected image.
+            \param [in] sizeDifferenceMax - a parameter to group elementary detections.
+            \param [in] motionMask - an using of motion detection flag. Useful for dynamical restriction of detection region to addition to ROI.
+            \param [in] motionRegions - a list of sets of rectangles (motion regions or ROI, one set per input image) to restrict detection region to addition to ROI.
+                                        The regions affect to the center of detected object. It must have the same size as src if motionMask is true.
+            \return a result of this operation.
+        */
+        bool Detect(const Views & src, ObjectsList & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2,
+            bool motionMask = false, const RectsList & motionRegions = RectsList())
+        {
+            SIMD_CHECK_PERFORMANCE();
 
-                    hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
+            if (_levels.empty() || (motionMask && motionRegions.size() != src.size()))
+                return false;
+            for (size_t i = 0; i < src.size(); ++i)
+                if (src[i].Size() != _imageSize)
+                    return false;
 
-                    AddObjects(candidates[hid.data->tag], level.dst, rect, hid.data->size, level.scale,
-                        level.throughColumn ? 2 : 1, hid.data->tag);
-                }
+            size_t contexts = std::min<size_t>(src.size(), std::max<ptrdiff_t>(_threadNumber, 1));
+            while (_pool.size() + 1 < contexts)
+            {
+                _pool.push_back(LevelPtrs());
+                if (!InitLevels(_pool.back()))
+                    return false;
             }
 
-            objects.clear();
-            for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
-                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
+            objects.resize(src.size());
+            Tasks tasks;
+            std::vector<size_t> offsets;
+            for (size_t begin = 0; begin < src.size(); begin += contexts)
+            {
+                size_t end = std::min(begin + contexts, src.size());
+                tasks.clear();
+                offsets.clear();
+                for (size_t i = begin; i < end; ++i)
+                {
+                    offsets.push_back(tasks.size());
+                    BuildTasks(i == begin ? _levels : _pool[i - begin - 1], src[i], motionMask, motionMask ? motionRegions[i] : Rects(), tasks);
+                }
+                offsets.push_back(tasks.size());
+                RunTasks(tasks);
+                for (size_t i = begin; i < end; ++i)
+                    CollectObjects(tasks, offsets[i - begin], offsets[i - begin + 1], objects[i], groupSizeMin, sizeDifferenceMax);
+            }
 
             return true;
         }
@@ -381,21 +431,26 @@ namespace Simd
             Handle handle;
             Data * data;
             DetectPtr detect;
+            View dst;
 
-            void Detect(const View & mask, const Rect & rect, View & dst, size_t threadNumber, bool throughColumn)
+            Rect Area(const Rect & rect) const
             {
-                SIMD_CHECK_PERFORMANCE();
+                return rect.Shifted(-data->size / 2).Intersection(Rect(dst.Size() - data->size));
+            }
 
-                Size s = dst.Size() - data->size;
-                View m = mask.Region(s, View::MiddleCenter);
-                Rect r = rect.Shifted(-data->size / 2).Intersection(Rect(s));
+            void Prepare()
+            {
                 Simd::Fill(dst, 0);
                 ::SimdDetectionPrepare(handle);
+            }
 
-                Parallel(r.top, r.bottom, [&](size_t thread, size_t begin, size_t end)
-                {
-                    detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
-                }, rect.Area() >= (data->Haar() ? 10000 : 30000) ? threadNumber : 1, throughColumn ? 2 : 1);
+            void Detect(const View & mask, const Rect & rect, ptrdiff_t begin, ptrdiff_t end) const
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                View m = mask.Region(dst.Size() - data->size, View::MiddleCenter);
+                Rect r = Area(rect);
+                detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
             }
         };
         typedef std::vector<Hid> Hids;
@@ -416,11 +471,31 @@ namespace Simd
             View tilted;
 
             View dst;
+            View gray;
 
             bool throughColumn;
             bool needSqsum;
             bool needTilted;
 
+            bool ready;
+            std::mutex mutex;
+            std::condition_variable condition;
+
+            void Wait()
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this] { return ready; });
+            }
+
+            void SetReady()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ready = true;
+                }
+                condition.notify_all();
+            }
+
             ~Level()
             {
                 for (size_t i = 0; i < hids.size(); ++i)
@@ -430,17 +505,41 @@ namespace Simd
         typedef std::shared_ptr<Level> LevelPtr;
         typedef std::vector<LevelPtr> LevelPtrs;
 
+        struct Task
+        {
+            Level * level;
+            Level * top;
+            const View * src;
+            Hid * hid;
+            const View * mask;
+            Rect rect;
+            ptrdiff_t begin, end;
+
+            Task(Level * l, Level * t, const View * s, Hid * h = NULL, const View * m = NULL, const Rect & r = Rect(), ptrdiff_t b = 0, ptrdiff_t e = 0)
+                : level(l), top(t), src(s), hid(h), mask(m), rect(r), begin(b), end(e)
+            {
+            }
+        };
+        typedef std::vector<Task> Tasks;
+
         std::vector<Data> _data;
         Size _imageSize;
         bool _needNormalization;
         ptrdiff_t _threadNumber;
+        double _scaleFactor;
+        Size _sizeMin, _sizeMax;
+        View _roi;
         LevelPtrs _levels;
+        std::vector<LevelPtrs> _pool;
 
-        bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
+        bool InitLevels(LevelPtrs & levels)
         {
+            const double scaleFactor = _scaleFactor;
+            const Size & sizeMin = _sizeMin, & sizeMax = _sizeMax;
+            const View & roi = _roi;
             _needNormalization = false;
-            _levels.clear();
-            _levels.reserve(100);
+            levels.clear();
+            levels.reserve(100);
             double scale = 1.0;
             do
             {
@@ -462,8 +561,8 @@ namespace Simd
 
                 if (insert)
                 {
-                    _levels.push_back(LevelPtr(new Level()));
-                    Level & level = *_levels.back();
+                    levels.push_back(LevelPtr(new Level()));
+                    Level & level = *levels.back();
 
                     level.scale = scale;
                     level.throughColumn = scale <= 2.0;
@@ -477,7 +576,10 @@ namespace Simd
                     level.sqsum.Recreate(scaledSize + Size(1, 1), View::Int32);
                     level.tilted.Recreate(scaledSize + Size(1, 1), View::Int32);
 
-                    level.dst.Recreate(scaledSize, View::Gray8);
+                    size_t count = 0;
+                    for (size_t i = 0; i < _data.size(); ++i)
+                        count += inserts[i] ? 1 : 0;
+                    level.dst.Recreate(scaledSize.x, scaledSize.y * count, View::Gray8);
 
                     level.needSqsum = false, level.needTilted = false;
                     for (size_t i = 0; i < _data.size(); ++i)
@@ -500,6 +602,8 @@ namespace Simd
                                 else
                                     hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect32fi : ::SimdDetectionLbpDetect32fp;
                             }
+                            ptrdiff_t top = scaledSize.y * level.hids.size();
+                            hid.dst = level.dst.Region(0, top, scaledSize.x, top + scaledSize.y);
                             level.hids.push_back(hid);
                         }
                         else
@@ -521,28 +625,109 @@ namespace Simd
                 }
                 scale *= scaleFactor;
             } while (true);
-            return !_levels.empty();
+            return !levels.empty();
         }
 
-        void FillLevels(View src)
+        void BuildTasks(LevelPtrs & levels, const View & src, bool motionMask, const Rects & motionRegions, Tasks & tasks)
         {
-            View gray;
-            if (src.format != View::Gray8)
+            const ptrdiff_t TILE_AREA = 16384;
+            Level * top = levels[0].get();
+            for (size_t i = 0; i < levels.size(); ++i)
+                levels[i]->ready = false;
+            tasks.push_back(Task(top, top, &src));
+            for (size_t i = 0; i < levels.size(); ++i)
+            {
+                if (i + 1 < levels.size())
+                    tasks.push_back(Task(levels[i + 1].get(), top, &src));
+                Level & level = *levels[i];
+                const View * mask = &level.roi;
+                Rect rect = level.rect;
+                if (motionMask)
+                {
+                    FillMotionMask(motionRegions, level, rect);
+                    mask = &level.mask;
+                }
+                if (rect.Empty())
+                    continue;
+                ptrdiff_t step = level.throughColumn ? 2 : 1;
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    Hid & hid = level.hids[j];
+                    Rect r = hid.Area(rect);
+                    if (r.Empty())
+                        continue;
+                    ptrdiff_t rows = (std::max<ptrdiff_t>(TILE_AREA / r.Width(), 1) + step - 1) / step * step;
+                    for (ptrdiff_t row = r.top; row < r.bottom; row += rows)
+                        tasks.push_back(Task(&level, top, &src, &hid, mask, rect, row, std::min(row + rows, r.bottom)));
+                }
+            }
+        }
+
+        void RunTask(const Task & task)
+        {
+            Level & level = *task.level;
+            if (task.hid)
             {
-                gray.Recreate(src.Size(), View::Gray8);
-                Convert(src, gray);
-                src = gray;
+                level.Wait();
+                task.hid->Detect(*task.mask, task.rect, task.begin, task.end);
             }
+            else
+            {
+                Level & top = *task.top;
+                if (&level == &top)
+                {
+                    const View * src = task.src;
+                    if (src->format != View::Gray8)
+                    {
+                        if (level.gray.Size() != src->Size())
+                            level.gray.Recreate(src->Size(), View::Gray8);
+                        Convert(*src, level.gray);
+                        src = &level.gray;
+                    }
+                    Simd::Resize(*src, level.src, SimdResizeMethodBilinear);
+                    if (_needNormalization)
+                        Simd::NormalizeHistogram(level.src, level.src);
+                }
+                else
+                {
+                    top.Wait();
+                    Simd::Resize(top.src, level.src, SimdResizeMethodBilinear);
+                }
+                EstimateIntegral(level);
+                for (size_t i = 0; i < level.hids.size(); ++i)
+                    level.hids[i].Prepare();
+                level.SetReady();
+            }
+        }
 
-            Simd::Resize(src, _levels[0]->src, SimdResizeMethodBilinear);
-            if (_needNormalization)
-                Simd::NormalizeHistogram(_levels[0]->src, _levels[0]->src);
-            EstimateIntegral(*_levels[0]);
-            for (size_t i = 1; i < _levels.size(); ++i)
+        void RunTasks(const Tasks & tasks)
+        {
+            std::atomic<size_t> next(0);
+            Parallel(0, _threadNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = next++; i < tasks.size(); i = next++)
+                    RunTask(tasks[i]);
+            }, _threadNumber);
+        }
+
+        void CollectObjects(const Tasks & tasks, size_t begin, size_t end, Objects & objects, int groupSizeMin, double sizeDifferenceMax)
+        {
+            typedef std::map<Tag, Objects> Candidates;
+            Candidates candidates;
+            for (size_t i = begin; i < end; ++i)
             {
-                Simd::Resize(_levels[0]->src, _levels[i]->src, SimdResizeMethodBilinear);
-                EstimateIntegral(*_levels[i]);
+                const Task & task = tasks[i];
+                if (task.hid && task.begin == task.hid->Area(task.rect).top)
+                {
+                    const Level & level = *task.level;
+                    const Hid & hid = *task.hid;
+                    AddObjects(candidates[hid.data->tag], hid.dst, task.rect, hid.data->size, level.scale,
+                        level.throughColumn ? 2 : 1, hid.data->tag);
+                }
             }
+            objects.clear();
+            for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
+                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
         }
 
         void EstimateIntegral(Level & level)
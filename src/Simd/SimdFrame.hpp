@@ -29,6 +29,9 @@
 
 #include "Simd/SimdLib.hpp"
 
+#include <vector>
+#include <climits>
+
 namespace Simd
 {
     /*! @ingroup cpp_frame
@@ -71,6 +74,34 @@ namespace Simd
             Yuv444p,
             /*! One plane 24-bit (3 8-bit channels) Lab (CIELAB) pixel format. */
             Lab24,
+            /*! Two planes (16-bit full size Y plane, 32-bit interlived half size UV plane) P010 pixel format (10-bit samples are stored in high bits). */
+            P010,
+            /*! Two planes (16-bit full size Y plane, 32-bit interlived half size UV plane) P012 pixel format (12-bit samples are stored in high bits). */
+            P012,
+            /*! Two planes (16-bit full size Y plane, 32-bit interlived half size UV plane) P016 pixel format. */
+            P016,
+            /*! Three planes (16-bit full size Y plane, 16-bit half size U plane, 16-bit half size V plane) YUV420P10LE pixel format (10-bit samples are stored in low bits). */
+            Yuv420p10,
+            /*! Three planes (16-bit full size Y plane, 16-bit half size U plane, 16-bit half size V plane) YUV420P12LE pixel format (12-bit samples are stored in low bits). */
+            Yuv420p12,
+            /*! Three planes (16-bit full size Y plane, 16-bit half size U plane, 16-bit half size V plane) YUV420P16LE pixel format. */
+            Yuv420p16,
+            /*! Three planes (16-bit full size Y, U, V planes) YUV444P10LE pixel format (10-bit samples are stored in low bits). */
+            Yuv444p10,
+            /*! Three planes (16-bit full size Y, U, V planes) YUV444P12LE pixel format (12-bit samples are stored in low bits). */
+            Yuv444p12,
+            /*! Two planes (8-bit full size Y plane, 16-bit interlived half size VU plane) NV21 pixel format. */
+            Nv21,
+            /*! Two planes (16-bit full size Y plane, 32-bit interlived half width UV plane) P210 pixel format (10-bit samples are stored in high bits). */
+            P210,
+            /*! Two planes (16-bit full size Y plane, 32-bit interlived half width UV plane) P216 pixel format. */
+            P216,
+            /*! Three planes (16-bit full size Y plane, 16-bit half width U plane, 16-bit half width V plane) YUV422P10LE pixel format (10-bit samples are stored in low bits). */
+            Yuv422p10,
+            /*! Three planes (16-bit full size Y plane, 16-bit half width U plane, 16-bit half width V plane) YUV422P12LE pixel format (12-bit samples are stored in low bits). */
+            Yuv422p12,
+            /*! Three planes (16-bit full size Y plane, 16-bit half width U plane, 16-bit half width V plane) YUV422P16LE pixel format. */
+            Yuv422p16,
         };
 
         typedef void (*DeleterPtr)(void* context); /*!< Deleter callback definition. */
@@ -418,13 +449,96 @@ namespace Simd
 
         \short Converts one frame to another frame.
 
-        The frames must have the same width and height.
+        The frames must have the same width and height. 
+        Pixel formats without direct conversion are converted with using of Simd::FrameConverter (through one or several intermediate formats).
 
         \param [in] src - an input frame.
         \param [out] dst - an output frame.
     */
     template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
 
+    /*! @ingroup cpp_frame
+
+        \short The FrameConverter structure provides plan-based conversion of frames between different pixel formats.
+
+        The converter searches the cheapest chain of direct conversions (in terms of memory traffic per pixel) between input and output pixel formats.
+        A chain of several conversions is executed stripe by stripe: intermediate results are stored in small buffers which fit in L2 cache, 
+        so full size intermediate frames are not created. The conversion plan is reused while size, pixel formats and YUV types of converted frames are not changed.
+    */
+    template <template<class> class A>
+    struct FrameConverter
+    {
+        typedef Simd::Frame<A> Frame; /*!< Frame type definition. */
+        typedef typename Frame::Format Format; /*!< Pixel format type definition. */
+
+        /*!
+            Creates a new empty FrameConverter structure.
+        */
+        FrameConverter();
+
+        /*!
+            Initializes a conversion plan. It does nothing if the plan for given parameters has already been created.
+
+            \param [in] width - a width of converted frames.
+            \param [in] height - a height of converted frames.
+            \param [in] srcFormat - a pixel format of input frame.
+            \param [in] dstFormat - a pixel format of output frame.
+            \param [in] srcYuvType - a YUV format type of input frame. It is equal to ::SimdYuvUnknown by default.
+            \param [in] dstYuvType - a YUV format type of output frame. It is equal to ::SimdYuvUnknown by default.
+            \param [in] stripe - a height of processed stripe. If it is equal to 0 (by default) then stripe height is estimated on the base of L2 cache size.
+            \return a result of initialization (false if there is no way to convert given pixel formats).
+        */
+        bool Init(size_t width, size_t height, Format srcFormat, Format dstFormat, SimdYuvType srcYuvType = SimdYuvUnknown, SimdYuvType dstYuvType = SimdYuvUnknown, size_t stripe = 0);
+
+        /*!
+            Gets number of direct conversions in current plan.
+
+            \return - number of direct conversions (0 if the plan is not initialized).
+        */
+        size_t Hops() const;
+
+        /*!
+            Gets pixel format of the node of current plan.
+
+            \param [in] index - an index of the node (0 - input pixel format, Hops() - output pixel format).
+            \return - pixel format of the node.
+        */
+        Format Node(size_t index) const;
+
+        /*!
+            Gets height of processed stripe.
+
+            \return - height of stripe.
+        */
+        size_t Stripe() const;
+
+        /*!
+            Converts one frame to another frame. The conversion plan is initialized (or reused) automatically.
+
+            \param [in] src - an input frame.
+            \param [out] dst - an output frame. It must have the same size as input frame.
+            \return a result of conversion (false if there is no way to convert given pixel formats).
+        */
+        bool Convert(const Frame & src, Frame & dst);
+
+    private:
+        size_t _width, _height, _stripe, _stripeParam;
+        Format _srcFormat, _dstFormat;
+        SimdYuvType _srcYuvType, _dstYuvType;
+        std::vector<Format> _path;
+        std::vector<Frame> _buffers;
+
+        bool Plan();
+
+        static bool IsRgb(Format format);
+        static bool IsYuv(Format format);
+        static bool IsYuv8(Format format);
+        static bool IsYuv444(Format format);
+        static bool Similar(Format a, Format b);
+        static int Bits(Format format);
+        static int Cost(Format src, Format dst);
+    };
+
     //-------------------------------------------------------------------------------------------------
 
     // struct Frame implementation:
@@ -562,6 +676,7 @@ namespace Simd
         case None:
             break;
         case Nv12:
+        case Nv21:
             assert((width & 1) == 0 && (height & 1) == 0);
             planes[0] = View<A>(width, height, stride0, View<A>::Gray8, data0);
             planes[1] = View<A>(width / 2, height / 2, stride1, View<A>::Uv16, data1);
@@ -613,6 +728,51 @@ namespace Simd
             if (yuvType != SimdYuvUnknown)
                 *(SimdYuvType*)&yuvType = SimdYuvUnknown;
             break;
+        case P010:
+        case P012:
+        case P016:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width, height / 2, stride1, View<A>::Int16, data1);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt709;
+            break;
+        case Yuv420p10:
+        case Yuv420p12:
+        case Yuv420p16:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width / 2, height / 2, stride1, View<A>::Int16, data1);
+            planes[2] = View<A>(width / 2, height / 2, stride2, View<A>::Int16, data2);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt709;
+            break;
+        case Yuv444p10:
+        case Yuv444p12:
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width, height, stride1, View<A>::Int16, data1);
+            planes[2] = View<A>(width, height, stride2, View<A>::Int16, data2);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt709;
+            break;
+        case P210:
+        case P216:
+            assert((width & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width, height, stride1, View<A>::Int16, data1);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt709;
+            break;
+        case Yuv422p10:
+        case Yuv422p12:
+        case Yuv422p16:
+            assert((width & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width / 2, height, stride1, View<A>::Int16, data1);
+            planes[2] = View<A>(width / 2, height, stride2, View<A>::Int16, data2);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt709;
+            break;
         default:
             assert(0);
         }
@@ -702,6 +862,7 @@ namespace Simd
         case None:
             break;
         case Nv12:
+        case Nv21:
             assert((width & 1) == 0 && (height & 1) == 0);
             planes[0].Recreate(width, height, View<A>::Gray8);
             planes[1].Recreate(width / 2, height / 2, View<A>::Uv16);
@@ -753,6 +914,51 @@ namespace Simd
             if (yuvType != SimdYuvUnknown)
                 *(SimdYuvType*)&yuvType = SimdYuvUnknown;
             break;
+        case P010:
+        case P012:
+        case P016:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width, height / 2, View<A>::Int16);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt709;
+            break;
+        case Yuv420p10:
+        case Yuv420p12:
+        case Yuv420p16:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width / 2, height / 2, View<A>::Int16);
+            planes[2].Recreate(width / 2, height / 2, View<A>::Int16);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt709;
+            break;
+        case Yuv444p10:
+        case Yuv444p12:
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width, height, View<A>::Int16);
+            planes[2].Recreate(width, height, View<A>::Int16);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt709;
+            break;
+        case P210:
+        case P216:
+            assert((width & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width, height, View<A>::Int16);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt709;
+            break;
+        case Yuv422p10:
+        case Yuv422p12:
+        case Yuv422p16:
+            assert((width & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width / 2, height, View<A>::Int16);
+            planes[2].Recreate(width / 2, height, View<A>::Int16);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt709;
+            break;
         default:
             assert(0);
         }
@@ -778,7 +984,13 @@ namespace Simd
             right = std::min<ptrdiff_t>(std::max<ptrdiff_t>(right, 0), width);
             bottom = std::min<ptrdiff_t>(std::max<ptrdiff_t>(bottom, 0), height);
 
-            if (format == Nv12 || format == Yuv420p)
+            bool p016 = format == P010 || format == P012 || format == P016;
+            bool yuv420p16 = format == Yuv420p10 || format == Yuv420p12 || format == Yuv420p16;
+            bool yuv444p16 = format == Yuv444p10 || format == Yuv444p12;
+            bool p216 = format == P210 || format == P216;
+            bool yuv422p16 = format == Yuv422p10 || format == Yuv422p12 || format == Yuv422p16;
+
+            if (format == Nv12 || format == Nv21 || format == Yuv420p || p016 || yuv420p16)
             {
                 left = left & ~1;
                 top = top & ~1;
@@ -786,6 +998,12 @@ namespace Simd
                 bottom = (bottom + 1) & ~1;
             }
 
+            if (p216 || yuv422p16)
+            {
+                left = left & ~1;
+                right = (right + 1) & ~1;
+            }
+
             Frame frame;
             *(size_t*)&frame.width = right - left;
             *(size_t*)&frame.height = bottom - top;
@@ -796,18 +1014,30 @@ namespace Simd
 
             frame.planes[0] = planes[0].Region(left, top, right, bottom);
 
-            if (format == Nv12 || format == Yuv420p)
+            if (format == Nv12 || format == Nv21 || format == Yuv420p || yuv420p16)
                 frame.planes[1] = planes[1].Region(left / 2, top / 2, right / 2, bottom / 2);
 
-            if (format == Yuv420p)
+            if (format == Yuv420p || yuv420p16)
                 frame.planes[2] = planes[2].Region(left / 2, top / 2, right / 2, bottom / 2);
 
-            if (format == Yuv444p)
+            if (p016)
+                frame.planes[1] = planes[1].Region(left, top / 2, right, bottom / 2);
+
+            if (format == Yuv444p || yuv444p16)
             {
                 frame.planes[1] = planes[1].Region(left, top, right, bottom);
                 frame.planes[2] = planes[2].Region(left, top, right, bottom);
             }
 
+            if (p216)
+                frame.planes[1] = planes[1].Region(left, top, right, bottom);
+
+            if (yuv422p16)
+            {
+                frame.planes[1] = planes[1].Region(left / 2, top, right / 2, bottom);
+                frame.planes[2] = planes[2].Region(left / 2, top, right / 2, bottom);
+            }
+
             return frame;
         }
         else
@@ -880,6 +1110,20 @@ namespace Simd
         case Rgba32:  return 1;
         case Yuv444p: return 3;
         case Lab24:   return 1;
+        case P010:    return 2;
+        case P012:    return 2;
+        case P016:    return 2;
+        case Yuv420p10: return 3;
+        case Yuv420p12: return 3;
+        case Yuv420p16: return 3;
+        case Yuv444p10: return 3;
+        case Yuv444p12: return 3;
+        case Nv21:    return 2;
+        case P210:    return 2;
+        case P216:    return 2;
+        case Yuv422p10: return 3;
+        case Yuv422p12: return 3;
+        case Yuv422p16: return 3;
         default: assert(0); return 0;
         }
     }
@@ -957,7 +1201,25 @@ namespace Simd
         }
     }
 
-    template <template<class> class A> SIMD_INLINE void Convert(const Frame<A> & src, Frame<A> & dst)
+    /*! \cond */
+    template <template<class> class A> SIMD_INLINE void ConvertYuv16(const Frame<A>& src, Frame<A>& dst, SimdYuv16LayoutType layout, size_t bitDepth)
+    {
+        const View<A>& v = layout == SimdYuv16LayoutP420 || layout == SimdYuv16LayoutP422 ? src.planes[1] : src.planes[2];
+        switch (dst.format)
+        {
+        case Frame<A>::Bgra32:
+        case Frame<A>::Bgr24:
+        case Frame<A>::Gray8:
+        case Frame<A>::Rgb24:
+        case Frame<A>::Rgba32:
+            Yuv16ToBgr(src.planes[0], src.planes[1], v, layout, bitDepth, dst.planes[0], src.yuvType);
+            break;
+        default:
+            assert(0);
+        }
+    }
+
+    template <template<class> class A> SIMD_INLINE void ConvertDirect(const Frame<A> & src, Frame<A> & dst)
     {
         assert(EqualSize(src, dst) && src.format && dst.format && src.flipped == dst.flipped);
 
@@ -978,19 +1240,11 @@ namespace Simd
                 DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
                 break;
             case Frame<A>::Bgra32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgra(src.planes[0], u, v, dst.planes[0], src.yuvType);
+                Nv12ToBgra(src.planes[0], src.planes[1], dst.planes[0], 0xFF, src.yuvType);
                 break;
-            }
             case Frame<A>::Bgr24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgr(src.planes[0], u, v, dst.planes[0], src.yuvType);
+                Nv12ToBgr(src.planes[0], src.planes[1], dst.planes[0], src.yuvType);
                 break;
-            }
             case Frame<A>::Gray8:
                 if (src.yuvType == SimdYuvTrect871)
                     Copy(src.planes[0], dst.planes[0]);
@@ -998,40 +1252,42 @@ namespace Simd
                     YToGray(src.planes[0], dst.planes[0]);
                 break;
             case Frame<A>::Rgb24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToRgb(src.planes[0], u, v, dst.planes[0], src.yuvType);
+                Nv12ToRgb(src.planes[0], src.planes[1], dst.planes[0], src.yuvType);
                 break;
-            }
             case Frame<A>::Rgba32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv420pToBgr(src.planes[0], u, v, bgr, src.yuvType);
-                BgrToRgba(bgr, dst.planes[0]);
+                Nv12ToRgba(src.planes[0], src.planes[1], dst.planes[0], 0xFF, src.yuvType);
                 break;
+            default:
+                assert(0);
             }
-            case Frame<A>::Yuv444p:
+            break;
+
+        case Frame<A>::Nv21:
+            switch (dst.format)
             {
+            case Frame<A>::Yuv420p:
                 assert(src.yuvType == dst.yuvType);
                 Copy(src.planes[0], dst.planes[0]);
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Simd::StretchGray2x2(u, dst.planes[1]);
-                Simd::StretchGray2x2(v, dst.planes[2]);
+                DeinterleaveUv(src.planes[1], dst.planes[2], dst.planes[1]);
                 break;
-            }
-            case Frame<A>::Lab24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv420pToBgr(src.planes[0], u, v, bgr, src.yuvType);
-                BgrToLab(bgr, dst.planes[0]);
+            case Frame<A>::Bgra32:
+                Nv21ToBgra(src.planes[0], src.planes[1], dst.planes[0], 0xFF, src.yuvType);
+                break;
+            case Frame<A>::Bgr24:
+                Nv21ToBgr(src.planes[0], src.planes[1], dst.planes[0], src.yuvType);
+                break;
+            case Frame<A>::Gray8:
+                if (src.yuvType == SimdYuvTrect871)
+                    Copy(src.planes[0], dst.planes[0]);
+                else
+                    YToGray(src.planes[0], dst.planes[0]);
+                break;
+            case Frame<A>::Rgb24:
+                Nv21ToRgb(src.planes[0], src.planes[1], dst.planes[0], src.yuvType);
+                break;
+            case Frame<A>::Rgba32:
+                Nv21ToRgba(src.planes[0], src.planes[1], dst.planes[0], 0xFF, src.yuvType);
                 break;
-            }
             default:
                 assert(0);
             }
@@ -1045,8 +1301,13 @@ namespace Simd
                 Copy(src.planes[0], dst.planes[0]);
                 InterleaveUv(src.planes[1], src.planes[2], dst.planes[1]);
                 break;
+            case Frame<A>::Nv21:
+                assert(src.yuvType == dst.yuvType);
+                Copy(src.planes[0], dst.planes[0]);
+                InterleaveUv(src.planes[2], src.planes[1], dst.planes[1]);
+                break;
             case Frame<A>::Bgra32:
-                Yuv420pToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], src.yuvType);
+                Yuv420pToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], 0xFF, src.yuvType);
                 break;
             case Frame<A>::Bgr24:
                 Yuv420pToBgr(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], src.yuvType);
@@ -1071,8 +1332,8 @@ namespace Simd
             {
                 assert(src.yuvType == dst.yuvType);
                 Copy(src.planes[0], dst.planes[0]);
-                Simd::StretchGray2x2(src.planes[0], dst.planes[1]);
-                Simd::StretchGray2x2(src.planes[1], dst.planes[2]);
+                Simd::StretchGray2x2(src.planes[1], dst.planes[1]);
+                Simd::StretchGray2x2(src.planes[2], dst.planes[2]);
                 break;
             }
             case Frame<A>::Lab24:
@@ -1090,13 +1351,6 @@ namespace Simd
         case Frame<A>::Bgra32:
             switch (dst.format)
             {
-            case Frame<A>::Nv12:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgraToYuv420p(src.planes[0], dst.planes[0], u, v, dst.yuvType);
-                InterleaveUv(u, v, dst.planes[1]);
-                break;
-            }
             case Frame<A>::Yuv420p:
                 BgraToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2], dst.yuvType);
                 break;
@@ -1115,13 +1369,6 @@ namespace Simd
             case Frame<A>::Yuv444p:
                 BgraToYuv444p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2], dst.yuvType);
                 break;
-            case Frame<A>::Lab24:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                BgraToBgr(src.planes[0], bgr);
-                BgrToLab(bgr, dst.planes[0]);
-                break;
-            }
             default:
                 assert(0);
             }
@@ -1130,13 +1377,6 @@ namespace Simd
         case Frame<A>::Bgr24:
             switch (dst.format)
             {
-            case Frame<A>::Nv12:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgrToYuv420p(src.planes[0], dst.planes[0], u, v, dst.yuvType);
-                InterleaveUv(u, v, dst.planes[1]);
-                break;
-            }
             case Frame<A>::Yuv420p:
                 BgrToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2], dst.yuvType);
                 break;
@@ -1194,13 +1434,6 @@ namespace Simd
             case Frame<A>::Rgba32:
                 GrayToRgba(src.planes[0], dst.planes[0]);
                 break;
-            case Frame<A>::Lab24:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                GrayToBgr(src.planes[0], bgr);
-                BgrToLab(bgr, dst.planes[0]);
-                break;
-            }
             default:
                 assert(0);
             }
@@ -1209,22 +1442,6 @@ namespace Simd
         case Frame<A>::Rgb24:
             switch (dst.format)
             {
-            case Frame<A>::Nv12:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                RgbToBgr(src.planes[0], bgr);
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgrToYuv420p(bgr, dst.planes[0], u, v, dst.yuvType);
-                InterleaveUv(u, v, dst.planes[1]);
-                break;
-            }
-            case Frame<A>::Yuv420p:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                RgbToBgr(src.planes[0], bgr);
-                BgrToYuv420p(bgr, dst.planes[0], dst.planes[1], dst.planes[2], dst.yuvType);
-                break;
-            }
             case Frame<A>::Bgra32:
                 RgbToBgra(src.planes[0], dst.planes[0]);
                 break;
@@ -1237,20 +1454,6 @@ namespace Simd
             case Frame<A>::Rgba32:
                 RgbToRgba(src.planes[0], dst.planes[0]);
                 break;
-            case Frame<A>::Yuv444p:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                RgbToBgr(src.planes[0], bgr);
-                BgrToYuv444p(bgr, dst.planes[0], dst.planes[1], dst.planes[2], dst.yuvType);
-                break;
-            }
-            case Frame<A>::Lab24:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                RgbToBgr(src.planes[0], bgr);
-                BgrToLab(bgr, dst.planes[0]);
-                break;
-            }
             default:
                 assert(0);
             }
@@ -1259,22 +1462,6 @@ namespace Simd
         case Frame<A>::Rgba32:
             switch (dst.format)
             {
-            case Frame<A>::Nv12:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                RgbaToBgr(src.planes[0], bgr);
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgrToYuv420p(bgr, dst.planes[0], u, v, dst.yuvType);
-                InterleaveUv(u, v, dst.planes[1]);
-                break;
-            }
-            case Frame<A>::Yuv420p:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                RgbaToBgr(src.planes[0], bgr);
-                BgrToYuv420p(bgr, dst.planes[0], dst.planes[1], dst.planes[2], dst.yuvType);
-                break;
-            }
             case Frame<A>::Bgra32:
                 RgbaToBgra(src.planes[0], dst.planes[0]);
                 break;
@@ -1287,20 +1474,6 @@ namespace Simd
             case Frame<A>::Rgb24:
                 RgbaToRgb(src.planes[0], dst.planes[0]);
                 break;
-            case Frame<A>::Yuv444p:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                RgbaToBgr(src.planes[0], bgr);
-                BgrToYuv444p(bgr, dst.planes[0], dst.planes[1], dst.planes[2], dst.yuvType);
-                break;
-            }
-            case Frame<A>::Lab24:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                RgbaToBgr(src.planes[0], bgr);
-                BgrToLab(bgr, dst.planes[0]);
-                break;
-            }
             default:
                 assert(0);
             }
@@ -1309,26 +1482,16 @@ namespace Simd
         case Frame<A>::Yuv444p:
             switch (dst.format)
             {
-            case Frame<A>::Nv12:
-            {
-                assert(src.yuvType == dst.yuvType);
-                Copy(src.planes[0], dst.planes[0]);
-                View<A> u(src.Size() / 2, View<A>::Gray8), v(src.Size() / 2, View<A>::Gray8);
-                Simd::ReduceGray2x2(src.planes[0], u);
-                Simd::ReduceGray2x2(src.planes[1], v);
-                InterleaveUv(u, v, dst.planes[1]);
-                break;
-            }
             case Frame<A>::Yuv420p:
             {
                 assert(src.yuvType == dst.yuvType);
                 Copy(src.planes[0], dst.planes[0]);
-                Simd::ReduceGray2x2(src.planes[0], dst.planes[1]);
-                Simd::ReduceGray2x2(src.planes[1], dst.planes[2]);
+                Simd::ReduceGray2x2(src.planes[1], dst.planes[1]);
+                Simd::ReduceGray2x2(src.planes[2], dst.planes[2]);
                 break;
             }            
             case Frame<A>::Bgra32:
-                Yuv444pToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], src.yuvType);
+                Yuv444pToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], 0xFF, src.yuvType);
                 break;
             case Frame<A>::Bgr24:
                 Yuv444pToBgr(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], src.yuvType);
@@ -1343,28 +1506,338 @@ namespace Simd
                 Yuv444pToRgb(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], src.yuvType);
                 break;
             case Frame<A>::Rgba32:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv444pToBgr(src.planes[0], src.planes[1], src.planes[2], bgr, src.yuvType);
-                BgrToRgba(bgr, dst.planes[0]);
+                Yuv444pToRgba(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], 0xFF, src.yuvType);
                 break;
-            }
-            case Frame<A>::Lab24:
-            {
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv444pToBgr(src.planes[0], src.planes[1], src.planes[2], bgr, src.yuvType);
-                BgrToLab(bgr, dst.planes[0]);
-                break;
-            }
             default:
                 assert(0);
             }
             break;
 
+        case Frame<A>::P010:
+            ConvertYuv16(src, dst, SimdYuv16LayoutP420, 10);
+            break;
+        case Frame<A>::P012:
+            ConvertYuv16(src, dst, SimdYuv16LayoutP420, 12);
+            break;
+        case Frame<A>::P016:
+            ConvertYuv16(src, dst, SimdYuv16LayoutP420, 16);
+            break;
+        case Frame<A>::Yuv420p10:
+            ConvertYuv16(src, dst, SimdYuv16Layout420p, 10);
+            break;
+        case Frame<A>::Yuv420p12:
+            ConvertYuv16(src, dst, SimdYuv16Layout420p, 12);
+            break;
+        case Frame<A>::Yuv420p16:
+            ConvertYuv16(src, dst, SimdYuv16Layout420p, 16);
+            break;
+        case Frame<A>::Yuv444p10:
+            ConvertYuv16(src, dst, SimdYuv16Layout444p, 10);
+            break;
+        case Frame<A>::Yuv444p12:
+            ConvertYuv16(src, dst, SimdYuv16Layout444p, 12);
+            break;
+        case Frame<A>::P210:
+            ConvertYuv16(src, dst, SimdYuv16LayoutP422, 10);
+            break;
+        case Frame<A>::P216:
+            ConvertYuv16(src, dst, SimdYuv16LayoutP422, 16);
+            break;
+        case Frame<A>::Yuv422p10:
+            ConvertYuv16(src, dst, SimdYuv16Layout422p, 10);
+            break;
+        case Frame<A>::Yuv422p12:
+            ConvertYuv16(src, dst, SimdYuv16Layout422p, 12);
+            break;
+        case Frame<A>::Yuv422p16:
+            ConvertYuv16(src, dst, SimdYuv16Layout422p, 16);
+            break;
+
         default:
             assert(0);
         }
     }
+    /*! \endcond */
+
+    // struct FrameConverter implementation:
+
+    template <template<class> class A> SIMD_INLINE FrameConverter<A>::FrameConverter()
+        : _width(0)
+        , _height(0)
+        , _stripe(0)
+        , _stripeParam(0)
+        , _srcFormat(Frame::None)
+        , _dstFormat(Frame::None)
+        , _srcYuvType(SimdYuvUnknown)
+        , _dstYuvType(SimdYuvUnknown)
+    {
+    }
+
+    template <template<class> class A> SIMD_INLINE bool FrameConverter<A>::Init(size_t width, size_t height, Format srcFormat, Format dstFormat, SimdYuvType srcYuvType, SimdYuvType dstYuvType, size_t stripe)
+    {
+        if (width == _width && height == _height && srcFormat == _srcFormat && dstFormat == _dstFormat &&
+            srcYuvType == _srcYuvType && dstYuvType == _dstYuvType && stripe == _stripeParam)
+            return _path.size() > 1;
+        _width = width;
+        _height = height;
+        _srcFormat = srcFormat;
+        _dstFormat = dstFormat;
+        _srcYuvType = srcYuvType;
+        _dstYuvType = dstYuvType;
+        _stripeParam = stripe;
+        return Plan();
+    }
+
+    template <template<class> class A> SIMD_INLINE size_t FrameConverter<A>::Hops() const
+    {
+        return _path.empty() ? 0 : _path.size() - 1;
+    }
+
+    template <template<class> class A> SIMD_INLINE typename FrameConverter<A>::Format FrameConverter<A>::Node(size_t index) const
+    {
+        return index < _path.size() ? _path[index] : Frame::None;
+    }
+
+    template <template<class> class A> SIMD_INLINE size_t FrameConverter<A>::Stripe() const
+    {
+        return _stripe;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool FrameConverter<A>::Convert(const Frame & src, Frame & dst)
+    {
+        assert(EqualSize(src, dst) && src.flipped == dst.flipped);
+
+        if (!Init(src.width, src.height, src.format, dst.format, src.yuvType, dst.yuvType, _stripeParam))
+            return false;
+
+        if (_buffers.empty())
+        {
+            ConvertDirect(src, dst);
+            return true;
+        }
+
+        Frame curr, next;
+        for (size_t row = 0; row < _height; row += _stripe)
+        {
+            size_t rows = std::min(_stripe, _height - row);
+            curr = src.Region(0, row, _width, row + rows);
+            for (size_t i = 0; i <= _buffers.size(); ++i)
+            {
+                if (i < _buffers.size())
+                {
+                    next = _buffers[i].Region(0, 0, _width, rows);
+                    next.flipped = src.flipped;
+                }
+                else
+                    next = dst.Region(0, row, _width, row + rows);
+                ConvertDirect(curr, next);
+                curr = next;
+            }
+        }
+        return true;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool FrameConverter<A>::IsRgb(Format format)
+    {
+        return format == Frame::Bgra32 || format == Frame::Bgr24 || format == Frame::Rgb24 || format == Frame::Rgba32;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool FrameConverter<A>::IsYuv(Format format)
+    {
+        return format != Frame::None && format != Frame::Gray8 && format != Frame::Lab24 && !IsRgb(format);
+    }
+
+    template <template<class> class A> SIMD_INLINE bool FrameConverter<A>::IsYuv8(Format format)
+    {
+        return format == Frame::Nv12 || format == Frame::Nv21 || format == Frame::Yuv420p || format == Frame::Yuv444p;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool FrameConverter<A>::IsYuv444(Format format)
+    {
+        return format == Frame::Yuv444p || format == Frame::Yuv444p10 || format == Frame::Yuv444p12;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool FrameConverter<A>::Similar(Format a, Format b)
+    {
+        return IsYuv8(a) && IsYuv8(b) && IsYuv444(a) == IsYuv444(b);
+    }
+
+    template <template<class> class A> SIMD_INLINE int FrameConverter<A>::Bits(Format format)
+    {
+        switch (format)
+        {
+        case Frame::Nv12: return 12;
+        case Frame::Nv21: return 12;
+        case Frame::Yuv420p: return 12;
+        case Frame::Bgra32: return 32;
+        case Frame::Bgr24: return 24;
+        case Frame::Gray8: return 8;
+        case Frame::Rgb24: return 24;
+        case Frame::Rgba32: return 32;
+        case Frame::Yuv444p: return 24;
+        case Frame::Lab24: return 24;
+        case Frame::P010: return 24;
+        case Frame::P012: return 24;
+        case Frame::P016: return 24;
+        case Frame::Yuv420p10: return 24;
+        case Frame::Yuv420p12: return 24;
+        case Frame::Yuv420p16: return 24;
+        case Frame::Yuv444p10: return 48;
+        case Frame::Yuv444p12: return 48;
+        case Frame::P210: return 32;
+        case Frame::P216: return 32;
+        case Frame::Yuv422p10: return 32;
+        case Frame::Yuv422p12: return 32;
+        case Frame::Yuv422p16: return 32;
+        default: assert(0); return 0;
+        }
+    }
+
+    template <template<class> class A> SIMD_INLINE int FrameConverter<A>::Cost(Format src, Format dst)
+    {
+        bool direct = false;
+        int extra = 0;
+        switch (src)
+        {
+        case Frame::Nv12:
+        case Frame::Nv21:
+            direct = IsRgb(dst) || dst == Frame::Gray8 || dst == Frame::Yuv420p;
+            break;
+        case Frame::Yuv420p:
+            direct = IsRgb(dst) || dst == Frame::Gray8 || dst == Frame::Nv12 || dst == Frame::Nv21 || dst == Frame::Yuv444p || dst == Frame::Lab24;
+            if (dst == Frame::Rgba32 || dst == Frame::Lab24)
+                extra = 2 * Bits(Frame::Bgr24);
+            break;
+        case Frame::Yuv444p:
+            direct = IsRgb(dst) || dst == Frame::Gray8 || dst == Frame::Yuv420p;
+            break;
+        case Frame::Bgra32:
+            direct = IsRgb(dst) || dst == Frame::Gray8 || dst == Frame::Yuv420p || dst == Frame::Yuv444p;
+            break;
+        case Frame::Bgr24:
+            direct = IsRgb(dst) || dst == Frame::Gray8 || dst == Frame::Yuv420p || dst == Frame::Yuv444p || dst == Frame::Lab24;
+            break;
+        case Frame::Gray8:
+            direct = IsRgb(dst) || dst == Frame::Nv12 || dst == Frame::Yuv420p || dst == Frame::Yuv444p;
+            break;
+        case Frame::Rgb24:
+        case Frame::Rgba32:
+            direct = IsRgb(dst) || dst == Frame::Gray8;
+            break;
+        default:
+            direct = IsYuv(src) && (IsRgb(dst) || dst == Frame::Gray8);
+        }
+        return direct && src != dst ? Bits(src) + Bits(dst) + extra : 0;
+    }
+
+    template <template<class> class A> SIMD_INLINE bool FrameConverter<A>::Plan()
+    {
+        _path.clear();
+        _buffers.clear();
+        _stripe = 0;
+        if (_srcFormat == Frame::None || _dstFormat == Frame::None)
+            return false;
+        if (_srcFormat == _dstFormat && (_srcYuvType == _dstYuvType || !IsYuv(_srcFormat)))
+        {
+            _path.push_back(_srcFormat);
+            _path.push_back(_dstFormat);
+            _stripe = _height;
+            return true;
+        }
+
+        // Nodes are pairs (format, phase): phase 0 - the chain passes only through YUV formats with source YUV type, 
+        // phase 1 - the chain has passed through RGB (or gray) format and intermediate YUV formats have destination YUV type.
+        const int N = Frame::Yuv422p16 + 1, S = (IsYuv(_srcFormat) ? 0 : 1) + _srcFormat * 2;
+        std::vector<int> cost(N * 2, INT_MAX), prev(N * 2, -1);
+        std::vector<bool> done(N * 2, false);
+        int best = INT_MAX, last = -1;
+        cost[S] = 0;
+        for (;;)
+        {
+            int u = -1;
+            for (int i = 0; i < N * 2; ++i)
+                if (!done[i] && cost[i] < best && (u < 0 || cost[i] < cost[u]))
+                    u = i;
+            if (u < 0)
+                break;
+            done[u] = true;
+            Format f = (Format)(u / 2);
+            for (int g = 1; g < N; ++g)
+            {
+                int c = Cost(f, (Format)g);
+                if (c == 0)
+                    continue;
+                int p = (u % 2 == 0 && IsYuv((Format)g)) ? 0 : 1;
+                if (g == _dstFormat)
+                {
+                    if (p == 0 && _srcYuvType != _dstYuvType)
+                        continue;
+                    if (cost[u] + c < best)
+                    {
+                        best = cost[u] + c;
+                        last = u;
+                    }
+                    continue;
+                }
+                if (!(IsRgb((Format)g) || Similar((Format)g, _dstFormat) || (p == 0 && Similar((Format)g, _srcFormat))))
+                    continue;
+                int v = g * 2 + p;
+                if (!done[v] && cost[u] + c < cost[v])
+                {
+                    cost[v] = cost[u] + c;
+                    prev[v] = u;
+                }
+            }
+        }
+        if (last < 0)
+        {
+            if (_srcFormat != _dstFormat)
+                return false;
+            _path.push_back(_srcFormat);
+            _path.push_back(_dstFormat);
+            _stripe = _height;
+            return true;
+        }
+
+        std::vector<int> nodes(1, last);
+        while (prev[nodes.back()] >= 0)
+            nodes.push_back(prev[nodes.back()]);
+        for (size_t i = nodes.size(); i > 0; --i)
+            _path.push_back((Format)(nodes[i - 1] / 2));
+        _path.push_back(_dstFormat);
+
+        if (nodes.size() > 1)
+        {
+            size_t rowSize = 0;
+            for (size_t i = nodes.size() - 1; i > 0; --i)
+                rowSize += Bits((Format)(nodes[i - 1] / 2)) * _width / 8;
+            size_t cache = SimdCpuInfo(SimdCpuInfoCacheL2);
+            _stripe = _stripeParam ? _stripeParam : (cache ? cache : 256 * 1024) / 2 / std::max<size_t>(rowSize, 1);
+            _stripe = std::min(std::max<size_t>(_stripe, 2) & ~size_t(1), _height);
+            _buffers.resize(nodes.size() - 1);
+            for (size_t i = nodes.size() - 1, b = 0; i > 0; --i, ++b)
+            {
+                int node = nodes[i - 1];
+                Format format = (Format)(node / 2);
+                SimdYuvType yuvType = IsYuv(format) ? (node % 2 ? _dstYuvType : _srcYuvType) : SimdYuvUnknown;
+                _buffers[b].Recreate(_width, (_stripe + 1) & ~size_t(1), format, yuvType);
+            }
+        }
+        else
+            _stripe = _height;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    template <template<class> class A> SIMD_INLINE void Convert(const Frame<A> & src, Frame<A> & dst)
+    {
+        assert(EqualSize(src, dst) && src.format && dst.format && src.flipped == dst.flipped);
+
+        FrameConverter<A> converter;
+        if (!converter.Convert(src, dst))
+            assert(0);
+    }
 }
 
 #endif
@@ -37,10 +37,21 @@ namespace Simd
         size_t channels;
         float sigma;
         float epsilon;
+        SimdGaussianBlurFlags flags;
         size_t align;
 
-        BlurParam(size_t w, size_t h, size_t c, const float* s, const float * e, size_t a);
+        BlurParam(size_t w, size_t h, size_t c, const float* s, const float * e, SimdGaussianBlurFlags f, size_t a);
         bool Valid() const;
+
+        SIMD_INLINE bool IsRecursive() const
+        {
+            return (flags & SimdGaussianBlurAlgMask) == SimdGaussianBlurRecursive;
+        }
+
+        SIMD_INLINE bool Is32f() const
+        {
+            return (flags & SimdGaussianBlurTypeMask) == SimdGaussianBlur32f;
+        }
     };
 
     class GaussianBlur : Deletable
@@ -90,7 +101,37 @@ namespace Simd
             BlurDefaultPtr _blur;
         };
 
-        void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+        //---------------------------------------------------------------------
+
+        struct AlgRecursive
+        {
+            size_t size, stride;
+            float b, a[3], m[9];
+        };
+
+        typedef void (*BlurRecursiveRowsPtr)(const BlurParam& p, const AlgRecursive& a, const uint8_t* src, size_t srcStride, size_t rowBeg, size_t rowEnd, float* buf);
+        typedef void (*BlurRecursiveColsPtr)(const BlurParam& p, const AlgRecursive& a, float* buf, size_t colBeg, size_t colEnd, uint8_t* dst, size_t dstStride);
+
+        void BlurRecursiveRows(const BlurParam& p, const AlgRecursive& a, const uint8_t* src, size_t srcStride, size_t rowBeg, size_t rowEnd, float* buf);
+
+        void BlurRecursiveCols(const BlurParam& p, const AlgRecursive& a, float* buf, size_t colBeg, size_t colEnd, uint8_t* dst, size_t dstStride);
+
+        class GaussianBlurRecursive : public Simd::GaussianBlur
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            AlgRecursive _alg;
+            Array32f _buf;
+            size_t _threads;
+            BlurRecursiveRowsPtr _rows;
+            BlurRecursiveColsPtr _cols;
+        };
+
+        void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -102,7 +143,13 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+        class GaussianBlurRecursive : public Base::GaussianBlurRecursive
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+        };
+
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     }
 #endif //SIMD_SSE41_ENABLE
 
@@ -115,7 +162,13 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+        class GaussianBlurRecursive : public Sse41::GaussianBlurRecursive
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+        };
+
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     }
 #endif //SIMD_AVX2_ENABLE
 
@@ -128,7 +181,13 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+        class GaussianBlurRecursive : public Avx2::GaussianBlurRecursive
+        {
+        public:
+            GaussianBlurRecursive(const BlurParam& param);
+        };
+
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     }
 #endif //SIMD_AVX512BW_ENABLE
 
@@ -141,7 +200,7 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     }
 #endif //SIMD_NEON_ENABLE
 }
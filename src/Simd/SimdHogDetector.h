@@ -0,0 +1,139 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdHogDetector_h__
+#define __SimdHogDetector_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    const size_t HOG_CELL = 8;
+    const size_t HOG_FEATURES = 31;
+
+    struct HogDetectorParam
+    {
+        size_t width;
+        size_t height;
+        size_t windowX;
+        size_t windowY;
+        float bias;
+        float scaleFactor;
+        size_t levelsMax;
+        size_t align;
+
+        HogDetectorParam(size_t w, size_t h, size_t wx, size_t wy, float b, float sf, size_t lm, size_t a);
+        bool Valid() const;
+    };
+
+    //-----------------------------------------------------------------------------------------
+
+    class HogDetector : Deletable
+    {
+    public:
+        HogDetector(const HogDetectorParam& param, const float* weights);
+        virtual ~HogDetector();
+
+        size_t Run(const uint8_t* src, size_t stride, float threshold, float overlap, SimdHogDetection* detections, size_t capacity);
+
+        typedef void (*ExtractPtr)(const uint8_t* src, size_t stride, size_t width, size_t height, float* features);
+        typedef void (*ScorePtr)(const float* features, size_t stride, size_t width, const float* weights, size_t size, size_t rows, float bias, float* dst);
+        typedef void* (*ResizerInitPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    protected:
+        struct Level
+        {
+            size_t width, height, cellsX, cellsY, image, features, scores;
+            float scaleX, scaleY;
+            void* resizer;
+        };
+        typedef std::vector<Level> Levels;
+        typedef std::vector<SimdHogDetection> Detections;
+        typedef std::vector<size_t> Indices;
+
+        HogDetectorParam _param;
+        Levels _levels;
+        std::vector<Indices> _groups, _grid;
+        std::vector<Detections> _found;
+        Detections _all;
+        size_t _gridCell, _gridX, _gridY;
+        Array8u _images;
+        Array32f _weights, _features, _scores;
+        size_t _size, _threads;
+        ExtractPtr _extract;
+        ScorePtr _score;
+        ResizerInitPtr _resizerInit;
+
+        void RunLevel(const uint8_t* src, size_t stride, size_t index, float threshold);
+    };
+
+    //-----------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        void HogDetectorScore(const float* features, size_t stride, size_t width, const float* weights, size_t size, size_t rows, float bias, float* dst);
+
+        class HogDetector : public Simd::HogDetector
+        {
+        public:
+            HogDetector(const HogDetectorParam& param, const float* weights);
+        };
+
+        void* HogDetectorInit(size_t width, size_t height, const float* weights, size_t windowX, size_t windowY, float bias, float scaleFactor, size_t levelsMax);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void HogDetectorScore(const float* features, size_t stride, size_t width, const float* weights, size_t size, size_t rows, float bias, float* dst);
+
+        class HogDetector : public Base::HogDetector
+        {
+        public:
+            HogDetector(const HogDetectorParam& param, const float* weights);
+        };
+
+        void* HogDetectorInit(size_t width, size_t height, const float* weights, size_t windowX, size_t windowY, float bias, float scaleFactor, size_t levelsMax);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void HogDetectorScore(const float* features, size_t stride, size_t width, const float* weights, size_t size, size_t rows, float bias, float* dst);
+
+        class HogDetector : public Sse41::HogDetector
+        {
+        public:
+            HogDetector(const HogDetectorParam& param, const float* weights);
+        };
+
+        void* HogDetectorInit(size_t width, size_t height, const float* weights, size_t windowX, size_t windowY, float bias, float scaleFactor, size_t levelsMax);
+    }
+#endif
+}
+
+#endif
@@ -58,6 +58,7 @@ namespace Simd
     {
     protected:
         typedef Simd::View<Simd::Allocator> Image;
+        typedef void (*Be16uToAnyPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t srcChannels, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat);
 
         ImageLoaderParam _param;
         InputMemoryStream _stream;
@@ -100,10 +101,12 @@ namespace Simd
             typedef void (*ToBgraPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha);
             ToAnyPtr _toAny;
             ToBgraPtr _toBgra;
+            Be16uToAnyPtr _be16uToAny;
             Array8u _buffer;
-            size_t _block, _size;
+            size_t _block, _size, _depth, _max;
 
             bool ReadHeader(size_t version);
+            bool FromStream16();
             virtual void SetConverters() = 0;
         };
 
@@ -169,6 +172,7 @@ namespace Simd
             DecodeLinePtr _decodeLine[7];
             ExpandPalettePtr _expandPalette;
             ConverterPtr _converter;
+            Be16uToAnyPtr _be16uToAny;
             virtual void SetConverter();
 
         private:
@@ -240,6 +244,24 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ImageQoiLoader : public ImageLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+            virtual bool FromStream();
+
+        protected:
+            virtual void SetConverters();
+
+            typedef void (*ToAnyPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
+            ToAnyPtr _toAny;
+            Array8u _buffer;
+            size_t _block;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 
@@ -305,6 +327,15 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImageQoiLoader : public Base::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
@@ -350,6 +381,12 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImagePngLoader : public Sse41::ImagePngLoader
+        {
+        public:
+            ImagePngLoader(const ImageLoaderParam& param);
+        };
+
         class ImageJpegLoader : public Sse41::ImageJpegLoader
         {
         public:
@@ -367,6 +404,15 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImageQoiLoader : public Sse41::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
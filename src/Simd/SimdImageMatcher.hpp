@@ -25,8 +25,12 @@
 #define __SimdImageMatcher_hpp__
 
 #include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
+#include <fstream>
+#include <algorithm>
+#include <type_traits>
 
 namespace Simd
 {
@@ -58,6 +62,9 @@ namespace Simd
             }
         }
         \endverbatim
+
+        \note Hashes added to ImageMatcher are stored in contiguous per-bucket arrays. 
+        Search is performed in parallel (see functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
     */
     template <class Tag, template<class> class Allocator>
     struct ImageMatcher
@@ -76,11 +83,16 @@ namespace Simd
         private:
             Hash(const Tag & t, size_t mainSize, size_t fastSize)
                 : tag(t)
+                , main(NULL)
+                , fast(NULL)
                 , skip(false)
             {
-                hash.resize(mainSize + fastSize, 0);
-                main = hash.data();
-                fast = main + mainSize;
+                if (mainSize + fastSize)
+                {
+                    hash.resize(mainSize + fastSize, 0);
+                    main = hash.data();
+                    fast = main + mainSize;
+                }
             }
 
             std::vector<uint8_t, Allocator<uint8_t> > hash;
@@ -91,6 +103,7 @@ namespace Simd
             friend struct ImageMatcher;
         };
         typedef std::shared_ptr<Hash> HashPtr; /*!< A shared pointer to Hash structure. */
+        typedef std::vector<HashPtr> HashPtrs; /*!< A vector of shared pointers to Hash structure. */
 
         /*!
             \short The Result structure is a result of matching current image and images added before to ImageMatcher.
@@ -113,6 +126,7 @@ namespace Simd
             }
         };
         typedef std::vector<Result> Results; /*!< A vector with results. */
+        typedef std::vector<Results> ResultsList; /*!< A list of result vectors (one per query in batch search). */
 
         /*!
             \enum HashType
@@ -160,6 +174,11 @@ namespace Simd
             static const size_t sizes[] = { 16, 32, 64 };
             size_t size = sizes[type];
 
+            _threshold = threshold;
+            _type = type;
+            _number = number;
+            _normalized = normalized;
+
             if (number >= 10000 && threshold < 0.10)
                 _matcher.reset(new Matcher_3D(threshold, size, number, normalized));
             else if (number > 1000 && !normalized)
@@ -225,18 +244,130 @@ namespace Simd
         bool Find(const HashPtr & hash, Results & results)
         {
             results.clear();
-            _matcher->Find(hash, results);
+            _matcher->Find(hash, results, ::SimdGetThreadNumber());
             return results.size() != 0;
         }
 
+        /*!
+            Finds all similar images earlier added to ImageMatcher for every image from given list.
+            The queries are processed in parallel.
+
+            \param [in] hashes - a list of smart pointers to hashes of the images.
+            \param [out] results - a list of found similar images for every query.
+            \return a number of queries which have similar images.
+        */
+        size_t Find(const HashPtrs & hashes, ResultsList & results)
+        {
+            results.clear();
+            results.resize(hashes.size());
+            Parallel(0, hashes.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    _matcher->Find(hashes[i], results[i], 1);
+            }, ::SimdGetThreadNumber());
+            size_t found = 0;
+            for (size_t i = 0; i < results.size(); ++i)
+                found += results[i].size() ? 1 : 0;
+            return found;
+        }
+
         /*!
             Adds given image to ImageMatcher.
 
+            \note The hash data is copied into internal storage of ImageMatcher, only tag is kept per added image.
+            The hash stays valid for search and can be added to other ImageMatcher.
+            To skip an added image use Skip() with Result::hash returned by Find().
+
             \param [in] hash - a smart pointer to hash of the image.
         */
         void Add(const HashPtr & hash)
         {
-            _matcher->Add(hash);
+            if (hash && hash->main)
+                _matcher->Add(hash);
+        }
+
+        /*!
+            Saves ImageMatcher index (parameters and all added hashes) to output stream.
+
+            \note Tag type must be trivially copyable.
+
+            \param [out] os - an output stream.
+            \return a result of the operation.
+        */
+        bool Save(std::ostream & os) const
+        {
+            static_assert(std::is_trivially_copyable<Tag>::value, "ImageMatcher::Save requires trivially copyable Tag!");
+            if (!_matcher)
+                return false;
+            Write(os, Magic());
+            Write(os, _threshold);
+            Write(os, (int32_t)_type);
+            Write(os, (uint64_t)_number);
+            Write(os, (int32_t)_normalized);
+            return _matcher->Save(os) && (bool)os;
+        }
+
+        /*!
+            Saves ImageMatcher index (parameters and all added hashes) to file.
+
+            \note Tag type must be trivially copyable.
+
+            \param [in] path - a path to output file.
+            \return a result of the operation.
+        */
+        bool Save(const std::string & path) const
+        {
+            std::ofstream ofs(path.c_str(), std::ofstream::binary);
+            if (ofs.is_open())
+            {
+                bool result = Save(ofs);
+                ofs.close();
+                return result;
+            }
+            return false;
+        }
+
+        /*!
+            Loads ImageMatcher index from input stream. ImageMatcher is reinitialized with saved parameters.
+
+            \param [in] is - an input stream.
+            \return a result of the operation.
+        */
+        bool Load(std::istream & is)
+        {
+            static_assert(std::is_trivially_copyable<Tag>::value, "ImageMatcher::Load requires trivially copyable Tag!");
+            uint64_t magic = 0, number = 0;
+            double threshold = 0;
+            int32_t type = 0, normalized = 0;
+            if (!Read(is, magic) || magic != Magic() || !Read(is, threshold) || !Read(is, type) ||
+                !Read(is, number) || !Read(is, normalized) || type < Hash16x16 || type > Hash64x64)
+                return false;
+            if (!Init(threshold, (HashType)type, (size_t)number, normalized != 0))
+                return false;
+            if (!_matcher->Load(is, Remaining(is)))
+            {
+                _matcher.reset();
+                return false;
+            }
+            return true;
+        }
+
+        /*!
+            Loads ImageMatcher index from file. ImageMatcher is reinitialized with saved parameters.
+
+            \param [in] path - a path to input file.
+            \return a result of the operation.
+        */
+        bool Load(const std::string & path)
+        {
+            std::ifstream ifs(path.c_str(), std::ifstream::binary);
+            if (ifs.is_open())
+            {
+                bool result = Load(ifs);
+                ifs.close();
+                return result;
+            }
+            return false;
         }
 
         /*!
@@ -250,6 +381,34 @@ namespace Simd
         }
 
     private:
+        typedef std::vector<uint8_t, Allocator<uint8_t> > Buffer;
+
+        static uint64_t Magic() { return 0x3148434d474d4953; }
+
+        template<class T> static void Write(std::ostream & os, const T & value)
+        {
+            os.write((const char*)&value, sizeof(T));
+        }
+
+        template<class T> static bool Read(std::istream & is, T & value)
+        {
+            is.read((char*)&value, sizeof(T));
+            return (bool)is;
+        }
+
+        static uint64_t Remaining(std::istream & is)
+        {
+            std::streampos pos = is.tellg();
+            if (pos < 0 || !is.seekg(0, std::ios::end))
+            {
+                is.clear();
+                return UINT64_MAX;
+            }
+            std::streampos end = is.tellg();
+            is.seekg(pos);
+            return end >= pos ? uint64_t(end - pos) : 0;
+        }
+
         struct Matcher
         {
             const size_t fast;
@@ -272,11 +431,71 @@ namespace Simd
 
             virtual ~Matcher() {}
             virtual void Add(const HashPtr & hash) = 0;
-            virtual void Find(const HashPtr & hash, Results & results) = 0;
+            virtual void Find(const HashPtr & hash, Results & results, size_t threadNumber) = 0;
+
+            bool Save(std::ostream & os) const
+            {
+                Write(os, (uint64_t)_sets.size());
+                for (size_t s = 0; s < _sets.size(); ++s)
+                {
+                    const Set & set = _sets[s];
+                    Write(os, (uint64_t)set.hashes.size());
+                    for (size_t i = 0; i < set.hashes.size(); ++i)
+                    {
+                        Write(os, set.hashes[i]->tag);
+                        Write(os, (uint8_t)set.hashes[i]->skip);
+                    }
+                    os.write((const char*)set.fast.data(), set.fast.size());
+                    os.write((const char*)set.main.data(), set.main.size());
+                }
+                return (bool)os;
+            }
+
+            bool Load(std::istream & is, uint64_t remaining)
+            {
+                uint64_t count = 0;
+                if (!Read(is, count) || count != _sets.size())
+                    return false;
+                _size = 0;
+                const uint64_t item = sizeof(Tag) + 1 + _fastSize + _mainSize;
+                remaining -= std::min<uint64_t>(remaining, sizeof(count));
+                for (size_t s = 0; s < _sets.size(); ++s)
+                {
+                    Set & set = _sets[s];
+                    uint64_t size = 0;
+                    if (!Read(is, size))
+                        return false;
+                    remaining -= std::min<uint64_t>(remaining, sizeof(size));
+                    if (size > remaining / item)
+                        return false;
+                    remaining -= size * item;
+                    set.hashes.clear();
+                    for (uint64_t i = 0; i < size; ++i)
+                    {
+                        Tag tag;
+                        uint8_t skip = 0;
+                        if (!Read(is, tag) || !Read(is, skip))
+                            return false;
+                        set.hashes.push_back(HashPtr(new Hash(tag, 0, 0)));
+                        set.hashes.back()->skip = skip != 0;
+                    }
+                    set.fast.resize(set.hashes.size() * _fastSize);
+                    set.main.resize(set.hashes.size() * _mainSize);
+                    if (!is.read((char*)set.fast.data(), set.fast.size()) || !is.read((char*)set.main.data(), set.main.size()))
+                        return false;
+                    _size += set.hashes.size();
+                }
+                return true;
+            }
 
         protected:
-            typedef std::vector<HashPtr> Set;
+            struct Set
+            {
+                HashPtrs hashes;
+                Buffer fast, main;
+            };
             typedef std::vector<Set> Sets;
+            typedef std::vector<size_t> Indexes;
             Sets _sets;
             size_t _fastSize, _mainSize, _size;
             uint64_t _mainMax, _fastMax;
@@ -284,33 +503,69 @@ namespace Simd
 
             void AddIn(size_t index, const HashPtr & hash)
             {
-                _sets[index].push_back(hash);
+                Set & set = _sets[index];
+                set.hashes.push_back(HashPtr(new Hash(hash->tag, 0, 0)));
+                set.hashes.back()->skip = hash->skip;
+                set.fast.insert(set.fast.end(), hash->fast, hash->fast + _fastSize);
+                set.main.insert(set.main.end(), hash->main, hash->main + _mainSize);
                 _size++;
             }
 
-            void FindIn(size_t index, const HashPtr & hash, Results & results)
+            void FindIn(const Indexes & indexes, const Hash & hash, Results & results, size_t threadNumber)
+            {
+                const size_t PARALLEL_SIZE_MIN = 16384;
+                if (hash.skip || hash.main == NULL)
+                    return;
+                const uint8_t * fast = hash.fast;
+                const uint8_t * main = hash.main;
+                Indexes offsets(indexes.size() + 1, 0);
+                for (size_t i = 0; i < indexes.size(); ++i)
+                    offsets[i + 1] = offsets[i] + _sets[indexes[i]].hashes.size();
+                size_t total = offsets.back();
+                if (threadNumber <= 1 || total < PARALLEL_SIZE_MIN)
+                {
+                    for (size_t i = 0; i < indexes.size(); ++i)
+                        FindIn(indexes[i], 0, _sets[indexes[i]].hashes.size(), fast, main, results);
+                }
+                else
+                {
+                    std::vector<Results> buffers(threadNumber);
+                    Parallel(0, total, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        size_t s = std::upper_bound(offsets.begin(), offsets.end(), begin) - offsets.begin() - 1;
+                        for (; begin < end; ++s)
+                        {
+                            size_t stop = std::min(end, offsets[s + 1]);
+                            FindIn(indexes[s], begin - offsets[s], stop - offsets[s], fast, main, buffers[thread]);
+                            begin = stop;
+                        }
+                    }, threadNumber);
+                    for (size_t t = 0; t < buffers.size(); ++t)
+                        for (size_t i = 0; i < buffers[t].size(); ++i)
+                            results.push_back(buffers[t][i]);
+                }
+            }
+
+            void FindIn(size_t index, size_t begin, size_t end, const uint8_t * fast, const uint8_t * main, Results & results) const
             {
                 const Set & set = _sets[index];
-                for (size_t i = 0; i < set.size(); ++i)
+                for (size_t i = begin; i < end; ++i)
                 {
                     double difference = 0;
-                    if (Compare(set[i], hash, difference))
-                        results.push_back(Result(set[i].get(), difference));
+                    if (!set.hashes[i]->skip && Compare(set.fast.data() + i * _fastSize, set.main.data() + i * _mainSize, fast, main, difference))
+                        results.push_back(Result(set.hashes[i].get(), difference));
                 }
             }
 
-            bool Compare(const HashPtr & a, const HashPtr &  b, double & difference)
+            bool Compare(const uint8_t * aFast, const uint8_t * aMain, const uint8_t * bFast, const uint8_t * bMain, double & difference) const
             {
-                if (a->skip || b->skip)
-                    return false;
-
                 uint64_t fastSum = 0;
-                ::SimdSquaredDifferenceSum(a->fast, _fastSize, b->fast, _fastSize, _fastSize, 1, &fastSum);
+                ::SimdSquaredDifferenceSum(aFast, _fastSize, bFast, _fastSize, _fastSize, 1, &fastSum);
                 if (fastSum > _fastMax)
                     return false;
 
                 uint64_t mainSum = 0;
-                ::SimdSquaredDifferenceSum(a->main, _mainSize, b->main, _mainSize, _mainSize, 1, &mainSum);
+                ::SimdSquaredDifferenceSum(aMain, _mainSize, bMain, _mainSize, _mainSize, 1, &mainSum);
                 if (mainSum > _mainMax)
                     return false;
 
@@ -321,6 +576,10 @@ namespace Simd
         };
         typedef std::unique_ptr<Matcher> MatcherPtr;
         MatcherPtr _matcher;
+        double _threshold;
+        HashType _type;
+        size_t _number;
+        bool _normalized;
 
         struct Matcher_0D : public Matcher
         {
@@ -328,7 +587,9 @@ namespace Simd
                 : Matcher(threshold, size)
             {
                 this->_sets.resize(1);
-                this->_sets[0].reserve(number);
+                this->_sets[0].hashes.reserve(number);
+                this->_sets[0].fast.reserve(number * this->_fastSize);
+                this->_sets[0].main.reserve(number * this->_mainSize);
             }
 
             virtual void Add(const HashPtr & hash)
@@ -336,9 +597,9 @@ namespace Simd
                 this->AddIn(0, hash);
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+            virtual void Find(const HashPtr & hash, Results & results, size_t threadNumber)
             {
-                this->FindIn(0, hash, results);
+                this->FindIn(typename Matcher::Indexes(1, 0), *hash, results, threadNumber);
             }
         };
 
@@ -357,11 +618,13 @@ namespace Simd
                 this->AddIn(Get(hash), hash);
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+            virtual void Find(const HashPtr & hash, Results & results, size_t threadNumber)
             {
                 size_t index = Get(hash);
+                typename Matcher::Indexes indexes;
                 for (size_t i = std::max(index, _half) - _half, end = std::min(index + _half + 1, _range); i < end; ++i)
-                    this->FindIn(i, hash, results);
+                    indexes.push_back(i);
+                this->FindIn(indexes, *hash, results, threadNumber);
             }
 
         private:
@@ -369,9 +632,10 @@ namespace Simd
 
             size_t Get(const HashPtr & hash)
             {
+                const uint8_t * fast = hash->fast;
                 size_t sum = 0;
                 for (size_t i = 0; i < this->_fastSize; ++i)
-                    sum += hash->fast[i];
+                    sum += fast[i];
                 return sum >> 4;
             }
         };
@@ -408,7 +672,7 @@ namespace Simd
                 this->AddIn(i.x*_stride.x + i.y*_stride.y + i.z*_stride.z, hash);
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+            virtual void Find(const HashPtr & hash, Results & results, size_t threadNumber)
             {
                 Index i, lo, hi;
                 Get(hash, i);
@@ -421,10 +685,12 @@ namespace Simd
                 hi.y = std::min(_range.y, i.y + _half + 1)*_stride.y;
                 hi.z = std::min(_range.z, i.z + _half + 1)*_stride.z;
 
+                typename Matcher::Indexes indexes;
                 for (int z = lo.z; z < hi.z; z += _stride.z)
                     for (int y = lo.y; y < hi.y; y += _stride.y)
                         for (int x = lo.x; x < hi.x; x += _stride.x)
-                            this->FindIn(x + y + z, hash, results);
+                            indexes.push_back(x + y + z);
+                this->FindIn(indexes, *hash, results, threadNumber);
             }
 
         private:
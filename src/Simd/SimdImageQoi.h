@@ -0,0 +1,144 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdImageQoi_h__
+#define __SimdImageQoi_h__
+
+#include "Simd/SimdMemory.h"
+
+namespace Simd
+{
+    const uint8_t QoiOpIndex = 0x00;
+    const uint8_t QoiOpDiff = 0x40;
+    const uint8_t QoiOpLuma = 0x80;
+    const uint8_t QoiOpRun = 0xC0;
+    const uint8_t QoiOpRgb = 0xFE;
+    const uint8_t QoiOpRgba = 0xFF;
+    const uint8_t QoiMask2 = 0xC0;
+
+    const size_t QoiHeaderSize = 14;
+    const size_t QoiPaddingSize = 8;
+    const size_t QoiRunMax = 62;
+    const size_t QoiPixelsMax = 400000000;
+
+    SIMD_INLINE bool QoiSignature(const uint8_t* data)
+    {
+        return data[0] == 'q' && data[1] == 'o' && data[2] == 'i' && data[3] == 'f';
+    }
+
+    struct QoiState
+    {
+        uint32_t index[64];
+        uint32_t prev;
+        size_t run;
+
+        SIMD_INLINE QoiState()
+        {
+            memset(index, 0, sizeof(index));
+            prev = 0xFF000000;
+            run = 0;
+        }
+    };
+
+    namespace Base
+    {
+        SIMD_INLINE size_t QoiHash(uint32_t px)
+        {
+            return ((px & 0xFF) * 3 + ((px >> 8) & 0xFF) * 5 + ((px >> 16) & 0xFF) * 7 + (px >> 24) * 11) & 63;
+        }
+
+        SIMD_INLINE uint8_t* QoiEncodeRun(QoiState& state, uint8_t* dst)
+        {
+            for (; state.run >= QoiRunMax; state.run -= QoiRunMax)
+                *dst++ = QoiOpRun | uint8_t(QoiRunMax - 1);
+            return dst;
+        }
+
+        SIMD_INLINE uint8_t* QoiEncodePixel(uint32_t px, size_t hash, QoiState& state, uint8_t* dst)
+        {
+            if (state.run)
+            {
+                *dst++ = QoiOpRun | uint8_t(state.run - 1);
+                state.run = 0;
+            }
+            if (state.index[hash] == px)
+                *dst++ = QoiOpIndex | uint8_t(hash);
+            else
+            {
+                state.index[hash] = px;
+                uint32_t prev = state.prev;
+                if ((px ^ prev) >> 24 == 0)
+                {
+                    int vr = int8_t(px - prev);
+                    int vg = int8_t((px >> 8) - (prev >> 8));
+                    int vb = int8_t((px >> 16) - (prev >> 16));
+                    int vgr = int8_t(vr - vg);
+                    int vgb = int8_t(vb - vg);
+                    if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+                        *dst++ = QoiOpDiff | uint8_t((vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+                    else if (vgr > -9 && vgr < 8 && vg > -33 && vg < 32 && vgb > -9 && vgb < 8)
+                    {
+                        *dst++ = QoiOpLuma | uint8_t(vg + 32);
+                        *dst++ = uint8_t((vgr + 8) << 4 | (vgb + 8));
+                    }
+                    else
+                    {
+                        dst[0] = QoiOpRgb;
+                        dst[1] = uint8_t(px);
+                        dst[2] = uint8_t(px >> 8);
+                        dst[3] = uint8_t(px >> 16);
+                        dst += 4;
+                    }
+                }
+                else
+                {
+                    dst[0] = QoiOpRgba;
+                    *(uint32_t*)(dst + 1) = px;
+                    dst += 5;
+                }
+            }
+            state.prev = px;
+            return dst;
+        }
+
+        uint8_t* QoiEncode(const uint8_t* rgba, size_t size, QoiState& state, uint8_t* dst);
+
+        const uint8_t* QoiDecode(const uint8_t* src, const uint8_t* end, size_t size, QoiState& state, uint8_t* rgba);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        uint8_t* QoiEncode(const uint8_t* rgba, size_t size, QoiState& state, uint8_t* dst);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        uint8_t* QoiEncode(const uint8_t* rgba, size_t size, QoiState& state, uint8_t* dst);
+    }
+#endif
+}
+
+#endif//__SimdImageQoi_h__
@@ -32,6 +32,10 @@ namespace Simd
 {
     typedef uint8_t* (*ImageSaveToMemoryPtr)(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+    struct QoiState;
+
+    typedef void (*AnyToBe16uPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, SimdPixelFormatType srcFormat, uint8_t* dst, size_t dstStride, size_t dstChannels);
+
     SimdBool ImageSaveToFile(const ImageSaveToMemoryPtr saver, const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path);
 
     //-------------------------------------------------------------------------------------------------
@@ -68,7 +72,7 @@ namespace Simd
         {
             if (file == SimdImageFileUndefined)
             {
-                if (format == SimdPixelFormatGray8)
+                if (format == SimdPixelFormatGray8 || format == SimdPixelFormatGray16)
                     file = SimdImageFilePgmBin;
                 else
                     file = SimdImageFilePpmBin;
@@ -77,6 +81,8 @@ namespace Simd
                 return false;
             if (yuvType == SimdYuvUnknown)
             {
+                if (format >= SimdPixelFormatGray16 && format <= SimdPixelFormatRgba64)
+                    return file == SimdImageFilePgmBin || file == SimdImageFilePpmBin || file == SimdImageFilePng;
                 if (format < SimdPixelFormatGray8 || format > SimdPixelFormatRgba32)
                     return false;
             }
@@ -87,7 +93,7 @@ namespace Simd
                 if (width % 2 != 0 || height % 2 != 0)
                     return false;
             }
-            if (file <= SimdImageFileUndefined || file > SimdImageFileBmp)
+            if (file <= SimdImageFileUndefined || file > SimdImageFileQoi)
                 return false;
             return true;
         }
@@ -130,10 +136,12 @@ namespace Simd
         protected:
             typedef void (*ConvertPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
             ConvertPtr _convert;
+            AnyToBe16uPtr _anyToBe16u;
             Array8u _buffer;
-            size_t _block, _size;
+            size_t _block, _size, _depth;
 
             void WriteHeader(size_t version);
+            bool WriteBody16(const uint8_t* src, size_t stride);
         };
 
         class ImagePgmTxtSaver : public ImagePxmSaver
@@ -186,7 +194,8 @@ namespace Simd
             ConvertPtr _convert;
             EncodePtr _encode[TYPES];
             CompressPtr _compress;
-            size_t _channels, _size;
+            AnyToBe16uPtr _anyToBe16u;
+            size_t _channels, _size, _depth;
             Array8u _filt, _buff;
             Array8i _line;
 
@@ -253,6 +262,26 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ImageQoiSaver : public ImageSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+
+            virtual bool ToStream(const uint8_t* src, size_t stride);
+
+        protected:
+            typedef void (*ConvertPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
+            typedef void (*ToBgraPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha);
+            typedef uint8_t* (*EncodePtr)(const uint8_t* rgba, size_t size, QoiState& state, uint8_t* dst);
+            ConvertPtr _convert;
+            ToBgraPtr _toBgra;
+            EncodePtr _encode;
+            Array8u _buffer;
+            size_t _channels, _size, _block;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -308,6 +337,12 @@ namespace Simd
             ImageBmpSaver(const ImageSaverParam& param);
         };
 
+        class ImageQoiSaver : public Base::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
@@ -366,6 +401,12 @@ namespace Simd
             ImageBmpSaver(const ImageSaverParam& param);
         };
 
+        class ImageQoiSaver : public Sse41::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
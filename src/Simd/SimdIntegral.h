@@ -246,5 +246,78 @@ namespace Simd
             }
         }
     }
+
+    template <class TSum> void IntegralTilted(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* sum, size_t sumStride,
+        uint8_t* sqsum, size_t sqsumStride, uint8_t* tilted, size_t tiltedStride, SimdPixelFormatType sqsumFormat)
+    {
+        assert(sumStride % sizeof(TSum) == 0 && tiltedStride % sizeof(TSum) == 0);
+        if (sqsum)
+        {
+            switch (sqsumFormat)
+            {
+            case SimdPixelFormatInt32:
+                IntegralSumSqsumTilted<TSum, uint32_t>(src, srcStride, width, height, (TSum*)sum, sumStride / sizeof(TSum),
+                    (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t), (TSum*)tilted, tiltedStride / sizeof(TSum));
+                break;
+            case SimdPixelFormatInt64:
+                IntegralSumSqsumTilted<TSum, uint64_t>(src, srcStride, width, height, (TSum*)sum, sumStride / sizeof(TSum),
+                    (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t), (TSum*)tilted, tiltedStride / sizeof(TSum));
+                break;
+            case SimdPixelFormatDouble:
+                IntegralSumSqsumTilted<TSum, double>(src, srcStride, width, height, (TSum*)sum, sumStride / sizeof(TSum),
+                    (double*)sqsum, sqsumStride / sizeof(double), (TSum*)tilted, tiltedStride / sizeof(TSum));
+                break;
+            default:
+                assert(0);
+            }
+        }
+        else
+            IntegralSumTilted<TSum>(src, srcStride, width, height, (TSum*)sum, sumStride / sizeof(TSum), (TSum*)tilted, tiltedStride / sizeof(TSum));
+    }
+
+    SIMD_INLINE void IntegralTilted(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* sum, size_t sumStride,
+        uint8_t* sqsum, size_t sqsumStride, uint8_t* tilted, size_t tiltedStride, SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+    {
+        switch (sumFormat)
+        {
+        case SimdPixelFormatInt32:
+            IntegralTilted<uint32_t>(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sqsumFormat);
+            break;
+        case SimdPixelFormatInt64:
+            IntegralTilted<uint64_t>(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sqsumFormat);
+            break;
+        case SimdPixelFormatFloat:
+            IntegralTilted<float>(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sqsumFormat);
+            break;
+        default:
+            assert(0);
+        }
+    }
+
+    const size_t INTEGRAL_WIDTH_MAX = 32768;
+
+    namespace Base
+    {
+        typedef void(*IntegralRowPtr)(const uint8_t* src, size_t width, const uint8_t* prev, uint8_t* dst);
+
+        IntegralRowPtr GetIntegralRow(SimdPixelFormatType format, bool square);
+
+        void IntegralParallel(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* sum, size_t sumStride, uint8_t* sqsum, size_t sqsumStride,
+            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat, IntegralRowPtr sumRow, IntegralRowPtr sqsumRow);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        Base::IntegralRowPtr GetIntegralRow(SimdPixelFormatType format, bool square, size_t width);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        Base::IntegralRowPtr GetIntegralRow(SimdPixelFormatType format, bool square, size_t width);
+    }
+#endif
 }
 #endif//__SimdIntegral_h__
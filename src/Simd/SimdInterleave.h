@@ -25,6 +25,7 @@
 #define __SimdInterleave_h__
 
 #include "Simd/SimdConst.h"
+#include "Simd/SimdStore.h"
 
 namespace Simd
 {
@@ -56,6 +57,85 @@ namespace Simd
                     _mm_or_si128(_mm_shuffle_epi8(green, K8_SHUFFLE_GREEN_TO_BGR2),
                         _mm_shuffle_epi8(red, K8_SHUFFLE_RED_TO_BGR2)));
         }
+
+        const __m128i K8_SHUFFLE_INTERLEAVE_16_3[9] = {
+            SIMD_MM_SETR_EPI8(0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, 0x4, 0x5, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, 0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, 0x4, 0x5),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1, -1, -1, 0xA, 0xB),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(0x4, 0x5, -1, -1, -1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(0xA, 0xB, -1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, 0xA, 0xB, -1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF) };
+        const __m128i K8_SHUFFLE_INTERLEAVE_32_3[9] = {
+            SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x3, -1, -1, -1, -1, -1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1),
+            SIMD_MM_SETR_EPI8(0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1, -1, -1, -1, -1, 0xC, 0xD, 0xE, 0xF) };
+
+        template<size_t C> SIMD_INLINE void InterleaveStore16u(const __m128i* src, uint8_t* dst);
+
+        template<> SIMD_INLINE void InterleaveStore16u<2>(const __m128i* src, uint8_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_unpacklo_epi16(src[0], src[1]));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_unpackhi_epi16(src[0], src[1]));
+        }
+
+        template<> SIMD_INLINE void InterleaveStore16u<3>(const __m128i* src, uint8_t* dst)
+        {
+            __m128i d[3];
+            for (size_t i = 0; i < 3; ++i)
+                d[i] = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(src[0], K8_SHUFFLE_INTERLEAVE_16_3[i * 3 + 0]),
+                    _mm_shuffle_epi8(src[1], K8_SHUFFLE_INTERLEAVE_16_3[i * 3 + 1])), _mm_shuffle_epi8(src[2], K8_SHUFFLE_INTERLEAVE_16_3[i * 3 + 2]));
+            _mm_storeu_si128((__m128i*)dst + 0, d[0]);
+            _mm_storeu_si128((__m128i*)dst + 1, d[1]);
+            _mm_storeu_si128((__m128i*)dst + 2, d[2]);
+        }
+
+        template<> SIMD_INLINE void InterleaveStore16u<4>(const __m128i* src, uint8_t* dst)
+        {
+            __m128i lo01 = _mm_unpacklo_epi16(src[0], src[1]), lo23 = _mm_unpacklo_epi16(src[2], src[3]);
+            __m128i hi01 = _mm_unpackhi_epi16(src[0], src[1]), hi23 = _mm_unpackhi_epi16(src[2], src[3]);
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_unpacklo_epi32(lo01, lo23));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_unpackhi_epi32(lo01, lo23));
+            _mm_storeu_si128((__m128i*)dst + 2, _mm_unpacklo_epi32(hi01, hi23));
+            _mm_storeu_si128((__m128i*)dst + 3, _mm_unpackhi_epi32(hi01, hi23));
+        }
+
+        template<size_t C> SIMD_INLINE void InterleaveStore32f(const __m128i* src, uint8_t* dst);
+
+        template<> SIMD_INLINE void InterleaveStore32f<2>(const __m128i* src, uint8_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_unpacklo_epi32(src[0], src[1]));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_unpackhi_epi32(src[0], src[1]));
+        }
+
+        template<> SIMD_INLINE void InterleaveStore32f<3>(const __m128i* src, uint8_t* dst)
+        {
+            __m128i d[3];
+            for (size_t i = 0; i < 3; ++i)
+                d[i] = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(src[0], K8_SHUFFLE_INTERLEAVE_32_3[i * 3 + 0]),
+                    _mm_shuffle_epi8(src[1], K8_SHUFFLE_INTERLEAVE_32_3[i * 3 + 1])), _mm_shuffle_epi8(src[2], K8_SHUFFLE_INTERLEAVE_32_3[i * 3 + 2]));
+            _mm_storeu_si128((__m128i*)dst + 0, d[0]);
+            _mm_storeu_si128((__m128i*)dst + 1, d[1]);
+            _mm_storeu_si128((__m128i*)dst + 2, d[2]);
+        }
+
+        template<> SIMD_INLINE void InterleaveStore32f<4>(const __m128i* src, uint8_t* dst)
+        {
+            __m128i t0 = _mm_unpacklo_epi32(src[0], src[1]), t1 = _mm_unpacklo_epi32(src[2], src[3]);
+            __m128i t2 = _mm_unpackhi_epi32(src[0], src[1]), t3 = _mm_unpackhi_epi32(src[2], src[3]);
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_unpacklo_epi64(t0, t1));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_unpackhi_epi64(t0, t1));
+            _mm_storeu_si128((__m128i*)dst + 2, _mm_unpacklo_epi64(t2, t3));
+            _mm_storeu_si128((__m128i*)dst + 3, _mm_unpackhi_epi64(t2, t3));
+        }
     }
 #endif
 
@@ -87,6 +167,103 @@ namespace Simd
                     _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permute4x64_epi64(green, 0xEE), K8_SHUFFLE_PERMUTED_GREEN_TO_BGR2),
                         _mm256_shuffle_epi8(_mm256_permute4x64_epi64(red, 0xEE), K8_SHUFFLE_PERMUTED_RED_TO_BGR2)));
         }
+
+        const __m256i K8_SHUFFLE_INTERLEAVE_16_3[9] = {
+            SIMD_MM256_SETR_EPI8(0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, 0x4, 0x5, -1, -1,
+                0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, 0x4, 0x5, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, 0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, 0x4, 0x5,
+                -1, -1, 0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, 0x4, 0x5),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, 0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1,
+                -1, -1, -1, -1, 0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1, -1, -1, 0xA, 0xB,
+                -1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1, -1, -1, 0xA, 0xB),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1, -1, -1,
+                -1, -1, -1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(0x4, 0x5, -1, -1, -1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1,
+                0x4, 0x5, -1, -1, -1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF, -1, -1, -1, -1,
+                -1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(0xA, 0xB, -1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF, -1, -1,
+                0xA, 0xB, -1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, 0xA, 0xB, -1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF,
+                -1, -1, 0xA, 0xB, -1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF) };
+        const __m256i K8_SHUFFLE_INTERLEAVE_32_3[9] = {
+            SIMD_MM256_SETR_EPI8(0x0, 0x1, 0x2, 0x3, -1, -1, -1, -1, -1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7,
+                0x0, 0x1, 0x2, 0x3, -1, -1, -1, -1, -1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, 0x0, 0x1, 0x2, 0x3, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB,
+                0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1, 0x8, 0x9, 0xA, 0xB),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, 0x4, 0x5, 0x6, 0x7, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(-1, -1, -1, -1, -1, -1, -1, -1, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, 0xC, 0xD, 0xE, 0xF, -1, -1, -1, -1),
+            SIMD_MM256_SETR_EPI8(0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1, -1, -1, -1, -1, 0xC, 0xD, 0xE, 0xF,
+                0x8, 0x9, 0xA, 0xB, -1, -1, -1, -1, -1, -1, -1, -1, 0xC, 0xD, 0xE, 0xF) };
+
+        template<size_t C> SIMD_INLINE void InterleaveStore16u(const __m256i* src, uint8_t* dst);
+
+        template<> SIMD_INLINE void InterleaveStore16u<2>(const __m256i* src, uint8_t* dst)
+        {
+            Store<false>((__m128i*)(dst + 0), (__m128i*)(dst + 32), _mm256_unpacklo_epi16(src[0], src[1]));
+            Store<false>((__m128i*)(dst + 16), (__m128i*)(dst + 48), _mm256_unpackhi_epi16(src[0], src[1]));
+        }
+
+        template<> SIMD_INLINE void InterleaveStore16u<3>(const __m256i* src, uint8_t* dst)
+        {
+            __m256i d[3];
+            for (size_t i = 0; i < 3; ++i)
+                d[i] = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(src[0], K8_SHUFFLE_INTERLEAVE_16_3[i * 3 + 0]),
+                    _mm256_shuffle_epi8(src[1], K8_SHUFFLE_INTERLEAVE_16_3[i * 3 + 1])), _mm256_shuffle_epi8(src[2], K8_SHUFFLE_INTERLEAVE_16_3[i * 3 + 2]));
+            Store<false>((__m128i*)(dst + 0), (__m128i*)(dst + 48), d[0]);
+            Store<false>((__m128i*)(dst + 16), (__m128i*)(dst + 64), d[1]);
+            Store<false>((__m128i*)(dst + 32), (__m128i*)(dst + 80), d[2]);
+        }
+
+        template<> SIMD_INLINE void InterleaveStore16u<4>(const __m256i* src, uint8_t* dst)
+        {
+            __m256i lo01 = _mm256_unpacklo_epi16(src[0], src[1]), lo23 = _mm256_unpacklo_epi16(src[2], src[3]);
+            __m256i hi01 = _mm256_unpackhi_epi16(src[0], src[1]), hi23 = _mm256_unpackhi_epi16(src[2], src[3]);
+            Store<false>((__m128i*)(dst + 0), (__m128i*)(dst + 64), _mm256_unpacklo_epi32(lo01, lo23));
+            Store<false>((__m128i*)(dst + 16), (__m128i*)(dst + 80), _mm256_unpackhi_epi32(lo01, lo23));
+            Store<false>((__m128i*)(dst + 32), (__m128i*)(dst + 96), _mm256_unpacklo_epi32(hi01, hi23));
+            Store<false>((__m128i*)(dst + 48), (__m128i*)(dst + 112), _mm256_unpackhi_epi32(hi01, hi23));
+        }
+
+        template<size_t C> SIMD_INLINE void InterleaveStore32f(const __m256i* src, uint8_t* dst);
+
+        template<> SIMD_INLINE void InterleaveStore32f<2>(const __m256i* src, uint8_t* dst)
+        {
+            Store<false>((__m128i*)(dst + 0), (__m128i*)(dst + 32), _mm256_unpacklo_epi32(src[0], src[1]));
+            Store<false>((__m128i*)(dst + 16), (__m128i*)(dst + 48), _mm256_unpackhi_epi32(src[0], src[1]));
+        }
+
+        template<> SIMD_INLINE void InterleaveStore32f<3>(const __m256i* src, uint8_t* dst)
+        {
+            __m256i d[3];
+            for (size_t i = 0; i < 3; ++i)
+                d[i] = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(src[0], K8_SHUFFLE_INTERLEAVE_32_3[i * 3 + 0]),
+                    _mm256_shuffle_epi8(src[1], K8_SHUFFLE_INTERLEAVE_32_3[i * 3 + 1])), _mm256_shuffle_epi8(src[2], K8_SHUFFLE_INTERLEAVE_32_3[i * 3 + 2]));
+            Store<false>((__m128i*)(dst + 0), (__m128i*)(dst + 48), d[0]);
+            Store<false>((__m128i*)(dst + 16), (__m128i*)(dst + 64), d[1]);
+            Store<false>((__m128i*)(dst + 32), (__m128i*)(dst + 80), d[2]);
+        }
+
+        template<> SIMD_INLINE void InterleaveStore32f<4>(const __m256i* src, uint8_t* dst)
+        {
+            __m256i t0 = _mm256_unpacklo_epi32(src[0], src[1]), t1 = _mm256_unpacklo_epi32(src[2], src[3]);
+            __m256i t2 = _mm256_unpackhi_epi32(src[0], src[1]), t3 = _mm256_unpackhi_epi32(src[2], src[3]);
+            Store<false>((__m128i*)(dst + 0), (__m128i*)(dst + 64), _mm256_unpacklo_epi64(t0, t1));
+            Store<false>((__m128i*)(dst + 16), (__m128i*)(dst + 80), _mm256_unpackhi_epi64(t0, t1));
+            Store<false>((__m128i*)(dst + 32), (__m128i*)(dst + 96), _mm256_unpacklo_epi64(t2, t3));
+            Store<false>((__m128i*)(dst + 48), (__m128i*)(dst + 112), _mm256_unpackhi_epi64(t2, t3));
+        }
     }
 #endif
 
@@ -64,10 +64,15 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdEmpty.h"
 #include "Simd/SimdTile.h"
 
+#include "Simd/SimdColorPipeline.h"
 #include "Simd/SimdDescrInt.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdHogDetector.h"
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageSave.h"
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdOpticalFlow.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdSynetAdd16b.h"
@@ -90,6 +95,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetScale8i.h"
 #include "Simd/SimdSynetScale16b.h"
 #include "Simd/SimdWarpAffine.h"
+#include "Simd/SimdRemap.h"
 
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse41.h"
@@ -556,6 +562,22 @@ SIMD_API void SimdAlphaBlendingUniform(const uint8_t* src, size_t srcStride, siz
         Base::AlphaBlendingUniform(src, srcStride, width, height, channelCount, alpha, dst, dstStride);
 }
 
+SIMD_API void SimdAlphaCompositing(const SimdAlphaCompositingLayer * layers, size_t count, uint8_t * dst, size_t dstStride, size_t width, size_t height)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::AlphaCompositing(layers, count, dst, dstStride, width, height);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::F)
+        Sse41::AlphaCompositing(layers, count, dst, dstStride, width, height);
+    else
+#endif
+        Base::AlphaCompositing(layers, count, dst, dstStride, width, height);
+}
+
 SIMD_API void SimdAlphaFilling(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * channel, size_t channelCount, const uint8_t * alpha, size_t alphaStride)
 {
     SIMD_EMPTY();
@@ -967,6 +989,23 @@ SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height
         Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdBayerDemosaic(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height, SimdPixelFormatType bayerFormat, size_t bitDepth,
+    size_t blackLevel, const float* gains, SimdBayerDemosaicType method, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BayerDemosaic(bayer, bayerStride, width, height, bayerFormat, bitDepth, blackLevel, gains, method, dst, dstStride, dstFormat);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BayerDemosaic(bayer, bayerStride, width, height, bayerFormat, bitDepth, blackLevel, gains, method, dst, dstStride, dstFormat);
+    else
+#endif
+        Base::BayerDemosaic(bayer, bayerStride, width, height, bayerFormat, bitDepth, blackLevel, gains, method, dst, dstStride, dstFormat);
+}
+
 SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
     SIMD_EMPTY();
@@ -1300,6 +1339,38 @@ SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, siz
         Base::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
 }
 
+SIMD_API void SimdBgrToGray16u(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t * gray, size_t grayStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::HA)
+        Avx2::BgrToGray16u(bgr, bgrStride, width, height, channels, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::HA)
+        Sse41::BgrToGray16u(bgr, bgrStride, width, height, channels, gray, grayStride);
+    else
+#endif
+        Base::BgrToGray16u(bgr, bgrStride, width, height, channels, gray, grayStride);
+}
+
+SIMD_API void SimdBgrToGray32f(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t * gray, size_t grayStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::BgrToGray32f(bgr, bgrStride, width, height, channels, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::F)
+        Sse41::BgrToGray32f(bgr, bgrStride, width, height, channels, gray, grayStride);
+    else
+#endif
+        Base::BgrToGray32f(bgr, bgrStride, width, height, channels, gray, grayStride);
+}
+
 SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
 {
     SIMD_EMPTY();
@@ -1502,6 +1573,21 @@ SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride,
     Base::AveragingBinarizationV2(src, srcStride, width, height, neighborhood, shift, positive, negative, dst, dstStride);
 }
 
+SIMD_API void* SimdColorPipelineInit(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize,
+    const float* lut, size_t lutSize, SimdColorPipelineFlags flags)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdColorPipelineInitPtr) (SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags);
+    const static SimdColorPipelineInitPtr simdColorPipelineInit = SIMD_FUNC2(ColorPipelineInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdColorPipelineInit(format, matrix, curves, curveSize, lut, lutSize, flags);
+}
+
+SIMD_API void SimdColorPipelineRun(const void* context, const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((ColorPipeline*)context)->Run(src, srcStride, width, height, dst, dstStride);
+}
+
 SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
                                    uint8_t value, SimdCompareType compareType, uint32_t * count)
 {
@@ -1841,6 +1927,40 @@ SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size
         Base::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
 }
 
+SIMD_API void SimdDeinterleave16u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+    uint8_t * dst0, size_t dst0Stride, uint8_t * dst1, size_t dst1Stride, uint8_t * dst2, size_t dst2Stride, uint8_t * dst3, size_t dst3Stride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::HA)
+        Avx2::Deinterleave16u(src, srcStride, width, height, channels, dst0, dst0Stride, dst1, dst1Stride, dst2, dst2Stride, dst3, dst3Stride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::HA)
+        Sse41::Deinterleave16u(src, srcStride, width, height, channels, dst0, dst0Stride, dst1, dst1Stride, dst2, dst2Stride, dst3, dst3Stride);
+    else
+#endif
+        Base::Deinterleave16u(src, srcStride, width, height, channels, dst0, dst0Stride, dst1, dst1Stride, dst2, dst2Stride, dst3, dst3Stride);
+}
+
+SIMD_API void SimdDeinterleave32f(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+    uint8_t * dst0, size_t dst0Stride, uint8_t * dst1, size_t dst1Stride, uint8_t * dst2, size_t dst2Stride, uint8_t * dst3, size_t dst3Stride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::Deinterleave32f(src, srcStride, width, height, channels, dst0, dst0Stride, dst1, dst1Stride, dst2, dst2Stride, dst3, dst3Stride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::F)
+        Sse41::Deinterleave32f(src, srcStride, width, height, channels, dst0, dst0Stride, dst1, dst1Stride, dst2, dst2Stride, dst3, dst3Stride);
+    else
+#endif
+        Base::Deinterleave32f(src, srcStride, width, height, channels, dst0, dst0Stride, dst1, dst1Stride, dst2, dst2Stride, dst3, dst3Stride);
+}
+
 SIMD_API void * SimdDetectionLoadStringXml(char * xml)
 {
     SIMD_EMPTY();
@@ -2425,12 +2545,17 @@ SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t
 }
 
 SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
+{
+    return SimdGaussianBlurInitV2(width, height, channels, sigma, epsilon, SimdGaussianBlurDefault);
+}
+
+SIMD_API void* SimdGaussianBlurInitV2(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags)
 {
     SIMD_EMPTY();
-    typedef void* (*SimdGaussianBlurInitPtr) (size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+    typedef void* (*SimdGaussianBlurInitPtr) (size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
     const static SimdGaussianBlurInitPtr simdGaussianBlurInit = SIMD_FUNC4(GaussianBlurInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
 
-    return simdGaussianBlurInit(width, height, channels, sigma, epsilon);
+    return simdGaussianBlurInit(width, height, channels, sigma, epsilon, flags);
 }
 
 SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
@@ -2765,6 +2890,20 @@ SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t
         Base::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
 }
 
+SIMD_API void* SimdHogDetectorInit(size_t width, size_t height, const float* weights, size_t windowX, size_t windowY, float bias, float scaleFactor, size_t levelsMax)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdHogDetectorInitPtr) (size_t width, size_t height, const float* weights, size_t windowX, size_t windowY, float bias, float scaleFactor, size_t levelsMax);
+    const static SimdHogDetectorInitPtr simdHogDetectorInit = SIMD_FUNC2(HogDetectorInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdHogDetectorInit(width, height, weights, windowX, windowY, bias, scaleFactor, levelsMax);
+}
+
+SIMD_API size_t SimdHogDetectorRun(const void* detector, const uint8_t* src, size_t stride, float threshold, float overlap, SimdHogDetection* detections, size_t capacity)
+{
+    SIMD_EMPTY();
+    return ((HogDetector*)detector)->Run(src, stride, threshold, overlap, detections, capacity);
+}
+
 SIMD_API uint8_t* SimdImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size)
 {
     SIMD_EMPTY();
@@ -2857,6 +2996,11 @@ SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width,
     if (Avx2::Enable)
         Avx2::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
     else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    else
 #endif
         Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
 }
@@ -2941,6 +3085,40 @@ SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_
         Base::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
 }
 
+SIMD_API void SimdInterleave16u(const uint8_t * src0, size_t src0Stride, const uint8_t * src1, size_t src1Stride, const uint8_t * src2, size_t src2Stride,
+    const uint8_t * src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::HA)
+        Avx2::Interleave16u(src0, src0Stride, src1, src1Stride, src2, src2Stride, src3, src3Stride, width, height, channels, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::HA)
+        Sse41::Interleave16u(src0, src0Stride, src1, src1Stride, src2, src2Stride, src3, src3Stride, width, height, channels, dst, dstStride);
+    else
+#endif
+        Base::Interleave16u(src0, src0Stride, src1, src1Stride, src2, src2Stride, src3, src3Stride, width, height, channels, dst, dstStride);
+}
+
+SIMD_API void SimdInterleave32f(const uint8_t * src0, size_t src0Stride, const uint8_t * src1, size_t src1Stride, const uint8_t * src2, size_t src2Stride,
+    const uint8_t * src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::Interleave32f(src0, src0Stride, src1, src1Stride, src2, src2Stride, src3, src3Stride, width, height, channels, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::F)
+        Sse41::Interleave32f(src0, src0Stride, src1, src1Stride, src2, src2Stride, src3, src3Stride, width, height, channels, dst, dstStride);
+    else
+#endif
+        Base::Interleave32f(src0, src0Stride, src1, src1Stride, src2, src2Stride, src3, src3Stride, width, height, channels, dst, dstStride);
+}
+
 SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -3175,6 +3353,44 @@ SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, s
         Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void* SimdMedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdMedianFilterInitPtr) (size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags);
+    const static SimdMedianFilterInitPtr simdMedianFilterInit = SIMD_FUNC2(MedianFilterInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdMedianFilterInit(width, height, channels, radius, flags);
+}
+
+SIMD_API void SimdMedianFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((MedianFilter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void SimdMorphology(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+    size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdMorphologyPtr) (const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+        size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, uint8_t* dst, size_t dstStride);
+    const static SimdMorphologyPtr simdMorphology = SIMD_FUNC2(Morphology, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdMorphology(src, srcStride, width, height, channels, kernelX, kernelY, shape, operation, dst, dstStride);
+}
+
+SIMD_API void SimdErode(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+    size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, uint8_t* dst, size_t dstStride)
+{
+    SimdMorphology(src, srcStride, width, height, channels, kernelX, kernelY, shape, SimdMorphologyErode, dst, dstStride);
+}
+
+SIMD_API void SimdDilate(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+    size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, uint8_t* dst, size_t dstStride)
+{
+    SimdMorphology(src, srcStride, width, height, channels, kernelX, kernelY, shape, SimdMorphologyDilate, dst, dstStride);
+}
+
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
     SIMD_EMPTY();
@@ -3680,6 +3896,21 @@ SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const ui
         Base::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
 }
 
+SIMD_API void* SimdOpticalFlowPyrLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigen)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdOpticalFlowPyrLkInitPtr) (size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigen);
+    const static SimdOpticalFlowPyrLkInitPtr simdOpticalFlowPyrLkInit = SIMD_FUNC2(OpticalFlowPyrLkInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdOpticalFlowPyrLkInit(width, height, levels, radius, iterations, epsilon, minEigen);
+}
+
+SIMD_API void SimdOpticalFlowPyrLkRun(const void* context, const uint8_t* const* prev, const size_t* prevStrides, const uint8_t* const* next, const size_t* nextStrides,
+    const float* prevPoints, size_t count, float* nextPoints, uint8_t* status, float* errors)
+{
+    SIMD_EMPTY();
+    ((OpticalFlowPyrLk*)context)->Run(prev, prevStrides, next, nextStrides, prevPoints, count, nextPoints, status, errors);
+}
+
 SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
 {
     SIMD_EMPTY();
@@ -3856,6 +4087,20 @@ SIMD_API void SimdReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcH
         Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
+SIMD_API void* SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdRemapInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+    const static SimdRemapInitPtr simdRemapInit = SIMD_FUNC2(RemapInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);// , SIMD_AVX512BW_FUNC, SIMD_NEON_FUNC);
+    return simdRemapInit(srcW, srcH, srcS, dstW, dstH, dstS, channels, map, flags, border);
+}
+
+SIMD_API void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    ((Remap*)context)->Run(src, dst);
+}
+
 SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
     SIMD_EMPTY();
@@ -4795,6 +5040,29 @@ SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_
         Base::CorrelationSum(a, aStride, b, bStride, width, height, sum);
 }
 
+SIMD_API void SimdTemplateMatch(const uint8_t* src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t* tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight,
+    SimdTemplateMatchMethodType method, float* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::TemplateMatch(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, method, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::TemplateMatch(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, method, dst, dstStride);
+    else
+#endif
+        Base::TemplateMatch(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, method, dst, dstStride);
+}
+
+SIMD_API size_t SimdTemplateMatchPeaks(const float* map, size_t stride, size_t width, size_t height, SimdTemplateMatchMethodType method,
+    size_t radius, SimdTemplateMatchPeak* peaks, size_t count)
+{
+    return Base::TemplateMatchPeaks(map, stride, width, height, method, radius, peaks, count);
+}
+
 SIMD_API void SimdStretchGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
@@ -6665,6 +6933,36 @@ SIMD_API void SimdWarpAffineRun(const void* context, const uint8_t* src, uint8_t
     ((WarpAffine*)context)->Run(src, dst);
 }
 
+SIMD_API void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+    SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdWarpAffineBatchInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+        SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper);
+    const static SimdWarpAffineBatchInitPtr simdWarpAffineBatchInit = SIMD_FUNC3(WarpAffineBatchInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdWarpAffineBatchInit(srcW, srcH, srcS, channels, dstW, dstH, flags, border, format, type, lower, upper);
+}
+
+SIMD_API void SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t count, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    ((WarpAffineBatch*)context)->Run(src, mats, count, dst);
+}
+
+SIMD_API void* SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdWarpPerspectiveInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    const static SimdWarpPerspectiveInitPtr simdWarpPerspectiveInit = SIMD_FUNC2(WarpPerspectiveInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);// , SIMD_AVX512BW_FUNC, SIMD_NEON_FUNC);
+    return simdWarpPerspectiveInit(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border);
+}
+
+SIMD_API void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    ((Remap*)context)->Run(src, dst);
+}
+
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
 typedef void(*SimdWinogradSetInputPtr) (const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
 typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
@@ -7373,6 +7671,167 @@ SIMD_API void SimdYuv444pToRgbaV2(const uint8_t* y, size_t yStride, const uint8_
         Base::Yuv444pToRgbaV2(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha, yuvType);
 }
 
+SIMD_API void SimdYuv16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height,
+    SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, uint8_t* dst, size_t dstStride, SimdYuv16OutputType output, SimdBool dither)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::Yuv16ToBgr(y, yStride, u, uStride, v, vStride, width, height, layout, bitDepth, yuvType, dst, dstStride, output, dither);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::Yuv16ToBgr(y, yStride, u, uStride, v, vStride, width, height, layout, bitDepth, yuvType, dst, dstStride, output, dither);
+    else
+#endif
+        Base::Yuv16ToBgr(y, yStride, u, uStride, v, vStride, width, height, layout, bitDepth, yuvType, dst, dstStride, output, dither);
+}
+
+SIMD_API void SimdNv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToRgbaV2(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToRgbaV2(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv12ToRgbaV2(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgrResized(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t srcWidth, size_t srcHeight, uint8_t* bgr, size_t bgrStride, size_t dstWidth, size_t dstHeight, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::Nv12ToBgrResized(y, yStride, uv, uvStride, srcWidth, srcHeight, bgr, bgrStride, dstWidth, dstHeight, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::Nv12ToBgrResized(y, yStride, uv, uvStride, srcWidth, srcHeight, bgr, bgrStride, dstWidth, dstHeight, yuvType);
+    else
+#endif
+        Base::Nv12ToBgrResized(y, yStride, uv, uvStride, srcWidth, srcHeight, bgr, bgrStride, dstWidth, dstHeight, yuvType);
+}
+
+SIMD_API void SimdNv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv21ToBgrV2(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv21ToBgraV2(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToRgbV2(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv21ToRgbV2(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Nv21ToRgbV2(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdNv21ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToRgbaV2(y, yStride, vu, vuStride, width, height, rgba, rgbaStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv21ToRgbaV2(y, yStride, vu, vuStride, width, height, rgba, rgbaStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv21ToRgbaV2(y, yStride, vu, vuStride, width, height, rgba, rgbaStride, alpha, yuvType);
+}
+
 SIMD_API void SimdYuv420pToUyvy422(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
     size_t width, size_t height, uint8_t* uyvy, size_t uyvyStride)
 {
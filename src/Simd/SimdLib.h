@@ -127,6 +127,17 @@ typedef enum
     SimdBayerLayoutBggr,
 } SimdBayerLayoutType;
 
+/*! @ingroup c_types
+    Describes demosaicing methods used in function ::SimdBayerDemosaic.
+*/
+typedef enum
+{
+    /*! Gradient-corrected bilinear interpolation (Malvar-He-Cutler, 5x5 kernels). */
+    SimdBayerDemosaicMalvar,
+    /*! Edge-directed interpolation of green channel (Hamilton-Adams) with color difference interpolation of red and blue channels. */
+    SimdBayerDemosaicEdgeDirected,
+} SimdBayerDemosaicType;
+
 /*! @ingroup c_types
     Describes boolean type.
 */
@@ -294,6 +305,25 @@ typedef enum
     SimdDetectionInfoCanInt16 = 8,
 } SimdDetectionInfoFlags;
 
+/*! @ingroup gaussian_filter
+    Describes Gaussian blur flags. This type used in function ::SimdGaussianBlurInitV2.
+*/
+typedef enum
+{
+    /*! Direct separable convolution. Its cost grows linearly with sigma. It supports only 8-bit images. */
+    SimdGaussianBlurDefault = 0,
+    /*! Recursive (IIR) Young - van Vliet approximation of Gaussian. Its cost does not depend on sigma. Sigma must be not less than 0.5. */
+    SimdGaussianBlurRecursive = 1,
+    /*! Algorithm type mask. */
+    SimdGaussianBlurAlgMask = 1,
+    /*! Input and output images have 8-bit unsigned integer channels. */
+    SimdGaussianBlur8u = 0,
+    /*! Input and output images have 32-bit float channels (only for ::SimdGaussianBlurRecursive). */
+    SimdGaussianBlur32f = 2,
+    /*! Image channel type mask. */
+    SimdGaussianBlurTypeMask = 2,
+} SimdGaussianBlurFlags;
+
 /*! @ingroup synet_grid_sample
     Describes grid sample interpolation type. It is used in function ::SimdSynetGridSample2dInit.
 */
@@ -341,8 +371,114 @@ typedef enum
     SimdImageFileJpeg,
     /*! A BMP (BitMap Picture) image file format. */
     SimdImageFileBmp,
+    /*! A QOI (Quite OK Image) lossless image file format. */
+    SimdImageFileQoi,
 } SimdImageFileType;
 
+/*! @ingroup median_filter
+    Describes median filter flags. This type used in function ::SimdMedianFilterInit.
+*/
+typedef enum
+{
+    /*! Input and output images have 8-bit unsigned integer channels. */
+    SimdMedianFilter8u = 0,
+    /*! Input and output images have 16-bit unsigned integer channels (for example depth maps). */
+    SimdMedianFilter16u = 1,
+    /*! Image channel type mask. */
+    SimdMedianFilterTypeMask = 1,
+} SimdMedianFilterFlags;
+
+/*! @ingroup other_filter
+    Describes types of morphological operation performed by function ::SimdMorphology.
+*/
+typedef enum
+{
+    /*! Erosion: every output point is a minimum over structuring element. */
+    SimdMorphologyErode,
+    /*! Dilation: every output point is a maximum over structuring element. */
+    SimdMorphologyDilate,
+    /*! Opening: erosion followed by dilation. */
+    SimdMorphologyOpen,
+    /*! Closing: dilation followed by erosion. */
+    SimdMorphologyClose,
+    /*! Morphological gradient: difference between dilation and erosion. */
+    SimdMorphologyGradient,
+} SimdMorphologyOperationType;
+
+/*! @ingroup other_filter
+    Describes shapes of structuring element used in function ::SimdMorphology.
+*/
+typedef enum
+{
+    /*! A rectangle kernelX x kernelY (a square if kernelX == kernelY). */
+    SimdMorphologyShapeRect,
+    /*! A cross: union of horizontal line kernelX x 1 and vertical line 1 x kernelY. */
+    SimdMorphologyShapeCross,
+} SimdMorphologyShapeType;
+
+/*! @ingroup correlation
+    Describes methods of template matching performed by function ::SimdTemplateMatch.
+    Here T(i, j) is a template, I(x + i, y + j) is a source image under the template window, n is a number of template pixels,
+    T' and I' are the template and the window with subtracted mean values.
+*/
+typedef enum
+{
+    /*! Sum of squared differences: R = sum((T - I)^2). The best match has minimal value. */
+    SimdTemplateMatchSqDiff,
+    /*! Normalized sum of squared differences: R = sum((T - I)^2) / sqrt(sum(T^2) * sum(I^2)). The best match has minimal value. */
+    SimdTemplateMatchSqDiffNormed,
+    /*! Cross correlation: R = sum(T * I). */
+    SimdTemplateMatchCCorr,
+    /*! Normalized cross correlation: R = sum(T * I) / sqrt(sum(T^2) * sum(I^2)). */
+    SimdTemplateMatchCCorrNormed,
+    /*! Correlation coefficient: R = sum(T' * I'). */
+    SimdTemplateMatchCCoeff,
+    /*! Normalized correlation coefficient: R = sum(T' * I') / sqrt(sum(T'^2) * sum(I'^2)). It lies in range [-1, 1]. */
+    SimdTemplateMatchCCoeffNormed,
+} SimdTemplateMatchMethodType;
+
+/*! @ingroup correlation
+    \brief Describes a peak of template matching score map found by function ::SimdTemplateMatchPeaks.
+*/
+typedef struct SimdTemplateMatchPeak
+{
+    size_t x; /*!< \brief A horizontal position of the peak (the left column of matched template window). */
+    size_t y; /*!< \brief A vertical position of the peak (the top row of matched template window). */
+    float score; /*!< \brief A value of score map at the peak. */
+} SimdTemplateMatchPeak;
+
+/*! @ingroup c_types
+    Describes blend modes of layers composited by function ::SimdAlphaCompositing.
+    Here S and D are premultiplied source and destination channel values, Sa and Da are source and destination alpha (normalized to [0, 1]).
+*/
+typedef enum
+{
+    /*! Normal (source-over) blending: D = S + D*(1 - Sa). */
+    SimdAlphaCompositingNormal,
+    /*! Additive blending: D = min(S + D, 1). */
+    SimdAlphaCompositingAdd,
+    /*! Multiply blending: D = S*D + S*(1 - Da) + D*(1 - Sa). */
+    SimdAlphaCompositingMultiply,
+    /*! Screen blending: D = S + D - S*D. */
+    SimdAlphaCompositingScreen,
+} SimdAlphaCompositingModeType;
+
+/*! @ingroup drawing
+    \brief Describes a layer composited by function ::SimdAlphaCompositing.
+*/
+typedef struct SimdAlphaCompositingLayer
+{
+    const uint8_t * src; /*!< \brief A pointer to pixels data of 32-bit BGRA layer image. */
+    size_t srcStride; /*!< \brief A row size of the layer image. */
+    size_t width; /*!< \brief A width of the layer image. */
+    size_t height; /*!< \brief A height of the layer image. */
+    ptrdiff_t left; /*!< \brief A horizontal offset of the layer in the output image (it can be negative). */
+    ptrdiff_t top; /*!< \brief A vertical offset of the layer in the output image (it can be negative). */
+    uint8_t alpha; /*!< \brief A global alpha (opacity) of the layer. */
+    SimdBool premultiplied; /*!< \brief A flag of premultiplied alpha in the layer image. Straight alpha layers are premultiplied on the fly. */
+    SimdAlphaCompositingModeType mode; /*!< \brief A blend mode of the layer. */
+} SimdAlphaCompositingLayer;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary8u.
     Images must have the same format (unsigned 8-bit integer for every channel).
@@ -426,6 +562,16 @@ typedef enum
     SimdPixelFormatArgb32,
     /*! A 24-bit (3 8-bit channels) LAB (CIELAB) pixel format. */
     SimdPixelFormatLab24,
+    /*! A 16-bit gray pixel format (1 16-bit unsigned channel). */
+    SimdPixelFormatGray16,
+    /*! A 48-bit (3 16-bit unsigned channels) BGR (Blue, Green, Red) pixel format. */
+    SimdPixelFormatBgr48,
+    /*! A 64-bit (4 16-bit unsigned channels) BGRA (Blue, Green, Red, Alpha) pixel format. */
+    SimdPixelFormatBgra64,
+    /*! A 48-bit (3 16-bit unsigned channels) RGB (Red, Green, Blue) pixel format. */
+    SimdPixelFormatRgb48,
+    /*! A 64-bit (4 16-bit unsigned channels) RGBA (Red, Green, Blue, Alpha) pixel format. */
+    SimdPixelFormatRgba64,
 } SimdPixelFormatType;
 
 /*! @ingroup recursive_bilateral_filter
@@ -626,6 +772,15 @@ typedef enum
     SimdWarpAffineBorderMask = 4, /*!< Bit mask of pixel interpolation options. */
 } SimdWarpAffineFlags;
 
+/*! @ingroup color_correction
+    Describes flags of color pipeline. This type used in function ::SimdColorPipelineInit.
+*/
+typedef enum
+{
+    SimdColorPipelineDefault = 0, /*!< Default flags: 3D LUT is stored in 32-bit float format. */
+    SimdColorPipelineLut16u = 1, /*!< 3D LUT is stored in 16-bit unsigned integer format (it halves memory footprint of large LUTs). */
+} SimdColorPipelineFlags;
+
 /*! @ingroup yuv_conversion
     Describes YUV format type. It is uses in YUV to BGR forward and backward conversions.
 */
@@ -638,6 +793,66 @@ typedef enum
     SimdYuvTrect871, /*!< Corresponds to T-REC-T.871 standard. Uses Kr=0.299, Kb=0.114. Y, U and V use full range [0..255]. */
 } SimdYuvType;
 
+/*! @ingroup yuv_conversion
+    Describes layouts of YUV images with high bit depth (from 9 to 16 bits per sample, every sample is stored in 16-bit unsigned integer).
+    This type is used in function ::SimdYuv16ToBgr.
+*/
+typedef enum
+{
+    /*! Three planes: full size Y, U and V of half width and half height. Samples are stored in low bits (yuv420p10le, yuv420p12le, yuv420p16le). */
+    SimdYuv16Layout420p,
+    /*! Three planes: full size Y, U and V of half width. Samples are stored in low bits (yuv422p10le, yuv422p12le, yuv422p16le). */
+    SimdYuv16Layout422p,
+    /*! Three full size planes Y, U and V. Samples are stored in low bits (yuv444p10le, yuv444p12le, yuv444p16le). */
+    SimdYuv16Layout444p,
+    /*! Two planes: full size Y and interleaved UV of half width and half height. Samples are stored in high bits (P010, P012, P016). */
+    SimdYuv16LayoutP420,
+    /*! Two planes: full size Y and interleaved UV of half width. Samples are stored in high bits (P210, P212, P216). */
+    SimdYuv16LayoutP422,
+} SimdYuv16LayoutType;
+
+/*! @ingroup yuv_conversion
+    Describes output formats of function ::SimdYuv16ToBgr.
+*/
+typedef enum
+{
+    /*! 8-bit gray image (it is restored from Y plane only). */
+    SimdYuv16OutputGray8,
+    /*! 24-bit BGR image (3 8-bit channels). */
+    SimdYuv16OutputBgr24,
+    /*! 32-bit BGRA image (4 8-bit channels, alpha is equal to 255). */
+    SimdYuv16OutputBgra32,
+    /*! 24-bit RGB image (3 8-bit channels). */
+    SimdYuv16OutputRgb24,
+    /*! 32-bit RGBA image (4 8-bit channels, alpha is equal to 255). */
+    SimdYuv16OutputRgba32,
+    /*! 48-bit BGR image (3 16-bit channels in range [0..65535]). */
+    SimdYuv16OutputBgr48,
+    /*! 48-bit RGB image (3 16-bit channels in range [0..65535]). */
+    SimdYuv16OutputRgb48,
+    /*! Planar 32-bit float tensor (NCHW format, BGR channel order) with values in range [0..1]. */
+    SimdYuv16OutputBgr32f,
+    /*! Planar 32-bit float tensor (NCHW format, RGB channel order) with values in range [0..1]. */
+    SimdYuv16OutputRgb32f,
+    /*! Planar 16-bit BFloat16 tensor (NCHW format, BGR channel order) with values in range [0..1]. */
+    SimdYuv16OutputBgr16b,
+    /*! Planar 16-bit BFloat16 tensor (NCHW format, RGB channel order) with values in range [0..1]. */
+    SimdYuv16OutputRgb16b,
+} SimdYuv16OutputType;
+
+/*! @ingroup hog
+    Describes an object found by HOG detector. It is used in function ::SimdHogDetectorRun.
+*/
+typedef struct SimdHogDetection
+{
+    size_t x; /*!< A left position of object bounding box (in original image coordinates). */
+    size_t y; /*!< A top position of object bounding box (in original image coordinates). */
+    size_t width; /*!< A width of object bounding box. */
+    size_t height; /*!< A height of object bounding box. */
+    size_t level; /*!< An index of pyramid level where object was found (0 - original scale). */
+    float score; /*!< A score of linear classifier for the object. */
+} SimdHogDetection;
+
 /*! @ingroup synet_types
     Describes convolution (deconvolution) parameters. It is used in ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, 
     ::SimdSynetDeconvolution32fInit, ::SimdSynetMergedConvolution32fInit and ::SimdSynetMergedConvolution8iInit.
@@ -1284,6 +1499,32 @@ extern "C"
     */
     SIMD_API void SimdAlphaBlendingUniform(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t alpha, uint8_t* dst, size_t dstStride);
 
+    /*! @ingroup drawing
+
+        \fn void SimdAlphaCompositing(const SimdAlphaCompositingLayer * layers, size_t count, uint8_t * dst, size_t dstStride, size_t width, size_t height);
+
+        \short Composites ordered list of BGRA layers onto premultiplied BGRA image in one pass.
+
+        Layers are applied in given order (the first layer is the bottom one). Every layer is placed with its offset, clipped by output image,
+        scaled by its global alpha and blended with its blend mode (see ::SimdAlphaCompositingModeType).
+        Output image is processed by tiles: each tile is read and written once while all layers are blended into it.
+
+        For every point of layer (premultiplied case, normal blend mode):
+        \verbatim
+        dst[x, y, c] = src[x, y, c]*alpha/255 + dst[x, y, c]*(255 - src[x, y, 3]*alpha/255)/255;
+        \endverbatim
+
+        \note This function is faster than sequential calls of ::SimdAlphaBlending for every layer because output image is not reloaded for each layer.
+
+        \param [in] layers - a pointer to array of layers descriptions.
+        \param [in] count - a number of layers.
+        \param [in, out] dst - a pointer to pixels data of 32-bit premultiplied BGRA output image. Opaque image can be used as is.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] width - a width of the output image.
+        \param [in] height - a height of the output image.
+    */
+    SIMD_API void SimdAlphaCompositing(const SimdAlphaCompositingLayer * layers, size_t count, uint8_t * dst, size_t dstStride, size_t width, size_t height);
+
     /*! @ingroup drawing
 
         \fn void SimdAlphaFilling(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * channel, size_t channelCount, const uint8_t * alpha, size_t alphaStride);
@@ -1729,6 +1970,37 @@ extern "C"
     */
     SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup bayer_conversion
+
+        \fn void SimdBayerDemosaic(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height, SimdPixelFormatType bayerFormat, size_t bitDepth, size_t blackLevel, const float* gains, SimdBayerDemosaicType method, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat);
+
+        \short Converts 8-bit or 10/12/16-bit raw Bayer image to 24-bit BGR/RGB or 32-bit BGRA/RGBA image with using of high quality demosaicing.
+
+        Black level subtraction and white balance gains are applied to raw samples before interpolation:
+        \verbatim
+        value = Max(raw - blackLevel, 0) * gain[color] * 255 / (2^bitDepth - 1 - blackLevel);
+        \endverbatim
+        Borders of the image are processed with mirror reflection (which preserves Bayer pattern). Rows of the image are processed in parallel.
+
+        \note This function has C++ wrappers Simd::BayerDemosaic(const View<A>& bayer, View<A>& dst, SimdBayerDemosaicType method, const float* gains) 
+            and Simd::BayerDemosaic(const View<A>& raw, SimdPixelFormatType bayerFormat, size_t bitDepth, size_t blackLevel, View<A>& dst, SimdBayerDemosaicType method, const float* gains).
+
+        \param [in] bayer - a pointer to pixels data of input raw Bayer image. It consists of 8-bit samples if bitDepth is equal to 8 or of 16-bit samples (stored in low bits) otherwise.
+        \param [in] bayerStride - a row size of the bayer image (in bytes).
+        \param [in] width - an image width. It must be at least 4.
+        \param [in] height - an image height. It must be at least 4.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [in] bitDepth - a bit depth of raw samples. It can be in range [8..16].
+        \param [in] blackLevel - a black level of raw samples.
+        \param [in] gains - a pointer to white balance gains (for blue, green and red channels). It can be NULL (all gains are equal to 1).
+        \param [in] method - a demosaicing method.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] dstFormat - a pixel format of the output image. It can be ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24 or ::SimdPixelFormatRgba32 (alpha channel is equal to 0xFF).
+    */
+    SIMD_API void SimdBayerDemosaic(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height, SimdPixelFormatType bayerFormat, size_t bitDepth,
+        size_t blackLevel, const float* gains, SimdBayerDemosaicType method, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
@@ -2015,6 +2287,46 @@ extern "C"
     */
     SIMD_API void SimdBgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToGray16u(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t * gray, size_t grayStride);
+
+        \short Converts 16-bit BGR (or BGRA) interleaved image to 16-bit gray image.
+
+        All images must have the same width and height. The conversion uses the same weights as ::SimdBgrToGray.
+        Alpha channel (if present) is ignored.
+
+        \note This function has a C++ wrapper Simd::BgrToGray16u(const View<A>& bgr, View<A>& gray).
+
+        \param [in] bgr - a pointer to pixels data of input 16-bit BGR (or BGRA) image.
+        \param [in] bgrStride - a row size (in bytes) of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a number of channels in the input image. It can be 3 (BGR) or 4 (BGRA).
+        \param [out] gray - a pointer to pixels data of output 16-bit gray image.
+        \param [in] grayStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdBgrToGray16u(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t * gray, size_t grayStride);
+
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToGray32f(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t * gray, size_t grayStride);
+
+        \short Converts 32-bit float BGR (or BGRA) interleaved image to 32-bit float gray image.
+
+        All images must have the same width and height. The conversion uses the same weights as ::SimdBgrToGray.
+        Alpha channel (if present) is ignored.
+
+        \param [in] bgr - a pointer to pixels data of input 32-bit float BGR (or BGRA) image.
+        \param [in] bgrStride - a row size (in bytes) of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a number of channels in the input image. It can be 3 (BGR) or 4 (BGRA).
+        \param [out] gray - a pointer to pixels data of output 32-bit float gray image.
+        \param [in] grayStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdBgrToGray32f(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t * gray, size_t grayStride);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride);
@@ -2284,6 +2596,60 @@ extern "C"
     SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride, size_t width, size_t height,
         size_t neighborhood, int32_t shift, uint8_t positive, uint8_t negative, uint8_t* dst, size_t dstStride);
 
+    /*! @ingroup color_correction
+
+        \fn void * SimdColorPipelineInit(SimdPixelFormatType format, const float * matrix, const float * curves, size_t curveSize, const float * lut, size_t lutSize, SimdColorPipelineFlags flags);
+
+        \short Creates color pipeline context.
+
+        Color pipeline performs next fused transformation for every pixel (all stages are optional, values are normalized to range [0..1]):
+        \verbatim
+        (r, g, b) = (src.r, src.g, src.b) / 255;
+        (r, g, b) = Clamp(matrix * (r, g, b), 0, 1);
+        (r, g, b) = (curves[0](r), curves[1](g), curves[2](b));
+        (r, g, b) = lut(r, g, b);
+        (dst.r, dst.g, dst.b) = Round(Clamp(r, g, b, 0, 1) * 255);
+        \endverbatim
+        Curves are interpolated linearly. 3D LUT is interpolated with using of tetrahedral interpolation. 
+        Alpha channel (for 32-bit formats) is copied from the source image. Rows of the image are processed in parallel.
+
+        \note This function has a C++ wrapper Simd::ColorPipeline(const View<A>& src, View<A>& dst, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags).
+
+        \param [in] format - a pixel format of input and output images. It can be ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24 or ::SimdPixelFormatRgba32.
+        \param [in] matrix - a pointer to 3x3 color correction matrix (row-major order, it is applied to column vector (r, g, b)). It can be NULL.
+        \param [in] curves - a pointer to 3 tone curves (for red, green and blue channels) which are applied after matrix. 
+            Every curve consists of curveSize values uniformly sampled in range [0..1]. It can be NULL.
+        \param [in] curveSize - a size of every curve. It must be in range [2..65536].
+        \param [in] lut - a pointer to 3D LUT. It consists of lutSize^3 nodes (r, g, b). Red index changes fastest (like in .cube format): node(r, g, b) = lut + ((b * lutSize + g) * lutSize + r) * 3. It can be NULL.
+        \param [in] lutSize - a size of 3D LUT along every axis. It must be in range [2..256] (typical values are 17, 33 and 65).
+        \param [in] flags - a flags of color pipeline.
+        \return a pointer to color pipeline context. On error it returns NULL.
+                This pointer is used in function ::SimdColorPipelineRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdColorPipelineInit(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, 
+        const float* lut, size_t lutSize, SimdColorPipelineFlags flags);
+
+    /*! @ingroup color_correction
+
+        \fn void SimdColorPipelineRun(const void * context, const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Applies color pipeline to the image.
+
+        Input and output images must have the same size and pixel format (which is given in ::SimdColorPipelineInit). It can be performed in-place.
+
+        \note This function has a C++ wrapper Simd::ColorPipeline(const View<A>& src, View<A>& dst, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags).
+
+        \param [in] context - a color pipeline context. It must be created by function ::SimdColorPipelineInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdColorPipelineRun(const void* context, const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride);
+
     /*! @ingroup conditional
 
         \fn void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t value, SimdCompareType compareType, uint32_t * count);
@@ -2732,6 +3098,60 @@ extern "C"
     SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
         uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride);
 
+    /*! @ingroup deinterleave_conversion
+
+        \fn void SimdDeinterleave16u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, uint8_t * dst0, size_t dst0Stride, uint8_t * dst1, size_t dst1Stride, uint8_t * dst2, size_t dst2Stride, uint8_t * dst3, size_t dst3Stride);
+
+        \short Deinterleaves 16-bit multi-channel interleaved image into separated 16-bit planar images.
+
+        All images must have the same width and height. Planes with index greater or equal to channels are ignored and can be NULL.
+
+        \note This function has C++ wrappers:
+            Simd::Deinterleave16u(const View<A>& src, View<A>& c0, View<A>& c1, View<A>& c2),
+            Simd::Deinterleave16u(const View<A>& src, View<A>& c0, View<A>& c1, View<A>& c2, View<A>& c3).
+
+        \param [in] src - a pointer to pixels data of input 16-bit interleaved image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a number of channels in the input image. It can be 2, 3 or 4.
+        \param [out] dst0 - a pointer to pixels data of output 16-bit planar image of channel 0.
+        \param [in] dst0Stride - a row size (in bytes) of the dst0 image.
+        \param [out] dst1 - a pointer to pixels data of output 16-bit planar image of channel 1.
+        \param [in] dst1Stride - a row size (in bytes) of the dst1 image.
+        \param [out] dst2 - a pointer to pixels data of output 16-bit planar image of channel 2.
+        \param [in] dst2Stride - a row size (in bytes) of the dst2 image.
+        \param [out] dst3 - a pointer to pixels data of output 16-bit planar image of channel 3.
+        \param [in] dst3Stride - a row size (in bytes) of the dst3 image.
+    */
+    SIMD_API void SimdDeinterleave16u(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+        uint8_t * dst0, size_t dst0Stride, uint8_t * dst1, size_t dst1Stride, uint8_t * dst2, size_t dst2Stride, uint8_t * dst3, size_t dst3Stride);
+
+    /*! @ingroup deinterleave_conversion
+
+        \fn void SimdDeinterleave32f(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, uint8_t * dst0, size_t dst0Stride, uint8_t * dst1, size_t dst1Stride, uint8_t * dst2, size_t dst2Stride, uint8_t * dst3, size_t dst3Stride);
+
+        \short Deinterleaves 32-bit float multi-channel interleaved image into separated 32-bit float planar images.
+
+        All images must have the same width and height. Planes with index greater or equal to channels are ignored and can be NULL.
+
+        \param [in] src - a pointer to pixels data of input 32-bit float interleaved image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a number of channels in the input image. It can be 2, 3 or 4.
+        \param [out] dst0 - a pointer to pixels data of output 32-bit float planar image of channel 0.
+        \param [in] dst0Stride - a row size (in bytes) of the dst0 image.
+        \param [out] dst1 - a pointer to pixels data of output 32-bit float planar image of channel 1.
+        \param [in] dst1Stride - a row size (in bytes) of the dst1 image.
+        \param [out] dst2 - a pointer to pixels data of output 32-bit float planar image of channel 2.
+        \param [in] dst2Stride - a row size (in bytes) of the dst2 image.
+        \param [out] dst3 - a pointer to pixels data of output 32-bit float planar image of channel 3.
+        \param [in] dst3Stride - a row size (in bytes) of the dst3 image.
+    */
+    SIMD_API void SimdDeinterleave32f(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels,
+        uint8_t * dst0, size_t dst0Stride, uint8_t * dst1, size_t dst1Stride, uint8_t * dst2, size_t dst2Stride, uint8_t * dst3, size_t dst3Stride);
+
     /*! @ingroup object_detection
 
         \fn void * SimdDetectionLoadA(const char * path);
@@ -3060,7 +3480,7 @@ extern "C"
         \param [in] width - an image width.
         \param [in] height - an image height.
         \param [in] pixel - a pointer to pixel to fill.
-        \param [in] pixelSize - a size of the image pixel. Parameter is restricted by range [1, 4]. 
+        \param [in] pixelSize - a size of the image pixel. It can be 1, 2, 3, 4 (8-bit images) or 6, 8, 12, 16 (16-bit and 32-bit float multi-channel images).
     */
     SIMD_API void SimdFillPixel(uint8_t * dst, size_t stride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize);
 
@@ -3360,6 +3780,31 @@ extern "C"
     */
     SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels, const float * sigma, const float* epsilon);
 
+    /*! @ingroup gaussian_filter
+
+        \fn void * SimdGaussianBlurInitV2(size_t width, size_t height, size_t channels, const float * sigma, const float* epsilon, SimdGaussianBlurFlags flags);
+
+        \short Creates Gaussian blur filter context with given algorithm and image channel type.
+
+        ::SimdGaussianBlurDefault algorithm is the same as in function ::SimdGaussianBlurInit.
+        ::SimdGaussianBlurRecursive algorithm uses third order recursive filter (Young - van Vliet) which is applied forward and backward
+        along rows and then along columns. Its cost per pixel does not depend on sigma, so it is preferable for large sigma (greater than 3-4).
+        Image borders are replicated as in default algorithm (Triggs - Sdika boundary conditions). Parameter epsilon is ignored.
+        Rows and columns are processed in several threads (see ::SimdSetThreadNumber).
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.    
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] sigma - a pointer to sigma parameter (blur radius). Its value must be greater than 0.000001.
+        \param [in] epsilon - a pointer to epsilon parameter (permissible relative error). 
+                              Its value must be greater than 0.000001. Pointer can be NULL and by default value 0.001 is used.
+        \param [in] flags - a flags of algorithm (see ::SimdGaussianBlurFlags).
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdGaussianBlurRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdGaussianBlurInitV2(size_t width, size_t height, size_t channels, const float * sigma, const float* epsilon, SimdGaussianBlurFlags flags);
+
     /*! @ingroup gaussian_filter
 
         \fn void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
@@ -3381,8 +3826,8 @@ extern "C"
         dst[dx, dy] = sum;
         \endverbatim
 
-        \param [in] filter - a filter context. It must be created by function ::SimdGaussianBlurInit and released by function ::SimdRelease.
-        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] filter - a filter context. It must be created by function ::SimdGaussianBlurInit (::SimdGaussianBlurInitV2) and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image (it is pointer to float for ::SimdGaussianBlur32f).
         \param [in] srcStride - a row size (in bytes) of the input image.
         \param [out] dst - a pointer to pixels data of the filtered output image.
         \param [in] dstStride - a row size (in bytes) of the output image.
@@ -3748,6 +4193,71 @@ extern "C"
     */
     SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t width, size_t height, const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add);
 
+    /*! @ingroup hog
+
+        \fn void * SimdHogDetectorInit(size_t width, size_t height, const float * weights, size_t windowX, size_t windowY, float bias, float scaleFactor, size_t levelsMax);
+
+        \short Initializes HOG detector (multiscale sliding window with linear SVM classifier).
+
+        The detector builds a pyramid of HOG features (see ::SimdHogExtractFeatures: 31 features for 8x8 cell) for 8-bit gray image,
+        scores every window position of every pyramid level with given linear classifier (SVM or DPM-like root filter) and suppresses non-maximum detections.
+        Pyramid levels are processed in parallel. All buffers are allocated once at initialization, so the detector should be reused for all frames of given size.
+
+        For every window position (x, y) of every pyramid level:
+        \verbatim
+        score = bias;
+        for(dy = 0; dy < windowY; dy++)
+            for(dx = 0; dx < windowX; dx++)
+                for(i = 0; i < 31; i++)
+                    score += features[((y + dy)*cellsX + x + dx)*31 + i]*weights[(dy*windowX + dx)*31 + i];
+        \endverbatim
+
+        Typical usage:
+        \verbatim
+        void * detector = SimdHogDetectorInit(width, height, weights, 8, 16, bias, 1.1f, 0);
+        for(;;) // for every frame
+        {
+            size_t count = SimdHogDetectorRun(detector, src, stride, 0.0f, 0.3f, detections, capacity);
+            ...
+        }
+        SimdRelease(detector);
+        \endverbatim
+
+        \param [in] width - a width of input 8-bit gray image. It must be not less than 8*max(windowX, 3).
+        \param [in] height - a height of input 8-bit gray image. It must be not less than 8*max(windowY, 2).
+        \param [in] weights - a pointer to 32-bit float array with weights of linear classifier. Its size is windowY*windowX*31. The order is the same as in output of ::SimdHogExtractFeatures.
+        \param [in] windowX - a width of detector window in cells (8 pixels).
+        \param [in] windowY - a height of detector window in cells (8 pixels).
+        \param [in] bias - a bias of linear classifier.
+        \param [in] scaleFactor - a scale factor between neighboring pyramid levels. It must be greater than 1 (if levelsMax is not equal to 1).
+        \param [in] levelsMax - a maximal number of pyramid levels. If it is equal to 0 then number of levels is restricted only by window size.
+        \return a pointer to HOG detector context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdHogDetectorRun.
+    */
+    SIMD_API void * SimdHogDetectorInit(size_t width, size_t height, const float * weights, size_t windowX, size_t windowY, float bias, float scaleFactor, size_t levelsMax);
+
+    /*! @ingroup hog
+
+        \fn size_t SimdHogDetectorRun(const void * detector, const uint8_t * src, size_t stride, float threshold, float overlap, SimdHogDetection * detections, size_t capacity);
+
+        \short Performs detection of objects with using HOG detector.
+
+        Found objects are sorted by score in descending order. A detection is suppressed if its overlap (intersection over union)
+        with any detection of greater score is greater than given overlap threshold.
+
+        \note This function is not thread safe: one detector context can't be used simultaneously in several threads.
+
+        \param [in] detector - a HOG detector context. It must be created by function ::SimdHogDetectorInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image. Its size must be equal to the size passed in ::SimdHogDetectorInit.
+        \param [in] stride - a row size of the image.
+        \param [in] threshold - a minimal score of detection.
+        \param [in] overlap - a threshold of non-maximum suppression. If it is not less than 1 then non-maximum suppression is not performed.
+        \param [out] detections - a pointer to output array of found objects.
+        \param [in] capacity - a size of output array. 
+        \return a total number of found objects. If it is greater than capacity then only first (best) objects are stored.
+    */
+    SIMD_API size_t SimdHogDetectorRun(const void * detector, const uint8_t * src, size_t stride, float threshold, float overlap, SimdHogDetection * detections, size_t capacity);
+
     /*! @ingroup image_io
 
         \fn uint8_t* SimdImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t * size);
@@ -3760,6 +4270,8 @@ extern "C"
         \param [in] height - a height of input image.
         \param [in] format - a pixel format of input image. 
             Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+            16-bit pixel formats ::SimdPixelFormatGray16, ::SimdPixelFormatBgr48, ::SimdPixelFormatBgra64, ::SimdPixelFormatRgb48, ::SimdPixelFormatRgba64 
+            are saved without loss of precision and are supported only for ::SimdImageFilePgmBin, ::SimdImageFilePpmBin and ::SimdImageFilePng.
         \param [in] file - a format of output image file. To auto choise format of output file set this parameter to ::SimdImageFileUndefined.
         \param [in] quality - a parameter of compression quality (if file format supports it).
         \param [out] size - a pointer to the size of output image file in bytes.
@@ -3782,6 +4294,8 @@ extern "C"
         \param [in] height - a height of input image.
         \param [in] format - a pixel format of input image. 
             Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+            16-bit pixel formats ::SimdPixelFormatGray16, ::SimdPixelFormatBgr48, ::SimdPixelFormatBgra64, ::SimdPixelFormatRgb48, ::SimdPixelFormatRgba64 
+            are saved without loss of precision and are supported only for ::SimdImageFilePgmBin, ::SimdImageFilePpmBin and ::SimdImageFilePng.
         \param [in] file - a format of output image file. To auto choise format of output file set this parameter to ::SimdImageFileUndefined.
         \param [in] quality - a parameter of compression quality (if file format supports it).
         \param [in] path - a path to output image file.
@@ -3848,6 +4362,9 @@ extern "C"
         \param [in, out] format - a pointer to pixel format of output image. 
             Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
             Or set ::SimdPixelFormatNone and use pixel format of input image file.
+            16-bit PNG, PGM and PPM (binary) files can be loaded without loss of precision in ::SimdPixelFormatGray16, ::SimdPixelFormatBgr48, 
+            ::SimdPixelFormatBgra64, ::SimdPixelFormatRgb48 or ::SimdPixelFormatRgba64 pixel format.
+            Samples of PGM and PPM files with maximal value less than 65535 are rescaled to the full 16-bit range.
         \return a pointer to pixels data of output image. 
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
     */
@@ -3868,6 +4385,9 @@ extern "C"
         \param [in, out] format - a pointer to pixel format of output image.
             Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
             Or set ::SimdPixelFormatNone and use pixel format of input image file.
+            16-bit PNG, PGM and PPM (binary) files can be loaded without loss of precision in ::SimdPixelFormatGray16, ::SimdPixelFormatBgr48, 
+            ::SimdPixelFormatBgra64, ::SimdPixelFormatRgb48 or ::SimdPixelFormatRgba64 pixel format.
+            Samples of PGM and PPM files with maximal value less than 65535 are rescaled to the full 16-bit range.
         \return a pointer to pixels data of output image.
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
     */
@@ -3905,6 +4425,11 @@ extern "C"
 
         The function can calculates sum integral image, square sum integral image (optionally) and tilted sum integral image (optionally).
         A integral images must have width and height per unit greater than that of the input image.
+        Sum and square sum integral images (without tilted) are calculated in parallel: column sums of horizontal bands
+        (one band per thread, or bands of 64 rows for float sums) are accumulated at first,
+        then every band is integrated independently starting from its own offset row.
+        Use ::SimdPixelFormatInt64 (or ::SimdPixelFormatFloat) sum format for large images where 32-bit sums can overflow.
+        Float sums are exact while they are less than 2^24 and they do not depend on the number of threads.
 
         \note This function has a C++ wrappers:
         \n Simd::Integral(const View<A>& src, View<A>& sum),
@@ -3915,14 +4440,14 @@ extern "C"
         \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
-        \param [out] sum - a pointer to pixels data of 32-bit integer sum image.
+        \param [out] sum - a pointer to pixels data of 32-bit integer, 64-bit integer or 32-bit float point sum image.
         \param [in] sumStride - a row size of sum image (in bytes).
-        \param [out] sqsum - a pointer to pixels data of 32-bit integer or 64-bit float point square sum image. It can be NULL.
+        \param [out] sqsum - a pointer to pixels data of 32-bit integer, 64-bit integer or 64-bit float point square sum image. It can be NULL.
         \param [in] sqsumStride - a row size of sqsum image (in bytes).
-        \param [out] tilted - a pointer to pixels data of 32-bit integer tilted sum image. It can be NULL.
+        \param [out] tilted - a pointer to pixels data of tilted sum image (it has the same format as sum image). It can be NULL.
         \param [in] tiltedStride - a row size of tilted image (in bytes).
-        \param [in] sumFormat - a format of sum image and tilted image. It can be equal to ::SimdPixelFormatInt32.
-        \param [in] sqsumFormat - a format of sqsum image. It can be equal to ::SimdPixelFormatInt32 or ::SimdPixelFormatDouble.
+        \param [in] sumFormat - a format of sum image and tilted image. It can be equal to ::SimdPixelFormatInt32, ::SimdPixelFormatInt64 or ::SimdPixelFormatFloat.
+        \param [in] sqsumFormat - a format of sqsum image. It can be equal to ::SimdPixelFormatInt32, ::SimdPixelFormatInt64 or ::SimdPixelFormatDouble.
     */
     SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
@@ -4000,6 +4525,60 @@ extern "C"
     SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
 
+    /*! @ingroup interleave_conversion
+
+        \fn void SimdInterleave16u(const uint8_t * src0, size_t src0Stride, const uint8_t * src1, size_t src1Stride, const uint8_t * src2, size_t src2Stride, const uint8_t * src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t * dst, size_t dstStride);
+
+        \short Interleaves separated 16-bit planar images into one 16-bit multi-channel interleaved image.
+
+        All images must have the same width and height. Planes with index greater or equal to channels are ignored and can be NULL.
+
+        \note This function has C++ wrappers:
+            Simd::Interleave16u(const View<A>& c0, const View<A>& c1, const View<A>& c2, View<A>& dst),
+            Simd::Interleave16u(const View<A>& c0, const View<A>& c1, const View<A>& c2, const View<A>& c3, View<A>& dst).
+
+        \param [in] src0 - a pointer to pixels data of input 16-bit planar image of channel 0.
+        \param [in] src0Stride - a row size (in bytes) of the src0 image.
+        \param [in] src1 - a pointer to pixels data of input 16-bit planar image of channel 1.
+        \param [in] src1Stride - a row size (in bytes) of the src1 image.
+        \param [in] src2 - a pointer to pixels data of input 16-bit planar image of channel 2.
+        \param [in] src2Stride - a row size (in bytes) of the src2 image.
+        \param [in] src3 - a pointer to pixels data of input 16-bit planar image of channel 3.
+        \param [in] src3Stride - a row size (in bytes) of the src3 image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a number of channels in the output image. It can be 2, 3 or 4.
+        \param [out] dst - a pointer to pixels data of output 16-bit interleaved image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdInterleave16u(const uint8_t * src0, size_t src0Stride, const uint8_t * src1, size_t src1Stride, const uint8_t * src2, size_t src2Stride,
+        const uint8_t * src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup interleave_conversion
+
+        \fn void SimdInterleave32f(const uint8_t * src0, size_t src0Stride, const uint8_t * src1, size_t src1Stride, const uint8_t * src2, size_t src2Stride, const uint8_t * src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t * dst, size_t dstStride);
+
+        \short Interleaves separated 32-bit float planar images into one 32-bit float multi-channel interleaved image.
+
+        All images must have the same width and height. Planes with index greater or equal to channels are ignored and can be NULL.
+
+        \param [in] src0 - a pointer to pixels data of input 32-bit float planar image of channel 0.
+        \param [in] src0Stride - a row size (in bytes) of the src0 image.
+        \param [in] src1 - a pointer to pixels data of input 32-bit float planar image of channel 1.
+        \param [in] src1Stride - a row size (in bytes) of the src1 image.
+        \param [in] src2 - a pointer to pixels data of input 32-bit float planar image of channel 2.
+        \param [in] src2Stride - a row size (in bytes) of the src2 image.
+        \param [in] src3 - a pointer to pixels data of input 32-bit float planar image of channel 3.
+        \param [in] src3Stride - a row size (in bytes) of the src3 image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a number of channels in the output image. It can be 2, 3 or 4.
+        \param [out] dst - a pointer to pixels data of output 32-bit float interleaved image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdInterleave32f(const uint8_t * src0, size_t src0Stride, const uint8_t * src1, size_t src1Stride, const uint8_t * src2, size_t src2Stride,
+        const uint8_t * src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup laplace_filter
 
         \fn void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
@@ -4211,6 +4790,123 @@ extern "C"
     SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup median_filter
+
+        \fn void * SimdMedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags);
+
+        \short Creates median filter context (filter window is a square (2*radius + 1)x(2*radius + 1)).
+
+        Image borders are processed by replication of edge pixels.
+        For 8-bit images it uses sliding histograms of Perreault and Hebert with constant cost per pixel.
+        For 16-bit images it uses two-level sliding histogram of Huang with cost linear to radius.
+
+        An using example:
+        \verbatim
+        void* filter = SimdMedianFilterInit(width, height, channels, 7, SimdMedianFilter8u);
+        if (filter)
+        {
+             SimdMedianFilterRun(filter, src, srcStride, dst, dstStride);
+             SimdRelease(filter);
+        }
+        \endverbatim
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] radius - a radius of filter window. Its value must be in range [1..127].
+        \param [in] flags - a flags of algorithm parameters (image channel type).
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdMedianFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdMedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags);
+
+    /*! @ingroup median_filter
+
+        \fn void SimdMedianFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        \short Performs median filtration of input image.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdMedianFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image. It must not overlap with input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdMedianFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdMorphology(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, uint8_t* dst, size_t dstStride);
+
+        \short Performs morphological operation (erosion, dilation, opening, closing or gradient) of 8-bit image.
+
+        Rectangular structuring element is decomposed into horizontal and vertical passes.
+        Every pass uses algorithm of van Herk and Gil-Werman, so the cost per pixel does not depend on kernel size.
+        The anchor of structuring element is its center (kernelX/2, kernelY/2). Image borders are processed by replication of edge pixels.
+        All images must have the same width, height and format (8-bit gray or mask, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrapper: Simd::Morphology(const View<A>& src, View<A>& dst, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, SimdMorphologyOperationType operation).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a channel count.
+        \param [in] kernelX - a width of structuring element. It must be greater than 0.
+        \param [in] kernelY - a height of structuring element. It must be greater than 0.
+        \param [in] shape - a shape of structuring element.
+        \param [in] operation - a type of morphological operation.
+        \param [out] dst - a pointer to pixels data of output image. It must not overlap with input image.
+        \param [in] dstStride - a row size of dst image.
+    */
+    SIMD_API void SimdMorphology(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+        size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, uint8_t* dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdErode(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, uint8_t* dst, size_t dstStride);
+
+        \short Performs erosion of 8-bit image. It is equal to ::SimdMorphology with operation ::SimdMorphologyErode.
+
+        \note This function has a C++ wrapper: Simd::Erode(const View<A>& src, View<A>& dst, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a channel count.
+        \param [in] kernelX - a width of structuring element. It must be greater than 0.
+        \param [in] kernelY - a height of structuring element. It must be greater than 0.
+        \param [in] shape - a shape of structuring element.
+        \param [out] dst - a pointer to pixels data of output image. It must not overlap with input image.
+        \param [in] dstStride - a row size of dst image.
+    */
+    SIMD_API void SimdErode(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+        size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, uint8_t* dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdDilate(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, uint8_t* dst, size_t dstStride);
+
+        \short Performs dilation of 8-bit image. It is equal to ::SimdMorphology with operation ::SimdMorphologyDilate.
+
+        \note This function has a C++ wrapper: Simd::Dilate(const View<A>& src, View<A>& dst, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channels - a channel count.
+        \param [in] kernelX - a width of structuring element. It must be greater than 0.
+        \param [in] kernelY - a height of structuring element. It must be greater than 0.
+        \param [in] shape - a shape of structuring element.
+        \param [out] dst - a pointer to pixels data of output image. It must not overlap with input image.
+        \param [in] dstStride - a row size of dst image.
+    */
+    SIMD_API void SimdDilate(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+        size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, uint8_t* dst, size_t dstStride);
+
     /*! @ingroup neural
 
         \fn void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
@@ -4840,6 +5536,53 @@ extern "C"
     SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal,
         uint8_t * dst, size_t stride, size_t width, size_t height);
 
+    /*! @ingroup optical_flow
+
+        \fn void * SimdOpticalFlowPyrLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigen);
+
+        \short Initializes pyramidal Lucas-Kanade sparse optical flow tracker.
+
+        The tracker uses image pyramids of 8-bit gray images (every next level is lesser in two times than previous, see Simd::Pyramid).
+        Image patches are sampled with bilinear interpolation in fixed-point arithmetic, spatial gradients and residuals are accumulated in 32-bit integers.
+        Points are tracked in parallel.
+
+        \note This function has a C++ wrapper Simd::OpticalFlowPyrLk(const Pyramid<A> & prev, const Pyramid<A> & next, const std::vector<Point<float>> & prevPoints, std::vector<Point<float>> & nextPoints, std::vector<uint8_t> & status, std::vector<float> & errors, size_t radius, size_t iterations, float epsilon, float minEigen).
+
+        \param [in] width - a width of the lowest (biggest) pyramid level.
+        \param [in] height - a height of the lowest (biggest) pyramid level.
+        \param [in] levels - a number of used pyramid levels.
+        \param [in] radius - a radius of tracking window (window size is (2*radius + 1)x(2*radius + 1)). It must be in range [1..15].
+        \param [in] iterations - a maximal number of iterations at every pyramid level.
+        \param [in] epsilon - a minimal shift (in pixels) at iteration to continue iterations.
+        \param [in] minEigen - a minimal eigen value of spatial gradient matrix (normalized by window area, in squared intensity per pixel units).
+            Points with lower value at the lowest pyramid level are marked as lost.
+        \return a pointer to optical flow tracker context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdOpticalFlowPyrLkRun.
+    */
+    SIMD_API void * SimdOpticalFlowPyrLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigen);
+
+    /*! @ingroup optical_flow
+
+        \fn void SimdOpticalFlowPyrLkRun(const void * context, const uint8_t * const * prev, const size_t * prevStrides, const uint8_t * const * next, const size_t * nextStrides, const float * prevPoints, size_t count, float * nextPoints, uint8_t * status, float * errors);
+
+        \short Tracks points from previous image to next image with using pyramidal Lucas-Kanade optical flow.
+
+        \note This function is not thread safe: one tracker context can't be used simultaneously in several threads.
+
+        \param [in] context - an optical flow tracker context. It must be created by function ::SimdOpticalFlowPyrLkInit and released by function ::SimdRelease.
+        \param [in] prev - an array of pointers to pixels data of levels of previous image pyramid.
+        \param [in] prevStrides - an array of row sizes of levels of previous image pyramid.
+        \param [in] next - an array of pointers to pixels data of levels of next image pyramid.
+        \param [in] nextStrides - an array of row sizes of levels of next image pyramid.
+        \param [in] prevPoints - a pointer to array of tracked points (pairs of x and y coordinates) in previous image.
+        \param [in] count - a number of tracked points.
+        \param [out] nextPoints - a pointer to array of found points (pairs of x and y coordinates) in next image. Lost points keep their previous positions.
+        \param [out] status - a pointer to array of statuses of tracked points (1 - point is found, 0 - point is lost). Can be NULL.
+        \param [out] errors - a pointer to array of tracking errors (mean absolute difference between patches of previous and next images). Can be NULL.
+    */
+    SIMD_API void SimdOpticalFlowPyrLkRun(const void * context, const uint8_t * const * prev, const size_t * prevStrides, const uint8_t * const * next, const size_t * nextStrides,
+        const float * prevPoints, size_t count, float * nextPoints, uint8_t * status, float * errors);
+
     /*! @ingroup recursive_bilateral_filter
 
         \fn void * SimdRecursiveBilateralFilterInit(size_t width, size_t height, size_t channels, const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags);
@@ -5033,6 +5776,54 @@ extern "C"
     SIMD_API void SimdReduceGray5x5(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
         uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
 
+    /*! @ingroup warp_affine
+
+        \fn void * SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates remap context.
+
+        Remap performs next transformation for every pixel:
+        \verbatim
+        dst[x, y] = src[map[y][x][0], map[y][x][1]];
+        \endverbatim
+
+        The map is converted once to compact fixed-point form (16-bit integer coordinates and 8-bit fractions for every output pixel).
+        It uses the same interpolation kernels and border modes as ::SimdWarpAffineInit.
+
+        \note This function has a C++ wrapper Simd::Remap(const View<A>& src, const float * map, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] srcW - a width of input image. It must be less then 32767.
+        \param [in] srcH - a height of input image. It must be less then 32767.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] dstS - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] map - a pointer to map with source coordinates (x, y) for every pixel of output image. Its size must be equal to dstW * dstH * 2.
+        \param [in] flags - a flags of algorithm parameters.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
+        \return a pointer to remap context. On error it returns NULL.
+                This pointer is used in functions ::SimdRemapRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+        size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst);
+
+        \short Performs remap for current image.
+
+        \note This function has a C++ wrapper Simd::Remap(const View<A>& src, const float * map, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] context - a remap context. It must be created by function ::SimdRemapInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+    */
+    SIMD_API void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst);
+
     /*! @ingroup reordering
 
         \fn void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
@@ -5967,6 +6758,57 @@ extern "C"
     */
     SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
 
+    /*! @ingroup correlation
+
+        \fn void SimdTemplateMatch(const uint8_t* src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t* tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchMethodType method, float* dst, size_t dstStride);
+
+        \short Slides gray 8-bit template over gray 8-bit image and computes score map for every template position.
+
+        Output score map has size (srcWidth - tmplWidth + 1) x (srcHeight - tmplHeight + 1).
+        Window energy terms (sums and square sums of image under the template) are taken from integral images,
+        cross correlation is computed directly with using of SIMD. Output rows are processed in parallel.
+
+        \note This function has a C++ wrapper: Simd::TemplateMatch(const View<A>& src, const View<A>& tmpl, SimdTemplateMatchMethodType method, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the source image.
+        \param [in] srcStride - a row size of the source image.
+        \param [in] srcWidth - a width of the source image.
+        \param [in] srcHeight - a height of the source image.
+        \param [in] tmpl - a pointer to pixels data of the template. Its size must be not greater than size of the source image.
+        \param [in] tmplStride - a row size of the template.
+        \param [in] tmplWidth - a width of the template. It must be not greater than 33025.
+        \param [in] tmplHeight - a height of the template.
+        \param [in] method - a method of template matching (see ::SimdTemplateMatchMethodType).
+        \param [out] dst - a pointer to 32-bit float output score map.
+        \param [in] dstStride - a row size of the output score map (in bytes).
+    */
+    SIMD_API void SimdTemplateMatch(const uint8_t* src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t* tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight,
+        SimdTemplateMatchMethodType method, float* dst, size_t dstStride);
+
+    /*! @ingroup correlation
+
+        \fn size_t SimdTemplateMatchPeaks(const float* map, size_t stride, size_t width, size_t height, SimdTemplateMatchMethodType method, size_t radius, SimdTemplateMatchPeak* peaks, size_t count);
+
+        \short Finds the best peaks in score map created by function ::SimdTemplateMatch.
+
+        Peaks are local extrema (minimums for ::SimdTemplateMatchSqDiff and ::SimdTemplateMatchSqDiffNormed, maximums for other methods) sorted from the best.
+        A peak is skipped if it lies within radius (in both directions) from an already found better peak.
+
+        \note This function has a C++ wrapper: Simd::TemplateMatchPeaks(const View<A>& map, SimdTemplateMatchMethodType method, size_t radius, size_t count, std::vector<SimdTemplateMatchPeak>& peaks).
+
+        \param [in] map - a pointer to 32-bit float score map.
+        \param [in] stride - a row size of the score map (in bytes).
+        \param [in] width - a width of the score map.
+        \param [in] height - a height of the score map.
+        \param [in] method - a method of template matching used to create the score map.
+        \param [in] radius - a radius of non-maximum suppression.
+        \param [out] peaks - a pointer to output array of peaks.
+        \param [in] count - a maximal number of peaks (capacity of the output array).
+        \return number of found peaks.
+    */
+    SIMD_API size_t SimdTemplateMatchPeaks(const float* map, size_t stride, size_t width, size_t height, SimdTemplateMatchMethodType method,
+        size_t radius, SimdTemplateMatchPeak* peaks, size_t count);
+
     /*! @ingroup resizing
 
         \fn void SimdStretchGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
@@ -8441,7 +9283,7 @@ extern "C"
         \param [in] srcStride - a row size of input image.
         \param [in] width - an input image width. 
         \param [in] height - an input image height.
-        \param [in] pixelSize - a pixel size in input and output images. It can be 1, 2, 3, 4.
+        \param [in] pixelSize - a pixel size in input and output images. It can be 1, 2, 3, 4 (8-bit images) or 6, 8, 12, 16 (16-bit and 32-bit float multi-channel images).
         \param [in] transform - a type of image transformation.
         \param [out] dst - a pointer to pixels data of output image.
         \param [in] dstStride - a row size of output image.
@@ -8550,6 +9392,107 @@ extern "C"
     */
     SIMD_API void SimdWarpAffineRun(const void* context, const uint8_t* src, uint8_t* dst);
 
+    /*! @ingroup warp_affine
+
+        \fn void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper);
+
+        \short Creates context of batched warp affine (extraction of several crops from one image into tensor).
+
+        Every crop is warped into output image of size dstW x dstH with its own 2x3 matrix (see ::SimdWarpAffineInit),
+        then it is stored to output tensor with shape [count, dstH, dstW, C] (::SimdTensorFormatNhwc) or [count, C, dstH, dstW] (::SimdTensorFormatNchw).
+        For ::SimdTensorData32f and ::SimdTensorData16b output types pixel values are normalized:
+        \verbatim
+        dst[c] = src[c] * (upper[c] - lower[c]) / 255 + lower[c];
+        \endverbatim
+        Float output has 1 channel for gray input and 3 channels for BGR or BGRA input (alpha channel is skipped).
+        A matrix which maps crop box (x0, y0, x1, y1) of input image into output image is:
+        \verbatim
+        float mat[6] = { dstW / (x1 - x0), 0, -x0 * dstW / (x1 - x0), 0, dstH / (y1 - y0), -y0 * dstH / (y1 - y0) };
+        \endverbatim
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] channels - a channel number of input image. Its value must be in range [1..4]. 2 channels are supported only for ::SimdTensorData8u output.
+        \param [in] dstW - a width of output crop.
+        \param [in] dstH - a height of output crop.
+        \param [in] flags - a flags of algorithm parameters. Border type must be ::SimdWarpAffineBorderConstant.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels. It can be NULL.
+        \param [in] format - a format of output tensor. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+        \param [in] type - a type of output tensor. It can be ::SimdTensorData8u, ::SimdTensorData32f or ::SimdTensorData16b.
+        \param [in] lower - a pointer to the array with lower bound of output values. The size of the array is 1 or 3 (output channels). It can be NULL (0 is used).
+        \param [in] upper - a pointer to the array with upper bound of output values. The size of the array is 1 or 3 (output channels). It can be NULL (1 is used).
+        \return a pointer to batched warp affine context. On error it returns NULL.
+                This pointer is used in functions ::SimdWarpAffineBatchRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+        SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t count, uint8_t* dst);
+
+        \short Extracts several crops from image and stores them to output tensor.
+
+        Crops are distributed between threads. A crop with degenerate matrix is filled by border color.
+
+        \param [in] context - a batched warp affine context. It must be created by function ::SimdWarpAffineBatchInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] mats - a pointer to array of 2x3 matrices (6 floats per crop).
+        \param [in] count - a number of crops.
+        \param [out] dst - a pointer to output tensor. Its size must be at least count * dstH * dstW * C * sizeof(type).
+    */
+    SIMD_API void SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t count, uint8_t* dst);
+
+    /*! @ingroup warp_affine
+
+        \fn void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates warp perspective context.
+
+        Warp perspective transforms image with using of 3x3 homography matrix. For every pixel of output image:
+        \verbatim
+        [X, Y, Z] = inv(mat) * [x, y, 1];
+        dst[x, y] = src[X / Z, Y / Z];
+        \endverbatim
+
+        It uses the same interpolation kernels and border modes as ::SimdWarpAffineInit.
+
+        \note This function has a C++ wrapper Simd::WarpPerspective(const View<A>& src, const float * mat, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] srcW - a width of input image. It must be less then 32767.
+        \param [in] srcH - a height of input image. It must be less then 32767.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] dstS - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] mat - a pointer to 3x3 matrix with coefficients of perspective warp (from input to output image).
+        \param [in] flags - a flags of algorithm parameters.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
+        \return a pointer to warp perspective context. On error (for example, degenerate matrix) it returns NULL.
+                This pointer is used in functions ::SimdWarpPerspectiveRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+        size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst);
+
+        \short Performs warp perspective for current image.
+
+        \note This function has a C++ wrapper Simd::WarpPerspective(const View<A>& src, const float * mat, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] context - a warp perspective context. It must be created by function ::SimdWarpPerspectiveInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+    */
+    SIMD_API void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst);
+
     /*! @ingroup synet_winograd
 
         \fn void SimdWinogradKernel1x3Block1x4SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
@@ -9401,6 +10344,256 @@ extern "C"
     SIMD_API void SimdYuv444pToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, uint8_t* dst, size_t dstStride, SimdYuv16OutputType output, SimdBool dither);
+
+        \short Converts YUV image with high bit depth (10, 12 or 16 bits per sample) to BGR/RGB image with 8-bit, 16-bit, 32-bit float or BFloat16 channels.
+
+        Samples are linearly scaled from code values (a transfer function (PQ, HLG) is not applied), so the output keeps the transfer characteristic of the source.
+        Chroma planes are upsampled with using of nearest neighbor. All standards of ::SimdYuvType are supported (range and matrix are scaled to bit depth).
+
+        \note This function has a C++ wrapper: Simd::Yuv16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, SimdYuv16LayoutType layout, size_t bitDepth, View<A>& dst, SimdYuvType yuvType = SimdYuvBt709, bool dither = false).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y plane.
+        \param [in] yStride - a row size (in bytes) of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U plane (or with interleaved UV plane for ::SimdYuv16LayoutP420 and ::SimdYuv16LayoutP422).
+        \param [in] uStride - a row size (in bytes) of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V plane. It is ignored for semi-planar layouts and can be NULL.
+        \param [in] vStride - a row size (in bytes) of the v image.
+        \param [in] width - an image width. It must be even for 4:2:0 and 4:2:2 layouts.
+        \param [in] height - an image height. It must be even for 4:2:0 layouts.
+        \param [in] layout - a layout of input YUV image (see ::SimdYuv16LayoutType).
+        \param [in] bitDepth - a number of significant bits in every sample. It must be in range [9..16].
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+        \param [out] dst - a pointer to output image (or to the first plane of output tensor).
+        \param [in] dstStride - a row size (in bytes) of output image (or of every plane of output tensor). Planes of output tensor follow each other with step dstStride * height.
+        \param [in] output - a format of output image (see ::SimdYuv16OutputType).
+        \param [in] dither - a flag to use ordered (4x4 Bayer) dithering for 8-bit outputs. It is ignored for other outputs.
+    */
+    SIMD_API void SimdYuv16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height,
+        SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, uint8_t* dst, size_t dstStride, SimdYuv16OutputType output, SimdBool dither);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component (every its pixel contains two 8-bit channels: U, V).
+        Chroma channels are read directly from the semi-planar image without intermediate deinterleaving.
+
+        \note This function has a C++ wrapper: Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even.
+        \param [in] height - an image height. It must be even.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component (every its pixel contains two 8-bit channels: U, V).
+        Chroma channels are read directly from the semi-planar image without intermediate deinterleaving.
+
+        \note This function has a C++ wrapper: Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even.
+        \param [in] height - an image height. It must be even.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component (every its pixel contains two 8-bit channels: U, V).
+        Chroma channels are read directly from the semi-planar image without intermediate deinterleaving.
+
+        \note This function has a C++ wrapper: Simd::Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even.
+        \param [in] height - an image height. It must be even.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit RGBA image.
+
+        The input Y and output RGBA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component (every its pixel contains two 8-bit channels: U, V).
+        Chroma channels are read directly from the semi-planar image without intermediate deinterleaving.
+
+        \note This function has a C++ wrapper: Simd::Nv12ToRgba(const View<A>& y, const View<A>& uv, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even.
+        \param [in] height - an image height. It must be even.
+        \param [out] rgba - a pointer to pixels data of output 32-bit RGBA image.
+        \param [in] rgbaStride - a row size of the rgba image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgrResized(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t srcWidth, size_t srcHeight, uint8_t* bgr, size_t bgrStride, size_t dstWidth, size_t dstHeight, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit BGR image of other size in a single pass.
+
+        Y and UV planes are bilinearly interpolated to the output size row by row and converted to BGR without full size intermediate images.
+
+        \note This function has a C++ wrapper: Simd::Nv12ToBgrResized(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] srcWidth - a width of input image. It must be even.
+        \param [in] srcHeight - a height of input image. It must be even.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] dstWidth - a width of output image.
+        \param [in] dstHeight - a height of output image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgrResized(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t srcWidth, size_t srcHeight, uint8_t* bgr, size_t bgrStride, size_t dstWidth, size_t dstHeight, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component (every its pixel contains two 8-bit channels: V, U).
+        Chroma channels are read directly from the semi-planar image without intermediate deinterleaving.
+
+        \note This function has a C++ wrapper: Simd::Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with interleaved VU color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width. It must be even.
+        \param [in] height - an image height. It must be even.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component (every its pixel contains two 8-bit channels: V, U).
+        Chroma channels are read directly from the semi-planar image without intermediate deinterleaving.
+
+        \note This function has a C++ wrapper: Simd::Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with interleaved VU color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width. It must be even.
+        \param [in] height - an image height. It must be even.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component (every its pixel contains two 8-bit channels: V, U).
+        Chroma channels are read directly from the semi-planar image without intermediate deinterleaving.
+
+        \note This function has a C++ wrapper: Simd::Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with interleaved VU color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width. It must be even.
+        \param [in] height - an image height. It must be even.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 32-bit RGBA image.
+
+        The input Y and output RGBA images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component (every its pixel contains two 8-bit channels: V, U).
+        Chroma channels are read directly from the semi-planar image without intermediate deinterleaving.
+
+        \note This function has a C++ wrapper: Simd::Nv21ToRgba(const View<A>& y, const View<A>& vu, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with interleaved VU color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width. It must be even.
+        \param [in] height - an image height. It must be even.
+        \param [out] rgba - a pointer to pixels data of output 32-bit RGBA image.
+        \param [in] rgbaStride - a row size of the rgba image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToRgbaV2(const uint8_t* y, size_t yStride, const uint8_t* vu, size_t vuStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv420pToUyvy422(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* uyvy, size_t uyvyStride);
@@ -364,6 +364,24 @@ namespace Simd
         SimdAlphaBlendingUniform(src.data, src.stride, src.width, src.height, src.ChannelCount(), alpha, dst.data, dst.stride);
     }
 
+    /*! @ingroup drawing
+
+        \fn void AlphaCompositing(const std::vector<SimdAlphaCompositingLayer> & layers, View<A> & dst)
+
+        \short Composites ordered list of BGRA layers onto premultiplied BGRA image in one pass.
+
+        \note This function is a C++ wrapper for function ::SimdAlphaCompositing.
+
+        \param [in] layers - a list of layers (the first layer is the bottom one).
+        \param [in, out] dst - an output 32-bit premultiplied BGRA image.
+    */
+    template<template<class> class A> SIMD_INLINE void AlphaCompositing(const std::vector<SimdAlphaCompositingLayer> & layers, View<A> & dst)
+    {
+        assert(dst.format == View<A>::Bgra32);
+
+        SimdAlphaCompositing(layers.data(), layers.size(), dst.data, dst.stride, dst.width, dst.height);
+    }
+
     /*! @ingroup drawing
 
         \fn void AlphaFilling(View<A> & dst, const Pixel & pixel, const View<A> & alpha)
@@ -812,6 +830,57 @@ namespace Simd
         SimdBayerToBgra(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerDemosaic(const View<A>& bayer, View<A>& dst, SimdBayerDemosaicType method = SimdBayerDemosaicMalvar, const float* gains = NULL);
+
+        \short Converts 8-bit Bayer image to 24-bit BGR/RGB or 32-bit BGRA/RGBA image with using of high quality demosaicing.
+
+        All images must have the same width and height. The width and the height must be at least 4.
+
+        \note This function is a C++ wrapper for function ::SimdBayerDemosaic.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] dst - an output image. It can be 24-bit BGR/RGB or 32-bit BGRA/RGBA image.
+        \param [in] method - a demosaicing method. By default it is equal to ::SimdBayerDemosaicMalvar.
+        \param [in] gains - a pointer to white balance gains (for blue, green and red channels). It can be NULL (by default).
+    */
+    template<template<class> class A> SIMD_INLINE void BayerDemosaic(const View<A>& bayer, View<A>& dst, SimdBayerDemosaicType method = SimdBayerDemosaicMalvar, const float* gains = NULL)
+    {
+        assert(EqualSize(bayer, dst) && bayer.width >= 4 && bayer.height >= 4);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert(dst.format == View<A>::Bgr24 || dst.format == View<A>::Bgra32 || dst.format == View<A>::Rgb24 || dst.format == View<A>::Rgba32);
+
+        SimdBayerDemosaic(bayer.data, bayer.stride, bayer.width, bayer.height, (SimdPixelFormatType)bayer.format, 8, 0, gains, method, dst.data, dst.stride, (SimdPixelFormatType)dst.format);
+    }
+
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerDemosaic(const View<A>& raw, SimdPixelFormatType bayerFormat, size_t bitDepth, size_t blackLevel, View<A>& dst, SimdBayerDemosaicType method = SimdBayerDemosaicMalvar, const float* gains = NULL);
+
+        \short Converts 10/12/16-bit raw Bayer image to 24-bit BGR/RGB or 32-bit BGRA/RGBA image with using of high quality demosaicing.
+
+        All images must have the same width and height. The width and the height must be at least 4.
+
+        \note This function is a C++ wrapper for function ::SimdBayerDemosaic.
+
+        \param [in] raw - an input 16-bit raw image (::SimdPixelFormatInt16).
+        \param [in] bayerFormat - a Bayer pattern of the raw image.
+        \param [in] bitDepth - a bit depth of raw samples. It can be in range [8..16].
+        \param [in] blackLevel - a black level of raw samples.
+        \param [out] dst - an output image. It can be 24-bit BGR/RGB or 32-bit BGRA/RGBA image.
+        \param [in] method - a demosaicing method. By default it is equal to ::SimdBayerDemosaicMalvar.
+        \param [in] gains - a pointer to white balance gains (for blue, green and red channels). It can be NULL (by default).
+    */
+    template<template<class> class A> SIMD_INLINE void BayerDemosaic(const View<A>& raw, SimdPixelFormatType bayerFormat, size_t bitDepth, size_t blackLevel, View<A>& dst, 
+        SimdBayerDemosaicType method = SimdBayerDemosaicMalvar, const float* gains = NULL)
+    {
+        assert(EqualSize(raw, dst) && raw.width >= 4 && raw.height >= 4 && raw.format == View<A>::Int16 && bitDepth > 8);
+        assert(dst.format == View<A>::Bgr24 || dst.format == View<A>::Bgra32 || dst.format == View<A>::Rgb24 || dst.format == View<A>::Rgba32);
+
+        SimdBayerDemosaic(raw.data, raw.stride, raw.width, raw.height, bayerFormat, bitDepth, blackLevel, gains, method, dst.data, dst.stride, (SimdPixelFormatType)dst.format);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToBayer(const View<A>& bgra, View<A>& bayer)
@@ -1105,6 +1174,26 @@ namespace Simd
         SimdBgrToGray(bgr.data, bgr.width, bgr.height, bgr.stride, gray.data, gray.stride);
     }
 
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToGray16u(const View<A>& bgr, View<A>& gray)
+
+        \short Converts 48-bit BGR (or 64-bit BGRA) image to 16-bit gray image.
+
+        All images must have the same width and height. Alpha channel (if present) is ignored.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToGray16u.
+
+        \param [in] bgr - an input 48-bit BGR (or 64-bit BGRA) image.
+        \param [out] gray - an output 16-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToGray16u(const View<A>& bgr, View<A>& gray)
+    {
+        assert(EqualSize(bgr, gray) && (bgr.format == View<A>::Bgr48 || bgr.format == View<A>::Bgra64) && gray.format == View<A>::Gray16);
+
+        SimdBgrToGray16u(bgr.data, bgr.stride, bgr.width, bgr.height, bgr.ChannelCount(), gray.data, gray.stride);
+    }
+
     /*! @ingroup bgr_conversion
 
         \fn void BgrToHsl(const View<A> & bgr, View<A> & hsl)
@@ -1781,6 +1870,51 @@ namespace Simd
         SimdDeinterleaveBgra(rgba.data, rgba.stride, rgba.width, rgba.height, r.data, r.stride, g.data, g.stride, b.data, b.stride, NULL, 0);
     }
 
+    /*! @ingroup deinterleave_conversion
+
+        \fn void Deinterleave16u(const View<A>& src, View<A>& c0, View<A>& c1, View<A>& c2)
+
+        \short Deinterleaves 48-bit BGR (or RGB) interleaved image into separated 16-bit planar images.
+
+        All images must have the same width and height. Planes are filled in order of channels in the input image.
+
+        \note This function is a C++ wrapper for function ::SimdDeinterleave16u.
+
+        \param [in] src - an input 48-bit BGR (or RGB) interleaved image.
+        \param [out] c0 - an output 16-bit planar image of channel 0.
+        \param [out] c1 - an output 16-bit planar image of channel 1.
+        \param [out] c2 - an output 16-bit planar image of channel 2.
+    */
+    template<template<class> class A> SIMD_INLINE void Deinterleave16u(const View<A>& src, View<A>& c0, View<A>& c1, View<A>& c2)
+    {
+        assert(EqualSize(src, c0) && Compatible(c0, c1, c2) && (src.format == View<A>::Bgr48 || src.format == View<A>::Rgb48) && c0.format == View<A>::Gray16);
+
+        SimdDeinterleave16u(src.data, src.stride, src.width, src.height, 3, c0.data, c0.stride, c1.data, c1.stride, c2.data, c2.stride, NULL, 0);
+    }
+
+    /*! @ingroup deinterleave_conversion
+
+        \fn void Deinterleave16u(const View<A>& src, View<A>& c0, View<A>& c1, View<A>& c2, View<A>& c3)
+
+        \short Deinterleaves 64-bit BGRA (or RGBA) interleaved image into separated 16-bit planar images.
+
+        All images must have the same width and height. Planes are filled in order of channels in the input image.
+
+        \note This function is a C++ wrapper for function ::SimdDeinterleave16u.
+
+        \param [in] src - an input 64-bit BGRA (or RGBA) interleaved image.
+        \param [out] c0 - an output 16-bit planar image of channel 0.
+        \param [out] c1 - an output 16-bit planar image of channel 1.
+        \param [out] c2 - an output 16-bit planar image of channel 2.
+        \param [out] c3 - an output 16-bit planar image of channel 3.
+    */
+    template<template<class> class A> SIMD_INLINE void Deinterleave16u(const View<A>& src, View<A>& c0, View<A>& c1, View<A>& c2, View<A>& c3)
+    {
+        assert(EqualSize(src, c0) && Compatible(c0, c1, c2, c3) && (src.format == View<A>::Bgra64 || src.format == View<A>::Rgba64) && c0.format == View<A>::Gray16);
+
+        SimdDeinterleave16u(src.data, src.stride, src.width, src.height, 4, c0.data, c0.stride, c1.data, c1.stride, c2.data, c2.stride, c3.data, c3.stride);
+    }
+
     /*! @ingroup filling
 
         \fn void Fill(View<A>& dst, uint8_t value)
@@ -2131,6 +2265,40 @@ namespace Simd
         SimdChangeColors(src.data, src.stride, src.width, src.height, colors, dst.data, dst.stride);
     }
 
+    /*! @ingroup color_correction
+
+        \fn void ColorPipeline(const View<A>& src, View<A>& dst, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags = SimdColorPipelineDefault)
+
+        \short Applies color correction (3x3 matrix, tone curves and 3D LUT) to the image in one pass.
+
+        All images must have the same width, height and format (24-bit BGR/RGB or 32-bit BGRA/RGBA).
+
+        \note This function is a C++ wrapper for functions ::SimdColorPipelineInit and ::SimdColorPipelineRun.
+            If the same color correction is applied to many images it is better to create context with ::SimdColorPipelineInit once.
+
+        \param [in] src - an input image.
+        \param [out] dst - an output image.
+        \param [in] matrix - a pointer to 3x3 color correction matrix. It can be NULL.
+        \param [in] curves - a pointer to 3 tone curves (for red, green and blue channels). It can be NULL.
+        \param [in] curveSize - a size of every curve.
+        \param [in] lut - a pointer to 3D LUT. It can be NULL.
+        \param [in] lutSize - a size of 3D LUT along every axis.
+        \param [in] flags - a flags of color pipeline. By default it is equal to ::SimdColorPipelineDefault.
+    */
+    template<template<class> class A> SIMD_INLINE void ColorPipeline(const View<A>& src, View<A>& dst, const float* matrix, const float* curves, size_t curveSize,
+        const float* lut, size_t lutSize, SimdColorPipelineFlags flags = SimdColorPipelineDefault)
+    {
+        assert(Compatible(src, dst) && EqualSize(src, dst));
+        assert(src.format == View<A>::Bgr24 || src.format == View<A>::Bgra32 || src.format == View<A>::Rgb24 || src.format == View<A>::Rgba32);
+
+        void* context = SimdColorPipelineInit((SimdPixelFormatType)src.format, matrix, curves, curveSize, lut, lutSize, flags);
+        if (context)
+        {
+            SimdColorPipelineRun(context, src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+            SimdRelease(context);
+        }
+    }
+
     /*! @ingroup histogram
 
         \fn void NormalizeHistogram(const View<A> & src, View<A> & dst)
@@ -2294,12 +2462,12 @@ namespace Simd
         \note This function is a C++ wrapper for function ::SimdIntegral.
 
         \param [in] src - an input 8-bit gray image.
-        \param [out] sum - a 32-bit integer sum image.
+        \param [out] sum - a 32-bit integer, 64-bit integer or 32-bit float point sum image.
     */
     template<template<class> class A> SIMD_INLINE void Integral(const View<A>& src, View<A>& sum)
     {
         assert(src.width + 1 == sum.width && src.height + 1 == sum.height);
-        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32);
+        assert(src.format == View<A>::Gray8 && (sum.format == View<A>::Int32 || sum.format == View<A>::Int64 || sum.format == View<A>::Float));
 
         SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, NULL, 0, NULL, 0,
             (SimdPixelFormatType)sum.format, SimdPixelFormatNone);
@@ -2317,13 +2485,14 @@ namespace Simd
         \note This function is a C++ wrapper for function ::SimdIntegral.
 
         \param [in] src - an input 8-bit gray image.
-        \param [out] sum - a 32-bit integer sum image.
-        \param [out] sqsum - a 32-bit integer or 64-bit float point square sum image.
+        \param [out] sum - a 32-bit integer, 64-bit integer or 32-bit float point sum image.
+        \param [out] sqsum - a 32-bit integer, 64-bit integer or 64-bit float point square sum image.
     */
     template<template<class> class A> SIMD_INLINE void Integral(const View<A>& src, View<A>& sum, View<A>& sqsum)
     {
         assert(src.width + 1 == sum.width && src.height + 1 == sum.height && EqualSize(sum, sqsum));
-        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32 && (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Double));
+        assert(src.format == View<A>::Gray8 && (sum.format == View<A>::Int32 || sum.format == View<A>::Int64 || sum.format == View<A>::Float)
+            && (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Int64 || sqsum.format == View<A>::Double));
 
         SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, sqsum.data, sqsum.stride, NULL, 0,
             (SimdPixelFormatType)sum.format, (SimdPixelFormatType)sqsum.format);
@@ -2341,14 +2510,15 @@ namespace Simd
         \note This function is a C++ wrapper for function ::SimdIntegral.
 
         \param [in] src - an input 8-bit gray image.
-        \param [out] sum - a 32-bit integer sum image.
-        \param [out] sqsum - a 32-bit integer or 64-bit float point square sum image.
-        \param [out] tilted - a 32-bit integer tilted sum image.
+        \param [out] sum - a 32-bit integer, 64-bit integer or 32-bit float point sum image.
+        \param [out] sqsum - a 32-bit integer, 64-bit integer or 64-bit float point square sum image.
+        \param [out] tilted - a tilted sum image (with the same format as sum image).
     */
     template<template<class> class A> SIMD_INLINE void Integral(const View<A>& src, View<A>& sum, View<A>& sqsum, View<A>& tilted)
     {
         assert(src.width + 1 == sum.width && src.height + 1 == sum.height && EqualSize(sum, sqsum) && Compatible(sum, tilted));
-        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32 && (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Double));
+        assert(src.format == View<A>::Gray8 && (sum.format == View<A>::Int32 || sum.format == View<A>::Int64 || sum.format == View<A>::Float)
+            && (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Int64 || sqsum.format == View<A>::Double));
 
         SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, sqsum.data, sqsum.stride, tilted.data, tilted.stride,
             (SimdPixelFormatType)sum.format, (SimdPixelFormatType)sqsum.format);
@@ -2421,6 +2591,51 @@ namespace Simd
         SimdInterleaveBgra(b.data, b.stride, g.data, g.stride, r.data, r.stride, a.data, a.stride, bgra.width, bgra.height, bgra.data, bgra.stride);
     }
 
+    /*! @ingroup interleave_conversion
+
+        \fn void Interleave16u(const View<A>& c0, const View<A>& c1, const View<A>& c2, View<A>& dst)
+
+        \short Interleaves three 16-bit planar images into one 48-bit BGR (or RGB) interleaved image.
+
+        All images must have the same width and height. Planes are stored in order of channels in the output image.
+
+        \note This function is a C++ wrapper for function ::SimdInterleave16u.
+
+        \param [in] c0 - an input 16-bit planar image of channel 0.
+        \param [in] c1 - an input 16-bit planar image of channel 1.
+        \param [in] c2 - an input 16-bit planar image of channel 2.
+        \param [out] dst - an output 48-bit BGR (or RGB) interleaved image.
+    */
+    template<template<class> class A> SIMD_INLINE void Interleave16u(const View<A>& c0, const View<A>& c1, const View<A>& c2, View<A>& dst)
+    {
+        assert(EqualSize(dst, c0) && Compatible(c0, c1, c2) && (dst.format == View<A>::Bgr48 || dst.format == View<A>::Rgb48) && c0.format == View<A>::Gray16);
+
+        SimdInterleave16u(c0.data, c0.stride, c1.data, c1.stride, c2.data, c2.stride, NULL, 0, dst.width, dst.height, 3, dst.data, dst.stride);
+    }
+
+    /*! @ingroup interleave_conversion
+
+        \fn void Interleave16u(const View<A>& c0, const View<A>& c1, const View<A>& c2, const View<A>& c3, View<A>& dst)
+
+        \short Interleaves four 16-bit planar images into one 64-bit BGRA (or RGBA) interleaved image.
+
+        All images must have the same width and height. Planes are stored in order of channels in the output image.
+
+        \note This function is a C++ wrapper for function ::SimdInterleave16u.
+
+        \param [in] c0 - an input 16-bit planar image of channel 0.
+        \param [in] c1 - an input 16-bit planar image of channel 1.
+        \param [in] c2 - an input 16-bit planar image of channel 2.
+        \param [in] c3 - an input 16-bit planar image of channel 3.
+        \param [out] dst - an output 64-bit BGRA (or RGBA) interleaved image.
+    */
+    template<template<class> class A> SIMD_INLINE void Interleave16u(const View<A>& c0, const View<A>& c1, const View<A>& c2, const View<A>& c3, View<A>& dst)
+    {
+        assert(EqualSize(dst, c0) && Compatible(c0, c1, c2, c3) && (dst.format == View<A>::Bgra64 || dst.format == View<A>::Rgba64) && c0.format == View<A>::Gray16);
+
+        SimdInterleave16u(c0.data, c0.stride, c1.data, c1.stride, c2.data, c2.stride, c3.data, c3.stride, dst.width, dst.height, 4, dst.data, dst.stride);
+    }
+
     /*! @ingroup laplace_filter
 
         \fn void Laplace(const View<A>& src, View<A>& dst)
@@ -2650,6 +2865,103 @@ namespace Simd
         SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
     }
 
+    /*! @ingroup median_filter
+
+        \fn void MedianFilter(const View<A>& src, View<A>& dst, size_t radius)
+
+        \short Performs median filtration of input image (filter window is a square (2*radius + 1)x(2*radius + 1)).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR, 32-bit BGRA or 16-bit Int16).
+
+        \note This function is a C++ wrapper for functions ::SimdMedianFilterInit and ::SimdMedianFilterRun.
+
+        \param [in] src - an original input image.
+        \param [out] dst - a filtered output image.
+        \param [in] radius - a radius of filter window. Its value must be in range [1..127].
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilter(const View<A>& src, View<A>& dst, size_t radius)
+    {
+        assert(Compatible(src, dst) && (src.ChannelSize() == 1 || src.format == View<A>::Int16));
+
+        bool depth = src.format == View<A>::Int16;
+        void* filter = SimdMedianFilterInit(src.width, src.height, depth ? 1 : src.ChannelCount(), radius, depth ? SimdMedianFilter16u : SimdMedianFilter8u);
+        if (filter)
+        {
+            SimdMedianFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(filter);
+        }
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void Morphology(const View<A>& src, View<A>& dst, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, SimdMorphologyOperationType operation)
+
+        \short Performs morphological operation (erosion, dilation, opening, closing or gradient) of 8-bit image.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMorphology.
+
+        \param [in] src - an original input image.
+        \param [out] dst - an output image.
+        \param [in] kernelX - a width of structuring element.
+        \param [in] kernelY - a height of structuring element.
+        \param [in] shape - a shape of structuring element.
+        \param [in] operation - a type of morphological operation.
+    */
+    template<template<class> class A> SIMD_INLINE void Morphology(const View<A>& src, View<A>& dst, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, SimdMorphologyOperationType operation)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdMorphology(src.data, src.stride, src.width, src.height, src.ChannelCount(), kernelX, kernelY, shape, operation, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void Erode(const View<A>& src, View<A>& dst, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape = SimdMorphologyShapeRect)
+
+        \short Performs erosion of 8-bit image.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdErode.
+
+        \param [in] src - an original input image.
+        \param [out] dst - an output image.
+        \param [in] kernelX - a width of structuring element.
+        \param [in] kernelY - a height of structuring element.
+        \param [in] shape - a shape of structuring element. By default it is a rectangle.
+    */
+    template<template<class> class A> SIMD_INLINE void Erode(const View<A>& src, View<A>& dst, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape = SimdMorphologyShapeRect)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdErode(src.data, src.stride, src.width, src.height, src.ChannelCount(), kernelX, kernelY, shape, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void Dilate(const View<A>& src, View<A>& dst, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape = SimdMorphologyShapeRect)
+
+        \short Performs dilation of 8-bit image.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdDilate.
+
+        \param [in] src - an original input image.
+        \param [out] dst - an output image.
+        \param [in] kernelX - a width of structuring element.
+        \param [in] kernelY - a height of structuring element.
+        \param [in] shape - a shape of structuring element. By default it is a rectangle.
+    */
+    template<template<class> class A> SIMD_INLINE void Dilate(const View<A>& src, View<A>& dst, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape = SimdMorphologyShapeRect)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdDilate(src.data, src.stride, src.width, src.height, src.ChannelCount(), kernelX, kernelY, shape, dst.data, dst.stride);
+    }
+
     /*! @ingroup neural
 
         \fn void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
@@ -3902,6 +4214,50 @@ namespace Simd
         SimdCorrelationSum(a.data, a.stride, b.data, b.stride, a.width, a.height, &sum);
     }
 
+    /*! @ingroup correlation
+
+        \fn void TemplateMatch(const View<A>& src, const View<A>& tmpl, SimdTemplateMatchMethodType method, View<A>& dst)
+
+        \short Slides gray 8-bit template over gray 8-bit image and computes score map for every template position.
+
+        \note This function is a C++ wrapper for function ::SimdTemplateMatch.
+
+        \param [in] src - a source image.
+        \param [in] tmpl - a template. Its size must be not greater than size of the source image.
+        \param [in] method - a method of template matching (see ::SimdTemplateMatchMethodType).
+        \param [out] dst - an output 32-bit float score map. Its size must be equal to (src.width - tmpl.width + 1) x (src.height - tmpl.height + 1).
+    */
+    template<template<class> class A> SIMD_INLINE void TemplateMatch(const View<A>& src, const View<A>& tmpl, SimdTemplateMatchMethodType method, View<A>& dst)
+    {
+        assert(src.format == View<A>::Gray8 && tmpl.format == View<A>::Gray8 && dst.format == View<A>::Float);
+        assert(tmpl.width <= src.width && tmpl.height <= src.height);
+        assert(dst.width == src.width - tmpl.width + 1 && dst.height == src.height - tmpl.height + 1);
+
+        SimdTemplateMatch(src.data, src.stride, src.width, src.height, tmpl.data, tmpl.stride, tmpl.width, tmpl.height, method, (float*)dst.data, dst.stride);
+    }
+
+    /*! @ingroup correlation
+
+        \fn void TemplateMatchPeaks(const View<A>& map, SimdTemplateMatchMethodType method, size_t radius, size_t count, std::vector<SimdTemplateMatchPeak>& peaks)
+
+        \short Finds the best peaks in score map created by function Simd::TemplateMatch.
+
+        \note This function is a C++ wrapper for function ::SimdTemplateMatchPeaks.
+
+        \param [in] map - a 32-bit float score map.
+        \param [in] method - a method of template matching used to create the score map.
+        \param [in] radius - a radius of non-maximum suppression.
+        \param [in] count - a maximal number of peaks.
+        \param [out] peaks - a vector with found peaks (sorted from the best).
+    */
+    template<template<class> class A> SIMD_INLINE void TemplateMatchPeaks(const View<A>& map, SimdTemplateMatchMethodType method, size_t radius, size_t count, std::vector<SimdTemplateMatchPeak>& peaks)
+    {
+        assert(map.format == View<A>::Float);
+
+        peaks.resize(count);
+        peaks.resize(SimdTemplateMatchPeaks((float*)map.data, map.stride, map.width, map.height, method, radius, peaks.data(), count));
+    }
+
     /*! @ingroup resizing
 
         \fn void StretchGray2x2(const View<A>& src, View<A>& dst)
@@ -4208,6 +4564,65 @@ namespace Simd
         }
     }
 
+    /*! @ingroup warp_affine
+
+        \fn void WarpPerspective(const View<A>& src, const float * mat, View<A>& dst, SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+
+        \short Performs warp perspective for current image.
+
+        \note This function is a C++ wrapper for functions ::SimdWarpPerspectiveInit and ::SimdWarpPerspectiveRun.
+
+        \param [in] src - an input image.
+        \param [in] mat - a pointer to 3x3 matrix with coefficients of perspective warp.
+        \param [in, out] dst - an output image.
+        \param [in] flags - a flags of algorithm parameters. By default is equal to ::SimdWarpAffineChannelByte | ::SimdWarpAffineInterpBilinear | ::SimdWarpAffineBorderConstant.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. By default is equal to NULL.
+    */
+    template<template<class> class A> SIMD_INLINE void WarpPerspective(const View<A>& src, const float* mat, View<A>& dst,
+        SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+    {
+        assert(src.format == dst.format && src.ChannelSize() == 1);
+        assert((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
+
+        void* context = SimdWarpPerspectiveInit(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, src.ChannelCount(), mat, flags, border);
+        if (context)
+        {
+            SimdWarpPerspectiveRun(context, src.data, dst.data);
+            SimdRelease(context);
+        }
+    }
+
+    /*! @ingroup warp_affine
+
+        \fn void Remap(const View<A>& src, const float * map, View<A>& dst, SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+
+        \short Performs remap for current image.
+
+        \note This function is a C++ wrapper for functions ::SimdRemapInit and ::SimdRemapRun.
+            If the same map is used for many images it is better to create context with ::SimdRemapInit once.
+
+        \param [in] src - an input image.
+        \param [in] map - a pointer to map with source coordinates (x, y) for every pixel of output image. Its size must be equal to dst.width * dst.height * 2.
+        \param [in, out] dst - an output image.
+        \param [in] flags - a flags of algorithm parameters. By default is equal to ::SimdWarpAffineChannelByte | ::SimdWarpAffineInterpBilinear | ::SimdWarpAffineBorderConstant.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. By default is equal to NULL.
+    */
+    template<template<class> class A> SIMD_INLINE void Remap(const View<A>& src, const float* map, View<A>& dst,
+        SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+    {
+        assert(src.format == dst.format && src.ChannelSize() == 1);
+        assert((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
+
+        void* context = SimdRemapInit(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, src.ChannelCount(), map, flags, border);
+        if (context)
+        {
+            SimdRemapRun(context, src.data, dst.data);
+            SimdRelease(context);
+        }
+    }
+
     /*! @ingroup warp_affine
 
         \fn bool InvertAffineTransform(const float* src, float* dst)
@@ -4684,6 +5099,258 @@ namespace Simd
         SimdYuv444pToRgbaV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, rgba.data, rgba.stride, alpha, yuvType);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, SimdYuv16LayoutType layout, size_t bitDepth, View<A>& dst, SimdYuvType yuvType = SimdYuvBt709, bool dither = false);
+
+        \short Converts YUV image with high bit depth (10, 12 or 16 bits per sample) to 8-bit gray, BGR, BGRA, RGB or RGBA image.
+
+        Format of output image is determined by dst.format. Input planes must have format View::Int16.
+
+        \note This function is a C++ wrapper for function ::SimdYuv16ToBgr.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane (or with interleaved UV plane for semi-planar layouts).
+        \param [in] v - an input 16-bit image with V color plane. It is ignored for semi-planar layouts.
+        \param [in] layout - a layout of input YUV image (see ::SimdYuv16LayoutType).
+        \param [in] bitDepth - a number of significant bits in every sample.
+        \param [out] dst - an output 8-bit gray, 24-bit BGR, 32-bit BGRA, 24-bit RGB or 32-bit RGBA image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt709.
+        \param [in] dither - a flag to use ordered dithering. By default it is false.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, SimdYuv16LayoutType layout, size_t bitDepth, View<A>& dst, SimdYuvType yuvType = SimdYuvBt709, bool dither = false)
+    {
+        assert(EqualSize(y, dst) && y.format == View<A>::Int16 && u.format == View<A>::Int16);
+
+        SimdYuv16OutputType output;
+        switch (dst.format)
+        {
+        case View<A>::Gray8: output = SimdYuv16OutputGray8; break;
+        case View<A>::Bgr24: output = SimdYuv16OutputBgr24; break;
+        case View<A>::Bgra32: output = SimdYuv16OutputBgra32; break;
+        case View<A>::Rgb24: output = SimdYuv16OutputRgb24; break;
+        case View<A>::Rgba32: output = SimdYuv16OutputRgba32; break;
+        default: assert(0); return;
+        }
+        SimdYuv16ToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, layout, bitDepth, yuvType, dst.data, dst.stride, output, dither ? SimdTrue : SimdFalse);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+        assert(EqualSize(y, bgr) && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgrV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+        assert(EqualSize(y, bgra) && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgraV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgbV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+        assert(EqualSize(y, rgb) && rgb.format == View<A>::Rgb24);
+
+        SimdNv12ToRgbV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToRgba(const View<A>& y, const View<A>& uv, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 32-bit RGBA image.
+
+        The input Y and output RGBA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgbaV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] rgba - an output 32-bit RGBA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgba(const View<A>& y, const View<A>& uv, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+        assert(EqualSize(y, rgba) && rgba.format == View<A>::Rgba32);
+
+        SimdNv12ToRgbaV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgba.data, rgba.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgrResized(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit BGR image of other size in a single pass.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgrResized.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes (half size relative to Y component).
+        \param [out] bgr - an output 24-bit BGR image. It can have arbitrary size.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgrResized(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgrResized(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, bgr.width, bgr.height, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved VU color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgr(const View<A>& y, const View<A>& vu, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && y.format == View<A>::Gray8 && vu.format == View<A>::Uv16);
+        assert(EqualSize(y, bgr) && bgr.format == View<A>::Bgr24);
+
+        SimdNv21ToBgrV2(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved VU color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgra(const View<A>& y, const View<A>& vu, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && y.format == View<A>::Gray8 && vu.format == View<A>::Uv16);
+        assert(EqualSize(y, bgra) && bgra.format == View<A>::Bgra32);
+
+        SimdNv21ToBgraV2(y.data, y.stride, vu.data, vu.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToRgbV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved VU color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToRgb(const View<A>& y, const View<A>& vu, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && y.format == View<A>::Gray8 && vu.format == View<A>::Uv16);
+        assert(EqualSize(y, rgb) && rgb.format == View<A>::Rgb24);
+
+        SimdNv21ToRgbV2(y.data, y.stride, vu.data, vu.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToRgba(const View<A>& y, const View<A>& vu, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image to 32-bit RGBA image.
+
+        The input Y and output RGBA images must have the same width and height.
+        The input VU image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToRgbaV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] vu - an input 16-bit image with interleaved VU color planes.
+        \param [out] rgba - an output 32-bit RGBA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToRgba(const View<A>& y, const View<A>& vu, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * vu.width && y.height == 2 * vu.height && y.format == View<A>::Gray8 && vu.format == View<A>::Uv16);
+        assert(EqualSize(y, rgba) && rgba.format == View<A>::Rgba32);
+
+        SimdNv21ToRgbaV2(y.data, y.stride, vu.data, vu.stride, y.width, y.height, rgba.data, rgba.stride, alpha, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv420pToUyvy422(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& uyvy);
@@ -4888,6 +5555,53 @@ namespace Simd
         for (size_t level = 1; level < pyramid.Size(); ++level)
             Simd::ReduceGray(pyramid.At(level - 1), pyramid.At(level), reduceType, compensation);
     }
+
+    /*! @ingroup cpp_pyramid_functions
+
+        \fn void OpticalFlowPyrLk(const Pyramid<A> & prev, const Pyramid<A> & next, const std::vector<Point<float>> & prevPoints, std::vector<Point<float>> & nextPoints, std::vector<uint8_t> & status, std::vector<float> & errors, size_t radius = 7, size_t iterations = 20, float epsilon = 0.01f, float minEigen = 0.1f)
+
+        \short Tracks points with using pyramidal Lucas-Kanade sparse optical flow.
+
+        \note This function is a C++ wrapper for functions ::SimdOpticalFlowPyrLkInit and ::SimdOpticalFlowPyrLkRun.
+
+        \param [in] prev - a built pyramid of previous image.
+        \param [in] next - a built pyramid of next image. It must have the same size as previous pyramid.
+        \param [in] prevPoints - tracked points in previous image.
+        \param [out] nextPoints - found points in next image.
+        \param [out] status - statuses of tracked points (1 - point is found, 0 - point is lost).
+        \param [out] errors - tracking errors (mean absolute difference between patches).
+        \param [in] radius - a radius of tracking window. It must be in range [1..15]. By default it is equal to 7.
+        \param [in] iterations - a maximal number of iterations at every pyramid level. By default it is equal to 20.
+        \param [in] epsilon - a minimal shift (in pixels) at iteration to continue iterations. By default it is equal to 0.01.
+        \param [in] minEigen - a minimal normalized eigen value of spatial gradient matrix. By default it is equal to 0.1.
+    */
+    template<template<class> class A> SIMD_INLINE void OpticalFlowPyrLk(const Pyramid<A> & prev, const Pyramid<A> & next, 
+        const std::vector<Point<float>> & prevPoints, std::vector<Point<float>> & nextPoints, std::vector<uint8_t> & status, std::vector<float> & errors,
+        size_t radius = 7, size_t iterations = 20, float epsilon = 0.01f, float minEigen = 0.1f)
+    {
+        assert(prev.Size() == next.Size() && prev.Size() > 0 && prev[0].Size() == next[0].Size());
+
+        size_t levels = prev.Size(), count = prevPoints.size();
+        std::vector<const uint8_t*> prevData(levels), nextData(levels);
+        std::vector<size_t> prevStrides(levels), nextStrides(levels);
+        for (size_t level = 0; level < levels; ++level)
+        {
+            prevData[level] = prev[level].data;
+            prevStrides[level] = prev[level].stride;
+            nextData[level] = next[level].data;
+            nextStrides[level] = next[level].stride;
+        }
+        nextPoints.resize(count);
+        status.resize(count);
+        errors.resize(count);
+        void* context = SimdOpticalFlowPyrLkInit(prev[0].width, prev[0].height, levels, radius, iterations, epsilon, minEigen);
+        if (context)
+        {
+            SimdOpticalFlowPyrLkRun(context, prevData.data(), prevStrides.data(), nextData.data(), nextStrides.data(),
+                (const float*)prevPoints.data(), count, (float*)nextPoints.data(), status.data(), errors.data());
+            SimdRelease(context);
+        }
+    }
 }
 
 #endif
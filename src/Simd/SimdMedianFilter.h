@@ -0,0 +1,166 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMedianFilter_h__
+#define __SimdMedianFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdConst.h"
+
+namespace Simd
+{
+    struct MedParam
+    {
+        size_t width;
+        size_t height;
+        size_t channels;
+        size_t radius;
+        SimdMedianFilterFlags flags;
+        size_t align;
+
+        MedParam(size_t w, size_t h, size_t c, size_t r, SimdMedianFilterFlags f, size_t a);
+        bool Valid() const;
+
+        SIMD_INLINE bool Is16u() const
+        {
+            return (flags & SimdMedianFilterTypeMask) == SimdMedianFilter16u;
+        }
+
+        SIMD_INLINE size_t Rank() const
+        {
+            return Square(2 * radius + 1) / 2;
+        }
+    };
+
+    class MedianFilter : Deletable
+    {
+    public:
+        MedianFilter(const MedParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        MedParam _param;
+    };
+
+    namespace Base
+    {
+        typedef void(*MedianStripPtr)(const MedParam& p, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint16_t* buf, uint8_t* dst, size_t dstStride);
+
+        SIMD_INLINE size_t MedianOffset(const MedParam& p, size_t begin, size_t col)
+        {
+            ptrdiff_t x = (ptrdiff_t)(begin + col) - (ptrdiff_t)p.radius;
+            return (x < 0 ? 0 : x < (ptrdiff_t)p.width ? x : p.width - 1) * p.channels;
+        }
+
+        SIMD_INLINE size_t MedianRow(const MedParam& p, ptrdiff_t row)
+        {
+            return row < 0 ? 0 : row < (ptrdiff_t)p.height ? row : p.height - 1;
+        }
+
+        SIMD_INLINE void MedianUpdate8u(const MedParam& p, const uint8_t* src, size_t begin, size_t size, uint16_t* fine, uint16_t* coarse, int delta)
+        {
+            for (size_t col = 0; col < size; ++col)
+            {
+                const uint8_t* ps = src + MedianOffset(p, begin, col);
+                for (size_t c = 0; c < p.channels; ++c)
+                {
+                    int v = ps[c];
+                    fine[((c * 16 + (v >> 4)) * size + col) * 16 + (v & 15)] += delta;
+                    coarse[(c * size + col) * 16 + (v >> 4)] += delta;
+                }
+            }
+        }
+
+        void MedianStrip8u(const MedParam& p, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint16_t* buf, uint8_t* dst, size_t dstStride);
+
+        void MedianStrip16u(const MedParam& p, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint16_t* buf, uint8_t* dst, size_t dstStride);
+
+        class MedianFilterHist : public Simd::MedianFilter
+        {
+        public:
+            MedianFilterHist(const MedParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            size_t _threads, _strip, _strips, _size;
+            Array16u _buffer;
+            MedianStripPtr _run;
+        };
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i MedianPrefix8(__m128i hist)
+        {
+            hist = _mm_add_epi16(hist, _mm_slli_si128(hist, 2));
+            hist = _mm_add_epi16(hist, _mm_slli_si128(hist, 4));
+            return _mm_add_epi16(hist, _mm_slli_si128(hist, 8));
+        }
+
+        SIMD_INLINE size_t MedianFind16(__m128i lo, __m128i hi, size_t rank, size_t& sum)
+        {
+            __m128i _rank = _mm_set1_epi16((short)(rank - sum));
+            lo = MedianPrefix8(lo);
+            hi = _mm_add_epi16(MedianPrefix8(hi), _mm_shuffle_epi32(_mm_shufflehi_epi16(lo, 0xFF), 0xFF));
+            __m128i le0 = _mm_cmpeq_epi16(_mm_min_epu16(lo, _rank), lo);
+            __m128i le1 = _mm_cmpeq_epi16(_mm_min_epu16(hi, _rank), hi);
+            __m128i below = _mm_max_epu16(_mm_and_si128(lo, le0), _mm_and_si128(hi, le1));
+            sum += 0xFFFF & ~_mm_cvtsi128_si32(_mm_minpos_epu16(_mm_xor_si128(below, K_INV_ZERO)));
+            __m128i count = _mm_sad_epu8(_mm_and_si128(_mm_packs_epi16(le0, le1), K8_01), K_ZERO);
+            return _mm_cvtsi128_si32(count) + _mm_extract_epi32(count, 2);
+        }
+
+        void MedianStrip8u(const MedParam& p, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint16_t* buf, uint8_t* dst, size_t dstStride);
+
+        class MedianFilterHist : public Base::MedianFilterHist
+        {
+        public:
+            MedianFilterHist(const MedParam& param);
+        };
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void MedianStrip8u(const MedParam& p, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint16_t* buf, uint8_t* dst, size_t dstStride);
+
+        class MedianFilterHist : public Sse41::MedianFilterHist
+        {
+        public:
+            MedianFilterHist(const MedParam& param);
+        };
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags);
+    }
+#endif
+}
+#endif
@@ -29,10 +29,13 @@
 #include "Simd/SimdFrame.hpp"
 #include "Simd/SimdDrawing.hpp"
 #include "Simd/SimdFont.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
 #include <stack>
 #include <sstream>
+#include <atomic>
+#include <chrono>
 
 #ifndef SIMD_CHECK_PERFORMANCE
 #define SIMD_CHECK_PERFORMANCE()
@@ -510,17 +513,20 @@ namespace Simd
         struct Options
         {
             int CalibrationScaleLevelMax;  /*!< \brief A maximum scale of input frame. By default it is equal to 3 (maximum scale in 8 times). */ 
+            int CalibrationScaleLevelMin;  /*!< \brief A minimum scale of input frame. It allows to start processing from reduced pyramid level for high resolution input. By default it is equal to 0 (no forced scale). */ 
 
             int DifferenceGrayFeatureWeight; /*!< \brief A weight of gray feature for difference estimation. By default it is equal to 18. */ 
             int DifferenceDxFeatureWeight; /*!< \brief A weight of X-gradient feature for difference estimation. By default it is equal to 18. */ 
             int DifferenceDyFeatureWeight; /*!< \brief A weight of Y-gradient feature for difference estimation. By default it is equal to 18. */ 
             bool DifferencePropagateForward; /*!< \brief An additional boosting of estimated difference. By default it is true. */ 
             bool DifferenceRoiMaskEnable; /*!< \brief A flag to restrict difference estimation by ROI. By default it is true. */ 
+            int DifferenceGradientFrameInterval; /*!< \brief An interval (in frames) of gradient features (X and Y gradients) estimation. Gray feature is estimated at every frame. By default it is equal to 1 (every frame). */ 
 
             double BackgroundGrowTime; /*!< \brief Initial time (in seconds) of updated background in fast mode. By default it is equal to 1 second. */ 
             double BackgroundStatUpdateTime; /*!< \brief Collect background statistics update interval (in seconds) in normal mode. By default it is equal to 0.04 second. */
             double BackgroundUpdateTime; /*!< \brief Background update speed (in seconds) in normal mode. By default it is equal to 1 second. */
             int BackgroundSabotageCountMax; /*!< \brief Maximal count of frame with sabotage without scene reinitialization. By default it is equal to 3. */
+            int BackgroundUpdateFrameInterval; /*!< \brief An interval (in frames) of background update. Segmentation and tracking are performed at every frame. By default it is equal to 1 (every frame). */
 
             double SegmentationCreateThreshold; /*!< \brief Threshold of segmentation to create motion region. It is restricted by range [0, 1]. By default it is equal to 0.5. */
             double SegmentationExpandCoefficient; /*!< \brief Segmentation coefficient of area expansion of motion region. It is restricted by range [0, 1]. By default it is equal to 0.75. */
@@ -547,17 +553,20 @@ namespace Simd
             Options()
             {
                 CalibrationScaleLevelMax = 3;
+                CalibrationScaleLevelMin = 0;
 
                 DifferenceGrayFeatureWeight = 18;
                 DifferenceDxFeatureWeight = 18;
                 DifferenceDyFeatureWeight = 18;
                 DifferencePropagateForward = true;
                 DifferenceRoiMaskEnable = true;
+                DifferenceGradientFrameInterval = 1;
 
                 BackgroundGrowTime = 1.0;
                 BackgroundStatUpdateTime = 0.04;
                 BackgroundUpdateTime = 1.0;
                 BackgroundSabotageCountMax = 3;
+                BackgroundUpdateFrameInterval = 1;
 
                 SegmentationCreateThreshold = 0.5;
                 SegmentationExpandCoefficient = 0.75;
@@ -628,9 +637,25 @@ namespace Simd
                 return true;
             }
 
+            /*!
+                Resets state of motion detector (background, tracked objects, counters). 
+                The detector will be calibrated again at the next frame, allocated buffers are reused if frame size is not changed.
+            */
+            void Reset()
+            {
+                _scene.background = Background();
+                _scene.stability = Stability();
+                _scene.tracking = Tracking();
+                _scene.classification = Classification();
+                _scene.segmentation.movingRegions.clear();
+                _scene.model.originalFrameSize = Size();
+            }
+
             /*!
                 Processes next frame. You have to successively process all frame of a movie with using of this function.
 
+                \note Y plane of Gray8, NV12, YUV420P and YUV444P input frames is used directly (without conversion and copying of full size image).
+
                 \param [in] input - a current input frame.
                 \param [out] metadata - a metadata (sets of detected objects and generated events). It is a result of processing of current frame.
                 \param [out] output - a pointer to output frame with debug annotation. Can be NULL.
@@ -663,12 +688,15 @@ namespace Simd
 
                 ClassifyObjects();
 
-                UpdateBackground();
+                if (_scene.frameIndex % std::max(_options.BackgroundUpdateFrameInterval, 1) == 0)
+                    UpdateBackground();
 
                 SetMetadata();
 
                 DebugAnnotation();
 
+                _scene.frameIndex++;
+
                 return true;
             }
 
@@ -941,6 +969,8 @@ namespace Simd
             {
                 Frame input, * output;
                 Pyramid scaled;
+                View top;
+                size_t frameIndex;
                 Metadata * metadata;
 
                 Font font;
@@ -963,7 +993,9 @@ namespace Simd
 
                 void Create(const Options & options)
                 {
+                    frameIndex = 0;
                     scaled.Recreate(model.originalFrameSize, model.scaleLevel + 1);
+                    scaled[0].Clear();
                     font.Resize(model.originalFrameSize.y / 32);
                     buffer.Recreate(model.frameSize, model.levelCount);
 
@@ -986,8 +1018,28 @@ namespace Simd
 
                 _scene.input = input;
                 _scene.output = output;
-                Simd::Convert(input, Frame(_scene.scaled[0]).Ref());
-                Simd::Build(_scene.scaled, SimdReduce2x2);
+                Pyramid & scaled = _scene.scaled;
+                if (input.format == Frame::Gray8 || input.format == Frame::Nv12 || input.format == Frame::Nv21 || input.format == Frame::Yuv420p || input.format == Frame::Yuv444p)
+                {
+                    const View & y = input.planes[0];
+                    if (scaled.Size() > 1)
+                    {
+                        Simd::ReduceGray2x2(y, scaled[1]);
+                        for (size_t i = 2; i < scaled.Size(); ++i)
+                            Simd::ReduceGray2x2(scaled[i - 1], scaled[i]);
+                        _scene.top = scaled.Top();
+                    }
+                    else
+                        _scene.top = y;
+                }
+                else
+                {
+                    if (scaled[0].Area() == 0)
+                        scaled[0].Recreate(_scene.model.originalFrameSize, View::Gray8);
+                    Simd::Convert(input, Frame(scaled[0]).Ref());
+                    Simd::Build(scaled, SimdReduce2x2);
+                    _scene.top = scaled.Top();
+                }
             }
 
             bool Calibrate(const Size & frameSize)
@@ -1024,7 +1076,8 @@ namespace Simd
                     model.areaRegionMinEstimated /= 4;
                 }
                 model.areaRegionMinEstimated = std::max(model.areaRegionMinEstimated, _options.CalibrationObjectAreaMin / 4 + 1);
-                model.scaleLevel = std::min(std::max(levelCount - _options.CalibrationLevelCountMin, 0), _options.CalibrationScaleLevelMax);
+                int scaleLevel = std::min(std::max(levelCount - _options.CalibrationLevelCountMin, 0), _options.CalibrationScaleLevelMax);
+                model.scaleLevel = std::min(std::max(scaleLevel, _options.CalibrationScaleLevelMin), levelCount - 1);
                 model.levelCount = levelCount - model.scaleLevel;
                 model.scale = size_t(1) << model.scaleLevel;
                 model.frameSize = model.originalFrameSize;
@@ -1108,9 +1161,10 @@ namespace Simd
                 SIMD_CHECK_PERFORMANCE();
 
                 Texture & texture = _scene.texture;
-                Simd::Copy(_scene.scaled.Top(), texture.gray.value[0]);
+                Simd::Copy(_scene.top, texture.gray.value[0]);
                 Simd::Build(texture.gray.value, SimdReduce4x4);
-                if (_options.DifferenceDxFeatureWeight || _options.DifferenceDyFeatureWeight)
+                if ((_options.DifferenceDxFeatureWeight || _options.DifferenceDyFeatureWeight) && 
+                    _scene.frameIndex % std::max(_options.DifferenceGradientFrameInterval, 1) == 0)
                 {
                     for (size_t i = 0; i < texture.gray.value.Size(); ++i)
                     {
@@ -1729,6 +1783,254 @@ namespace Simd
                 }
             }
         };
+
+        /*! @ingroup cpp_motion
+
+            \short Class Engine.
+
+            Performs motion detection for many video streams with using of common pool of work threads.
+            Every stream has its own Simd::Motion::Detector. Frames of one stream are processed in order of submission,
+            frames of different streams are processed in parallel. Detectors of removed streams are kept in the pool
+            and reused by new streams (so their pyramids are not reallocated for the same frame size).
+
+            Using example:
+            \verbatim
+            Simd::Motion::Engine engine;
+            size_t cam0 = engine.AddStream(), cam1 = engine.AddStream();
+            ...
+            Simd::Motion::Engine::Inputs inputs;
+            inputs.push_back(Simd::Motion::Engine::Input(cam0, &frame0));
+            inputs.push_back(Simd::Motion::Engine::Input(cam1, &frame1));
+            Simd::Motion::Engine::Metadatas metadatas;
+            engine.NextFrames(inputs, metadatas);
+            \endverbatim
+        */
+        class Engine
+        {
+        public:
+            /*!
+                \short Input structure.
+
+                Describes a frame of one of the streams for Engine::NextFrames.
+            */
+            struct Input
+            {
+                size_t stream; /*!< \brief An index of the stream (returned by Engine::AddStream). */
+                const Frame * frame; /*!< \brief A pointer to input frame. */
+                Frame * output; /*!< \brief A pointer to output frame with debug annotation. Can be NULL. */
+
+                /*!
+                    Constructs Input structure.
+
+                    \param [in] s - an index of the stream.
+                    \param [in] f - a pointer to input frame.
+                    \param [in] o - a pointer to output frame with debug annotation. Can be NULL.
+                */
+                Input(size_t s, const Frame * f, Frame * o = NULL)
+                    : stream(s)
+                    , frame(f)
+                    , output(o)
+                {
+                }
+            };
+            typedef std::vector<Input> Inputs; /*!< \brief Vector of inputs. */
+            typedef std::vector<Metadata> Metadatas; /*!< \brief Vector of metadata (one per input). */
+
+            /*!
+                \short Latency structure.
+
+                Contains latency metrics of the stream (in seconds).
+            */
+            struct Latency
+            {
+                size_t frames; /*!< \brief A number of processed frames. */
+                double last; /*!< \brief A latency (time from submission in Engine::NextFrames to the end of processing) of the last frame. */
+                double average; /*!< \brief An average latency. */
+                double max; /*!< \brief A maximal latency. */
+                double processing; /*!< \brief An average time of frame processing (without waiting in the queue). */
+
+                /*!
+                    Default constructor of Latency.
+                */
+                Latency()
+                    : frames(0)
+                    , last(0)
+                    , average(0)
+                    , max(0)
+                    , processing(0)
+                {
+                }
+            };
+
+            /*!
+                Constructs Engine.
+
+                \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number.
+            */
+            Engine(ptrdiff_t threadNumber = -1)
+            {
+                ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
+                _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+            }
+
+            /*!
+                Adds new stream.
+
+                \param [in] model - a model of scene of the stream.
+                \param [in] options - options of motion detector of the stream.
+                \return an index of the new stream.
+            */
+            size_t AddStream(const Model & model = Model(), const Simd::Motion::Options & options = Simd::Motion::Options())
+            {
+                StreamPtr stream(new Stream());
+                if (_pool.size())
+                {
+                    stream->detector = _pool.back();
+                    _pool.pop_back();
+                    stream->detector->Reset();
+                }
+                else
+                    stream->detector.reset(new Detector());
+                stream->detector->SetModel(model);
+                stream->detector->SetOptions(options);
+                for (size_t i = 0; i < _streams.size(); ++i)
+                {
+                    if (!_streams[i])
+                    {
+                        _streams[i] = stream;
+                        return i;
+                    }
+                }
+                _streams.push_back(stream);
+                return _streams.size() - 1;
+            }
+
+            /*!
+                Removes the stream. Its motion detector is returned to the pool.
+
+                \param [in] stream - an index of the stream.
+                \return a result of the operation.
+            */
+            bool RemoveStream(size_t stream)
+            {
+                if (!Valid(stream))
+                    return false;
+                _pool.push_back(_streams[stream]->detector);
+                _streams[stream].reset();
+                return true;
+            }
+
+            /*!
+                Gets number of active streams.
+
+                \return number of active streams.
+            */
+            size_t StreamCount() const
+            {
+                size_t count = 0;
+                for (size_t i = 0; i < _streams.size(); ++i)
+                    count += _streams[i] ? 1 : 0;
+                return count;
+            }
+
+            /*!
+                Processes next frames of several streams. Frames of the same stream are processed in the order of inputs.
+
+                \param [in] inputs - a list of input frames.
+                \param [out] metadatas - a list of metadata (one per input).
+                \return a result of the operation.
+            */
+            bool NextFrames(const Inputs & inputs, Metadatas & metadatas)
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                typedef std::vector<size_t> Indexes;
+                std::vector<Indexes> groups;
+                std::vector<size_t> streamToGroup(_streams.size(), SIZE_MAX);
+                for (size_t i = 0; i < inputs.size(); ++i)
+                {
+                    size_t stream = inputs[i].stream;
+                    if (!Valid(stream) || inputs[i].frame == NULL)
+                        return false;
+                    if (streamToGroup[stream] == SIZE_MAX)
+                    {
+                        streamToGroup[stream] = groups.size();
+                        groups.push_back(Indexes());
+                    }
+                    groups[streamToGroup[stream]].push_back(i);
+                }
+
+                metadatas.resize(inputs.size());
+                std::vector<uint8_t> results(inputs.size(), 0);
+                double start = Now();
+                std::atomic<size_t> next(0);
+                Parallel(0, _threadNumber, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t g = next++; g < groups.size(); g = next++)
+                    {
+                        const Indexes & group = groups[g];
+                        Stream & stream = *_streams[inputs[group[0]].stream];
+                        for (size_t i = 0; i < group.size(); ++i)
+                        {
+                            const Input & input = inputs[group[i]];
+                            double begin = Now();
+                            results[group[i]] = stream.detector->NextFrame(*input.frame, metadatas[group[i]], input.output) ? 1 : 0;
+                            double end = Now();
+                            stream.Update(end - start, end - begin);
+                        }
+                    }
+                }, _threadNumber);
+
+                for (size_t i = 0; i < results.size(); ++i)
+                    if (!results[i])
+                        return false;
+                return true;
+            }
+
+            /*!
+                Gets latency metrics of the stream.
+
+                \param [in] stream - an index of the stream.
+                \return a pointer to latency metrics or NULL if stream index is wrong.
+            */
+            const Latency * GetLatency(size_t stream) const
+            {
+                return Valid(stream) ? &_streams[stream]->latency : NULL;
+            }
+
+        private:
+            typedef std::shared_ptr<Detector> DetectorPtr;
+
+            struct Stream
+            {
+                DetectorPtr detector;
+                Engine::Latency latency;
+
+                void Update(double total, double processing)
+                {
+                    latency.frames++;
+                    latency.last = total;
+                    latency.average += (total - latency.average) / latency.frames;
+                    latency.max = std::max(latency.max, total);
+                    latency.processing += (processing - latency.processing) / latency.frames;
+                }
+            };
+            typedef std::shared_ptr<Stream> StreamPtr;
+
+            std::vector<StreamPtr> _streams;
+            std::vector<DetectorPtr> _pool;
+            ptrdiff_t _threadNumber;
+
+            bool Valid(size_t stream) const
+            {
+                return stream < _streams.size() && _streams[stream];
+            }
+
+            static double Now()
+            {
+                return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            }
+        };
     }
 }
 
@@ -158,6 +158,8 @@ namespace Simd
                 FillBgr<align>(dst, stride, width, height, pixel[0], pixel[1], pixel[2]);
             else if (pixelSize == 1)
                 Base::Fill(dst, stride, width, height, 1, pixel[0]);
+            else if (pixelSize == 6 || pixelSize == 12)
+                Base::FillPixel(dst, stride, width, height, pixel, pixelSize);
             else
             {
                 uint8x16_t _pixel;
@@ -169,6 +171,12 @@ namespace Simd
                 case 4:
                     _pixel = (uint8x16_t)vdupq_n_u32(*(uint32_t*)pixel);
                     break;
+                case 8:
+                    _pixel = (uint8x16_t)vdupq_n_u64(*(uint64_t*)pixel);
+                    break;
+                case 16:
+                    _pixel = vld1q_u8(pixel);
+                    break;
                 default:
                     assert(0);
                 }
@@ -336,11 +336,13 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
-        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
+        void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags)
         {
-            BlurParam param(width, height, channels, sigma, epsilon, A);
+            BlurParam param(width, height, channels, sigma, epsilon, flags, A);
             if (!param.Valid())
                 return NULL;
+            if (param.IsRecursive())
+                return new Base::GaussianBlurRecursive(param);
             return new GaussianBlurDefault(param);
         }
 
@@ -156,6 +156,7 @@ namespace Simd
             case SimdImageFilePng: return new Base::ImagePngLoader(param);
             case SimdImageFileJpeg: return new Base::ImageJpegLoader(param);
             case SimdImageFileBmp: return new ImageBmpLoader(param);
+            case SimdImageFileQoi: return new Base::ImageQoiLoader(param);
             default:
                 return NULL;
             }
@@ -0,0 +1,128 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdOpticalFlow_h__
+#define __SimdOpticalFlow_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    const int LK_WEIGHT_BITS = 14;
+    const int LK_VALUE_SHIFT = 10;
+    const int LK_VALUE_ROUND = 1 << (LK_VALUE_SHIFT - 1);
+    const size_t LK_RADIUS_MAX = 15;
+
+    struct LkParam
+    {
+        size_t width;
+        size_t height;
+        size_t levels;
+        size_t radius;
+        size_t iterations;
+        float epsilon;
+        float minEigen;
+        size_t align;
+
+        LkParam(size_t w, size_t h, size_t l, size_t r, size_t i, float e, float m, size_t a);
+        bool Valid() const;
+    };
+
+    //-----------------------------------------------------------------------------------------
+
+    class OpticalFlowPyrLk : Deletable
+    {
+    public:
+        OpticalFlowPyrLk(const LkParam& param);
+
+        void Run(const uint8_t* const* prev, const size_t* prevStrides, const uint8_t* const* next, const size_t* nextStrides,
+            const float* prevPoints, size_t count, float* nextPoints, uint8_t* status, float* errors);
+
+        typedef void (*PreparePtr)(const uint8_t* src, size_t stride, const int16_t* weights, size_t size, size_t pStride,
+            int16_t* ext, int16_t* val, int16_t* dx, int16_t* dy, const int16_t* mask, float* gradient);
+        typedef void (*ResidualPtr)(const uint8_t* src, size_t stride, const int16_t* weights, size_t size, size_t pStride,
+            const int16_t* val, const int16_t* dx, const int16_t* dy, const int16_t* mask, float* residual);
+
+    protected:
+        LkParam _param;
+        std::vector<size_t> _widths, _heights;
+        size_t _size, _pStride, _eStride, _threads, _scratch;
+        Array16i _mask;
+        Array8u _buffer;
+        PreparePtr _prepare;
+        ResidualPtr _residual;
+
+        void Track(const uint8_t* const* prev, const size_t* prevStrides, const uint8_t* const* next, const size_t* nextStrides,
+            const float* prevPoint, float* nextPoint, uint8_t* status, float* error, uint8_t* buffer);
+    };
+
+    //-----------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        void LkPrepare(const uint8_t* src, size_t stride, const int16_t* weights, size_t size, size_t pStride,
+            int16_t* ext, int16_t* val, int16_t* dx, int16_t* dy, const int16_t* mask, float* gradient);
+
+        void LkResidual(const uint8_t* src, size_t stride, const int16_t* weights, size_t size, size_t pStride,
+            const int16_t* val, const int16_t* dx, const int16_t* dy, const int16_t* mask, float* residual);
+
+        class OpticalFlowPyrLk : public Simd::OpticalFlowPyrLk
+        {
+        public:
+            OpticalFlowPyrLk(const LkParam& param);
+        };
+
+        void* OpticalFlowPyrLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigen);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class OpticalFlowPyrLk : public Base::OpticalFlowPyrLk
+        {
+        public:
+            OpticalFlowPyrLk(const LkParam& param);
+        };
+
+        void* OpticalFlowPyrLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigen);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class OpticalFlowPyrLk : public Sse41::OpticalFlowPyrLk
+        {
+        public:
+            OpticalFlowPyrLk(const LkParam& param);
+        };
+
+        void* OpticalFlowPyrLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigen);
+    }
+#endif
+}
+
+#endif
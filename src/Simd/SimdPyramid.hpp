@@ -185,7 +185,7 @@ namespace Simd
     template <template<class> class A>
     SIMD_INLINE void Pyramid<A>::Recreate(Point<ptrdiff_t> size, size_t levelCount)
     {
-        if (_views.size() && size == _views[0].Size())
+        if (_views.size() && _views.size() == levelCount && size == _views[0].Size())
             return;
         _views.resize(levelCount);
         for (size_t level = 0; level < levelCount; ++level)
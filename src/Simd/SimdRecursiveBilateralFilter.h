@@ -87,12 +87,20 @@ namespace Simd
             return _buffer.RawSize();
         }
 
+        void SetThreadNumber(size_t threadNumber);
+
         typedef void (*FilterPtr)(const RbfParam& p, float* buf, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
 
     protected:
         RbfParam _param;
         Array8u _buffer;
         FilterPtr _hFilter, _vFilter;
+        size_t _threads, _strip, _strips;
+
+        size_t StripWidth(size_t strip) const
+        {
+            return strip == _strips - 1 ? _param.width - strip * _strip : _strip;
+        }
     };
 
     //-----------------------------------------------------------------------------------------
@@ -147,6 +155,8 @@ namespace Simd
 
         protected:
             float* GetBuffer();
+        private:
+            size_t _size;
         };
 
         class RecursiveBilateralFilterFast : public Simd::RecursiveBilateralFilter
@@ -159,7 +169,7 @@ namespace Simd
         protected:
             uint8_t* GetBuffer();
         private:
-            size_t _size, _stride;
+            size_t _size, _stride, _scratch;
         };
 
         void * RecursiveBilateralFilterInit(size_t width, size_t height, size_t channels, const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags);
@@ -0,0 +1,200 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdRemap_h__
+#define __SimdRemap_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct RemapParam
+    {
+        static const int BorderSizeMax = 4 * 1;
+
+        SimdWarpAffineFlags flags;
+        uint8_t border[BorderSizeMax];
+        size_t srcW, srcH, srcS, dstW, dstH, dstS, channels, align;
+
+        RemapParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, size_t align);
+
+        bool Valid() const
+        {
+            return channels >= 1 && channels <= 4 && srcH * srcS <= 0x100000000 && srcW < 0x7FFF && srcH < 0x7FFF;
+        }
+
+        bool IsNearest() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest;
+        }
+
+        bool IsByteBilinear() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear && (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte;
+        }
+
+        bool NeedFill() const
+        {
+            return (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant;
+        }
+
+        size_t ChannelSize() const
+        {
+            switch (SimdWarpAffineChannelMask & flags)
+            {
+            case SimdWarpAffineChannelByte: return 1;
+            default:
+                assert(0); return 0;
+            }
+        }
+
+        size_t PixelSize() const
+        {
+            return ChannelSize() * channels;
+        }
+
+        size_t RowMapSize() const
+        {
+            return AlignHi(dstW, align) + align;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class Remap : Deletable
+    {
+    public:
+        typedef void(*RunPtr)(const RemapParam& p, const int16_t* xy, const uint8_t* fxy, const uint8_t* src, uint8_t* dst, uint8_t* buf);
+
+        Remap(const RemapParam& param, bool rowMap);
+
+        virtual void Run(const uint8_t* src, uint8_t* dst);
+
+    protected:
+        virtual void GetRow(int y, uint8_t* buf, const int16_t*& xy, const uint8_t*& fxy) = 0;
+
+        RemapParam _param;
+        size_t _map, _size, _threads;
+        Array8u _buf;
+        RunPtr _run;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class RemapMap : public Remap
+        {
+        public:
+            RemapMap(const RemapParam& param, const float* map);
+
+        protected:
+            virtual void GetRow(int y, uint8_t* buf, const int16_t*& xy, const uint8_t*& fxy);
+
+            Array16i _xy;
+            Array8u _fxy;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpPerspective : public Remap
+        {
+        public:
+            WarpPerspective(const RemapParam& param, const float* mat);
+
+            bool Valid() const { return _valid; }
+
+        protected:
+            virtual void GetRow(int y, uint8_t* buf, const int16_t*& xy, const uint8_t*& fxy);
+
+            virtual void SetRow(int y, int16_t* xy, uint8_t* fxy);
+
+            float _mat[9], _inv[9];
+            bool _valid;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        class RemapMap : public Base::RemapMap
+        {
+        public:
+            RemapMap(const RemapParam& param, const float* map);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpPerspective : public Base::WarpPerspective
+        {
+        public:
+            WarpPerspective(const RemapParam& param, const float* mat);
+
+        protected:
+            virtual void SetRow(int y, int16_t* xy, uint8_t* fxy);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class RemapMap : public Sse41::RemapMap
+        {
+        public:
+            RemapMap(const RemapParam& param, const float* map);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpPerspective : public Sse41::WarpPerspective
+        {
+        public:
+            WarpPerspective(const RemapParam& param, const float* mat);
+
+        protected:
+            virtual void SetRow(int y, int16_t* xy, uint8_t* fxy);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* map, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif
+}
+#endif//__SimdRemap_h__
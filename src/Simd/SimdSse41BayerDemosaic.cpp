@@ -0,0 +1,188 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBayerDemosaic.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K32_BAYER_EVEN = SIMD_MM_SETR_EPI32(-1, 0, -1, 0);
+        const __m128i K32_BAYER_ODD = SIMD_MM_SETR_EPI32(0, -1, 0, -1);
+
+        SIMD_INLINE __m128 BayerColorMask(bool greenFirst)
+        {
+            return _mm_castsi128_ps(greenFirst ? K32_BAYER_ODD : K32_BAYER_EVEN);
+        }
+
+        SIMD_INLINE void BayerShift(const float* const* src, size_t count, size_t x, const float** dst)
+        {
+            for (size_t i = 0; i < count; ++i)
+                dst[i] = src[i] + x;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void BayerNormalizeRow(const uint8_t* src, size_t width, size_t bitDepth, float black, const float* scale, float* dst)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            __m128 _black = _mm_set1_ps(black), _scale = _mm_setr_ps(scale[0], scale[1], scale[0], scale[1]);
+            if (bitDepth > 8)
+            {
+                const uint16_t* src16 = (const uint16_t*)src;
+                __m128i mask = _mm_set1_epi32((1 << bitDepth) - 1);
+                for (; x < widthF; x += F)
+                {
+                    __m128i _src = _mm_and_si128(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)(src16 + x))), mask);
+                    _mm_storeu_ps(dst + x, _mm_mul_ps(_mm_max_ps(_mm_sub_ps(_mm_cvtepi32_ps(_src), _black), _mm_setzero_ps()), _scale));
+                }
+            }
+            else
+            {
+                for (; x < widthF; x += F)
+                {
+                    __m128i _src = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)(src + x)));
+                    _mm_storeu_ps(dst + x, _mm_mul_ps(_mm_max_ps(_mm_sub_ps(_mm_cvtepi32_ps(_src), _black), _mm_setzero_ps()), _scale));
+                }
+            }
+            if (x < width)
+                Base::BayerNormalizeRow(src + x * (bitDepth > 8 ? 2 : 1), width - x, bitDepth, black, scale, dst + x);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void BayerMalvarRow(const float* const* src, size_t width, bool greenFirst, float* c, float* g, float* o)
+        {
+            const float* s0 = src[0], * s1 = src[1], * s2 = src[2], * s3 = src[3], * s4 = src[4];
+            __m128 mask = BayerColorMask(greenFirst);
+            __m128 k0125 = _mm_set1_ps(0.125f), k025 = _mm_set1_ps(0.25f), k05 = _mm_set1_ps(0.5f);
+            __m128 k00625 = _mm_set1_ps(0.0625f), k01875 = _mm_set1_ps(0.1875f), k0625 = _mm_set1_ps(0.625f), k075 = _mm_set1_ps(0.75f);
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+            {
+                __m128 _c = _mm_loadu_ps(s2 + x);
+                __m128 h1 = _mm_add_ps(_mm_loadu_ps(s2 + x - 1), _mm_loadu_ps(s2 + x + 1));
+                __m128 h2 = _mm_add_ps(_mm_loadu_ps(s2 + x - 2), _mm_loadu_ps(s2 + x + 2));
+                __m128 v1 = _mm_add_ps(_mm_loadu_ps(s1 + x), _mm_loadu_ps(s3 + x));
+                __m128 v2 = _mm_add_ps(_mm_loadu_ps(s0 + x), _mm_loadu_ps(s4 + x));
+                __m128 d = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(s1 + x - 1), _mm_loadu_ps(s1 + x + 1)),
+                    _mm_add_ps(_mm_loadu_ps(s3 + x - 1), _mm_loadu_ps(s3 + x + 1)));
+                __m128 hv2 = _mm_add_ps(h2, v2);
+                __m128 gAtC = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(_c, k05), _mm_mul_ps(_mm_add_ps(h1, v1), k025)), _mm_mul_ps(hv2, k0125));
+                __m128 oAtC = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(_c, k075), _mm_mul_ps(d, k025)), _mm_mul_ps(hv2, k01875));
+                __m128 cAtG = _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(_c, k0625), _mm_mul_ps(h1, k05)),
+                    _mm_mul_ps(_mm_add_ps(h2, d), k0125)), _mm_mul_ps(v2, k00625));
+                __m128 oAtG = _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(_c, k0625), _mm_mul_ps(v1, k05)),
+                    _mm_mul_ps(_mm_add_ps(v2, d), k0125)), _mm_mul_ps(h2, k00625));
+                _mm_storeu_ps(c + x, _mm_blendv_ps(cAtG, _c, mask));
+                _mm_storeu_ps(g + x, _mm_blendv_ps(_c, gAtC, mask));
+                _mm_storeu_ps(o + x, _mm_blendv_ps(oAtG, oAtC, mask));
+            }
+            if (x < width)
+            {
+                const float* tail[5];
+                BayerShift(src, 5, x, tail);
+                Base::BayerMalvarRow(tail, width - x, greenFirst, c + x, g + x, o + x);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void BayerGreenRow(const float* const* src, size_t width, bool greenFirst, float* g)
+        {
+            const float* s0 = src[0], * s1 = src[1], * s2 = src[2], * s3 = src[3], * s4 = src[4];
+            __m128 mask = BayerColorMask(greenFirst);
+            __m128 k025 = _mm_set1_ps(0.25f), k05 = _mm_set1_ps(0.5f), k2 = _mm_set1_ps(2.0f);
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+            {
+                __m128 _c = _mm_loadu_ps(s2 + x), c2 = _mm_mul_ps(_c, k2);
+                __m128 l = _mm_loadu_ps(s2 + x - 1), r = _mm_loadu_ps(s2 + x + 1);
+                __m128 t = _mm_loadu_ps(s1 + x), b = _mm_loadu_ps(s3 + x);
+                __m128 lh = _mm_sub_ps(c2, _mm_add_ps(_mm_loadu_ps(s2 + x - 2), _mm_loadu_ps(s2 + x + 2)));
+                __m128 lv = _mm_sub_ps(c2, _mm_add_ps(_mm_loadu_ps(s0 + x), _mm_loadu_ps(s4 + x)));
+                __m128 gh = _mm_add_ps(_mm_mul_ps(_mm_add_ps(l, r), k05), _mm_mul_ps(lh, k025));
+                __m128 gv = _mm_add_ps(_mm_mul_ps(_mm_add_ps(t, b), k05), _mm_mul_ps(lv, k025));
+                __m128 dh = _mm_add_ps(Abs(_mm_sub_ps(l, r)), Abs(lh));
+                __m128 dv = _mm_add_ps(Abs(_mm_sub_ps(t, b)), Abs(lv));
+                __m128 _g = _mm_mul_ps(_mm_add_ps(gh, gv), k05);
+                _g = _mm_blendv_ps(_g, gv, _mm_cmplt_ps(dv, dh));
+                _g = _mm_blendv_ps(_g, gh, _mm_cmplt_ps(dh, dv));
+                _mm_storeu_ps(g + x, _mm_blendv_ps(_c, _g, mask));
+            }
+            if (x < width)
+            {
+                const float* tail[5];
+                BayerShift(src, 5, x, tail);
+                Base::BayerGreenRow(tail, width - x, greenFirst, g + x);
+            }
+        }
+
+        void BayerChromaRow(const float* const* src, const float* const* green, size_t width, bool greenFirst, float* c, float* o)
+        {
+            const float* s0 = src[0], * s1 = src[1], * s2 = src[2];
+            const float* g0 = green[0], * g1 = green[1], * g2 = green[2];
+            __m128 mask = BayerColorMask(greenFirst);
+            __m128 k025 = _mm_set1_ps(0.25f), k05 = _mm_set1_ps(0.5f);
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+            {
+                __m128 _g = _mm_loadu_ps(g1 + x);
+                __m128 d0l = _mm_sub_ps(_mm_loadu_ps(s0 + x - 1), _mm_loadu_ps(g0 + x - 1));
+                __m128 d0r = _mm_sub_ps(_mm_loadu_ps(s0 + x + 1), _mm_loadu_ps(g0 + x + 1));
+                __m128 d2l = _mm_sub_ps(_mm_loadu_ps(s2 + x - 1), _mm_loadu_ps(g2 + x - 1));
+                __m128 d2r = _mm_sub_ps(_mm_loadu_ps(s2 + x + 1), _mm_loadu_ps(g2 + x + 1));
+                __m128 d1l = _mm_sub_ps(_mm_loadu_ps(s1 + x - 1), _mm_loadu_ps(g1 + x - 1));
+                __m128 d1r = _mm_sub_ps(_mm_loadu_ps(s1 + x + 1), _mm_loadu_ps(g1 + x + 1));
+                __m128 d0 = _mm_sub_ps(_mm_loadu_ps(s0 + x), _mm_loadu_ps(g0 + x));
+                __m128 d2 = _mm_sub_ps(_mm_loadu_ps(s2 + x), _mm_loadu_ps(g2 + x));
+                __m128 oAtC = _mm_add_ps(_g, _mm_mul_ps(_mm_add_ps(_mm_add_ps(d0l, d0r), _mm_add_ps(d2l, d2r)), k025));
+                __m128 cAtG = _mm_add_ps(_g, _mm_mul_ps(_mm_add_ps(d1l, d1r), k05));
+                __m128 oAtG = _mm_add_ps(_g, _mm_mul_ps(_mm_add_ps(d0, d2), k05));
+                _mm_storeu_ps(c + x, _mm_blendv_ps(cAtG, _mm_loadu_ps(s1 + x), mask));
+                _mm_storeu_ps(o + x, _mm_blendv_ps(oAtG, oAtC, mask));
+            }
+            if (x < width)
+            {
+                const float* tail[3], * tailGreen[3];
+                BayerShift(src, 3, x, tail);
+                BayerShift(green, 3, x, tailGreen);
+                Base::BayerChromaRow(tail, tailGreen, width - x, greenFirst, c + x, o + x);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void BayerDemosaic(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height, SimdPixelFormatType bayerFormat, size_t bitDepth,
+            size_t blackLevel, const float* gains, SimdBayerDemosaicType method, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat)
+        {
+            Base::BayerDemosaicApply(bayer, bayerStride, width, height, bayerFormat, bitDepth, blackLevel, gains, method, dst, dstStride, dstFormat,
+                BayerNormalizeRow, BayerMalvarRow, BayerGreenRow, BayerChromaRow, FloatToUint8Row);
+        }
+    }
+#endif
+}
@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdStore.h"
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdDeinterleave.h"
 
 namespace Simd
 {
@@ -143,6 +145,81 @@ namespace Simd
             else
                 RgbToGray<false>(rgb, width, height, rgbStride, gray, grayStride);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128i BgrToGray32i(__m128i blue, __m128i green, __m128i red)
+        {
+            __m128i sum = _mm_add_epi32(_mm_mullo_epi32(blue, _mm_set1_epi32(Base::BLUE_TO_GRAY_WEIGHT)), _mm_mullo_epi32(green, _mm_set1_epi32(Base::GREEN_TO_GRAY_WEIGHT)));
+            sum = _mm_add_epi32(sum, _mm_mullo_epi32(red, _mm_set1_epi32(Base::RED_TO_GRAY_WEIGHT)));
+            return _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(Base::BGR_TO_GRAY_ROUND_TERM)), Base::BGR_TO_GRAY_AVERAGING_SHIFT);
+        }
+
+        template<size_t C> SIMD_INLINE void BgrToGray16u(const uint8_t* bgr, uint8_t* gray)
+        {
+            __m128i bgra[C];
+            LoadDeinterleave16u<C>(bgr, bgra);
+            __m128i lo = BgrToGray32i(_mm_unpacklo_epi16(bgra[0], K_ZERO), _mm_unpacklo_epi16(bgra[1], K_ZERO), _mm_unpacklo_epi16(bgra[2], K_ZERO));
+            __m128i hi = BgrToGray32i(_mm_unpackhi_epi16(bgra[0], K_ZERO), _mm_unpackhi_epi16(bgra[1], K_ZERO), _mm_unpackhi_epi16(bgra[2], K_ZERO));
+            _mm_storeu_si128((__m128i*)gray, _mm_packus_epi32(lo, hi));
+        }
+
+        template<size_t C> void BgrToGray16u(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* gray, size_t grayStride)
+        {
+            assert(width >= HA);
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthHA; col += HA)
+                    BgrToGray16u<C>(bgr + col * 2 * C, gray + col * 2);
+                if (widthHA < width)
+                    BgrToGray16u<C>(bgr + (width - HA) * 2 * C, gray + (width - HA) * 2);
+                bgr += bgrStride;
+                gray += grayStride;
+            }
+        }
+
+        void BgrToGray16u(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t* gray, size_t grayStride)
+        {
+            assert(channels == 3 || channels == 4);
+            if (channels == 3)
+                BgrToGray16u<3>(bgr, bgrStride, width, height, gray, grayStride);
+            else
+                BgrToGray16u<4>(bgr, bgrStride, width, height, gray, grayStride);
+        }
+
+        template<size_t C> SIMD_INLINE void BgrToGray32f(const uint8_t* bgr, uint8_t* gray)
+        {
+            __m128i bgra[C];
+            LoadDeinterleave32f<C>(bgr, bgra);
+            __m128 sum = _mm_add_ps(_mm_mul_ps(_mm_castsi128_ps(bgra[0]), _mm_set1_ps(Base::BLUE_TO_GRAY_WEIGHT_32F)),
+                _mm_mul_ps(_mm_castsi128_ps(bgra[1]), _mm_set1_ps(Base::GREEN_TO_GRAY_WEIGHT_32F)));
+            _mm_storeu_ps((float*)gray, _mm_add_ps(sum, _mm_mul_ps(_mm_castsi128_ps(bgra[2]), _mm_set1_ps(Base::RED_TO_GRAY_WEIGHT_32F))));
+        }
+
+        template<size_t C> void BgrToGray32f(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* gray, size_t grayStride)
+        {
+            assert(width >= F);
+            size_t widthF = AlignLo(width, F);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    BgrToGray32f<C>(bgr + col * 4 * C, gray + col * 4);
+                if (widthF < width)
+                    BgrToGray32f<C>(bgr + (width - F) * 4 * C, gray + (width - F) * 4);
+                bgr += bgrStride;
+                gray += grayStride;
+            }
+        }
+
+        void BgrToGray32f(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t* gray, size_t grayStride)
+        {
+            assert(channels == 3 || channels == 4);
+            if (channels == 3)
+                BgrToGray32f<3>(bgr, bgrStride, width, height, gray, grayStride);
+            else
+                BgrToGray32f<4>(bgr, bgrStride, width, height, gray, grayStride);
+        }
     }
 #endif
 }
@@ -0,0 +1,184 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdColorPipeline.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K8_SHUFFLE_CP_BGR_TO_BGRA = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, -1, 0x3, 0x4, 0x5, -1, 0x6, 0x7, 0x8, -1, 0x9, 0xA, 0xB, -1);
+        const __m128i K8_SHUFFLE_CP_BGRA_TO_BGR = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+        SIMD_INLINE __m128 Gather(const float* tab, __m128i idx)
+        {
+            return _mm_setr_ps(tab[_mm_extract_epi32(idx, 0)], tab[_mm_extract_epi32(idx, 1)], tab[_mm_extract_epi32(idx, 2)], tab[_mm_extract_epi32(idx, 3)]);
+        }
+
+        SIMD_INLINE __m128i Gather(const int32_t* tab, __m128i idx)
+        {
+            return _mm_setr_epi32(tab[_mm_extract_epi32(idx, 0)], tab[_mm_extract_epi32(idx, 1)], tab[_mm_extract_epi32(idx, 2)], tab[_mm_extract_epi32(idx, 3)]);
+        }
+
+        SIMD_INLINE __m128 Clamp(__m128 value)
+        {
+            return _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+        }
+
+        SIMD_INLINE __m128 Curve(const float* curve, __m128 scale, __m128i last, __m128 value)
+        {
+            __m128 s = _mm_mul_ps(Clamp(value), scale);
+            __m128i i = _mm_min_epi32(_mm_cvttps_epi32(s), last);
+            __m128 f = _mm_sub_ps(s, _mm_cvtepi32_ps(i));
+            __m128 c0 = Gather(curve, i), c1 = Gather(curve + 1, i);
+            return _mm_add_ps(c0, _mm_mul_ps(_mm_sub_ps(c1, c0), f));
+        }
+
+        SIMD_INLINE __m128 Interpolate(__m128 v0, __m128 v1, __m128 v2, __m128 v3, __m128 w0, __m128 w1, __m128 w2, __m128 w3)
+        {
+            return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(v0, w0), _mm_mul_ps(v1, w1)), _mm_mul_ps(v2, w2)), _mm_mul_ps(v3, w3));
+        }
+
+        template<bool lut16u> SIMD_INLINE void Lut(const ColorPipelineParam& p, const ColorPipelineTables& t, __m128 v[3])
+        {
+            __m128 k = _mm_set1_ps(float(p.lutSize - 1));
+            __m128i last = _mm_set1_epi32(int(p.lutSize) - 2);
+            __m128i o0 = _mm_set1_epi32(t.offset[0]), o1 = _mm_set1_epi32(t.offset[1]), o2 = _mm_set1_epi32(t.offset[2]);
+            __m128 s0 = _mm_mul_ps(Clamp(v[0]), k), s1 = _mm_mul_ps(Clamp(v[1]), k), s2 = _mm_mul_ps(Clamp(v[2]), k);
+            __m128i i0 = _mm_min_epi32(_mm_cvttps_epi32(s0), last);
+            __m128i i1 = _mm_min_epi32(_mm_cvttps_epi32(s1), last);
+            __m128i i2 = _mm_min_epi32(_mm_cvttps_epi32(s2), last);
+            __m128 f0 = _mm_sub_ps(s0, _mm_cvtepi32_ps(i0)), f1 = _mm_sub_ps(s1, _mm_cvtepi32_ps(i1)), f2 = _mm_sub_ps(s2, _mm_cvtepi32_ps(i2));
+            __m128i base = _mm_add_epi32(_mm_add_epi32(_mm_mullo_epi32(i0, o0), _mm_mullo_epi32(i1, o1)), _mm_mullo_epi32(i2, o2));
+            __m128 maxIs0 = _mm_and_ps(_mm_cmpge_ps(f0, f1), _mm_cmpge_ps(f0, f2)), maxIs1 = _mm_cmpge_ps(f1, f2);
+            __m128 minIs2 = _mm_and_ps(_mm_cmple_ps(f2, f0), _mm_cmple_ps(f2, f1)), minIs1 = _mm_cmple_ps(f1, f0);
+            __m128i oMax = _mm_blendv_epi8(_mm_blendv_epi8(o2, o1, _mm_castps_si128(maxIs1)), o0, _mm_castps_si128(maxIs0));
+            __m128i oMin = _mm_blendv_epi8(_mm_blendv_epi8(o0, o1, _mm_castps_si128(minIs1)), o2, _mm_castps_si128(minIs2));
+            __m128i oAll = _mm_add_epi32(_mm_add_epi32(o0, o1), o2);
+            __m128 fMax = _mm_max_ps(f0, _mm_max_ps(f1, f2));
+            __m128 fMin = _mm_min_ps(f0, _mm_min_ps(f1, f2));
+            __m128 fMid = _mm_max_ps(_mm_min_ps(f0, f1), _mm_min_ps(_mm_max_ps(f0, f1), f2));
+            __m128 w0 = _mm_sub_ps(_mm_set1_ps(1.0f), fMax), w1 = _mm_sub_ps(fMax, fMid), w2 = _mm_sub_ps(fMid, fMin), w3 = fMin;
+            __m128i n0 = base, n1 = _mm_add_epi32(base, oMax), n3 = _mm_add_epi32(base, oAll), n2 = _mm_sub_epi32(n3, oMin);
+            if (lut16u)
+            {
+                const int32_t* lut = (const int32_t*)t.lut16u.data;
+                n0 = _mm_slli_epi32(n0, 1), n1 = _mm_slli_epi32(n1, 1), n2 = _mm_slli_epi32(n2, 1), n3 = _mm_slli_epi32(n3, 1);
+                __m128i a0 = Gather(lut, n0), a1 = Gather(lut, n1), a2 = Gather(lut, n2), a3 = Gather(lut, n3);
+                __m128i b0 = Gather(lut + 1, n0), b1 = Gather(lut + 1, n1), b2 = Gather(lut + 1, n2), b3 = Gather(lut + 1, n3);
+                __m128i lo = _mm_set1_epi32(0xFFFF);
+                __m128 scale = _mm_set1_ps(1.0f / 65535.0f);
+                v[0] = _mm_mul_ps(Interpolate(_mm_cvtepi32_ps(_mm_and_si128(a0, lo)), _mm_cvtepi32_ps(_mm_and_si128(a1, lo)),
+                    _mm_cvtepi32_ps(_mm_and_si128(a2, lo)), _mm_cvtepi32_ps(_mm_and_si128(a3, lo)), w0, w1, w2, w3), scale);
+                v[1] = _mm_mul_ps(Interpolate(_mm_cvtepi32_ps(_mm_srli_epi32(a0, 16)), _mm_cvtepi32_ps(_mm_srli_epi32(a1, 16)),
+                    _mm_cvtepi32_ps(_mm_srli_epi32(a2, 16)), _mm_cvtepi32_ps(_mm_srli_epi32(a3, 16)), w0, w1, w2, w3), scale);
+                v[2] = _mm_mul_ps(Interpolate(_mm_cvtepi32_ps(_mm_and_si128(b0, lo)), _mm_cvtepi32_ps(_mm_and_si128(b1, lo)),
+                    _mm_cvtepi32_ps(_mm_and_si128(b2, lo)), _mm_cvtepi32_ps(_mm_and_si128(b3, lo)), w0, w1, w2, w3), scale);
+            }
+            else
+            {
+                const float* lut = t.lut32f.data;
+                n0 = _mm_slli_epi32(n0, 2), n1 = _mm_slli_epi32(n1, 2), n2 = _mm_slli_epi32(n2, 2), n3 = _mm_slli_epi32(n3, 2);
+                for (size_t c = 0; c < 3; ++c)
+                    v[c] = Interpolate(Gather(lut + c, n0), Gather(lut + c, n1), Gather(lut + c, n2), Gather(lut + c, n3), w0, w1, w2, w3);
+            }
+        }
+
+        template<size_t N, bool lut16u> void ColorPipelineRow(const ColorPipelineParam& p, const ColorPipelineTables& t, const uint8_t* src, size_t width, uint8_t* dst)
+        {
+            const float* in0 = t.input.data, * in1 = in0 + 256, * in2 = in1 + 256, * m = t.matrix;
+            size_t widthF = N == 4 ? AlignLo(width, F) : AlignLo(width > 2 ? width - 2 : 0, F), x = 0;
+            __m128i byte = _mm_set1_epi32(0xFF), alpha = _mm_set1_epi32(0xFF000000);
+            __m128 k255 = _mm_set1_ps(255.0f), curveScale = _mm_set1_ps(float(p.curveSize - 1));
+            __m128i curveLast = _mm_set1_epi32(int(p.curveSize) - 2);
+            for (; x < widthF; x += F)
+            {
+                __m128i px = _mm_loadu_si128((__m128i*)(src + x * N));
+                if (N == 3)
+                    px = _mm_shuffle_epi8(px, K8_SHUFFLE_CP_BGR_TO_BGRA);
+                __m128 v[3];
+                v[0] = Gather(in0, _mm_and_si128(px, byte));
+                v[1] = Gather(in1, _mm_and_si128(_mm_srli_epi32(px, 8), byte));
+                v[2] = Gather(in2, _mm_and_si128(_mm_srli_epi32(px, 16), byte));
+                if (p.matrix)
+                {
+                    __m128 v0 = Clamp(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0]), v[0]), _mm_mul_ps(_mm_set1_ps(m[1]), v[1])), _mm_mul_ps(_mm_set1_ps(m[2]), v[2])));
+                    __m128 v1 = Clamp(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[3]), v[0]), _mm_mul_ps(_mm_set1_ps(m[4]), v[1])), _mm_mul_ps(_mm_set1_ps(m[5]), v[2])));
+                    __m128 v2 = Clamp(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[6]), v[0]), _mm_mul_ps(_mm_set1_ps(m[7]), v[1])), _mm_mul_ps(_mm_set1_ps(m[8]), v[2])));
+                    v[0] = v0, v[1] = v1, v[2] = v2;
+                }
+                if (p.CurvesAfterMatrix())
+                {
+                    for (size_t c = 0; c < 3; ++c)
+                        v[c] = Curve(t.curves.data + c * p.curveSize, curveScale, curveLast, v[c]);
+                }
+                if (p.lut)
+                    Lut<lut16u>(p, t, v);
+                __m128i d0 = _mm_cvtps_epi32(_mm_mul_ps(Clamp(v[0]), k255));
+                __m128i d1 = _mm_cvtps_epi32(_mm_mul_ps(Clamp(v[1]), k255));
+                __m128i d2 = _mm_cvtps_epi32(_mm_mul_ps(Clamp(v[2]), k255));
+                __m128i out = _mm_or_si128(_mm_or_si128(d0, _mm_slli_epi32(d1, 8)), _mm_slli_epi32(d2, 16));
+                if (N == 4)
+                    _mm_storeu_si128((__m128i*)(dst + x * N), _mm_or_si128(out, _mm_and_si128(px, alpha)));
+                else
+                {
+                    out = _mm_shuffle_epi8(out, K8_SHUFFLE_CP_BGRA_TO_BGR);
+                    _mm_storel_epi64((__m128i*)(dst + x * N), out);
+                    *(int32_t*)(dst + x * N + 8) = _mm_extract_epi32(out, 2);
+                }
+            }
+            if (x < width)
+                Base::ColorPipelineRow(p, t, src + x * N, width - x, dst + x * N);
+        }
+
+        void ColorPipelineRow(const ColorPipelineParam& p, const ColorPipelineTables& t, const uint8_t* src, size_t width, uint8_t* dst)
+        {
+            if (p.channels == 4)
+                p.Lut16u() ? ColorPipelineRow<4, true>(p, t, src, width, dst) : ColorPipelineRow<4, false>(p, t, src, width, dst);
+            else
+                p.Lut16u() ? ColorPipelineRow<3, true>(p, t, src, width, dst) : ColorPipelineRow<3, false>(p, t, src, width, dst);
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        ColorPipeline::ColorPipeline(const ColorPipelineParam& param, const float* matrix, const float* curves, const float* lut)
+            : Base::ColorPipeline(param, matrix, curves, lut)
+        {
+            _row = ColorPipelineRow;
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        void* ColorPipelineInit(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags)
+        {
+            ColorPipelineParam param(format, matrix, curves, curveSize, lut, lutSize, flags);
+            if (!param.Valid())
+                return NULL;
+            return new ColorPipeline(param, matrix, curves, lut);
+        }
+    }
+#endif
+}
@@ -59,6 +59,7 @@ namespace Simd
         ImagePgmBinLoader::ImagePgmBinLoader(const ImageLoaderParam& param)
             : Base::ImagePgmBinLoader(param)
         {
+            _be16uToAny = Sse41::Be16uToAny;
         }
 
         void ImagePgmBinLoader::SetConverters()
@@ -105,6 +106,7 @@ namespace Simd
         ImagePpmBinLoader::ImagePpmBinLoader(const ImageLoaderParam& param)
             : Base::ImagePpmBinLoader(param)
         {
+            _be16uToAny = Sse41::Be16uToAny;
         }
 
         void ImagePpmBinLoader::SetConverters()
@@ -150,6 +152,29 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : Base::ImageQoiLoader(param)
+        {
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            Base::ImageQoiLoader::SetConverters();
+            if (_image.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toAny = Sse41::RgbaToGray; break;
+                case SimdPixelFormatBgr24: _toAny = Sse41::BgraToRgb; break;
+                case SimdPixelFormatBgra32: _toAny = Sse41::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toAny = Sse41::BgraToBgr; break;
+                default: break;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         ImageLoader* CreateImageLoader(const ImageLoaderParam& param)
         {
             switch (param.file)
@@ -161,6 +186,7 @@ namespace Simd
             case SimdImageFilePng: return new ImagePngLoader(param);
             case SimdImageFileJpeg: return new ImageJpegLoader(param);
             case SimdImageFileBmp: return new ImageBmpLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
             default:
                 return NULL;
             }
@@ -25,7 +25,8 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
-#include "Simd/SimdSse41.h"
+#include "Simd/SimdSse41.h"
+#include "Simd/SimdBe16u.h"
 
 namespace Simd
 {
@@ -1717,10 +1718,13 @@ namespace Simd
         {
             if (_param.format == SimdPixelFormatNone)
                 _param.format = SimdPixelFormatRgb24;
+            _be16uToAny = Sse41::Be16uToAny;
         }
 
         bool ImagePngLoader::FromStream()
         {
+            if (Base::Channels16u(_param.format))
+                return Base::ImagePngLoader::FromStream();
             const int req_comp = 4;
             int x, y, comp;
             png__context s;
@@ -54,6 +54,7 @@ namespace Simd
         ImagePgmBinSaver::ImagePgmBinSaver(const ImageSaverParam& param)
             : Base::ImagePgmBinSaver(param)
         {
+            _anyToBe16u = Sse41::AnyToBe16u;
             if (_param.width >= A)
             {
                 switch (_param.format)
@@ -90,6 +91,7 @@ namespace Simd
         ImagePpmBinSaver::ImagePpmBinSaver(const ImageSaverParam& param)
             : Base::ImagePpmBinSaver(param)
         {
+            _anyToBe16u = Sse41::AnyToBe16u;
             if (_param.width >= A)
             {
                 switch (_param.format)
@@ -130,6 +132,7 @@ namespace Simd
             case SimdImageFilePng: return new ImagePngSaver(param);
             case SimdImageFileJpeg: return new ImageJpegSaver(param);
             case SimdImageFileBmp: return new ImageBmpSaver(param);
+            case SimdImageFileQoi: return new ImageQoiSaver(param);
             default:
                 return NULL;
             }
@@ -365,6 +365,7 @@ namespace Simd
             _encode[5] = Sse41::EncodeLine5;
             _encode[6] = Sse41::EncodeLine6;
             _compress = Sse41::ZlibCompress;
+            _anyToBe16u = Sse41::AnyToBe16u;
         }
     }
 #endif// SIMD_SSE41_ENABLE
@@ -0,0 +1,107 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{        
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K8_QOI_HASH = SIMD_MM_SET1_EPI32(0x0B070503);
+        const __m128i K16_QOI_MASK = SIMD_MM_SET1_EPI16(0x003F);
+
+        SIMD_INLINE __m128i QoiHash4(const uint8_t* rgba)
+        {
+            return _mm_madd_epi16(_mm_maddubs_epi16(_mm_loadu_si128((__m128i*)rgba), K8_QOI_HASH), K16_0001);
+        }
+
+        SIMD_INLINE void QoiHash(const uint8_t* rgba, size_t size, uint8_t* hash)
+        {
+            size_t size16 = AlignLo(size, 16), i = 0;
+            for (; i < size16; i += 16, rgba += 64)
+            {
+                __m128i lo = _mm_and_si128(_mm_packs_epi32(QoiHash4(rgba + 0), QoiHash4(rgba + 16)), K16_QOI_MASK);
+                __m128i hi = _mm_and_si128(_mm_packs_epi32(QoiHash4(rgba + 32), QoiHash4(rgba + 48)), K16_QOI_MASK);
+                _mm_storeu_si128((__m128i*)(hash + i), _mm_packus_epi16(lo, hi));
+            }
+            for (; i < size; ++i, rgba += 4)
+                hash[i] = (uint8_t)Base::QoiHash(*(uint32_t*)rgba);
+        }
+
+        uint8_t* QoiEncode(const uint8_t* rgba, size_t size, QoiState& state, uint8_t* dst)
+        {
+            const size_t BLOCK = 256;
+            uint8_t hash[BLOCK];
+            for (size_t blk = 0; blk < size; blk += BLOCK)
+            {
+                size_t n = Simd::Min(size - blk, BLOCK);
+                const uint32_t* src = (const uint32_t*)rgba + blk;
+                QoiHash(rgba + blk * 4, n, hash);
+                for (size_t i = 0; i < n;)
+                {
+                    uint32_t px = src[i];
+                    if (px == state.prev)
+                    {
+                        __m128i _px = _mm_set1_epi32(px);
+                        size_t j = i + 1;
+                        for (; j + 4 <= n; j += 4)
+                            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_loadu_si128((__m128i*)(src + j)), _px)) != 0xFFFF)
+                                break;
+                        for (; j < n && src[j] == px; ++j);
+                        state.run += j - i;
+                        dst = Base::QoiEncodeRun(state, dst);
+                        i = j;
+                    }
+                    else
+                        dst = Base::QoiEncodePixel(px, hash[i++], state, dst);
+                }
+            }
+            return dst;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : Base::ImageQoiSaver(param)
+        {
+            _encode = Sse41::QoiEncode;
+            if (_param.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toBgra = Sse41::GrayToBgra; break;
+                case SimdPixelFormatBgr24: _toBgra = Sse41::RgbToBgra; break;
+                case SimdPixelFormatBgra32: _convert = Sse41::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toBgra = Sse41::BgrToBgra; break;
+                default: break;
+                }
+            }
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
@@ -0,0 +1,115 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdIntegral.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<bool square> SIMD_INLINE __m128i IntegralPrefix(const uint8_t* src, __m128i& carry)
+        {
+            __m128i value = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src));
+            if (square)
+                value = _mm_mullo_epi32(value, value);
+            value = _mm_add_epi32(value, _mm_slli_si128(value, 4));
+            value = _mm_add_epi32(value, _mm_slli_si128(value, 8));
+            value = _mm_add_epi32(value, carry);
+            carry = _mm_shuffle_epi32(value, 0xFF);
+            return value;
+        }
+
+        template<class T> SIMD_INLINE void IntegralStore(const T* prev, __m128i sum, T* dst);
+
+        template<> SIMD_INLINE void IntegralStore(const uint32_t* prev, __m128i sum, uint32_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst, _mm_add_epi32(sum, _mm_loadu_si128((__m128i*)prev)));
+        }
+
+        template<> SIMD_INLINE void IntegralStore(const uint64_t* prev, __m128i sum, uint64_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_add_epi64(_mm_cvtepu32_epi64(sum), _mm_loadu_si128((__m128i*)prev + 0)));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_add_epi64(_mm_cvtepu32_epi64(_mm_srli_si128(sum, 8)), _mm_loadu_si128((__m128i*)prev + 1)));
+        }
+
+        template<> SIMD_INLINE void IntegralStore(const float* prev, __m128i sum, float* dst)
+        {
+            _mm_storeu_ps(dst, _mm_add_ps(_mm_cvtepi32_ps(sum), _mm_loadu_ps(prev)));
+        }
+
+        template<> SIMD_INLINE void IntegralStore(const double* prev, __m128i sum, double* dst)
+        {
+            _mm_storeu_pd(dst + 0, _mm_add_pd(_mm_cvtepi32_pd(sum), _mm_loadu_pd(prev + 0)));
+            _mm_storeu_pd(dst + 2, _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(sum, 8)), _mm_loadu_pd(prev + 2)));
+        }
+
+        template<class T, bool square> void IntegralRow(const uint8_t* src, size_t width, const uint8_t* prev, uint8_t* dst)
+        {
+            const T* p = (const T*)prev + 1;
+            T* d = (T*)dst;
+            size_t width4 = AlignLo(width, 4), col = 0;
+            __m128i carry = _mm_setzero_si128();
+            d[0] = 0, d += 1;
+            for (; col < width4; col += 4)
+                IntegralStore<T>(p + col, IntegralPrefix<square>(src + col, carry), d + col);
+            uint32_t rowSum = _mm_cvtsi128_si32(carry);
+            for (; col < width; ++col)
+            {
+                uint32_t value = src[col];
+                rowSum += square ? value * value : value;
+                d[col] = p[col] + T(rowSum);
+            }
+        }
+
+        Base::IntegralRowPtr GetIntegralRow(SimdPixelFormatType format, bool square, size_t width)
+        {
+            if (width > INTEGRAL_WIDTH_MAX)
+                return Base::GetIntegralRow(format, square);
+            switch (format)
+            {
+            case SimdPixelFormatInt32: return square ? IntegralRow<uint32_t, true> : IntegralRow<uint32_t, false>;
+            case SimdPixelFormatInt64: return square ? IntegralRow<uint64_t, true> : IntegralRow<uint64_t, false>;
+            case SimdPixelFormatFloat: return square ? IntegralRow<float, true> : IntegralRow<float, false>;
+            case SimdPixelFormatDouble: return square ? IntegralRow<double, true> : IntegralRow<double, false>;
+            default: assert(0); return NULL;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Integral(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            uint8_t* sum, size_t sumStride, uint8_t* sqsum, size_t sqsumStride, uint8_t* tilted, size_t tiltedStride,
+            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+        {
+            if (tilted)
+                IntegralTilted(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+            else
+                Base::IntegralParallel(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, sumFormat, sqsumFormat,
+                    GetIntegralRow(sumFormat, false, width), sqsum ? GetIntegralRow(sqsumFormat, true, width) : NULL);
+        }
+    }
+#endif
+}
@@ -25,6 +25,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -654,6 +655,105 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void MedianAdd16(const uint16_t* src, uint16_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_add_epi16(_mm_loadu_si128((__m128i*)dst + 0), _mm_loadu_si128((__m128i*)src + 0)));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_add_epi16(_mm_loadu_si128((__m128i*)dst + 1), _mm_loadu_si128((__m128i*)src + 1)));
+        }
+
+        SIMD_INLINE void MedianSub16(const uint16_t* src, uint16_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_sub_epi16(_mm_loadu_si128((__m128i*)dst + 0), _mm_loadu_si128((__m128i*)src + 0)));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_sub_epi16(_mm_loadu_si128((__m128i*)dst + 1), _mm_loadu_si128((__m128i*)src + 1)));
+        }
+
+        SIMD_INLINE void MedianAddSub16(const uint16_t* add, const uint16_t* sub, uint16_t* dst)
+        {
+            __m128i d0 = _mm_add_epi16(_mm_loadu_si128((__m128i*)dst + 0), _mm_loadu_si128((__m128i*)add + 0));
+            __m128i d1 = _mm_add_epi16(_mm_loadu_si128((__m128i*)dst + 1), _mm_loadu_si128((__m128i*)add + 1));
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_sub_epi16(d0, _mm_loadu_si128((__m128i*)sub + 0)));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_sub_epi16(d1, _mm_loadu_si128((__m128i*)sub + 1)));
+        }
+
+        SIMD_INLINE size_t MedianFind16(const uint16_t* hist, size_t rank, size_t& sum)
+        {
+            return MedianFind16(_mm_loadu_si128((__m128i*)hist + 0), _mm_loadu_si128((__m128i*)hist + 1), rank, sum);
+        }
+
+        void MedianStrip8u(const MedParam& p, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint16_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t width = end - begin, window = 2 * p.radius + 1, size = width + window - 1, rank = p.Rank();
+            uint16_t* fine = buf, * coarse = fine + p.channels * size * 256, * kFine = coarse + p.channels * size * 16;
+            memset(buf, 0, p.channels * size * 272 * sizeof(uint16_t));
+            for (size_t dy = 0; dy < window; ++dy)
+                Base::MedianUpdate8u(p, src + Base::MedianRow(p, dy - p.radius) * srcStride, begin, size, fine, coarse, 1);
+            for (size_t y = 0; y < p.height; ++y)
+            {
+                if (y)
+                {
+                    Base::MedianUpdate8u(p, src + Base::MedianRow(p, y - p.radius - 1) * srcStride, begin, size, fine, coarse, -1);
+                    Base::MedianUpdate8u(p, src + Base::MedianRow(p, y + p.radius) * srcStride, begin, size, fine, coarse, 1);
+                }
+                uint8_t* pd = dst + y * dstStride + begin * p.channels;
+                for (size_t c = 0; c < p.channels; ++c)
+                {
+                    const uint16_t* cFine = fine + c * 16 * size * 16, * cCoarse = coarse + c * size * 16;
+                    size_t last[16] = { 0 };
+                    __m128i kc0 = _mm_setzero_si128(), kc1 = _mm_setzero_si128();
+                    for (size_t col = 0; col < window - 1; ++col)
+                    {
+                        kc0 = _mm_add_epi16(kc0, _mm_loadu_si128((__m128i*)(cCoarse + col * 16) + 0));
+                        kc1 = _mm_add_epi16(kc1, _mm_loadu_si128((__m128i*)(cCoarse + col * 16) + 1));
+                    }
+                    for (size_t x = 0; x < width; ++x)
+                    {
+                        const uint16_t* add = cCoarse + (x + window - 1) * 16;
+                        kc0 = _mm_add_epi16(kc0, _mm_loadu_si128((__m128i*)add + 0));
+                        kc1 = _mm_add_epi16(kc1, _mm_loadu_si128((__m128i*)add + 1));
+                        size_t sum = 0, k = MedianFind16(kc0, kc1, rank, sum);
+                        const uint16_t* cf = cFine + k * size * 16;
+                        uint16_t* kf = kFine + k * 16;
+                        if (last[k] <= x)
+                        {
+                            memset(kf, 0, 16 * sizeof(uint16_t));
+                            for (last[k] = x; last[k] < x + window; ++last[k])
+                                MedianAdd16(cf + last[k] * 16, kf);
+                        }
+                        else
+                        {
+                            for (; last[k] < x + window; ++last[k])
+                                MedianAddSub16(cf + last[k] * 16, cf + (last[k] - window) * 16, kf);
+                        }
+                        const uint16_t* sub = cCoarse + x * 16;
+                        kc0 = _mm_sub_epi16(kc0, _mm_loadu_si128((__m128i*)sub + 0));
+                        kc1 = _mm_sub_epi16(kc1, _mm_loadu_si128((__m128i*)sub + 1));
+                        pd[x * p.channels + c] = uint8_t(k * 16 + MedianFind16(kf, rank, sum));
+                    }
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        MedianFilterHist::MedianFilterHist(const MedParam& param)
+            : Base::MedianFilterHist(param)
+        {
+            if (!_param.Is16u())
+                _run = MedianStrip8u;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags)
+        {
+            MedParam param(width, height, channels, radius, flags, A);
+            if (!param.Valid())
+                return NULL;
+            return new MedianFilterHist(param);
+        }
     }
 #endif
 }
@@ -0,0 +1,133 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdOpticalFlow.h"
+#include "Simd/SimdSet.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i LkValue(const uint8_t* s0, const uint8_t* s1, __m128i w01, __m128i w23)
+        {
+            __m128i r0 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)s0), _mm_loadl_epi64((__m128i*)(s0 + 1)));
+            __m128i r1 = _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)s1), _mm_loadl_epi64((__m128i*)(s1 + 1)));
+            __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi8(r0, K_ZERO), w01), _mm_madd_epi16(_mm_unpacklo_epi8(r1, K_ZERO), w23));
+            __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi8(r0, K_ZERO), w01), _mm_madd_epi16(_mm_unpackhi_epi8(r1, K_ZERO), w23));
+            __m128i round = _mm_set1_epi32(LK_VALUE_ROUND);
+            lo = _mm_srai_epi32(_mm_add_epi32(lo, round), LK_VALUE_SHIFT);
+            hi = _mm_srai_epi32(_mm_add_epi32(hi, round), LK_VALUE_SHIFT);
+            return _mm_packs_epi32(lo, hi);
+        }
+
+        SIMD_INLINE __m128 LkRowSums(__m128i a, __m128i b, __m128i c)
+        {
+            return _mm_cvtepi32_ps(_mm_hadd_epi32(_mm_hadd_epi32(a, b), _mm_hadd_epi32(c, _mm_setzero_si128())));
+        }
+
+        void LkPrepare(const uint8_t* src, size_t stride, const int16_t* weights, size_t size, size_t pStride,
+            int16_t* ext, int16_t* val, int16_t* dx, int16_t* dy, const int16_t* mask, float* gradient)
+        {
+            size_t eSize = size + 2, eStride = AlignHi(size + 2, HA);
+            __m128i w01 = SetInt16(weights[0], weights[1]);
+            __m128i w23 = SetInt16(weights[2], weights[3]);
+            for (size_t y = 0; y < eSize; ++y)
+            {
+                const uint8_t* s0 = src + y * stride, * s1 = s0 + stride;
+                int16_t* e = ext + y * eStride;
+                for (size_t x = 0; x < eStride; x += HA)
+                    _mm_storeu_si128((__m128i*)(e + x), LkValue(s0 + x, s1 + x, w01, w23));
+            }
+            __m128 sum = _mm_setzero_ps();
+            for (size_t y = 0; y < size; ++y)
+            {
+                const int16_t* e0 = ext + y * eStride + 1;
+                const int16_t* e1 = e0 + eStride;
+                const int16_t* e2 = e1 + eStride;
+                int16_t* v = val + y * pStride, * ix = dx + y * pStride, * iy = dy + y * pStride;
+                __m128i xx = _mm_setzero_si128(), xy = _mm_setzero_si128(), yy = _mm_setzero_si128();
+                for (size_t x = 0; x < pStride; x += HA)
+                {
+                    __m128i m = _mm_loadu_si128((__m128i*)(mask + x));
+                    __m128i _dx = _mm_and_si128(_mm_sub_epi16(_mm_loadu_si128((__m128i*)(e1 + x + 1)), _mm_loadu_si128((__m128i*)(e1 + x - 1))), m);
+                    __m128i _dy = _mm_and_si128(_mm_sub_epi16(_mm_loadu_si128((__m128i*)(e2 + x)), _mm_loadu_si128((__m128i*)(e0 + x))), m);
+                    _mm_storeu_si128((__m128i*)(v + x), _mm_loadu_si128((__m128i*)(e1 + x)));
+                    _mm_storeu_si128((__m128i*)(ix + x), _dx);
+                    _mm_storeu_si128((__m128i*)(iy + x), _dy);
+                    xx = _mm_add_epi32(xx, _mm_madd_epi16(_dx, _dx));
+                    xy = _mm_add_epi32(xy, _mm_madd_epi16(_dx, _dy));
+                    yy = _mm_add_epi32(yy, _mm_madd_epi16(_dy, _dy));
+                }
+                sum = _mm_add_ps(sum, LkRowSums(xx, xy, yy));
+            }
+            _mm_storeu_ps(gradient, _mm_add_ps(_mm_loadu_ps(gradient), sum));
+        }
+
+        void LkResidual(const uint8_t* src, size_t stride, const int16_t* weights, size_t size, size_t pStride,
+            const int16_t* val, const int16_t* dx, const int16_t* dy, const int16_t* mask, float* residual)
+        {
+            __m128i w01 = SetInt16(weights[0], weights[1]);
+            __m128i w23 = SetInt16(weights[2], weights[3]);
+            __m128 sum = _mm_setzero_ps();
+            for (size_t y = 0; y < size; ++y)
+            {
+                const uint8_t* s0 = src + y * stride, * s1 = s0 + stride;
+                const int16_t* v = val + y * pStride, * ix = dx + y * pStride, * iy = dy + y * pStride;
+                __m128i bx = _mm_setzero_si128(), by = _mm_setzero_si128(), sad = _mm_setzero_si128();
+                for (size_t x = 0; x < pStride; x += HA)
+                {
+                    __m128i d = _mm_sub_epi16(_mm_loadu_si128((__m128i*)(v + x)), LkValue(s0 + x, s1 + x, w01, w23));
+                    d = _mm_and_si128(d, _mm_loadu_si128((__m128i*)(mask + x)));
+                    bx = _mm_add_epi32(bx, _mm_madd_epi16(d, _mm_loadu_si128((__m128i*)(ix + x))));
+                    by = _mm_add_epi32(by, _mm_madd_epi16(d, _mm_loadu_si128((__m128i*)(iy + x))));
+                    sad = _mm_add_epi32(sad, _mm_madd_epi16(_mm_abs_epi16(d), K16_0001));
+                }
+                sum = _mm_add_ps(sum, LkRowSums(bx, by, sad));
+            }
+            _mm_storeu_ps(residual, _mm_add_ps(_mm_loadu_ps(residual), sum));
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        OpticalFlowPyrLk::OpticalFlowPyrLk(const LkParam& param)
+            : Base::OpticalFlowPyrLk(param)
+        {
+            _prepare = LkPrepare;
+            _residual = LkResidual;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* OpticalFlowPyrLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigen)
+        {
+            LkParam param(width, height, levels, radius, iterations, epsilon, minEigen, HA);
+            if (!param.Valid())
+                return NULL;
+            return new OpticalFlowPyrLk(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,99 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdTemplateMatch.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        SIMD_INLINE void TemplateMatchCorr8(const uint8_t* s, const __m128i& w, __m128i& s0, __m128i& s1)
+        {
+            __m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)(s + 0)));
+            __m128i b = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)(s + 1)));
+            s0 = _mm_add_epi32(s0, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w));
+            s1 = _mm_add_epi32(s1, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w));
+        }
+
+        SIMD_INLINE void TemplateMatchCorr8Tail(const uint8_t* s, const __m128i& w, __m128i& s0, __m128i& s1)
+        {
+            __m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)s));
+            s0 = _mm_add_epi32(s0, _mm_madd_epi16(_mm_unpacklo_epi16(a, K_ZERO), w));
+            s1 = _mm_add_epi32(s1, _mm_madd_epi16(_mm_unpackhi_epi16(a, K_ZERO), w));
+        }
+
+        template<int blocks> void TemplateMatchCorr(const uint8_t* src, size_t srcStride, const int32_t* tmpl, size_t tmplWidth, size_t rows, int32_t* dst)
+        {
+            size_t pairs = DivHi(tmplWidth, 2), even = AlignLo(tmplWidth, 2);
+            __m128i sums[2 * blocks];
+            for (int b = 0; b < 2 * blocks; ++b)
+                sums[b] = _mm_setzero_si128();
+            for (size_t j = 0; j < rows; ++j, src += srcStride, tmpl += pairs)
+            {
+                for (size_t i = 0; i < even; i += 2)
+                {
+                    __m128i w = _mm_set1_epi32(tmpl[i / 2]);
+                    for (int b = 0; b < blocks; ++b)
+                        TemplateMatchCorr8(src + b * 8 + i, w, sums[2 * b + 0], sums[2 * b + 1]);
+                }
+                if (even < tmplWidth)
+                {
+                    __m128i w = _mm_set1_epi32(tmpl[pairs - 1]);
+                    for (int b = 0; b < blocks; ++b)
+                        TemplateMatchCorr8Tail(src + b * 8 + even, w, sums[2 * b + 0], sums[2 * b + 1]);
+                }
+            }
+            for (int b = 0; b < 2 * blocks; ++b)
+                _mm_storeu_si128((__m128i*)dst + b, sums[b]);
+        }
+
+        void TemplateMatchCorr(const uint8_t* src, size_t srcStride, size_t width, const int32_t* tmpl, size_t tmplWidth, size_t rows, int32_t* dst)
+        {
+            if (width < 8)
+            {
+                Base::TemplateMatchCorr(src, srcStride, width, tmpl, tmplWidth, rows, dst);
+                return;
+            }
+            size_t width16 = AlignLo(width, 16), x = 0;
+            for (; x < width16; x += 16)
+                TemplateMatchCorr<2>(src + x, srcStride, tmpl, tmplWidth, rows, dst + x);
+            for (; x < width; x += 8)
+            {
+                x = Simd::Min(x, width - 8);
+                TemplateMatchCorr<1>(src + x, srcStride, tmpl, tmplWidth, rows, dst + x);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void TemplateMatch(const uint8_t* src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t* tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight,
+            SimdTemplateMatchMethodType method, float* dst, size_t dstStride)
+        {
+            Base::TemplateMatchApply(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, method, dst, dstStride, TemplateMatchCorr, A);
+        }
+    }
+#endif
+}
@@ -0,0 +1,210 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdYuv16ToBgr.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        const __m128i K8_SHUFFLE_UV16_TO_U = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD);
+        const __m128i K8_SHUFFLE_UV16_TO_V = SIMD_MM_SETR_EPI8(0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF);
+
+        template<int mode> SIMD_INLINE void LoadYuv16Uv(const uint16_t* u, const uint16_t* v, size_t x, __m128i mask, __m128i& _u, __m128i& _v)
+        {
+            if (mode == 0)
+            {
+                _u = _mm_loadu_si128((__m128i*)(u + x));
+                _v = _mm_loadu_si128((__m128i*)(v + x));
+            }
+            else if (mode == 1)
+            {
+                __m128i u4 = _mm_loadl_epi64((__m128i*)(u + x / 2));
+                __m128i v4 = _mm_loadl_epi64((__m128i*)(v + x / 2));
+                _u = _mm_unpacklo_epi16(u4, u4);
+                _v = _mm_unpacklo_epi16(v4, v4);
+            }
+            else
+            {
+                __m128i uv = _mm_loadu_si128((__m128i*)(u + x));
+                _u = _mm_shuffle_epi8(uv, K8_SHUFFLE_UV16_TO_U);
+                _v = _mm_shuffle_epi8(uv, K8_SHUFFLE_UV16_TO_V);
+            }
+            _u = _mm_and_si128(_u, mask);
+            _v = _mm_and_si128(_v, mask);
+        }
+
+        SIMD_INLINE __m128 Yuv16ToFloat(__m128i value, __m128 lo)
+        {
+            return _mm_sub_ps(_mm_cvtepi32_ps(value), lo);
+        }
+
+        template<int mode> void Yuv16ToFloatRow(const Base::Yuv16ToBgrParam& p, const uint16_t* y, const uint16_t* u, const uint16_t* v, size_t width, float* b, float* g, float* r)
+        {
+            __m128i mask = _mm_set1_epi16(p.mask);
+            __m128 yLo = _mm_set1_ps(p.yLo), uvLo = _mm_set1_ps(p.uvLo), _y = _mm_set1_ps(p.y);
+            __m128 ub = _mm_set1_ps(p.ub), ug = _mm_set1_ps(p.ug), vg = _mm_set1_ps(p.vg), vr = _mm_set1_ps(p.vr);
+            size_t width8 = AlignLo(width, 8), x = 0;
+            for (; x < width8; x += 8)
+            {
+                __m128i y16 = _mm_and_si128(_mm_loadu_si128((__m128i*)(y + x)), mask), u16, v16;
+                LoadYuv16Uv<mode>(u, v, x, mask, u16, v16);
+                for (size_t i = 0; i < 2; ++i)
+                {
+                    __m128i y32 = i ? _mm_unpackhi_epi16(y16, K_ZERO) : _mm_cvtepu16_epi32(y16);
+                    __m128i u32 = i ? _mm_unpackhi_epi16(u16, K_ZERO) : _mm_cvtepu16_epi32(u16);
+                    __m128i v32 = i ? _mm_unpackhi_epi16(v16, K_ZERO) : _mm_cvtepu16_epi32(v16);
+                    __m128 _yf = _mm_mul_ps(Yuv16ToFloat(y32, yLo), _y);
+                    __m128 _uf = Yuv16ToFloat(u32, uvLo);
+                    __m128 _vf = Yuv16ToFloat(v32, uvLo);
+                    _mm_storeu_ps(b + x + i * 4, _mm_add_ps(_yf, _mm_mul_ps(_uf, ub)));
+                    _mm_storeu_ps(g + x + i * 4, _mm_add_ps(_mm_add_ps(_yf, _mm_mul_ps(_uf, ug)), _mm_mul_ps(_vf, vg)));
+                    _mm_storeu_ps(r + x + i * 4, _mm_add_ps(_yf, _mm_mul_ps(_vf, vr)));
+                }
+            }
+            if (x < width)
+                Base::Yuv16ToFloatRow(p, y + x, u + (mode == 1 ? x / 2 : x), v ? v + (mode == 1 ? x / 2 : x) : v, width - x, b + x, g + x, r + x);
+        }
+
+        void Yuv16ToFloatRow(const Base::Yuv16ToBgrParam& p, const uint16_t* y, const uint16_t* u, const uint16_t* v, size_t width, float* b, float* g, float* r)
+        {
+            if (g == NULL)
+            {
+                __m128i mask = _mm_set1_epi16(p.mask);
+                __m128 yLo = _mm_set1_ps(p.yLo), _y = _mm_set1_ps(p.y);
+                size_t width8 = AlignLo(width, 8), x = 0;
+                for (; x < width8; x += 8)
+                {
+                    __m128i y16 = _mm_and_si128(_mm_loadu_si128((__m128i*)(y + x)), mask);
+                    _mm_storeu_ps(b + x + 0, _mm_mul_ps(Yuv16ToFloat(_mm_cvtepu16_epi32(y16), yLo), _y));
+                    _mm_storeu_ps(b + x + 4, _mm_mul_ps(Yuv16ToFloat(_mm_unpackhi_epi16(y16, K_ZERO), yLo), _y));
+                }
+                if (x < width)
+                    Base::Yuv16ToFloatRow(p, y + x, NULL, NULL, width - x, b + x, NULL, NULL);
+            }
+            else if (Base::Yuv16SemiPlanar(p.layout))
+                Yuv16ToFloatRow<2>(p, y, u, v, width, b, g, r);
+            else if (Base::Yuv16HalfWidth(p.layout))
+                Yuv16ToFloatRow<1>(p, y, u, v, width, b, g, r);
+            else
+                Yuv16ToFloatRow<0>(p, y, u, v, width, b, g, r);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128i FloatToUint8(const float* src, __m128 bias)
+        {
+            __m128i i0 = _mm_cvtps_epi32(_mm_add_ps(_mm_loadu_ps(src + 0 * F), bias));
+            __m128i i1 = _mm_cvtps_epi32(_mm_add_ps(_mm_loadu_ps(src + 1 * F), bias));
+            __m128i i2 = _mm_cvtps_epi32(_mm_add_ps(_mm_loadu_ps(src + 2 * F), bias));
+            __m128i i3 = _mm_cvtps_epi32(_mm_add_ps(_mm_loadu_ps(src + 3 * F), bias));
+            return _mm_packus_epi16(_mm_packs_epi32(i0, i1), _mm_packs_epi32(i2, i3));
+        }
+
+        void FloatToUint8Row(const float* b, const float* g, const float* r, const float* bias, size_t width, size_t channels, uint8_t* dst)
+        {
+            __m128 _bias = _mm_loadu_ps(bias);
+            size_t widthA = AlignLo(width, A), x = 0;
+            for (; x < widthA; x += A)
+            {
+                __m128i _b = FloatToUint8(b + x, _bias);
+                if (channels == 1)
+                {
+                    _mm_storeu_si128((__m128i*)(dst + x), _b);
+                    continue;
+                }
+                __m128i _g = FloatToUint8(g + x, _bias);
+                __m128i _r = FloatToUint8(r + x, _bias);
+                if (channels == 3)
+                {
+                    uint8_t* d = dst + 3 * x;
+                    _mm_storeu_si128((__m128i*)d + 0, InterleaveBgr<0>(_b, _g, _r));
+                    _mm_storeu_si128((__m128i*)d + 1, InterleaveBgr<1>(_b, _g, _r));
+                    _mm_storeu_si128((__m128i*)d + 2, InterleaveBgr<2>(_b, _g, _r));
+                }
+                else
+                {
+                    uint8_t* d = dst + 4 * x;
+                    __m128i bgLo = _mm_unpacklo_epi8(_b, _g), bgHi = _mm_unpackhi_epi8(_b, _g);
+                    __m128i raLo = _mm_unpacklo_epi8(_r, K_INV_ZERO), raHi = _mm_unpackhi_epi8(_r, K_INV_ZERO);
+                    _mm_storeu_si128((__m128i*)d + 0, _mm_unpacklo_epi16(bgLo, raLo));
+                    _mm_storeu_si128((__m128i*)d + 1, _mm_unpackhi_epi16(bgLo, raLo));
+                    _mm_storeu_si128((__m128i*)d + 2, _mm_unpacklo_epi16(bgHi, raHi));
+                    _mm_storeu_si128((__m128i*)d + 3, _mm_unpackhi_epi16(bgHi, raHi));
+                }
+            }
+            if (x < width)
+                Base::FloatToUint8Row(b + x, channels > 1 ? g + x : g, channels > 1 ? r + x : r, bias, width - x, channels, dst + x * channels);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m128i K8_SHUFFLE_B16_TO_BGR48_0 = SIMD_MM_SETR_EPI8(0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, 0x4, 0x5, -1, -1);
+        const __m128i K8_SHUFFLE_G16_TO_BGR48_0 = SIMD_MM_SETR_EPI8(-1, -1, 0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, 0x4, 0x5);
+        const __m128i K8_SHUFFLE_R16_TO_BGR48_0 = SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1);
+        const __m128i K8_SHUFFLE_B16_TO_BGR48_1 = SIMD_MM_SETR_EPI8(-1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1, -1, -1, 0xA, 0xB);
+        const __m128i K8_SHUFFLE_G16_TO_BGR48_1 = SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1, -1, -1);
+        const __m128i K8_SHUFFLE_R16_TO_BGR48_1 = SIMD_MM_SETR_EPI8(0x4, 0x5, -1, -1, -1, -1, 0x6, 0x7, -1, -1, -1, -1, 0x8, 0x9, -1, -1);
+        const __m128i K8_SHUFFLE_B16_TO_BGR48_2 = SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF, -1, -1, -1, -1);
+        const __m128i K8_SHUFFLE_G16_TO_BGR48_2 = SIMD_MM_SETR_EPI8(0xA, 0xB, -1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF, -1, -1);
+        const __m128i K8_SHUFFLE_R16_TO_BGR48_2 = SIMD_MM_SETR_EPI8(-1, -1, 0xA, 0xB, -1, -1, -1, -1, 0xC, 0xD, -1, -1, -1, -1, 0xE, 0xF);
+
+        SIMD_INLINE __m128i FloatToUint16(const float* src)
+        {
+            return _mm_packus_epi32(_mm_cvtps_epi32(_mm_loadu_ps(src + 0)), _mm_cvtps_epi32(_mm_loadu_ps(src + F)));
+        }
+
+        void InterleaveBgr48(__m128i b, __m128i g, __m128i r, uint16_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_or_si128(_mm_shuffle_epi8(b, K8_SHUFFLE_B16_TO_BGR48_0),
+                _mm_or_si128(_mm_shuffle_epi8(g, K8_SHUFFLE_G16_TO_BGR48_0), _mm_shuffle_epi8(r, K8_SHUFFLE_R16_TO_BGR48_0))));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_or_si128(_mm_shuffle_epi8(b, K8_SHUFFLE_B16_TO_BGR48_1),
+                _mm_or_si128(_mm_shuffle_epi8(g, K8_SHUFFLE_G16_TO_BGR48_1), _mm_shuffle_epi8(r, K8_SHUFFLE_R16_TO_BGR48_1))));
+            _mm_storeu_si128((__m128i*)dst + 2, _mm_or_si128(_mm_shuffle_epi8(b, K8_SHUFFLE_B16_TO_BGR48_2),
+                _mm_or_si128(_mm_shuffle_epi8(g, K8_SHUFFLE_G16_TO_BGR48_2), _mm_shuffle_epi8(r, K8_SHUFFLE_R16_TO_BGR48_2))));
+        }
+
+        void FloatToUint16Row(const float* b, const float* g, const float* r, size_t width, uint16_t* dst)
+        {
+            size_t width8 = AlignLo(width, 8), x = 0;
+            for (; x < width8; x += 8)
+                InterleaveBgr48(FloatToUint16(b + x), FloatToUint16(g + x), FloatToUint16(r + x), dst + 3 * x);
+            if (x < width)
+                Base::FloatToUint16Row(b + x, g + x, r + x, width - x, dst + 3 * x);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Yuv16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height,
+            SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, uint8_t* dst, size_t dstStride, SimdYuv16OutputType output, SimdBool dither)
+        {
+            Base::Yuv16ToBgrApply(y, yStride, u, uStride, v, vStride, width, height, layout, bitDepth, yuvType, dst, dstStride, output, dither,
+                Yuv16ToFloatRow, FloatToUint8Row, FloatToUint16Row, Float32ToBFloat16);
+        }
+    }
+#endif
+}
@@ -0,0 +1,54 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdTemplateMatch_h__
+#define __SimdTemplateMatch_h__
+
+#include "Simd/SimdDefs.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+        * Computes dst[x] = sum(tmpl[j][i] * src[j * srcStride + x + i]) for x < width, j < rows and i < tmplWidth.
+        * Template rows are packed by pairs of 16-bit values (the last pair of odd row is padded by zero).
+        * The caller guarantees that sum of one call fits in 32-bit integer.
+        */
+        typedef void(*TemplateMatchCorrPtr)(const uint8_t* src, size_t srcStride, size_t width, const int32_t* tmpl, size_t tmplWidth, size_t rows, int32_t* dst);
+
+        void TemplateMatchCorr(const uint8_t* src, size_t srcStride, size_t width, const int32_t* tmpl, size_t tmplWidth, size_t rows, int32_t* dst);
+
+        void TemplateMatchApply(const uint8_t* src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t* tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight,
+            SimdTemplateMatchMethodType method, float* dst, size_t dstStride, TemplateMatchCorrPtr corr, size_t align);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void TemplateMatchCorr(const uint8_t* src, size_t srcStride, size_t width, const int32_t* tmpl, size_t tmplWidth, size_t rows, int32_t* dst);
+    }
+#endif
+}
+
+#endif
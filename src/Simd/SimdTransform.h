@@ -36,13 +36,19 @@ namespace Simd
         {
             typedef void(*TransformPtr)(const uint8_t* src, ptrdiff_t srcStride, size_t width, size_t height, uint8_t* dst, ptrdiff_t dstStride);
 
-            TransformPtr transforms[4][8];
+            TransformPtr transforms[8][8];
+
+            static SIMD_INLINE int Index(size_t pixelSize)
+            {
+                static const int index[17] = { -1, 0, 1, 2, 3, -1, 4, -1, 5, -1, -1, -1, 6, -1, -1, -1, 7 };
+                return pixelSize < 17 ? index[pixelSize] : -1;
+            }
 
             SIMD_INLINE void TransformImage(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t* dst, size_t dstStride)
             {
-                assert(pixelSize >= 1 && pixelSize <= 4 && transform >= SimdTransformRotate0 && transform <= SimdTransformTransposeRotate270);
+                assert(Index(pixelSize) >= 0 && transform >= SimdTransformRotate0 && transform <= SimdTransformTransposeRotate270);
 
-                transforms[pixelSize - 1][transform](src, srcStride, width, height, dst, dstStride);
+                transforms[Index(pixelSize)][transform](src, srcStride, width, height, dst, dstStride);
             }
 
             ImageTransforms();
@@ -93,6 +93,24 @@ namespace Simd
             Store<align>(dst + 2 * F, buf23);
             Store<align>(dst + 3 * F, buf33);
         }
+
+        SIMD_INLINE void Transpose8u16x16(__m128i* v)
+        {
+            __m128i t[16];
+            for (size_t s = 0; s < 2; ++s)
+            {
+                for (size_t i = 0; i < 8; ++i)
+                {
+                    t[2 * i + 0] = _mm_unpacklo_epi8(v[i], v[i + 8]);
+                    t[2 * i + 1] = _mm_unpackhi_epi8(v[i], v[i + 8]);
+                }
+                for (size_t i = 0; i < 8; ++i)
+                {
+                    v[2 * i + 0] = _mm_unpacklo_epi8(t[i], t[i + 8]);
+                    v[2 * i + 1] = _mm_unpackhi_epi8(t[i], t[i + 8]);
+                }
+            }
+        }
     }
 #endif//SIMD_SSE41_ENABLE
 
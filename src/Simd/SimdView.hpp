@@ -119,6 +119,16 @@ namespace Simd
             Argb32,
             /*! A 24-bit (3 8-bit channels) LAB (CIELAB) pixel format. */
             Lab24,
+            /*! A 16-bit gray pixel format (1 16-bit unsigned channel). */
+            Gray16,
+            /*! A 48-bit (3 16-bit unsigned channels) BGR (Blue, Green, Red) pixel format. */
+            Bgr48,
+            /*! A 64-bit (4 16-bit unsigned channels) BGRA (Blue, Green, Red, Alpha) pixel format. */
+            Bgra64,
+            /*! A 48-bit (3 16-bit unsigned channels) RGB (Red, Green, Blue) pixel format. */
+            Rgb48,
+            /*! A 64-bit (4 16-bit unsigned channels) RGBA (Red, Green, Blue, Alpha) pixel format. */
+            Rgba64,
         };
 
         /*!
@@ -543,6 +553,7 @@ namespace Simd
             \param [in] path - a path to image file.
             \param [in] format - a desired format of loaded image.
                 Supported values are View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 and View::None.
+                16-bit PNG, PGM and PPM (binary) files can also be loaded in View::Gray16, View::Bgr48, View::Bgra64, View::Rgb48 or View::Rgba64.
                 Default value is View::None (loads image in native pixel format of image file).
             \return - a result of loading.
         */
@@ -559,6 +570,7 @@ namespace Simd
             \param [in] size - a buffer size.
             \param [in] format - a desired format of loaded image.
                 Supported values are View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 and View::None.
+                16-bit PNG, PGM and PPM (binary) files can also be loaded in View::Gray16, View::Bgr48, View::Bgra64, View::Rgb48 or View::Rgba64.
                 Default value is View::None (loads image in native pixel format of image file).
             \return - a result of loading.
         */
@@ -1147,6 +1159,11 @@ namespace Simd
         case Uyvy16:    return 2;
         case Argb32:    return 4;
         case Lab24:     return 3;
+        case Gray16:    return 2;
+        case Bgr48:     return 6;
+        case Bgra64:    return 8;
+        case Rgb48:     return 6;
+        case Rgba64:    return 8;
         default: assert(0); return 0;
         }
     }
@@ -1181,6 +1198,11 @@ namespace Simd
         case Uyvy16:    return 1;
         case Argb32:    return 1;
         case Lab24:     return 1;
+        case Gray16:    return 2;
+        case Bgr48:     return 2;
+        case Bgra64:    return 2;
+        case Rgb48:     return 2;
+        case Rgba64:    return 2;
         default: assert(0); return 0;
         }
     }
@@ -1215,6 +1237,11 @@ namespace Simd
         case Uyvy16:    return 2;
         case Argb32:    return 4;
         case Lab24:     return 3;
+        case Gray16:    return 1;
+        case Bgr48:     return 3;
+        case Bgra64:    return 4;
+        case Rgb48:     return 3;
+        case Rgba64:    return 4;
         default: assert(0); return 0;
         }
     }
@@ -1249,6 +1276,11 @@ namespace Simd
         case Uyvy16:    return CV_8UC2;
         case Argb32:    return CV_8UC4;
         case Lab24:     return CV_8UC3;
+        case Gray16:    return CV_16UC1;
+        case Bgr48:     return CV_16UC3;
+        case Bgra64:    return CV_16UC4;
+        case Rgb48:     return CV_16UC3;
+        case Rgba64:    return CV_16UC4;
         default: assert(0); return 0;
         }
     }
@@ -1265,6 +1297,9 @@ namespace Simd
         case CV_32SC1:  return Int32;
         case CV_32FC1:  return Float;
         case CV_64FC1:  return Double;
+        case CV_16UC1:  return Gray16;
+        case CV_16UC3:  return Bgr48;
+        case CV_16UC4:  return Bgra64;
         default: assert(0); return None;
         }
     }
@@ -29,6 +29,8 @@
 
 #include "Simd/SimdPoint.hpp"
 
+#include <vector>
+
 namespace Simd
 {
     struct WarpAffParam
@@ -88,6 +90,10 @@ namespace Simd
 
         virtual void Run(const uint8_t * src, uint8_t * dst) = 0;
 
+        bool SetMatrix(const float* mat);
+
+        void SetThreads(size_t threads) { _threads = threads; }
+
     protected:
         WarpAffParam _param;
         bool _first;
@@ -97,6 +103,67 @@ namespace Simd
 
     //-------------------------------------------------------------------------------------------------
 
+    struct WarpAffBatchParam
+    {
+        static const int ChannelsMax = 4;
+
+        size_t srcW, srcH, srcS, channels, dstW, dstH;
+        SimdWarpAffineFlags flags;
+        uint8_t border[ChannelsMax];
+        SimdTensorFormatType format;
+        SimdTensorDataType type;
+        float scale[ChannelsMax], shift[ChannelsMax];
+
+        WarpAffBatchParam(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper);
+
+        bool Valid() const
+        {
+            return channels >= 1 && channels <= 4 && dstW > 0 && dstH > 0 && 
+                (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant &&
+                (format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc) &&
+                (type == SimdTensorData8u || ((type == SimdTensorData32f || type == SimdTensorData16b) && channels != 2));
+        }
+
+        size_t DstChannels() const
+        {
+            return type == SimdTensorData8u ? channels : (channels == 1 ? 1 : 3);
+        }
+
+        size_t DstSize() const
+        {
+            return dstW * dstH * DstChannels() * (type == SimdTensorData8u ? 1 : (type == SimdTensorData16b ? 2 : 4));
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class WarpAffineBatch : Deletable
+    {
+    public:
+        typedef void* (*InitPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+        typedef void (*ToBf16Ptr)(const float* src, size_t size, uint16_t* dst);
+
+        WarpAffineBatch(const WarpAffBatchParam& param, InitPtr init, ToBf16Ptr toBf16);
+
+        virtual ~WarpAffineBatch();
+
+        bool Valid() const;
+
+        void Run(const uint8_t* src, const float* mats, size_t count, uint8_t* dst);
+
+    protected:
+        void SetOutput(const uint8_t* src, float* buf, uint8_t* dst) const;
+
+        WarpAffBatchParam _param;
+        size_t _threads, _size;
+        std::vector<class WarpAffine*> _engines;
+        ToBf16Ptr _toBf16;
+        Array8u _buf;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
     namespace Base
     {
         typedef Simd::Point<float> Point;
@@ -145,6 +212,9 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void * WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper);
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -173,6 +243,9 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper);
     }
 #endif
 
@@ -202,6 +275,9 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper);
     }
 #endif
 
@@ -231,6 +307,9 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper);
     }
 #endif
 }
@@ -26,6 +26,9 @@
 
 #include "Simd/SimdWarpAffine.h"
 #include "Simd/SimdCopy.h"
+#include "Simd/SimdUnpack.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdLoad.h"
 
 namespace Simd
 {
@@ -94,15 +97,8 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        template<int N> SIMD_INLINE void ByteBilinearInterpEdge(int x, int y, const float* m, int w, int h, int s, const uint8_t* src, const uint8_t* brd, uint8_t* dst)
+        template<int N> SIMD_INLINE void ByteBilinearInterpEdge(int ix, int iy, int fx, int fy, int w, int h, int s, const uint8_t* src, const uint8_t* brd, uint8_t* dst)
         {
-            float sx = (float)x, sy = (float)y;
-            float dx = sx * m[0] + sy * m[1] + m[2];
-            float dy = sx * m[3] + sy * m[4] + m[5];
-            int ix = (int)floor(dx);
-            int iy = (int)floor(dy);
-            int fx = Round((dx - ix) * WA_FRACTION_RANGE);
-            int fy = Round((dy - iy) * WA_FRACTION_RANGE);
             int f00 = (WA_FRACTION_RANGE - fy) * (WA_FRACTION_RANGE - fx);
             int f01 = (WA_FRACTION_RANGE - fy) * fx;
             int f10 = fy * (WA_FRACTION_RANGE - fx);
@@ -117,6 +113,20 @@ namespace Simd
             for (int c = 0; c < N; c++)
                 dst[c] = (s00[c] * f00 + s01[c] * f01 + s10[c] * f10 + s11[c] * f11 + WA_BILINEAR_ROUND_TERM) >> WA_BILINEAR_SHIFT;
         }
+
+        // Edge coordinates are evaluated in double to give the same fractions with and without FMA contraction.
+        template<int N> SIMD_INLINE void ByteBilinearInterpEdge(int x, int y, const float* m, int w, int h, int s, const uint8_t* src, const uint8_t* brd, uint8_t* dst)
+        {
+            double sx = (double)x, sy = (double)y;
+            float dx = float(sx * m[0] + sy * m[1] + m[2]);
+            float dy = float(sx * m[3] + sy * m[4] + m[5]);
+            int ix = (int)floor(dx);
+            int iy = (int)floor(dy);
+            int fx = Round((dx - ix) * WA_FRACTION_RANGE);
+            int fy = Round((dy - iy) * WA_FRACTION_RANGE);
+            ByteBilinearInterpEdge<N>(ix, iy, fx, fy, w, h, s, src, brd, dst);
+        }
+
         //-------------------------------------------------------------------------------------------------
 
         template<int N> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
@@ -129,11 +139,500 @@ namespace Simd
                 Base::CopyPixel<N * 2>(src1 + offs, dst1);
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        // Coordinates are evaluated in double: products of floats are exact there, so the result doesn't depend on FMA contraction.
+        SIMD_INLINE void WarpPerspectivePoint(size_t x, const float* m, double bx, double by, double bz, float& sx, float& sy)
+        {
+            double fx = (double)x, dx = fx * m[0] + bx, dy = fx * m[3] + by, dz = fx * m[6] + bz;
+            sx = -2.0f, sy = -2.0f;
+            if (dz > 0.0)
+            {
+                sx = float(dx / dz);
+                sy = float(dy / dz);
+            }
+        }
+
+        SIMD_INLINE void RemapNearestPoint(float sx, float sy, float w, float h, int16_t* xy)
+        {
+            xy[0] = (int16_t)Round(Simd::Min(Simd::Max(sx, -1.0f), w));
+            xy[1] = (int16_t)Round(Simd::Min(Simd::Max(sy, -1.0f), h));
+        }
+
+        SIMD_INLINE void RemapBilinearPoint(float sx, float sy, float w, float h, int16_t* xy, uint8_t* fxy)
+        {
+            if (sx >= -1.0f && sx < w && sy >= -1.0f && sy < h)
+            {
+                float ix = ::floor(sx), iy = ::floor(sy);
+                xy[0] = (int16_t)ix;
+                xy[1] = (int16_t)iy;
+                fxy[0] = (uint8_t)Round((sx - ix) * WA_FRACTION_RANGE);
+                fxy[1] = (uint8_t)Round((sy - iy) * WA_FRACTION_RANGE);
+            }
+            else
+            {
+                xy[0] = -1;
+                xy[1] = -1;
+                fxy[0] = 0;
+                fxy[1] = 0;
+            }
+        }
+
+        template<int N> SIMD_INLINE void RemapBilinearPrep(const int16_t* xy, const uint8_t* fxy, int s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
+        {
+            *offs = xy[1] * s + xy[0] * N;
+            fx[0] = WA_FRACTION_RANGE - fxy[0];
+            fx[1] = fxy[0];
+            fy[0] = WA_FRACTION_RANGE - fxy[1];
+            fy[1] = fxy[1];
+        }
     }
 
 #ifdef SIMD_SSE41_ENABLE
     namespace Sse41
     {
+        const __m128i K32_WA_FRACTION_RANGE = SIMD_MM_SET1_EPI32(Base::WA_FRACTION_RANGE);
+        const __m128i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
+
+        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            __m128i fx0 = _mm_loadu_si128((__m128i*)fx + 0);
+            __m128i fx1 = _mm_loadu_si128((__m128i*)fx + 1);
+            __m128i r00 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 0), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 1), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 0), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 1), fx1);
+
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), _mm_loadu_si128((__m128i*)fy + 0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), _mm_loadu_si128((__m128i*)fy + 1));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), _mm_loadu_si128((__m128i*)fy + 2));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), _mm_loadu_si128((__m128i*)fy + 3));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
+
+            __m128i fy0 = _mm_loadu_si128((__m128i*)fy + 0);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = _mm_loadu_si128((__m128i*)fy + 1);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SRC_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
+            static const __m128i DST_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SRC_SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SRC_SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SRC_SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SRC_SHUFFLE), fx1);
+
+            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
+            __m128i fy0 = UnpackU32<0>(_fy, _fy);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = UnpackU32<1>(_fy, _fy);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            Store12(dst, _mm_shuffle_epi8(_mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)), DST_SHUFFLE));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
+
+            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
+            __m128i fy0 = UnpackU32<0>(_fy, _fy);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = UnpackU32<1>(_fy, _fy);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128 WarpPerspectiveDiv4(__m128d n0, __m128d n1, __m128d d0, __m128d d1)
+        {
+            const __m128d _2 = _mm_set1_pd(-2.0), _0 = _mm_setzero_pd();
+            __m128 q0 = _mm_cvtpd_ps(_mm_blendv_pd(_2, _mm_div_pd(n0, d0), _mm_cmpgt_pd(d0, _0)));
+            __m128 q1 = _mm_cvtpd_ps(_mm_blendv_pd(_2, _mm_div_pd(n1, d1), _mm_cmpgt_pd(d1, _0)));
+            return _mm_movelh_ps(q0, q1);
+        }
+
+        SIMD_INLINE void WarpPerspectivePoint4(const __m128d& x0, const __m128d& x1, const __m128d& m0, const __m128d& m3, const __m128d& m6,
+            const __m128d& bx, const __m128d& by, const __m128d& bz, __m128& sx, __m128& sy)
+        {
+            __m128d dz0 = _mm_add_pd(_mm_mul_pd(x0, m6), bz), dz1 = _mm_add_pd(_mm_mul_pd(x1, m6), bz);
+            sx = WarpPerspectiveDiv4(_mm_add_pd(_mm_mul_pd(x0, m0), bx), _mm_add_pd(_mm_mul_pd(x1, m0), bx), dz0, dz1);
+            sy = WarpPerspectiveDiv4(_mm_add_pd(_mm_mul_pd(x0, m3), by), _mm_add_pd(_mm_mul_pd(x1, m3), by), dz0, dz1);
+        }
+
+        SIMD_INLINE void RemapNearestPoint4(__m128 sx, __m128 sy, const __m128& w, const __m128& h, int16_t* xy)
+        {
+            const __m128 _1 = _mm_set1_ps(-1.0f);
+            __m128i ix = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(sx, _1), w));
+            __m128i iy = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(sy, _1), h));
+            _mm_storeu_si128((__m128i*)xy, _mm_or_si128(_mm_and_si128(ix, K32_0000FFFF), _mm_slli_epi32(iy, 16)));
+        }
+
+        SIMD_INLINE void RemapBilinearPoint4(__m128 sx, __m128 sy, const __m128& w, const __m128& h, int16_t* xy, uint8_t* fxy)
+        {
+            const __m128 _1 = _mm_set1_ps(-1.0f);
+            __m128i mask = _mm_castps_si128(_mm_and_ps(_mm_and_ps(_mm_cmpge_ps(sx, _1), _mm_cmplt_ps(sx, w)),
+                _mm_and_ps(_mm_cmpge_ps(sy, _1), _mm_cmplt_ps(sy, h))));
+            __m128 ix = _mm_floor_ps(sx);
+            __m128 iy = _mm_floor_ps(sy);
+            __m128 range = _mm_cvtepi32_ps(K32_WA_FRACTION_RANGE);
+            __m128i fx = _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(_mm_sub_ps(sx, ix), range)), mask);
+            __m128i fy = _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(_mm_sub_ps(sy, iy), range)), mask);
+            __m128i _xy = _mm_or_si128(_mm_and_si128(_mm_cvtps_epi32(ix), K32_0000FFFF), _mm_slli_epi32(_mm_cvtps_epi32(iy), 16));
+            _mm_storeu_si128((__m128i*)xy, _mm_or_si128(_mm_and_si128(mask, _xy), _mm_andnot_si128(mask, K_INV_ZERO)));
+            __m128i _fxy = _mm_or_si128(fx, _mm_slli_epi32(fy, 8));
+            _mm_storel_epi64((__m128i*)fxy, _mm_packus_epi32(_fxy, _mm_setzero_si128()));
+        }
+
+        SIMD_INLINE void RemapBilinearPrep4(const int16_t* xy, const uint8_t* fxy, const __m128i& n, const __m128i& s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
+        {
+            __m128i _xy = _mm_loadu_si128((__m128i*)xy);
+            __m128i ix = _mm_srai_epi32(_mm_slli_epi32(_xy, 16), 16);
+            __m128i iy = _mm_srai_epi32(_xy, 16);
+            _mm_storeu_si128((__m128i*)offs, _mm_add_epi32(_mm_mullo_epi32(ix, n), _mm_mullo_epi32(iy, s)));
+            __m128i _fxy = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)fxy));
+            __m128i _fx = _mm_and_si128(_fxy, K32_0000FFFF);
+            __m128i _fy = _mm_srli_epi32(_fxy, 16);
+            _fx = _mm_or_si128(_mm_sub_epi32(K32_WA_FRACTION_RANGE, _fx), _mm_slli_epi32(_fx, 16));
+            _fy = _mm_or_si128(_mm_sub_epi32(K32_WA_FRACTION_RANGE, _fy), _mm_slli_epi32(_fy, 16));
+            _mm_storel_epi64((__m128i*)fx, _mm_packus_epi16(_fx, _mm_setzero_si128()));
+            _mm_storeu_si128((__m128i*)fy, _fy);
+        }
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        const __m256i K32_WA_FRACTION_RANGE = SIMD_MM256_SET1_EPI32(Base::WA_FRACTION_RANGE);
+
+        template<int N, bool soft> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0;
+            for (; i < count; i++, dst0 += 2 * N, dst1 += 2 * N)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<N * 2>(src0 + offs, dst0);
+                Base::CopyPixel<N * 2>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<1, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst0 += 16, dst1 += 16)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                __m256i _dst0 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int*)src0, _offs, 1), SHUFFLE);
+                _mm_storeu_si128((__m128i*)dst0, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_dst0, 0x08)));
+                __m256i _dst1 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int*)src1, _offs, 1), SHUFFLE);
+                _mm_storeu_si128((__m128i*)dst1, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_dst1, 0x08)));
+            }
+            for (; i < count; i++, dst0 += 2, dst1 += 2)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<2>(src0 + offs, dst0);
+                Base::CopyPixel<2>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<2, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst0 += 32, dst1 += 32)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                _mm256_storeu_si256((__m256i*)dst0, _mm256_i32gather_epi32((int*)src0, _offs, 1));
+                _mm256_storeu_si256((__m256i*)dst1, _mm256_i32gather_epi32((int*)src1, _offs, 1));
+            }
+            for (; i < count; i++, dst0 += 4, dst1 += 4)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<4>(src0 + offs, dst0);
+                Base::CopyPixel<4>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<4, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0, count4 = (int)AlignLo(count, 4);
+            for (; i < count4; i += 4, dst0 += 32, dst1 += 32)
+            {
+                __m128i _offs = _mm_loadu_si128((__m128i*)(offset + i));
+                _mm256_storeu_si256((__m256i*)dst0, _mm256_i32gather_epi64((long long*)src0, _offs, 1));
+                _mm256_storeu_si256((__m256i*)dst1, _mm256_i32gather_epi64((long long*)src1, _offs, 1));
+            }
+            for (; i < count; i++, dst0 += 8, dst1 += 8)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<8>(src0 + offs, dst0);
+                Base::CopyPixel<8>(src1 + offs, dst1);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m256i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM256_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
+
+        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            __m256i fx0 = _mm256_loadu_si256((__m256i*)fx + 0);
+            __m256i fx1 = _mm256_loadu_si256((__m256i*)fx + 1);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 0), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 1), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 0), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 1), fx1);
+
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), Load<false>((__m128i*)fy + 0, (__m128i*)fy + 2));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), Load<false>((__m128i*)fy + 1, (__m128i*)fy + 3));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), Load<false>((__m128i*)fy + 4, (__m128i*)fy + 6));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), Load<false>((__m128i*)fy + 5, (__m128i*)fy + 7));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+
+            __m256i _fx = LoadPermuted<false>((__m256i*)fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
+
+            __m256i fy0 = _mm256_loadu_si256((__m256i*)fy + 0);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = _mm256_loadu_si256((__m256i*)fy + 1);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SRC_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
+            static const __m256i DST_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+            static const __m256i DST_PERMUTE = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 0, 0);
+
+            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SRC_SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SRC_SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SRC_SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SRC_SHUFFLE), fx1);
+
+            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
+            __m256i fy0 = UnpackU32<0>(_fy, _fy);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = UnpackU32<1>(_fy, _fy);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i _dst = PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3));
+            Store24<false>(dst, _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_dst, DST_SHUFFLE), DST_PERMUTE));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
+
+            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
+            __m256i fy0 = UnpackU32<0>(_fy, _fy);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = UnpackU32<1>(_fy, _fy);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m256 WarpPerspectiveDiv8(__m256d n0, __m256d n1, __m256d d0, __m256d d1)
+        {
+            const __m256d _2 = _mm256_set1_pd(-2.0), _0 = _mm256_setzero_pd();
+            __m128 q0 = _mm256_cvtpd_ps(_mm256_blendv_pd(_2, _mm256_div_pd(n0, d0), _mm256_cmp_pd(d0, _0, _CMP_GT_OQ)));
+            __m128 q1 = _mm256_cvtpd_ps(_mm256_blendv_pd(_2, _mm256_div_pd(n1, d1), _mm256_cmp_pd(d1, _0, _CMP_GT_OQ)));
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(q0), q1, 1);
+        }
+
+        SIMD_INLINE void WarpPerspectivePoint8(const __m256d& x0, const __m256d& x1, const __m256d& m0, const __m256d& m3, const __m256d& m6,
+            const __m256d& bx, const __m256d& by, const __m256d& bz, __m256& sx, __m256& sy)
+        {
+            __m256d dz0 = _mm256_add_pd(_mm256_mul_pd(x0, m6), bz), dz1 = _mm256_add_pd(_mm256_mul_pd(x1, m6), bz);
+            sx = WarpPerspectiveDiv8(_mm256_add_pd(_mm256_mul_pd(x0, m0), bx), _mm256_add_pd(_mm256_mul_pd(x1, m0), bx), dz0, dz1);
+            sy = WarpPerspectiveDiv8(_mm256_add_pd(_mm256_mul_pd(x0, m3), by), _mm256_add_pd(_mm256_mul_pd(x1, m3), by), dz0, dz1);
+        }
+
+        SIMD_INLINE void RemapNearestPoint8(__m256 sx, __m256 sy, const __m256& w, const __m256& h, int16_t* xy)
+        {
+            const __m256 _1 = _mm256_set1_ps(-1.0f);
+            __m256i ix = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(sx, _1), w));
+            __m256i iy = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(sy, _1), h));
+            _mm256_storeu_si256((__m256i*)xy, _mm256_or_si256(_mm256_and_si256(ix, K32_0000FFFF), _mm256_slli_epi32(iy, 16)));
+        }
+
+        SIMD_INLINE void RemapBilinearPoint8(__m256 sx, __m256 sy, const __m256& w, const __m256& h, int16_t* xy, uint8_t* fxy)
+        {
+            const __m256 _1 = _mm256_set1_ps(-1.0f);
+            __m256i mask = _mm256_castps_si256(_mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(sx, _1, _CMP_GE_OQ), _mm256_cmp_ps(sx, w, _CMP_LT_OQ)),
+                _mm256_and_ps(_mm256_cmp_ps(sy, _1, _CMP_GE_OQ), _mm256_cmp_ps(sy, h, _CMP_LT_OQ))));
+            __m256 ix = _mm256_floor_ps(sx);
+            __m256 iy = _mm256_floor_ps(sy);
+            __m256 range = _mm256_cvtepi32_ps(K32_WA_FRACTION_RANGE);
+            __m256i fx = _mm256_and_si256(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_sub_ps(sx, ix), range)), mask);
+            __m256i fy = _mm256_and_si256(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_sub_ps(sy, iy), range)), mask);
+            __m256i _xy = _mm256_or_si256(_mm256_and_si256(_mm256_cvtps_epi32(ix), K32_0000FFFF), _mm256_slli_epi32(_mm256_cvtps_epi32(iy), 16));
+            _mm256_storeu_si256((__m256i*)xy, _mm256_or_si256(_mm256_and_si256(mask, _xy), _mm256_andnot_si256(mask, K_INV_ZERO)));
+            __m256i _fxy = _mm256_or_si256(fx, _mm256_slli_epi32(fy, 8));
+            _fxy = _mm256_permute4x64_epi64(_mm256_packus_epi32(_fxy, _mm256_setzero_si256()), 0x08);
+            _mm_storeu_si128((__m128i*)fxy, _mm256_castsi256_si128(_fxy));
+        }
+
+        SIMD_INLINE void RemapBilinearPrep8(const int16_t* xy, const uint8_t* fxy, const __m256i& n, const __m256i& s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
+        {
+            __m256i _xy = _mm256_loadu_si256((__m256i*)xy);
+            __m256i ix = _mm256_srai_epi32(_mm256_slli_epi32(_xy, 16), 16);
+            __m256i iy = _mm256_srai_epi32(_xy, 16);
+            _mm256_storeu_si256((__m256i*)offs, _mm256_add_epi32(_mm256_mullo_epi32(ix, n), _mm256_mullo_epi32(iy, s)));
+            __m256i _fxy = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)fxy));
+            __m256i _fx = _mm256_and_si256(_fxy, K32_0000FFFF);
+            __m256i _fy = _mm256_srli_epi32(_fxy, 16);
+            _fx = _mm256_or_si256(_mm256_sub_epi32(K32_WA_FRACTION_RANGE, _fx), _mm256_slli_epi32(_fx, 16));
+            _fy = _mm256_or_si256(_mm256_sub_epi32(K32_WA_FRACTION_RANGE, _fy), _mm256_slli_epi32(_fy, 16));
+            _mm_storeu_si128((__m128i*)fx, _mm256_castsi256_si128(PackI16ToU8(_fx, _mm256_setzero_si256())));
+            _mm256_storeu_si256((__m256i*)fy, _fy);
+        }
     }
 #endif
 }
@@ -0,0 +1,94 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdYuv16ToBgr_h__
+#define __SimdYuv16ToBgr_h__
+
+#include "Simd/SimdDefs.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct Yuv16ToBgrParam
+        {
+            SimdYuv16LayoutType layout;
+            uint16_t mask;
+            float yLo, uvLo, y, vr, ug, vg, ub;
+            float dither[4][4];
+
+            Yuv16ToBgrParam(SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, float range, bool dither);
+        };
+
+        SIMD_INLINE bool Yuv16HalfWidth(SimdYuv16LayoutType layout)
+        {
+            return layout != SimdYuv16Layout444p;
+        }
+
+        SIMD_INLINE bool Yuv16HalfHeight(SimdYuv16LayoutType layout)
+        {
+            return layout == SimdYuv16Layout420p || layout == SimdYuv16LayoutP420;
+        }
+
+        SIMD_INLINE bool Yuv16SemiPlanar(SimdYuv16LayoutType layout)
+        {
+            return layout == SimdYuv16LayoutP420 || layout == SimdYuv16LayoutP422;
+        }
+
+        /*
+        * Converts one row of YUV samples to float B, G, R rows (scaled to the output range).
+        * For Gray output pointers g and r are NULL and b receives luminance only.
+        * For semi-planar layouts u points to interleaved UV row and v is not used.
+        */
+        typedef void(*Yuv16ToFloatRowPtr)(const Yuv16ToBgrParam& p, const uint16_t* y, const uint16_t* u, const uint16_t* v, size_t width, float* b, float* g, float* r);
+        typedef void(*FloatToUint8RowPtr)(const float* b, const float* g, const float* r, const float* bias, size_t width, size_t channels, uint8_t* dst);
+        typedef void(*FloatToUint16RowPtr)(const float* b, const float* g, const float* r, size_t width, uint16_t* dst);
+        typedef void(*Float32ToBFloat16Ptr)(const float* src, size_t size, uint16_t* dst);
+
+        void Yuv16ToFloatRow(const Yuv16ToBgrParam& p, const uint16_t* y, const uint16_t* u, const uint16_t* v, size_t width, float* b, float* g, float* r);
+        void FloatToUint8Row(const float* b, const float* g, const float* r, const float* bias, size_t width, size_t channels, uint8_t* dst);
+        void FloatToUint16Row(const float* b, const float* g, const float* r, size_t width, uint16_t* dst);
+
+        void Yuv16ToBgrApply(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height,
+            SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, uint8_t* dst, size_t dstStride, SimdYuv16OutputType output, SimdBool dither,
+            Yuv16ToFloatRowPtr toFloat, FloatToUint8RowPtr toUint8, FloatToUint16RowPtr toUint16, Float32ToBFloat16Ptr toBFloat16);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void FloatToUint8Row(const float* b, const float* g, const float* r, const float* bias, size_t width, size_t channels, uint8_t* dst);
+
+        void InterleaveBgr48(__m128i b, __m128i g, __m128i r, uint16_t* dst);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void FloatToUint8Row(const float* b, const float* g, const float* r, const float* bias, size_t width, size_t channels, uint8_t* dst);
+    }
+#endif
+}
+
+#endif
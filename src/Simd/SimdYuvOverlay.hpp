@@ -0,0 +1,409 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdYuvOverlay_hpp__
+#define __SimdYuvOverlay_hpp__
+
+#include "Simd/SimdFrame.hpp"
+#include "Simd/SimdDrawing.hpp"
+#include "Simd/SimdFont.hpp"
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <memory>
+
+namespace Simd
+{
+    /*! @ingroup cpp_drawing
+
+        \short The YuvOverlay class composites overlay primitives directly into YUV420P, NV12 or NV21 images.
+
+        It accumulates a list of primitives (rectangles, filled rectangles, polylines, text and BGRA sprites with alpha channel) 
+        and blends them into Y and chroma planes without conversion of the whole frame to BGRA and back.
+        Each primitive is rasterized into a coverage mask restricted by its bounding box, then per-row spans of nonzero coverage 
+        are blended into the Y plane, and 2x2 reduced coverage is blended into the chroma planes. 
+        So only touched rows and columns of the frame are processed.
+
+        Using example:
+        \code
+        #include "Simd/SimdYuvOverlay.hpp"
+
+        int main()
+        {
+            typedef Simd::YuvOverlay Overlay;
+
+            Overlay::Frame frame(1920, 1080, Overlay::Frame::Nv12);
+            Simd::Fill(frame.planes[0], 16);
+            Simd::Fill(frame.planes[1], 128);
+
+            Simd::Font font(32);
+
+            Overlay overlay;
+            overlay.AddRectangle(Overlay::Rect(100, 100, 400, 300), Overlay::Color(0, 255, 0), 3);
+            overlay.AddFilledRectangle(Overlay::Rect(500, 100, 700, 200), Overlay::Color(0, 0, 255, 128));
+            overlay.AddText(font, "Hello, Simd!", Overlay::Point(100, 320), Overlay::Color(255, 255, 255));
+            overlay.Render(frame);
+
+            return 0;
+        }
+        \endcode
+    */
+    class YuvOverlay
+    {
+    public:
+        typedef std::string String; /*!< String type definition. */
+        typedef Simd::Point<ptrdiff_t> Point; /*!< Point type definition. */
+        typedef std::vector<Point> Points; /*!< Vector of points type definition. */
+        typedef Simd::Rectangle<ptrdiff_t> Rect; /*!< Rectangle type definition. */
+        typedef Simd::View<Simd::Allocator> View; /*!< Image type definition. */
+        typedef Simd::Frame<Simd::Allocator> Frame; /*!< Frame type definition. */
+        typedef Simd::Pixel::Bgra32 Color; /*!< Color type definition. Alpha channel sets opacity of the primitive. */
+
+        /*!
+            Creates a new empty YuvOverlay.
+        */
+        YuvOverlay()
+        {
+        }
+
+        /*!
+            Removes all primitives from the overlay.
+        */
+        void Clear()
+        {
+            _primitives.clear();
+        }
+
+        /*!
+            Gets number of accumulated primitives.
+
+            \return a number of primitives.
+        */
+        size_t Size() const
+        {
+            return _primitives.size();
+        }
+
+        /*!
+            Adds a rectangle frame to the overlay.
+
+            \param [in] rect - a rectangle.
+            \param [in] color - a color of the rectangle frame.
+            \param [in] width - a width of the rectangle frame. By default it is equal to 1.
+        */
+        void AddRectangle(const Rect & rect, const Color & color, size_t width = 1)
+        {
+            ptrdiff_t w = std::min<ptrdiff_t>(width, std::min(rect.Width(), rect.Height()));
+            if (w <= 0)
+                return;
+            AddFilledRectangle(Rect(rect.left, rect.top, rect.right, rect.top + w), color);
+            AddFilledRectangle(Rect(rect.left, rect.bottom - w, rect.right, rect.bottom), color);
+            AddFilledRectangle(Rect(rect.left, rect.top + w, rect.left + w, rect.bottom - w), color);
+            AddFilledRectangle(Rect(rect.right - w, rect.top + w, rect.right, rect.bottom - w), color);
+        }
+
+        /*!
+            Adds a filled rectangle to the overlay.
+
+            \param [in] rect - a rectangle.
+            \param [in] color - a color of the rectangle.
+        */
+        void AddFilledRectangle(const Rect & rect, const Color & color)
+        {
+            if (rect.Empty() || color.alpha == 0)
+                return;
+            Primitive primitive(Primitive::Fill, color, rect);
+            _primitives.push_back(primitive);
+        }
+
+        /*!
+            Adds a polyline to the overlay.
+
+            \param [in] points - a points of the polyline.
+            \param [in] color - a color of the polyline.
+            \param [in] width - a width of the polyline. By default it is equal to 1.
+            \param [in] closed - a flag of closed polyline (the last point is connected to the first one). By default it is false.
+        */
+        void AddPolyline(const Points & points, const Color & color, size_t width = 1, bool closed = false)
+        {
+            if (points.size() < 2 || color.alpha == 0 || width == 0)
+                return;
+            Rect rect;
+            for (size_t i = 0; i < points.size(); ++i)
+                rect |= points[i];
+            ptrdiff_t border = width / 2 + 1;
+            Primitive primitive(Primitive::Lines, color, Rect(rect.left - border, rect.top - border, rect.right + border, rect.bottom + border));
+            primitive.points = points;
+            if (closed)
+                primitive.points.push_back(points[0]);
+            primitive.width = width;
+            _primitives.push_back(primitive);
+        }
+
+        /*!
+            Adds a text to the overlay. The text is rasterized into coverage mask immediately.
+
+            \param [in] font - a font used to draw the text.
+            \param [in] text - a text to draw.
+            \param [in] position - a position of the text (top left corner).
+            \param [in] color - a color of the text.
+            \return a result of the operation.
+        */
+        bool AddText(const Font & font, const String & text, const Point & position, const Color & color)
+        {
+            Point size = font.Measure(text);
+            if (size.x <= 0 || size.y <= 0 || color.alpha == 0)
+                return false;
+            Primitive primitive(Primitive::Mask, color, Rect(position, position + size));
+            primitive.image.reset(new View(size, View::Gray8));
+            Simd::Fill(*primitive.image, 0);
+            font.Draw(*primitive.image, text, Point(0, 0), uint8_t(color.alpha));
+            _primitives.push_back(primitive);
+            return true;
+        }
+
+        /*!
+            Adds a BGRA sprite to the overlay. Its alpha channel is used for blending. The sprite is copied.
+
+            \param [in] bgra - a 32-bit BGRA image of the sprite.
+            \param [in] position - a position of the sprite (top left corner).
+            \return a result of the operation.
+        */
+        bool AddSprite(const View & bgra, const Point & position)
+        {
+            if (bgra.format != View::Bgra32 || bgra.Area() == 0)
+                return false;
+            Primitive primitive(Primitive::Sprite, Color(), Rect(position, position + bgra.Size()));
+            primitive.image.reset(new View(bgra.Size(), View::Bgra32));
+            Simd::Copy(bgra, *primitive.image);
+            _primitives.push_back(primitive);
+            return true;
+        }
+
+        /*!
+            Renders all primitives into YUV420P image.
+
+            \param [in, out] y - an 8-bit Y plane. Its width and height must be even.
+            \param [in, out] u - an 8-bit U plane with half width and height.
+            \param [in, out] v - an 8-bit V plane with half width and height.
+            \param [in] yuvType - a type of YUV to BGR conversion. By default it is equal to ::SimdYuvBt601.
+            \return a result of the operation.
+        */
+        bool Render(View & y, View & u, View & v, SimdYuvType yuvType = SimdYuvBt601) const
+        {
+            if (!Compatible(y, u, View::Gray8) || !EqualSize(u, v) || v.format != View::Gray8)
+                return false;
+            for (size_t i = 0; i < _primitives.size(); ++i)
+                Render(_primitives[i], y, u, v, 0, yuvType);
+            return true;
+        }
+
+        /*!
+            Renders all primitives into NV12 or NV21 image.
+
+            \param [in, out] y - an 8-bit Y plane. Its width and height must be even.
+            \param [in, out] uv - a 16-bit interleaved UV (or VU for NV21) plane with half width and height.
+            \param [in] nv21 - a flag of NV21 format (interleaved plane has VU order). By default it is false.
+            \param [in] yuvType - a type of YUV to BGR conversion. By default it is equal to ::SimdYuvBt601.
+            \return a result of the operation.
+        */
+        bool Render(View & y, View & uv, bool nv21 = false, SimdYuvType yuvType = SimdYuvBt601) const
+        {
+            if (!Compatible(y, uv, View::Uv16))
+                return false;
+            View dummy;
+            for (size_t i = 0; i < _primitives.size(); ++i)
+                Render(_primitives[i], y, uv, dummy, nv21 ? 2 : 1, yuvType);
+            return true;
+        }
+
+        /*!
+            Renders all primitives into frame. Supported formats are Frame::Yuv420p, Frame::Nv12 and Frame::Nv21. 
+            A YUV type of the frame is used for color conversion (::SimdYuvBt601 if it is undefined).
+
+            \param [in, out] frame - a frame to draw.
+            \return a result of the operation.
+        */
+        bool Render(Frame & frame) const
+        {
+            SimdYuvType yuvType = frame.yuvType == SimdYuvUnknown ? SimdYuvBt601 : frame.yuvType;
+            switch (frame.format)
+            {
+            case Frame::Yuv420p: return Render(frame.planes[0], frame.planes[1], frame.planes[2], yuvType);
+            case Frame::Nv12: return Render(frame.planes[0], frame.planes[1], false, yuvType);
+            case Frame::Nv21: return Render(frame.planes[0], frame.planes[1], true, yuvType);
+            default:
+                return false;
+            }
+        }
+
+    private:
+        struct Primitive
+        {
+            enum Type { Fill, Lines, Mask, Sprite } type;
+            Color color;
+            Rect rect;
+            Points points;
+            size_t width;
+            std::shared_ptr<View> image;
+
+            Primitive(Type t, const Color & c, const Rect & r)
+                : type(t), color(c), rect(r), width(1)
+            {
+            }
+        };
+        typedef std::vector<Primitive> Primitives;
+
+        Primitives _primitives;
+        mutable View _mask, _alpha, _bgra, _y, _u, _v, _uv;
+
+        static bool Compatible(const View & y, const View & c, View::Format format)
+        {
+            return y.format == View::Gray8 && c.format == format && (y.width & 1) == 0 && (y.height & 1) == 0 
+                && c.width == y.width / 2 && c.height == y.height / 2;
+        }
+
+        static void Reserve(View & buffer, const Point & size, View::Format format)
+        {
+            if (buffer.width < (size_t)size.x || buffer.height < (size_t)size.y || buffer.format != format)
+                buffer.Recreate(std::max<size_t>(buffer.width, size.x), std::max<size_t>(buffer.height, size.y), format);
+        }
+
+        static void ToYuv(const Color & color, SimdYuvType yuvType, uint8_t yuv[3])
+        {
+            Color bgra(color.blue, color.green, color.red, 0xFF);
+            SimdBgraToYuv444pV2((uint8_t*)&bgra, 4, 1, 1, yuv + 0, 1, yuv + 1, 1, yuv + 2, 1, yuvType);
+        }
+
+        void Render(const Primitive & primitive, View & y, View & u, View & v, int interleaved, SimdYuvType yuvType) const
+        {
+            Rect clip = primitive.rect.Intersection(Rect(y.Size()));
+            if (clip.Empty())
+                return;
+            Rect even(clip.left & ~1, clip.top & ~1, (clip.right + 1) & ~1, (clip.bottom + 1) & ~1);
+            if (primitive.type == Primitive::Sprite)
+                RenderSprite(primitive, even, y, u, v, interleaved, yuvType);
+            else
+                RenderMask(primitive, even, y, u, v, interleaved, yuvType);
+        }
+
+        void RenderMask(const Primitive & primitive, const Rect & even, View & y, View & u, View & v, int interleaved, SimdYuvType yuvType) const
+        {
+            Reserve(_mask, even.Size(), View::Gray8);
+            Reserve(_alpha, Point(even.Width() / 2, 1), View::Gray8);
+            View mask = _mask.Region(even.Size(), View::TopLeft);
+            Simd::Fill(mask, 0);
+            uint8_t alpha = primitive.color.alpha;
+            switch (primitive.type)
+            {
+            case Primitive::Fill:
+                Simd::Fill(mask.Region(primitive.rect.Shifted(-even.TopLeft())).Ref(), alpha);
+                break;
+            case Primitive::Lines:
+                for (size_t i = 1; i < primitive.points.size(); ++i)
+                    DrawLine(mask, primitive.points[i - 1] - even.TopLeft(), primitive.points[i] - even.TopLeft(), alpha, primitive.width);
+                break;
+            case Primitive::Mask:
+            {
+                Rect src = even.Shifted(-primitive.rect.TopLeft()).Intersection(Rect(primitive.image->Size()));
+                Simd::Copy(primitive.image->Region(src), mask.Region(src.Shifted(primitive.rect.TopLeft() - even.TopLeft())).Ref());
+                break;
+            }
+            default:
+                assert(0);
+            }
+
+            uint8_t yuv[3], uv[2];
+            ToYuv(primitive.color, yuvType, yuv);
+            uv[0] = yuv[interleaved == 2 ? 2 : 1];
+            uv[1] = yuv[interleaved == 2 ? 1 : 2];
+            for (ptrdiff_t row = 0; row < even.Height(); row += 2)
+            {
+                ptrdiff_t begin = mask.width, end = 0;
+                for (ptrdiff_t r = row; r < row + 2; ++r)
+                {
+                    const uint8_t * m = mask.Row<uint8_t>(r);
+                    ptrdiff_t b = 0, e = mask.width;
+                    while (b < e && m[b] == 0)
+                        b++;
+                    while (e > b && m[e - 1] == 0)
+                        e--;
+                    if (b == e)
+                        continue;
+                    SimdAlphaFilling(y.Row<uint8_t>(even.top + r) + even.left + b, y.stride, e - b, 1, yuv, 1, m + b, mask.stride);
+                    begin = std::min(begin, b);
+                    end = std::max(end, e);
+                }
+                if (begin >= end)
+                    continue;
+                begin = begin & ~1;
+                end = (end + 1) & ~1;
+                size_t width = (end - begin) / 2;
+                ptrdiff_t cy = (even.top + row) / 2, cx = even.left / 2 + begin / 2;
+                SimdReduceGray2x2(mask.Row<uint8_t>(row) + begin, end - begin, 2, mask.stride, _alpha.data, width, 1, _alpha.stride);
+                if (interleaved)
+                    SimdAlphaFilling(u.Row<uint8_t>(cy) + cx * 2, u.stride, width, 1, uv, 2, _alpha.data, _alpha.stride);
+                else
+                {
+                    SimdAlphaFilling(u.Row<uint8_t>(cy) + cx, u.stride, width, 1, yuv + 1, 1, _alpha.data, _alpha.stride);
+                    SimdAlphaFilling(v.Row<uint8_t>(cy) + cx, v.stride, width, 1, yuv + 2, 1, _alpha.data, _alpha.stride);
+                }
+            }
+        }
+
+        void RenderSprite(const Primitive & primitive, const Rect & even, View & y, View & u, View & v, int interleaved, SimdYuvType yuvType) const
+        {
+            Point size = even.Size(), half = size / 2;
+            Reserve(_bgra, size, View::Bgra32);
+            View bgra = _bgra.Region(size, View::TopLeft);
+            Simd::Fill(bgra, 0);
+            Rect src = even.Shifted(-primitive.rect.TopLeft()).Intersection(Rect(primitive.image->Size()));
+            Simd::Copy(primitive.image->Region(src), bgra.Region(src.Shifted(primitive.rect.TopLeft() - even.TopLeft())).Ref());
+            Rect chroma(even.left / 2, even.top / 2, even.right / 2, even.bottom / 2);
+            if (interleaved == 0)
+            {
+                SimdAlphaBlendingBgraToYuv420p(bgra.data, bgra.stride, size.x, size.y, y.Region(even).data, y.stride,
+                    u.Region(chroma).data, u.stride, v.Region(chroma).data, v.stride, yuvType);
+                return;
+            }
+            Reserve(_mask, size, View::Gray8);
+            Reserve(_alpha, half, View::Gray8);
+            Reserve(_y, size, View::Gray8);
+            Reserve(_u, half, View::Gray8);
+            Reserve(_v, half, View::Gray8);
+            Reserve(_uv, half, View::Uv16);
+            SimdDeinterleaveBgra(bgra.data, bgra.stride, size.x, size.y, _y.data, _y.stride, _y.data, _y.stride, _y.data, _y.stride, _mask.data, _mask.stride);
+            SimdBgraToYuv420pV2(bgra.data, bgra.stride, size.x, size.y, _y.data, _y.stride, _u.data, _u.stride, _v.data, _v.stride, yuvType);
+            SimdAlphaBlending(_y.data, _y.stride, size.x, size.y, 1, _mask.data, _mask.stride, y.Region(even).data, y.stride);
+            SimdReduceGray2x2(_mask.data, size.x, size.y, _mask.stride, _alpha.data, half.x, half.y, _alpha.stride);
+            if (interleaved == 2)
+                SimdInterleaveUv(_v.data, _v.stride, _u.data, _u.stride, half.x, half.y, _uv.data, _uv.stride);
+            else
+                SimdInterleaveUv(_u.data, _u.stride, _v.data, _v.stride, half.x, half.y, _uv.data, _uv.stride);
+            SimdAlphaBlending(_uv.data, _uv.stride, half.x, half.y, 2, _alpha.data, _alpha.stride, u.Region(chroma).data, u.stride);
+        }
+    };
+}
+
+#endif
@@ -86,6 +86,8 @@ namespace Test
     TEST_ADD_GROUP_A0(BgraToRgb);
     TEST_ADD_GROUP_A0(BgraToRgba);
     TEST_ADD_GROUP_A0(BgrToGray);
+    TEST_ADD_GROUP_A0(BgrToGray16u);
+    TEST_ADD_GROUP_A0(BgrToGray32f);
     TEST_ADD_GROUP_A0(BgrToHsl);
     TEST_ADD_GROUP_A0(BgrToHsv);
     TEST_ADD_GROUP_AS(BgrToLab);
@@ -127,6 +129,7 @@ namespace Test
     TEST_ADD_GROUP_A0(Base64Encode);
 
     TEST_ADD_GROUP_A0(BayerToBgr);
+    TEST_ADD_GROUP_A0(BayerDemosaic);
 
     TEST_ADD_GROUP_A0(BayerToBgra);
 
@@ -139,6 +142,8 @@ namespace Test
     TEST_ADD_GROUP_A0(AveragingBinarization);
     TEST_ADD_GROUP_A0(AveragingBinarizationV2);
 
+    TEST_ADD_GROUP_A0(ColorPipeline);
+
     TEST_ADD_GROUP_A0(ConditionalCount8u);
     TEST_ADD_GROUP_A0(ConditionalCount16i);
     TEST_ADD_GROUP_A0(ConditionalSum);
@@ -167,6 +172,8 @@ namespace Test
     TEST_ADD_GROUP_A0(DeinterleaveUv);
     TEST_ADD_GROUP_A0(DeinterleaveBgr);
     TEST_ADD_GROUP_A0(DeinterleaveBgra);
+    TEST_ADD_GROUP_A0(Deinterleave16u);
+    TEST_ADD_GROUP_A0(Deinterleave32f);
 
     TEST_ADD_GROUP_A0(DetectionHaarDetect32fp);
     TEST_ADD_GROUP_A0(DetectionHaarDetect32fi);
@@ -180,6 +187,7 @@ namespace Test
     TEST_ADD_GROUP_A0(AlphaBlending2x);
     TEST_ADD_GROUP_A0(AlphaBlendingBgraToYuv420p);
     TEST_ADD_GROUP_A0(AlphaBlendingUniform);
+    TEST_ADD_GROUP_A0(AlphaCompositing);
     TEST_ADD_GROUP_A0(AlphaFilling);
     TEST_ADD_GROUP_A0(AlphaPremultiply);
     TEST_ADD_GROUP_A0(AlphaUnpremultiply);
@@ -193,6 +201,8 @@ namespace Test
 
     TEST_ADD_GROUP_0S(FontDraw);
 
+    TEST_ADD_GROUP_0S(YuvOverlay);
+
     TEST_ADD_GROUP_A0(Fill);
     TEST_ADD_GROUP_A0(FillFrame);
     TEST_ADD_GROUP_A0(FillBgra);
@@ -225,6 +235,8 @@ namespace Test
     TEST_ADD_GROUP_A0(MedianFilterRhomb5x5);
     TEST_ADD_GROUP_A0(MedianFilterSquare3x3);
     TEST_ADD_GROUP_A0(MedianFilterSquare5x5);
+    TEST_ADD_GROUP_A0(MedianFilter);
+    TEST_ADD_GROUP_A0(Morphology);
     TEST_ADD_GROUP_A0(GaussianBlur3x3);
     TEST_ADD_GROUP_A0(AbsGradientSaturatedSum);
     TEST_ADD_GROUP_A0(LbpEstimate);
@@ -249,6 +261,7 @@ namespace Test
     TEST_ADD_GROUP_A0(HogExtractFeatures);
     TEST_ADD_GROUP_A0(HogDeinterleave);
     TEST_ADD_GROUP_A0(HogFilterSeparable);
+    TEST_ADD_GROUP_A0(HogDetector);
 
     TEST_ADD_GROUP_0S(ImageMatcher);
 
@@ -257,8 +270,12 @@ namespace Test
     TEST_ADD_GROUP_A0(InterleaveUv);
     TEST_ADD_GROUP_A0(InterleaveBgr);
     TEST_ADD_GROUP_A0(InterleaveBgra);
+    TEST_ADD_GROUP_A0(Interleave16u);
+    TEST_ADD_GROUP_A0(Interleave32f);
 
     TEST_ADD_GROUP_0S(Motion);
+    TEST_ADD_GROUP_0S(MotionEngine);
+    TEST_ADD_GROUP_0S(MotionInput);
 
     TEST_ADD_GROUP_A0(NeuralConvert);
     TEST_ADD_GROUP_A0(NeuralProductSum);
@@ -295,12 +312,16 @@ namespace Test
     TEST_ADD_GROUP_A0(OperationBinary16i);
     TEST_ADD_GROUP_A0(VectorProduct);
 
+    TEST_ADD_GROUP_A0(OpticalFlowPyrLk);
+
     TEST_ADD_GROUP_A0(ReduceColor2x2);
     TEST_ADD_GROUP_A0(ReduceGray2x2);
     TEST_ADD_GROUP_A0(ReduceGray3x3);
     TEST_ADD_GROUP_A0(ReduceGray4x4);
     TEST_ADD_GROUP_A0(ReduceGray5x5);
 
+    TEST_ADD_GROUP_A0(Remap);
+
     TEST_ADD_GROUP_A0(Reorder16bit);
     TEST_ADD_GROUP_A0(Reorder32bit);
     TEST_ADD_GROUP_A0(Reorder64bit);
@@ -335,6 +356,7 @@ namespace Test
     TEST_ADD_GROUP_A0(ValueSquareSum);
     TEST_ADD_GROUP_A0(ValueSquareSums);
     TEST_ADD_GROUP_A0(CorrelationSum);
+    TEST_ADD_GROUP_A0(TemplateMatch);
 
     TEST_ADD_GROUP_A0(StretchGray2x2);
 
@@ -440,9 +462,12 @@ namespace Test
     TEST_ADD_GROUP_A0(Uyvy422ToBgr);
 
     TEST_ADD_GROUP_A0(WarpAffine);
+    TEST_ADD_GROUP_A0(WarpAffineBatch);
 #ifdef SIMD_OPENCV_ENABLE
     TEST_ADD_GROUP_0S(WarpAffineOpenCv);
 #endif
+    TEST_ADD_GROUP_A0(WarpPerspective);
+    TEST_ADD_GROUP_0S(WarpPerspectiveAffine);
 
 #if defined(SIMD_SYNET_ENABLE)
     TEST_ADD_GROUP_A0(WinogradKernel1x3Block1x4SetFilter);
@@ -484,6 +509,17 @@ namespace Test
     TEST_ADD_GROUP_A0(Yuv444pToHue);
     TEST_ADD_GROUP_A0(Yuv420pToHue);
     TEST_ADD_GROUP_A0(Yuv444pToRgbV2);
+    TEST_ADD_GROUP_A0(Yuv16ToBgr);
+    TEST_ADD_GROUP_A0(Nv12ToBgrV2);
+    TEST_ADD_GROUP_A0(Nv12ToBgraV2);
+    TEST_ADD_GROUP_A0(Nv12ToRgbV2);
+    TEST_ADD_GROUP_A0(Nv12ToRgbaV2);
+    TEST_ADD_GROUP_A0(Nv21ToBgrV2);
+    TEST_ADD_GROUP_A0(Nv21ToBgraV2);
+    TEST_ADD_GROUP_A0(Nv21ToRgbV2);
+    TEST_ADD_GROUP_A0(Nv21ToRgbaV2);
+    TEST_ADD_GROUP_A0(Nv12ToBgrResized);
+    TEST_ADD_GROUP_A0(FrameConverter);
     TEST_ADD_GROUP_A0(Yuv422pToRgbV2);
     TEST_ADD_GROUP_AS(Yuv420pToRgbV2);
     TEST_ADD_GROUP_A0(Yuv420pToUyvy422);
@@ -258,6 +258,133 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncGN
+        {
+            typedef void(*FuncPtr)(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, size_t channels, uint8_t* gray, size_t grayStride);
+
+            FuncPtr func;
+            String desc;
+
+            FuncGN(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t channels)
+            {
+                desc = desc + "[" + ToString(channels) + "]";
+            }
+
+            void Call(const View& bgr, size_t channels, View& gray) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(bgr.data, bgr.stride, gray.width, gray.height, channels, gray.data, gray.stride);
+            }
+        };
+    }
+
+#define FUNC_GN(function) FuncGN(function, #function)
+
+    bool BgrToGrayNAutoTest(View::Format format, size_t channels, int width, int height, FuncGN f1, FuncGN f2)
+    {
+        bool result = true;
+
+        f1.Update(channels);
+        f2.Update(channels);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        View bgr(width * channels, height, format, NULL, TEST_ALIGN(width));
+        if (format == View::Float)
+            FillRandom32f(bgr, 0.0f, 1.0f);
+        else
+            FillRandom16u(bgr);
+
+        View gray1(width, height, format, NULL, TEST_ALIGN(width));
+        View gray2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(bgr, channels, gray1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(bgr, channels, gray2));
+
+        if (format == View::Float)
+            result = result && Compare(gray1, gray2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(gray1, gray2, 0, true, 64);
+
+        return result;
+    }
+
+    bool BgrToGrayNAutoTest(View::Format format, const FuncGN& f1, const FuncGN& f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 3; channels <= 4; ++channels)
+        {
+            result = result && BgrToGrayNAutoTest(format, channels, W, H, f1, f2);
+            result = result && BgrToGrayNAutoTest(format, channels, W + O, H - O, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool BgrToGray16uViewTest(View::Format format, size_t channels)
+    {
+        size_t width = W + O, height = H - O;
+        View raw(width * channels, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(raw);
+        View bgr(width, height, raw.stride, format, raw.data);
+
+        View gray1(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View gray2(width, height, View::Gray16, NULL, TEST_ALIGN(width));
+        SimdBgrToGray16u(raw.data, raw.stride, width, height, channels, gray1.data, gray1.stride);
+        Simd::BgrToGray16u(bgr, gray2);
+
+        return Compare(gray1, View(width, height, gray2.stride, View::Int16, gray2.data), 0, true, 64, 0, "View");
+    }
+
+    bool BgrToGray16uAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        result = result && BgrToGray16uViewTest(View::Bgr48, 3);
+        result = result && BgrToGray16uViewTest(View::Bgra64, 4);
+
+        if (TestBase(options))
+            result = result && BgrToGrayNAutoTest(View::Int16, FUNC_GN(Simd::Base::BgrToGray16u), FUNC_GN(SimdBgrToGray16u));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options) && W >= Simd::Sse41::HA)
+            result = result && BgrToGrayNAutoTest(View::Int16, FUNC_GN(Simd::Sse41::BgrToGray16u), FUNC_GN(SimdBgrToGray16u));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options) && W >= Simd::Avx2::HA)
+            result = result && BgrToGrayNAutoTest(View::Int16, FUNC_GN(Simd::Avx2::BgrToGray16u), FUNC_GN(SimdBgrToGray16u));
+#endif 
+
+        return result;
+    }
+
+    bool BgrToGray32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && BgrToGrayNAutoTest(View::Float, FUNC_GN(Simd::Base::BgrToGray32f), FUNC_GN(SimdBgrToGray32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options) && W >= Simd::Sse41::F)
+            result = result && BgrToGrayNAutoTest(View::Float, FUNC_GN(Simd::Sse41::BgrToGray32f), FUNC_GN(SimdBgrToGray32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options) && W >= Simd::Avx2::F)
+            result = result && BgrToGrayNAutoTest(View::Float, FUNC_GN(Simd::Avx2::BgrToGray32f), FUNC_GN(SimdBgrToGray32f));
+#endif 
+
+        return result;
+    }
+
     bool BgrToHslAutoTest(const Options & options)
     {
         bool result = true;
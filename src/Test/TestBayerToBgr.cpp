@@ -113,4 +113,106 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncBd
+        {
+            typedef void(*FuncPtr)(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height, SimdPixelFormatType bayerFormat, size_t bitDepth,
+                size_t blackLevel, const float* gains, SimdBayerDemosaicType method, uint8_t* dst, size_t dstStride, SimdPixelFormatType dstFormat);
+            FuncPtr func;
+            String description;
+
+            FuncBd(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdPixelFormatType bayerFormat, size_t bitDepth, SimdBayerDemosaicType method, View::Format dstFormat)
+            {
+                description = description + "[" + ToString(bayerFormat - SimdPixelFormatBayerGrbg) + "-" + ToString(bitDepth) + "-" +
+                    (method == SimdBayerDemosaicMalvar ? "M" : "E") + "-" + ToString(View::PixelSize(dstFormat)) + "]";
+            }
+
+            void Call(const View& src, SimdPixelFormatType bayerFormat, size_t bitDepth, size_t blackLevel, const float* gains, SimdBayerDemosaicType method, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, bayerFormat, bitDepth, blackLevel, gains, method, dst.data, dst.stride, (SimdPixelFormatType)dst.format);
+            }
+        };
+    }
+
+#define FUNC_BD(func) FuncBd(func, #func)
+
+    bool BayerDemosaicAutoTest(int width, int height, SimdPixelFormatType bayerFormat, size_t bitDepth, SimdBayerDemosaicType method, View::Format dstFormat, FuncBd f1, FuncBd f2)
+    {
+        bool result = true;
+
+        f1.Update(bayerFormat, bitDepth, method, dstFormat);
+        f2.Update(bayerFormat, bitDepth, method, dstFormat);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View s(width, height, bitDepth > 8 ? View::Int16 : View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+        size_t blackLevel = bitDepth > 8 ? (size_t(1) << (bitDepth - 4)) : 16;
+        const float gains[3] = { 1.75f, 1.0f, 1.25f };
+
+        View d1(width, height, dstFormat, NULL, TEST_ALIGN(width));
+        View d2(width, height, dstFormat, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, bayerFormat, bitDepth, blackLevel, gains, method, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, bayerFormat, bitDepth, blackLevel, gains, method, d2));
+
+        result = result && Compare(d1, d2, 1, true, 64);
+
+        return result;
+    }
+
+    bool BayerDemosaicAutoTest(const FuncBd& f1, const FuncBd& f2)
+    {
+        bool result = true;
+
+        const size_t bitDepths[] = { 8, 10, 12, 16 };
+        SimdBayerDemosaicType methods[] = { SimdBayerDemosaicMalvar, SimdBayerDemosaicEdgeDirected };
+        View::Format dstFormats[] = { View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (int bayerFormat = SimdPixelFormatBayerGrbg; bayerFormat <= SimdPixelFormatBayerBggr; bayerFormat++)
+        {
+            for (size_t b = 0; b < 4; ++b)
+            {
+                for (size_t m = 0; m < 2; ++m)
+                {
+                    for (size_t d = 0; d < 4; ++d)
+                    {
+                        if (d != 0 && (b != 0 || bayerFormat != SimdPixelFormatBayerGrbg))
+                            continue;
+                        result = result && BayerDemosaicAutoTest(W, H, (SimdPixelFormatType)bayerFormat, bitDepths[b], methods[m], dstFormats[d], f1, f2);
+                        result = result && BayerDemosaicAutoTest(W + O, H - O, (SimdPixelFormatType)bayerFormat, bitDepths[b], methods[m], dstFormats[d], f1, f2);
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool BayerDemosaicAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && BayerDemosaicAutoTest(FUNC_BD(Simd::Base::BayerDemosaic), FUNC_BD(SimdBayerDemosaic));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options) && W >= Simd::Sse41::A)
+            result = result && BayerDemosaicAutoTest(FUNC_BD(Simd::Sse41::BayerDemosaic), FUNC_BD(SimdBayerDemosaic));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options) && W >= Simd::Avx2::A)
+            result = result && BayerDemosaicAutoTest(FUNC_BD(Simd::Avx2::BayerDemosaic), FUNC_BD(SimdBayerDemosaic));
+#endif
+
+        return result;
+    }
 }
@@ -0,0 +1,155 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+
+#include "Simd/SimdColorPipeline.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncCP
+        {
+            typedef void*(*FuncPtr)(SimdPixelFormatType format, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags);
+
+            FuncPtr func;
+            String description;
+
+            FuncCP(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(View::Format format, bool matrix, bool curves, size_t lutSize, SimdColorPipelineFlags flags)
+            {
+                std::stringstream ss;
+                ss << description << "[" << View::PixelSize(format) << (format == View::Rgb24 || format == View::Rgba32 ? "r" : "b");
+                ss << "-" << (matrix ? "m" : "") << (curves ? "c" : "") << (lutSize ? "l" + ToString(lutSize) : "");
+                ss << ((flags & SimdColorPipelineLut16u) ? "-16u" : "") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst, const float* matrix, const float* curves, size_t curveSize, const float* lut, size_t lutSize, SimdColorPipelineFlags flags) const
+            {
+                void * context = func((SimdPixelFormatType)src.format, matrix, curves, curveSize, lut, lutSize, flags);
+                if (context)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdColorPipelineRun(context, src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_CP(function) FuncCP(function, std::string(#function))
+
+    bool ColorPipelineAutoTest(size_t width, size_t height, View::Format format, const float* matrix, const float* curves, size_t curveSize, 
+        const float* lut, size_t lutSize, SimdColorPipelineFlags flags, FuncCP f1, FuncCP f2)
+    {
+        bool result = true;
+
+        f1.Update(format, matrix != NULL, curves != NULL, lut ? lutSize : 0, flags);
+        f2.Update(format, matrix != NULL, curves != NULL, lut ? lutSize : 0, flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, matrix, curves, curveSize, lut, lutSize, flags));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, matrix, curves, curveSize, lut, lutSize, flags));
+
+        result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool ColorPipelineAutoTest(const FuncCP& f1, const FuncCP& f2)
+    {
+        bool result = true;
+
+        const float matrix[9] = { 1.60f, -0.45f, -0.15f, -0.25f, 1.45f, -0.20f, -0.05f, -0.55f, 1.60f };
+
+        const size_t curveSize = 256;
+        Buffer32f curves(3 * curveSize);
+        for (size_t c = 0; c < 3; ++c)
+            for (size_t i = 0; i < curveSize; ++i)
+                curves[c * curveSize + i] = ::powf(float(i) / float(curveSize - 1), 1.0f / (2.0f + 0.2f * float(c)));
+
+        const size_t lutSize = 33;
+        Buffer32f lut(lutSize * lutSize * lutSize * 3);
+        for (size_t b = 0, i = 0; b < lutSize; ++b)
+        {
+            for (size_t g = 0; g < lutSize; ++g)
+            {
+                for (size_t r = 0; r < lutSize; ++r, i += 3)
+                {
+                    float _r = float(r) / float(lutSize - 1), _g = float(g) / float(lutSize - 1), _b = float(b) / float(lutSize - 1);
+                    lut[i + 0] = _r * 0.85f + _g * 0.10f + 0.05f * _b * _b;
+                    lut[i + 1] = ::sqrtf(_g * 0.9f + _r * 0.1f);
+                    lut[i + 2] = _b * _b * 0.7f + _g * 0.3f;
+                }
+            }
+        }
+
+        View::Format formats[4] = { View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (size_t f = 0; f < 4; ++f)
+        {
+            result = result && ColorPipelineAutoTest(W, H, formats[f], matrix, NULL, 0, NULL, 0, SimdColorPipelineDefault, f1, f2);
+            result = result && ColorPipelineAutoTest(W, H, formats[f], NULL, curves.data(), curveSize, lut.data(), lutSize, SimdColorPipelineDefault, f1, f2);
+            result = result && ColorPipelineAutoTest(W, H, formats[f], matrix, curves.data(), curveSize, lut.data(), lutSize, SimdColorPipelineDefault, f1, f2);
+            result = result && ColorPipelineAutoTest(W + O, H - O, formats[f], matrix, curves.data(), curveSize, lut.data(), lutSize, SimdColorPipelineLut16u, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ColorPipelineAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && ColorPipelineAutoTest(FUNC_CP(Simd::Base::ColorPipelineInit), FUNC_CP(SimdColorPipelineInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && ColorPipelineAutoTest(FUNC_CP(Simd::Sse41::ColorPipelineInit), FUNC_CP(SimdColorPipelineInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && ColorPipelineAutoTest(FUNC_CP(Simd::Avx2::ColorPipelineInit), FUNC_CP(SimdColorPipelineInit));
+#endif
+
+        return result;
+    }
+}
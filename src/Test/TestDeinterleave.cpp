@@ -327,4 +327,161 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncDN
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+                uint8_t* dst0, size_t dst0Stride, uint8_t* dst1, size_t dst1Stride, uint8_t* dst2, size_t dst2Stride, uint8_t* dst3, size_t dst3Stride);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDN(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t channels)
+            {
+                desc = desc + "[" + ToString(channels) + "]";
+            }
+
+            void Call(const View& src, size_t channels, View dst[4]) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.data, src.stride, dst[0].width, src.height, channels, dst[0].data, dst[0].stride,
+                    dst[1].data, dst[1].stride, dst[2].data, dst[2].stride, dst[3].data, dst[3].stride);
+            }
+        };
+    }
+
+#define FUNC_DN(function) FuncDN(function, #function)
+
+    bool DeinterleaveNAutoTest(View::Format format, size_t channels, int width, int height, FuncDN f1, FuncDN f2)
+    {
+        bool result = true;
+
+        f1.Update(channels);
+        f2.Update(channels);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        View src(width * channels, height, format, NULL, TEST_ALIGN(width));
+        if (format == View::Float)
+            FillRandom32f(src, -1000.0f, 1000.0f);
+        else
+            FillRandom16u(src);
+
+        View dst1[4], dst2[4];
+        for (size_t c = 0; c < channels; ++c)
+        {
+            dst1[c].Recreate(width, height, format, NULL, TEST_ALIGN(width));
+            dst2[c].Recreate(width, height, format, NULL, TEST_ALIGN(width));
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, dst2));
+
+        for (size_t c = 0; c < channels && result; ++c)
+            result = result && Compare(dst1[c], dst2[c], 0, true, 64, 0, "dst" + ToString(c));
+
+        return result;
+    }
+
+    bool DeinterleaveNAutoTest(View::Format format, const FuncDN& f1, const FuncDN& f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 2; channels <= 4; ++channels)
+        {
+            result = result && DeinterleaveNAutoTest(format, channels, W, H, f1, f2);
+            result = result && DeinterleaveNAutoTest(format, channels, W + O, H - O, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool Deinterleave16uViewTest(View::Format format, size_t channels)
+    {
+        size_t width = W + O, height = H - O;
+        View raw(width * channels, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(raw);
+        View src(width, height, raw.stride, format, raw.data);
+
+        View planes[4], dst(width, height, format, NULL, TEST_ALIGN(width));
+        for (size_t c = 0; c < channels; ++c)
+            planes[c].Recreate(width, height, View::Gray16, NULL, TEST_ALIGN(width));
+        if (channels == 3)
+        {
+            Simd::Deinterleave16u(src, planes[0], planes[1], planes[2]);
+            Simd::Interleave16u(planes[0], planes[1], planes[2], dst);
+        }
+        else
+        {
+            Simd::Deinterleave16u(src, planes[0], planes[1], planes[2], planes[3]);
+            Simd::Interleave16u(planes[0], planes[1], planes[2], planes[3], dst);
+        }
+
+        for (size_t y = 0; y < height; ++y)
+        {
+            const uint16_t* s = raw.Row<uint16_t>(y), * d = dst.Row<uint16_t>(y);
+            for (size_t x = 0, i = 0; x < width; ++x)
+            {
+                for (size_t c = 0; c < channels; ++c, ++i)
+                {
+                    if (planes[c].Row<uint16_t>(y)[x] != s[i] || d[i] != s[i])
+                    {
+                        TEST_LOG_SS(Error, "Deinterleave16u/Interleave16u for View[" << channels << "] error at (" << x << ", " << y << ", " << c << ") !");
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    bool Deinterleave16uAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        result = result && Deinterleave16uViewTest(View::Bgr48, 3);
+        result = result && Deinterleave16uViewTest(View::Rgba64, 4);
+
+        if (TestBase(options))
+            result = result && DeinterleaveNAutoTest(View::Int16, FUNC_DN(Simd::Base::Deinterleave16u), FUNC_DN(SimdDeinterleave16u));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options) && W >= Simd::Sse41::HA)
+            result = result && DeinterleaveNAutoTest(View::Int16, FUNC_DN(Simd::Sse41::Deinterleave16u), FUNC_DN(SimdDeinterleave16u));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options) && W >= Simd::Avx2::HA)
+            result = result && DeinterleaveNAutoTest(View::Int16, FUNC_DN(Simd::Avx2::Deinterleave16u), FUNC_DN(SimdDeinterleave16u));
+#endif 
+
+        return result;
+    }
+
+    bool Deinterleave32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && DeinterleaveNAutoTest(View::Float, FUNC_DN(Simd::Base::Deinterleave32f), FUNC_DN(SimdDeinterleave32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options) && W >= Simd::Sse41::F)
+            result = result && DeinterleaveNAutoTest(View::Float, FUNC_DN(Simd::Sse41::Deinterleave32f), FUNC_DN(SimdDeinterleave32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options) && W >= Simd::Avx2::F)
+            result = result && DeinterleaveNAutoTest(View::Float, FUNC_DN(Simd::Avx2::Deinterleave32f), FUNC_DN(SimdDeinterleave32f));
+#endif 
+
+        return result;
+    }
 }
@@ -483,29 +483,8 @@ namespace Test
 #endif
     }
 
-    bool DetectionSpecialTest(const Options & options)
+    static bool Compare(const Objects & os, const Objects & om, const String & desc)
     {
-        Detection detection;
-
-        double time = GetTime();
-        detection.Load(ROOT_PATH + "/data/cascade/haar_face_0.xml", 0);
-        detection.Load(ROOT_PATH + "/data/cascade/haar_face_1.xml", 1);
-        detection.Load(ROOT_PATH + "/data/cascade/lbp_face.xml", 2);
-        TEST_LOG_SS(Info, "Load: " << (GetTime() - time) * 1000 << " ms " << std::endl);
-
-        Objects os, om;
-
-        DetectionSpecialTest(detection, os, 1);
-
-        if (std::thread::hardware_concurrency() >= 2)
-            DetectionSpecialTest(detection, om, 2);
-
-        if(std::thread::hardware_concurrency() >= 4)
-            DetectionSpecialTest(detection, om, 4);
-
-        if (std::thread::hardware_concurrency() >= 8)
-            DetectionSpecialTest(detection, om, 8);
-
         bool result = true;
         if (os.size() != om.size())
             result = false;
@@ -530,7 +509,7 @@ namespace Test
                     << os[i].rect.right << ", " << os[i].rect.bottom << ") - " << os[i].weight);
             }
 
-            TEST_LOG_SS(Error, "Detection multi threads: ");
+            TEST_LOG_SS(Error, "Detection " << desc << ": ");
             for (size_t i = 0; i < om.size(); ++i)
             {
                 TEST_LOG_SS(Error, "(" << om[i].rect.left << ", " << om[i].rect.top << ", "
@@ -540,5 +519,82 @@ namespace Test
 
         return result;
     }
+
+    static bool DetectionBatchSpecialTest(Detection & detection, const Objects & objects, size_t batch)
+    {
+        View src = GetSample(Size(W, H), true);
+        Detection::Views srcs(batch, src);
+        Detection::RectsList rects(batch);
+        size_t B = O + E;
+        for (size_t i = 0; i < batch; ++i)
+            rects[i].push_back(Rect(B, B, W - B, H - B));
+
+        Detection::ObjectsList dst;
+        double time = GetTime();
+        detection.Detect(srcs, dst, 3, 0.2, true, rects);
+        TEST_LOG_SS(Info, "Detect batch of " << batch << " : " << (GetTime() - time) * 1000 << " ms " << std::endl);
+
+        bool result = dst.size() == batch;
+        for (size_t i = 0; i < dst.size() && result; ++i)
+            result = Compare(objects, dst[i], String("batch ") + ToString(i));
+        return result;
+    }
+
+    static bool DetectionTaskQueueSpecialTest(Detection & detection)
+    {
+        View gray = GetSample(Size(W, H), true);
+        View bgr(gray.Size(), View::Bgr24);
+        Simd::Convert(gray, bgr);
+
+        Objects objects[2];
+        for (size_t i = 0; i < 2; ++i)
+        {
+            detection.Init(bgr.Size(), 1.1, Size(), Size(INT_MAX, INT_MAX), View(), i ? 3 : 1);
+            detection.Detect(bgr, objects[i]);
+        }
+        if (objects[0].empty())
+        {
+            TEST_LOG_SS(Error, "Detection without motion mask finds nothing!");
+            return false;
+        }
+        return Compare(objects[0], objects[1], "without motion mask");
+    }
+
+    bool DetectionSpecialTest(const Options & options)
+    {
+        Detection detection;
+
+        double time = GetTime();
+        detection.Load(ROOT_PATH + "/data/cascade/haar_face_0.xml", 0);
+        detection.Load(ROOT_PATH + "/data/cascade/haar_face_1.xml", 1);
+        detection.Load(ROOT_PATH + "/data/cascade/lbp_face.xml", 2);
+        TEST_LOG_SS(Info, "Load: " << (GetTime() - time) * 1000 << " ms " << std::endl);
+
+        Objects os, om;
+
+        DetectionSpecialTest(detection, os, 1);
+
+        if (std::thread::hardware_concurrency() >= 2)
+            DetectionSpecialTest(detection, om, 2);
+
+        if(std::thread::hardware_concurrency() >= 4)
+            DetectionSpecialTest(detection, om, 4);
+
+        if (std::thread::hardware_concurrency() >= 8)
+            DetectionSpecialTest(detection, om, 8);
+
+        bool result = std::thread::hardware_concurrency() < 2 || Compare(os, om, "multi threads");
+
+        for (int threadNumber = 1; threadNumber <= 3 && result; ++threadNumber)
+        {
+            DetectionSpecialTest(detection, om, threadNumber);
+            result = result && Compare(os, om, String("threads ") + ToString(threadNumber));
+            result = result && DetectionBatchSpecialTest(detection, os, 5);
+        }
+
+        result = result && DetectionTaskQueueSpecialTest(detection);
+
+        return result;
+    }
 }
 
@@ -413,6 +413,101 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncAC
+        {
+            typedef void(*FuncPtr)(const SimdAlphaCompositingLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height);
+            FuncPtr func;
+            String description;
+
+            FuncAC(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const std::vector<SimdAlphaCompositingLayer>& layers, const View& dstSrc, View& dstDst) const
+            {
+                Simd::Copy(dstSrc, dstDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(layers.data(), layers.size(), dstDst.data, dstDst.stride, dstDst.width, dstDst.height);
+            }
+        };
+    }
+
+#define FUNC_AC(func) FuncAC(func, #func)
+
+    bool AlphaCompositingAutoTest(int width, int height, size_t count, const FuncAC& f1, const FuncAC& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] and " << count << " layers.");
+
+        View b(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(b);
+        Simd::AlphaPremultiply(b, b);
+
+        std::vector<View> images(count);
+        std::vector<SimdAlphaCompositingLayer> layers(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            SimdAlphaCompositingLayer& layer = layers[i];
+            layer.width = width / 2 + Random(width);
+            layer.height = height / 2 + Random(height / 2);
+            images[i].Recreate(layer.width, layer.height, View::Bgra32, NULL, TEST_ALIGN(width));
+            FillRandom(images[i]);
+            layer.premultiplied = i & 1 ? SimdTrue : SimdFalse;
+            if (layer.premultiplied)
+                Simd::AlphaPremultiply(images[i], images[i]);
+            layer.src = images[i].data;
+            layer.srcStride = images[i].stride;
+            layer.left = Random(width) - width / 3;
+            layer.top = Random(height) - height / 3;
+            layer.alpha = i & 2 ? 0xFF : uint8_t(Random(256));
+            layer.mode = SimdAlphaCompositingModeType(i % 4);
+        }
+
+        View d1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(layers, b, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(layers, b, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool AlphaCompositingAutoTest(const FuncAC& f1, const FuncAC& f2)
+    {
+        bool result = true;
+
+        result = result && AlphaCompositingAutoTest(W, H, 12, f1, f2);
+        result = result && AlphaCompositingAutoTest(W + O, H - O, 9, f1, f2);
+
+        return result;
+    }
+
+    bool AlphaCompositingAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && AlphaCompositingAutoTest(FUNC_AC(Simd::Base::AlphaCompositing), FUNC_AC(SimdAlphaCompositing));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options) && W >= Simd::Sse41::F)
+            result = result && AlphaCompositingAutoTest(FUNC_AC(Simd::Sse41::AlphaCompositing), FUNC_AC(SimdAlphaCompositing));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options) && W >= Simd::Avx2::F)
+            result = result && AlphaCompositingAutoTest(FUNC_AC(Simd::Avx2::AlphaCompositing), FUNC_AC(SimdAlphaCompositing));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
     namespace
     {
         struct FuncAF
@@ -29,6 +29,7 @@
 #include "Test/TestOptions.h"
 
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdMedianFilter.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
 
 namespace Test
@@ -293,6 +294,225 @@ namespace Test
         return result;
     }
 
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncMF
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags);
+
+            FuncPtr func;
+            String description;
+
+            FuncMF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, size_t r, SimdMedianFilterFlags f)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << (f == SimdMedianFilter16u ? "16u" : "8u") << "-" << c << "-" << r << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t channels, size_t radius, SimdMedianFilterFlags flags, View& dst) const
+            {
+                void* filter = func(src.width, src.height, channels, radius, flags);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdMedianFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_MF(function) \
+    FuncMF(function, std::string(#function))
+
+    bool MedianFilterAutoTest(size_t width, size_t height, size_t channels, size_t radius, SimdMedianFilterFlags flags, FuncMF f1, FuncMF f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, radius, flags);
+        f2.Update(channels, radius, flags);
+
+        View src;
+        if (flags == SimdMedianFilter16u)
+        {
+            TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+            src.Recreate(width, height, View::Int16);
+            FillRandom(src);
+        }
+        else if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
+            return false;
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x03);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, radius, flags, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, radius, flags, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool MedianFilterAutoTest(const FuncMF& f1, const FuncMF& f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 1; channels <= 4; channels++)
+        {
+            if (channels == 2 && (!REAL_IMAGE.empty() || NOISE_IMAGE == false))
+                continue;
+            result = result && MedianFilterAutoTest(W, H, channels, 3, SimdMedianFilter8u, f1, f2);
+            result = result && MedianFilterAutoTest(W + O, H - O, channels, 15, SimdMedianFilter8u, f1, f2);
+        }
+        result = result && MedianFilterAutoTest(W, H, 1, 3, SimdMedianFilter16u, f1, f2);
+        result = result && MedianFilterAutoTest(W + O, H - O, 1, 15, SimdMedianFilter16u, f1, f2);
+
+        return result;
+    }
+
+    bool MedianFilterAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && MedianFilterAutoTest(FUNC_MF(Simd::Base::MedianFilterInit), FUNC_MF(SimdMedianFilterInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && MedianFilterAutoTest(FUNC_MF(Simd::Sse41::MedianFilterInit), FUNC_MF(SimdMedianFilterInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && MedianFilterAutoTest(FUNC_MF(Simd::Avx2::MedianFilterInit), FUNC_MF(SimdMedianFilterInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncMO
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels,
+                size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, uint8_t* dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncMO(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, size_t kx, size_t ky, SimdMorphologyShapeType s, SimdMorphologyOperationType o)
+            {
+                static const char* ops[] = { "erode", "dilate", "open", "close", "gradient" };
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << ops[o] << "-" << (s == SimdMorphologyShapeCross ? "cross" : "rect") << "-" << c << "-" << kx << "x" << ky << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t channels, size_t kernelX, size_t kernelY, SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, channels, kernelX, kernelY, shape, operation, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_MO(function) \
+    FuncMO(function, std::string(#function))
+
+    bool MorphologyAutoTest(size_t width, size_t height, size_t channels, size_t kernelX, size_t kernelY,
+        SimdMorphologyShapeType shape, SimdMorphologyOperationType operation, FuncMO f1, FuncMO f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, kernelX, kernelY, shape, operation);
+        f2.Update(channels, kernelX, kernelY, shape, operation);
+
+        View src;
+        if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
+            return false;
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x03);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, kernelX, kernelY, shape, operation, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, kernelX, kernelY, shape, operation, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool MorphologyAutoTest(const FuncMO& f1, const FuncMO& f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 1; channels <= 4; channels++)
+        {
+            if (channels == 2 && (!REAL_IMAGE.empty() || NOISE_IMAGE == false))
+                continue;
+            result = result && MorphologyAutoTest(W, H, channels, 3, 3, SimdMorphologyShapeRect, SimdMorphologyErode, f1, f2);
+            result = result && MorphologyAutoTest(W + O, H - O, channels, 15, 7, SimdMorphologyShapeRect, SimdMorphologyDilate, f1, f2);
+            result = result && MorphologyAutoTest(W, H, channels, 5, 5, SimdMorphologyShapeCross, SimdMorphologyOpen, f1, f2);
+            result = result && MorphologyAutoTest(W + O, H - O, channels, 1, 9, SimdMorphologyShapeRect, SimdMorphologyClose, f1, f2);
+            result = result && MorphologyAutoTest(W, H, channels, 7, 4, SimdMorphologyShapeCross, SimdMorphologyGradient, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool MorphologyZeroKernelTest()
+    {
+        View src(W, H, View::Gray8, NULL, TEST_ALIGN(W));
+        View dst(W, H, View::Gray8, NULL, TEST_ALIGN(W));
+        View control(W, H, View::Gray8, NULL, TEST_ALIGN(W));
+        FillRandom(src);
+        Simd::Fill(dst, 0x05);
+        Simd::Fill(control, 0x05);
+
+        SimdMorphology(src.data, src.stride, src.width, src.height, 1, 0, 3, SimdMorphologyShapeRect, SimdMorphologyErode, dst.data, dst.stride);
+        SimdMorphology(src.data, src.stride, src.width, src.height, 1, 3, 0, SimdMorphologyShapeCross, SimdMorphologyGradient, dst.data, dst.stride);
+
+        return Compare(dst, control, 0, true, 64, 0, "zero kernel");
+    }
+
+    bool MorphologyAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        result = result && MorphologyZeroKernelTest();
+
+        if (TestBase(options))
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Base::Morphology), FUNC_MO(SimdMorphology));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options) && W >= Simd::Sse41::A)
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Sse41::Morphology), FUNC_MO(SimdMorphology));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options) && W >= Simd::Avx2::A)
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Avx2::Morphology), FUNC_MO(SimdMorphology));
+#endif
+
+        return result;
+    }
+
     bool GaussianBlur3x3AutoTest(const Options & options)
     {
         bool result = true;
@@ -674,25 +894,27 @@ namespace Test
     {
         struct FuncGB
         {
-            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon, SimdGaussianBlurFlags flags);
 
             FuncPtr func;
             String description;
 
             FuncGB(const FuncPtr& f, const String& d) : func(f), description(d) {}
 
-            void Update(size_t c, float s)
+            void Update(size_t c, float s, SimdGaussianBlurFlags f)
             {
                 std::stringstream ss;
                 ss << description;
-                ss << "[" << ToString(s, 1, true) << "-" << c << "]";
+                ss << "[" << ToString(s, 1, true) << "-" << c;
+                ss << "-" << ((f & SimdGaussianBlurAlgMask) == SimdGaussianBlurRecursive ? "r" : "d");
+                ss << "-" << ((f & SimdGaussianBlurTypeMask) == SimdGaussianBlur32f ? "f" : "b") << "]";
                 description = ss.str();
             }
 
-            void Call(const View& src, float sigma, float epsilon,  View& dst) const
+            void Call(const View& src, size_t channels, float sigma, float epsilon, SimdGaussianBlurFlags flags, View& dst) const
             {
                 void* filter = NULL;
-                filter = func(src.width, src.height, src.ChannelCount(), &sigma, &epsilon);
+                filter = func(src.width / (src.format == View::Float ? channels : 1), src.height, channels, &sigma, &epsilon, flags);
                 {
                     TEST_PERFORMANCE_TEST(description);
                     SimdGaussianBlurRun(filter, src.data, src.stride, dst.data, dst.stride);
@@ -705,17 +927,26 @@ namespace Test
 #define FUNC_GB(function) \
     FuncGB(function, std::string(#function))
 
-    bool GaussianBlurAutoTest(size_t width, size_t height, size_t channels, float sigma, FuncGB f1, FuncGB f2)
+    bool GaussianBlurAutoTest(size_t width, size_t height, size_t channels, float sigma, SimdGaussianBlurFlags flags, FuncGB f1, FuncGB f2)
     {
         bool result = true;
 
-        f1.Update(channels, sigma);
-        f2.Update(channels, sigma);
+        f1.Update(channels, sigma, flags);
+        f2.Update(channels, sigma, flags);
 
         View src;
         if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
             return false;
 
+        if ((flags & SimdGaussianBlurTypeMask) == SimdGaussianBlur32f)
+        {
+            View src32f(src.width * channels, src.height, View::Float, NULL, TEST_ALIGN(width));
+            for (size_t y = 0; y < src.height; ++y)
+                for (size_t x = 0; x < src32f.width; ++x)
+                    src32f.At<float>(x, y) = float(src.Row<uint8_t>(y)[x]) / 255.0f;
+            src.Swap(src32f);
+        }
+
         View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
         View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
 
@@ -723,9 +954,15 @@ namespace Test
 
         TEST_ALIGN(SIMD_ALIGN);
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, sigma, epsilon, dst1));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, sigma, epsilon, flags, dst1));
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, sigma, epsilon, dst2));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, sigma, epsilon, flags, dst2));
+
+        if (src.format == View::Float)
+        {
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+            return result;
+        }
 
         result = result && Compare(dst1, dst2, 1, true, 64);
 
@@ -738,12 +975,12 @@ namespace Test
         return result;
     }
 
-    bool GaussianBlurAutoTest(int channels, float sigma, const FuncGB& f1, const FuncGB& f2)
+    bool GaussianBlurAutoTest(int channels, float sigma, SimdGaussianBlurFlags flags, const FuncGB& f1, const FuncGB& f2)
     {
         bool result = true;
 
-        result = result && GaussianBlurAutoTest(W, H, channels, sigma, f1, f2);
-        result = result && GaussianBlurAutoTest(W + O, H - O, channels, sigma, f1, f2);
+        result = result && GaussianBlurAutoTest(W, H, channels, sigma, flags, f1, f2);
+        result = result && GaussianBlurAutoTest(W + O, H - O, channels, sigma, flags, f1, f2);
 
         return result;
     }
@@ -756,9 +993,20 @@ namespace Test
 
         for (int channels = 1; channels <= 4; channels++)
         {
-            result = result && GaussianBlurAutoTest(channels, 0.5f, f1, f2);
-            result = result && GaussianBlurAutoTest(channels, 1.0f, f1, f2);
-            result = result && GaussianBlurAutoTest(channels, 3.0f, f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 0.5f, SimdGaussianBlurDefault, f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 1.0f, SimdGaussianBlurDefault, f1, f2);
+            result = result && GaussianBlurAutoTest(channels, 3.0f, SimdGaussianBlurDefault, f1, f2);
+        }
+
+        for (int channels = 1; channels <= 4; channels++)
+        {
+            for (int type = 0; type < 2; ++type)
+            {
+                SimdGaussianBlurFlags flags = (SimdGaussianBlurFlags)(SimdGaussianBlurRecursive | (type ? SimdGaussianBlur32f : SimdGaussianBlur8u));
+                result = result && GaussianBlurAutoTest(channels, 1.0f, flags, f1, f2);
+                result = result && GaussianBlurAutoTest(channels, 10.0f, flags, f1, f2);
+                result = result && GaussianBlurAutoTest(channels, 30.0f, flags, f1, f2);
+            }
         }
 
         return result;
@@ -769,26 +1017,26 @@ namespace Test
         bool result = true;
 
         if (TestBase(options))
-            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Base::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Base::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInitV2));
 
 #ifdef SIMD_SSE41_ENABLE
         if (Simd::Sse41::Enable && TestSse41(options))
-            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Sse41::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Sse41::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInitV2));
 #endif 
 
 #ifdef SIMD_AVX2_ENABLE
         if (Simd::Avx2::Enable && TestAvx2(options))
-            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Avx2::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Avx2::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInitV2));
 #endif 
 
 #ifdef SIMD_AVX512BW_ENABLE
         if (Simd::Avx512bw::Enable && TestAvx512bw(options))
-            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Avx512bw::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Avx512bw::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInitV2));
 #endif 
 
 #ifdef SIMD_NEON_ENABLE
         if (Simd::Neon::Enable && TestNeon(options))
-            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Neon::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInit));
+            result = result && GaussianBlurAutoTest(FUNC_GB(Simd::Neon::GaussianBlurInit), FUNC_GB(SimdGaussianBlurInitV2));
 #endif
 
         return result;
@@ -900,6 +1148,38 @@ namespace Test
         return result;
     }
 
+    bool RecursiveBilateralFilterThreadsAutoTest(size_t channels, size_t threads, SimdRecursiveBilateralFilterFlags flags, FuncRBF f)
+    {
+        bool result = true;
+
+        f.Update(channels, 0.12f, 0.09f, flags);
+        String desc = f.description + "[" + ToString(threads) + "-threads]";
+        size_t width = Simd::Max<size_t>(W, 1024) + O, height = H - O;
+        float spatial = 0.12f, range = 0.09f;
+
+        View src;
+        if (!GetTestImage(src, width, height, channels, f.description, desc))
+            return false;
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x03);
+
+        void* filter1 = f.func(width, height, channels, &spatial, &range, flags);
+        void* filter2 = f.func(width, height, channels, &spatial, &range, flags);
+        ((class Simd::RecursiveBilateralFilter*)filter1)->SetThreadNumber(1);
+        ((class Simd::RecursiveBilateralFilter*)filter2)->SetThreadNumber(threads);
+        SimdRecursiveBilateralFilterRun(filter1, src.data, src.stride, dst1.data, dst1.stride);
+        SimdRecursiveBilateralFilterRun(filter2, src.data, src.stride, dst2.data, dst2.stride);
+        SimdRelease(filter1);
+        SimdRelease(filter2);
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 0, desc);
+
+        return result;
+    }
+
     bool RecursiveBilateralFilterAutoTest(const FuncRBF& f1, const FuncRBF& f2)
     {
         bool result = true;
@@ -925,6 +1205,12 @@ namespace Test
             result = result && RecursiveBilateralFilterAutoTest(channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)pa, f1, f2);
         }
 
+        for (size_t threads = 2; threads <= 5; threads += 3)
+        {
+            result = result && RecursiveBilateralFilterThreadsAutoTest(3, threads, (SimdRecursiveBilateralFilterFlags)fa, f1);
+            result = result && RecursiveBilateralFilterThreadsAutoTest(1, threads, (SimdRecursiveBilateralFilterFlags)pa, f1);
+        }
+
         return result;
     }
 
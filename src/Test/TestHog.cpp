@@ -26,6 +26,8 @@
 #include "Test/TestRandom.h"
 #include "Test/TestOptions.h"
 
+#include "Simd/SimdHogDetector.h"
+
 namespace Test
 {
     namespace
@@ -391,4 +393,124 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncHDT
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, const float* weights, size_t windowX, size_t windowY, float bias, float scaleFactor, size_t levelsMax);
+
+            FuncPtr func;
+            String description;
+
+            FuncHDT(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t windowX, size_t windowY, float overlap)
+            {
+                std::stringstream ss;
+                ss << description << "[" << windowX << "x" << windowY << "-" << (overlap < 1.0f ? "nms" : "all") << "]";
+                description = ss.str();
+            }
+
+            size_t Call(const View& src, const Buffer32f& weights, size_t windowX, size_t windowY, float threshold, float overlap, std::vector<SimdHogDetection>& dst) const
+            {
+                void* detector = func(src.width, src.height, weights.data(), windowX, windowY, -1.0f, 1.2f, 0);
+                size_t count = 0;
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    count = SimdHogDetectorRun(detector, src.data, src.stride, threshold, overlap, dst.data(), dst.size());
+                }
+                SimdRelease(detector);
+                return count;
+            }
+        };
+    }
+
+#define FUNC_HDT(function) FuncHDT(function, #function)
+
+    SIMD_INLINE bool HogDetectionLesser(const SimdHogDetection& a, const SimdHogDetection& b)
+    {
+        if (a.level != b.level)
+            return a.level < b.level;
+        return a.y < b.y || (a.y == b.y && a.x < b.x);
+    }
+
+    bool HogDetectorAutoTest(size_t width, size_t height, size_t windowX, size_t windowY, float threshold, float overlap, FuncHDT f1, FuncHDT f2)
+    {
+        bool result = true;
+
+        f1.Update(windowX, windowY, overlap);
+        f2.Update(windowX, windowY, overlap);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        Buffer32f weights(windowX * windowY * 31);
+        FillRandom(weights, -0.1f, 0.1f);
+
+        std::vector<SimdHogDetection> dst1(width * height), dst2(width * height);
+        size_t count1 = 0, count2 = 0;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(count1 = f1.Call(src, weights, windowX, windowY, threshold, overlap, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(count2 = f2.Call(src, weights, windowX, windowY, threshold, overlap, dst2));
+
+        if (count1 != count2)
+        {
+            TEST_LOG_SS(Error, "Detection count: " << count1 << " != " << count2 << " !");
+            return false;
+        }
+        dst1.resize(count1);
+        dst2.resize(count2);
+        std::sort(dst1.begin(), dst1.end(), HogDetectionLesser);
+        std::sort(dst2.begin(), dst2.end(), HogDetectionLesser);
+        for (size_t i = 0; i < count1 && result; ++i)
+        {
+            const SimdHogDetection& d1 = dst1[i], & d2 = dst2[i];
+            if (d1.x != d2.x || d1.y != d2.y || d1.width != d2.width || d1.height != d2.height || d1.level != d2.level ||
+                ::fabs(d1.score - d2.score) > EPS * (1.0f + ::fabs(d1.score)))
+            {
+                TEST_LOG_SS(Error, "Detection " << i << ": [" << d1.level << ": " << d1.x << ", " << d1.y << ", " << d1.width << ", " << d1.height << ", " << d1.score
+                    << "] != [" << d2.level << ": " << d2.x << ", " << d2.y << ", " << d2.width << ", " << d2.height << ", " << d2.score << "] !");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool HogDetectorAutoTest(const FuncHDT& f1, const FuncHDT& f2)
+    {
+        bool result = true;
+
+        result = result && HogDetectorAutoTest(W, H, 8, 16, -FLT_MAX, 1.0f, f1, f2);
+        result = result && HogDetectorAutoTest(W + O, H - O, 5, 5, -FLT_MAX, 1.0f, f1, f2);
+        result = result && HogDetectorAutoTest(W, H, 8, 16, 0.0f, 0.3f, f1, f2);
+
+        return result;
+    }
+
+    bool HogDetectorAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && HogDetectorAutoTest(FUNC_HDT(Simd::Base::HogDetectorInit), FUNC_HDT(SimdHogDetectorInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && HogDetectorAutoTest(FUNC_HDT(Simd::Sse41::HogDetectorInit), FUNC_HDT(SimdHogDetectorInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && HogDetectorAutoTest(FUNC_HDT(Simd::Avx2::HogDetectorInit), FUNC_HDT(SimdHogDetectorInit));
+#endif 
+
+        return result;
+    }
 }
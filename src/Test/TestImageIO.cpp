@@ -70,7 +70,10 @@ namespace Test
             FillRandom(buffer);
             Simd::MeanFilter3x3(buffer, image);
 #else
-            CreateTestImage(image, 10, 10);
+            if (image.ChannelSize() == 2)
+                FillRandom(image);
+            else
+                CreateTestImage(image, 10, 10);
 #endif
         }
         else
@@ -109,6 +112,8 @@ namespace Test
             ss << suffix << ".png";
         else if (file == SimdImageFileBmp)
             ss << suffix << ".bmp";
+        else if (file == SimdImageFileQoi)
+            ss << suffix << ".qoi";
         if (file == SimdImageFileJpeg)
             ss << "_" << ToString(quality) << suffix << ".jpg";
         const String dir = "_out";
@@ -216,7 +221,7 @@ namespace Test
         std::vector<View::Format> formats({ View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32});
         for (int format = 0; format < (int)formats.size(); format++)
         {
-            for (int file = (int)SimdImageFileBmp; file <= (int)SimdImageFileBmp; file++)
+            for (int file = (int)SimdImageFileBmp; file <= (int)SimdImageFileQoi; file++)
             {
                 if (file == SimdImageFileJpeg)
                 {
@@ -229,6 +234,15 @@ namespace Test
             }
         }
 
+        std::vector<View::Format> formats16({ View::Gray16, View::Bgr48, View::Bgra64, View::Rgb48, View::Rgba64 });
+        for (size_t format = 0; format < formats16.size(); format++)
+        {
+            if (formats16[format] == View::Gray16)
+                result = result && ImageSaveToMemoryAutoTest(formats16[format], SimdImageFilePgmBin, 65, f1, f2);
+            result = result && ImageSaveToMemoryAutoTest(formats16[format], SimdImageFilePpmBin, 65, f1, f2);
+            result = result && ImageSaveToMemoryAutoTest(formats16[format], SimdImageFilePng, 65, f1, f2);
+        }
+
         return result;
     }
 
@@ -595,11 +609,13 @@ namespace Test
     bool SaveLoadCompatible(View::Format format, SimdImageFileType file, int quality)
     {
         if (file == SimdImageFilePgmTxt || file == SimdImageFilePgmBin)
-            return format == View::Gray8;
+            return format == View::Gray8 || format == View::Gray16;
         if (file == SimdImageFilePpmTxt || file == SimdImageFilePpmBin)
-            return format != View::Bgra32 && format != View::Rgba32;
-        if (file == SimdImageFileBmp)
+            return format != View::Bgra32 && format != View::Rgba32 && format != View::Gray16 && format != View::Bgra64 && format != View::Rgba64;
+        if (file == SimdImageFileBmp || file == SimdImageFileQoi)
             return true;
+        if (file == SimdImageFilePng)
+            return View::ChannelSize(format) == 2;
         return false;
     }
 
@@ -673,7 +689,7 @@ namespace Test
         std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
         for (size_t format = 0; format < formats.size(); format++)
         {
-            for (int file = (int)SimdImageFileBmp; file <= (int)SimdImageFileBmp; file++)
+            for (int file = (int)SimdImageFileBmp; file <= (int)SimdImageFileQoi; file++)
             {
                 if (file == SimdImageFileJpeg)
                 {
@@ -685,6 +701,15 @@ namespace Test
             }
         }
 
+        std::vector<View::Format> formats16 = { View::Gray16, View::Bgr48, View::Bgra64, View::Rgb48, View::Rgba64 };
+        for (size_t format = 0; format < formats16.size(); format++)
+        {
+            if (formats16[format] == View::Gray16)
+                result = result && ImageLoadFromMemoryAutoTest(formats16[format], SimdImageFilePgmBin, 65, f1, f2);
+            result = result && ImageLoadFromMemoryAutoTest(formats16[format], SimdImageFilePpmBin, 65, f1, f2);
+            result = result && ImageLoadFromMemoryAutoTest(formats16[format], SimdImageFilePng, 65, f1, f2);
+        }
+
         return result;
     }
 
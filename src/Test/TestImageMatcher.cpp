@@ -124,6 +124,119 @@ namespace Test
         TEST_LOG_SS(Info, "Filtration performance for " << g_names[type] << " : " << std::setprecision(3) << std::fixed << (GetTime() - time) << " s. ");
     }
 
+    bool CheckBatchAndStorage(const ViewPtrs & src, double threshold, size_t type, bool normalized)
+    {
+        ImageMatcher matcher;
+        matcher.Init(threshold, ImageMatcher::Hash16x16, g_numbers[type], normalized);
+        ImageMatcher::HashPtrs queries, added;
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            ImageMatcher::HashPtr hash = matcher.Create(*src[i], i);
+            if (i % 2 == 0)
+            {
+                matcher.Add(hash);
+                added.push_back(hash);
+            }
+            else
+                queries.push_back(hash);
+        }
+
+        ImageMatcher other;
+        other.Init(threshold, ImageMatcher::Hash16x16, g_numbers[type], normalized);
+        for (size_t i = 0; i < added.size(); ++i)
+            other.Add(added[i]);
+        if (other.Size() != matcher.Size())
+        {
+            TEST_LOG_SS(Error, "Can't add hashes to second ImageMatcher for " << g_names[type] << " !");
+            return false;
+        }
+
+        ImageMatcher::ResultsList batch;
+        matcher.Find(queries, batch);
+
+        std::stringstream stream;
+        ImageMatcher loaded;
+        if (!matcher.Save(stream) || !loaded.Load(stream) || loaded.Size() != matcher.Size())
+        {
+            TEST_LOG_SS(Error, "Can't save and load ImageMatcher index for " << g_names[type] << " !");
+            return false;
+        }
+
+        for (size_t i = 0; i < added.size(); ++i)
+        {
+            ImageMatcher::Results results[3];
+            matcher.Find(added[i], results[0]);
+            other.Find(added[i], results[1]);
+            loaded.Find(added[i], results[2]);
+            for (size_t k = 0; k < 3; ++k)
+            {
+                bool found = false, shared = false;
+                for (size_t j = 0; j < results[k].size(); ++j)
+                {
+                    found = found || results[k][j].hash->tag == added[i]->tag;
+                    shared = shared || results[k][j].hash == added[i].get();
+                }
+                if (!found || shared || results[k].size() != results[0].size())
+                {
+                    TEST_LOG_SS(Error, "ImageMatcher search of added hash error for " << g_names[type] << " : hash " << added[i]->tag << " matcher " << k << " !");
+                    return false;
+                }
+            }
+        }
+
+        if (added.size())
+        {
+            ImageMatcher::Results results;
+            other.Find(added[0], results);
+            for (size_t j = 0; j < results.size(); ++j)
+                if (results[j].hash->tag == added[0]->tag)
+                    other.Skip(results[j].hash);
+            other.Find(added[0], results);
+            for (size_t j = 0; j < results.size(); ++j)
+            {
+                if (results[j].hash->tag == added[0]->tag)
+                {
+                    TEST_LOG_SS(Error, "ImageMatcher finds skipped hash for " << g_names[type] << " !");
+                    return false;
+                }
+            }
+        }
+
+        const std::string saved = stream.str();
+        std::string huge = saved;
+        uint64_t count = UINT64_MAX / 2;
+        huge.replace(40, sizeof(count), (char*)&count, sizeof(count));
+        std::stringstream hugeStream(huge), truncatedStream(saved.substr(0, saved.size() - 1));
+        ImageMatcher corrupted;
+        if (corrupted.Load(hugeStream) || corrupted.Load(truncatedStream))
+        {
+            TEST_LOG_SS(Error, "ImageMatcher loads corrupted index for " << g_names[type] << " !");
+            return false;
+        }
+
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            ImageMatcher::Results single, stored;
+            matcher.Find(queries[i], single);
+            loaded.Find(queries[i], stored);
+            if (single.size() != batch[i].size() || single.size() != stored.size())
+            {
+                TEST_LOG_SS(Error, "Batch or loaded ImageMatcher search error for " << g_names[type] << " : query " << i <<
+                    " found " << single.size() << " / " << batch[i].size() << " / " << stored.size() << " !");
+                return false;
+            }
+            for (size_t j = 0; j < single.size(); ++j)
+            {
+                if (single[j].hash->tag != batch[i][j].hash->tag || single[j].hash->tag != stored[j].hash->tag)
+                {
+                    TEST_LOG_SS(Error, "Batch or loaded ImageMatcher search error for " << g_names[type] << " : query " << i << " result " << j << " !");
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
     bool ImageMatcherSpecialTest(const Options & options)
     {
         bool result = true;
@@ -154,6 +267,9 @@ namespace Test
 
         result = Compare(is1, is2, 0, true, 0, "D3");
 
+        for (size_t type = 0; type < 3 && result; ++type)
+            result = CheckBatchAndStorage(samples, threshold, type, normalized);
+
         return result;
     }
 }
@@ -113,12 +113,96 @@ namespace Test
         return result;
     }
 
+    static void IntegralStore(const std::vector<uint64_t> & src, size_t row, View & dst)
+    {
+        for (size_t col = 0; col < src.size(); ++col)
+        {
+            switch (dst.format)
+            {
+            case View::Int32: dst.At<uint32_t>(col, row) = (uint32_t)src[col]; break;
+            case View::Int64: dst.At<uint64_t>(col, row) = src[col]; break;
+            case View::Float: dst.At<float>(col, row) = (float)src[col]; break;
+            case View::Double: dst.At<double>(col, row) = (double)src[col]; break;
+            default: assert(0);
+            }
+        }
+    }
+
+    static void IntegralNaive(const View & src, bool square, View & dst)
+    {
+        std::vector<uint64_t> prev(src.width + 1, 0), curr(src.width + 1, 0);
+        IntegralStore(prev, 0, dst);
+        for (size_t row = 0; row < src.height; ++row)
+        {
+            uint64_t sum = 0;
+            for (size_t col = 0; col < src.width; ++col)
+            {
+                uint64_t value = src.At<uint8_t>(col, row);
+                sum += square ? value * value : value;
+                curr[col + 1] = prev[col + 1] + sum;
+            }
+            IntegralStore(curr, row + 1, dst);
+            prev.swap(curr);
+        }
+    }
+
+    bool IntegralBandsAutoTest(int width, int height, View::Format sumFormat, View::Format sqsumFormat, const Func & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << ColorDescription(sumFormat) << ColorDescription(sqsumFormat) << " in " 
+            << SimdGetThreadNumber() << " threads against serial integral [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View sum1(width + 1, height + 1, sumFormat, NULL, TEST_ALIGN(width));
+        View sum2(width + 1, height + 1, sumFormat, NULL, TEST_ALIGN(width));
+        View sqsum1(width + 1, height + 1, sqsumFormat, NULL, TEST_ALIGN(width));
+        View sqsum2(width + 1, height + 1, sqsumFormat, NULL, TEST_ALIGN(width));
+        View tilted;
+
+        f.Call(src, sum1, sqsum1, tilted);
+
+        IntegralNaive(src, false, sum2);
+        IntegralNaive(src, true, sqsum2);
+
+        if (sumFormat == View::Float)
+            result = result && Compare(sum1, sum2, EPS, true, 32, true, "sum");
+        else
+            result = result && Compare(sum1, sum2, 0, true, 32, 0, "sum");
+        result = result && Compare(sqsum1, sqsum2, 0, true, 32, 0, "sqsum");
+
+        return result;
+    }
+
+    bool IntegralBandsAutoTest(const Func & f)
+    {
+        bool result = true;
+
+        size_t threads = SimdGetThreadNumber();
+        SimdSetThreadNumber(std::thread::hardware_concurrency());
+
+        result = result && IntegralBandsAutoTest(W, H + O, View::Int32, View::Int32, f);
+        result = result && IntegralBandsAutoTest(W, H + O, View::Int32, View::Double, f);
+        result = result && IntegralBandsAutoTest(W, H + O, View::Int64, View::Int64, f);
+        result = result && IntegralBandsAutoTest(W, H + O, View::Float, View::Double, f);
+
+        SimdSetThreadNumber(threads);
+
+        return result;
+    }
+
     bool IntegralAutoTest(const Func & f1, const Func & f2)
     {
         bool result = true;
 
         result = result && IntegralAutoTest(View::Int32, View::Int32, f1, f2);
         result = result && IntegralAutoTest(View::Int32, View::Double, f1, f2);
+        result = result && IntegralAutoTest(View::Int64, View::Int64, f1, f2);
+        result = result && IntegralAutoTest(View::Float, View::Double, f1, f2);
+
+        result = result && IntegralBandsAutoTest(f1);
 
         return result;
     }
@@ -130,6 +214,11 @@ namespace Test
         if (TestBase(options))
             result = result && IntegralAutoTest(FUNC(Simd::Base::Integral), FUNC(SimdIntegral));
 
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && IntegralAutoTest(FUNC(Simd::Sse41::Integral), FUNC(SimdIntegral));
+#endif
+
 #ifdef SIMD_AVX2_ENABLE
         if (Simd::Avx2::Enable && TestAvx2(options))
             result = result && IntegralAutoTest(FUNC(Simd::Avx2::Integral), FUNC(SimdIntegral));
@@ -288,4 +288,118 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncIN
+        {
+            typedef void(*FuncPtr)(const uint8_t* src0, size_t src0Stride, const uint8_t* src1, size_t src1Stride, const uint8_t* src2, size_t src2Stride,
+                const uint8_t* src3, size_t src3Stride, size_t width, size_t height, size_t channels, uint8_t* dst, size_t dstStride);
+
+            FuncPtr func;
+            String desc;
+
+            FuncIN(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t channels)
+            {
+                desc = desc + "[" + ToString(channels) + "]";
+            }
+
+            void Call(const View src[4], size_t channels, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src[0].data, src[0].stride, src[1].data, src[1].stride, src[2].data, src[2].stride, src[3].data, src[3].stride,
+                    src[0].width, src[0].height, channels, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_IN(function) FuncIN(function, #function)
+
+    bool InterleaveNAutoTest(View::Format format, size_t channels, int width, int height, FuncIN f1, FuncIN f2)
+    {
+        bool result = true;
+
+        f1.Update(channels);
+        f2.Update(channels);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        View src[4];
+        for (size_t c = 0; c < channels; ++c)
+        {
+            src[c].Recreate(width, height, format, NULL, TEST_ALIGN(width));
+            if (format == View::Float)
+                FillRandom32f(src[c], -1000.0f, 1000.0f);
+            else
+                FillRandom16u(src[c]);
+        }
+
+        View dst1(width * channels, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width * channels, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool InterleaveNAutoTest(View::Format format, const FuncIN& f1, const FuncIN& f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 2; channels <= 4; ++channels)
+        {
+            result = result && InterleaveNAutoTest(format, channels, W, H, f1, f2);
+            result = result && InterleaveNAutoTest(format, channels, W + O, H - O, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool Interleave16uAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && InterleaveNAutoTest(View::Int16, FUNC_IN(Simd::Base::Interleave16u), FUNC_IN(SimdInterleave16u));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options) && W >= Simd::Sse41::HA)
+            result = result && InterleaveNAutoTest(View::Int16, FUNC_IN(Simd::Sse41::Interleave16u), FUNC_IN(SimdInterleave16u));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options) && W >= Simd::Avx2::HA)
+            result = result && InterleaveNAutoTest(View::Int16, FUNC_IN(Simd::Avx2::Interleave16u), FUNC_IN(SimdInterleave16u));
+#endif 
+
+        return result;
+    }
+
+    bool Interleave32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && InterleaveNAutoTest(View::Float, FUNC_IN(Simd::Base::Interleave32f), FUNC_IN(SimdInterleave32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options) && W >= Simd::Sse41::F)
+            result = result && InterleaveNAutoTest(View::Float, FUNC_IN(Simd::Sse41::Interleave32f), FUNC_IN(SimdInterleave32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options) && W >= Simd::Avx2::F)
+            result = result && InterleaveNAutoTest(View::Float, FUNC_IN(Simd::Avx2::Interleave32f), FUNC_IN(SimdInterleave32f));
+#endif 
+
+        return result;
+    }
 }
@@ -162,4 +162,176 @@ namespace Test
 
         return true;
     }
+
+    //-----------------------------------------------------------------------------
+
+    static void DrawMotionFrame(size_t index, size_t stream, Frame & frame)
+    {
+        View & y = frame.planes[0];
+        Simd::Fill(y, 64);
+        if (frame.format == Frame::Nv12)
+            Simd::Fill(frame.planes[1], 128);
+        ptrdiff_t size = y.height / 6, x = (index * 4 + stream * 17) % (y.width - size), top = y.height / 3;
+        Simd::Fill(y.Region(x, top, x + size, top + size).Ref(), 192);
+        frame.timestamp = double(index) * 0.04;
+    }
+
+    static bool EqualMetadata(const Simd::Motion::Metadata& a, const Simd::Motion::Metadata& b)
+    {
+        bool equal = a.objects.size() == b.objects.size() && a.events.size() == b.events.size();
+        for (size_t i = 0; i < a.objects.size() && equal; ++i)
+            equal = a.objects[i].rect == b.objects[i].rect && a.objects[i].id == b.objects[i].id;
+        for (size_t i = 0; i < a.events.size() && equal; ++i)
+            equal = a.events[i].type == b.events[i].type && a.events[i].objectId == b.events[i].objectId;
+        return equal;
+    }
+
+    bool MotionEngineSpecialTest(const Options & options)
+    {
+        typedef std::shared_ptr<Simd::Motion::Detector> DetectorPtr;
+        typedef Simd::Motion::Engine Engine;
+        const size_t streams = 6, frames = 100;
+        const Size size(320, 240);
+
+        Engine engine;
+        std::vector<DetectorPtr> detectors;
+        std::vector<Frame> inputs;
+        for (size_t s = 0; s < streams; ++s)
+        {
+            if (engine.AddStream() != s)
+            {
+                TEST_LOG_SS(Error, "Motion::Engine: wrong index of added stream!");
+                return false;
+            }
+            detectors.push_back(DetectorPtr(new Simd::Motion::Detector()));
+            inputs.push_back(Frame(size, s % 2 ? Frame::Nv12 : Frame::Gray8));
+        }
+
+        for (size_t f = 0; f < frames; ++f)
+        {
+            Engine::Inputs batch;
+            for (size_t s = 0; s < streams; ++s)
+            {
+                DrawMotionFrame(f, s, inputs[s]);
+                batch.push_back(Engine::Input(s, &inputs[s]));
+            }
+            Engine::Metadatas metadatas;
+            if (!engine.NextFrames(batch, metadatas))
+            {
+                TEST_LOG_SS(Error, "Motion::Engine: can't process frame " << f << " !");
+                return false;
+            }
+            for (size_t s = 0; s < streams; ++s)
+            {
+                Simd::Motion::Metadata control;
+                detectors[s]->NextFrame(inputs[s], control);
+                if (!EqualMetadata(control, metadatas[s]))
+                {
+                    TEST_LOG_SS(Error, "Motion::Engine: metadata of stream " << s << " at frame " << f << " is differ from Motion::Detector!");
+                    return false;
+                }
+            }
+        }
+
+        for (size_t s = 0; s < streams; ++s)
+        {
+            const Engine::Latency * latency = engine.GetLatency(s);
+            TEST_LOG_SS(Info, "Motion::Engine stream " << s << " : frames " << latency->frames << ", latency average " << std::setprecision(3) << std::fixed
+                << latency->average * 1000 << " ms, max " << latency->max * 1000 << " ms, processing " << latency->processing * 1000 << " ms.");
+        }
+
+        Simd::Motion::Options reused;
+        reused.CalibrationScaleLevelMin = 1;
+        if (!engine.RemoveStream(1) || engine.StreamCount() != streams - 1 || engine.AddStream(Simd::Motion::Model(), reused) != 1)
+        {
+            TEST_LOG_SS(Error, "Motion::Engine: stream removing error!");
+            return false;
+        }
+
+        Simd::Motion::Detector control;
+        control.SetOptions(reused);
+        for (size_t f = 0; f < frames; ++f)
+        {
+            DrawMotionFrame(f, 1, inputs[1]);
+            Engine::Inputs batch(1, Engine::Input(1, &inputs[1]));
+            Engine::Metadatas metadatas;
+            Simd::Motion::Metadata metadata;
+            if (!engine.NextFrames(batch, metadatas) || !control.NextFrame(inputs[1], metadata) || !EqualMetadata(metadata, metadatas[0]))
+            {
+                TEST_LOG_SS(Error, "Motion::Engine: reused detector with other options is differ from Motion::Detector at frame " << f << " !");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //-----------------------------------------------------------------------------
+
+    static void ConvertMotionFrame(const Frame& gray, Frame& dst)
+    {
+        if (dst.format == Frame::Bgr24)
+            Simd::GrayToBgr(gray.planes[0], dst.planes[0]);
+        else
+        {
+            Simd::Copy(gray.planes[0], dst.planes[0]);
+            for (size_t i = 1; i < dst.PlaneCount(); ++i)
+                Simd::Fill(dst.planes[i], 128);
+        }
+        dst.timestamp = gray.timestamp;
+    }
+
+    bool MotionInputSpecialTest(const Simd::Motion::Options& options, Frame::Format format, const String& name, const String& desc)
+    {
+        const size_t frames = 100;
+        const Size size(320, 240);
+
+        TEST_LOG_SS(Info, "Test Motion::Detector " << desc << " input Gray8 & " << name << ".");
+
+        Simd::Motion::Detector detector1, detector2;
+        detector1.SetOptions(options);
+        detector2.SetOptions(options);
+        Frame gray(size, Frame::Gray8), other(size, format);
+        size_t objects = 0;
+        for (size_t f = 0; f < frames; ++f)
+        {
+            DrawMotionFrame(f, 0, gray);
+            ConvertMotionFrame(gray, other);
+            Simd::Motion::Metadata metadata1, metadata2;
+            if (!detector1.NextFrame(gray, metadata1) || !detector2.NextFrame(other, metadata2))
+            {
+                TEST_LOG_SS(Error, "Motion::Detector: can't process frame " << f << " !");
+                return false;
+            }
+            if (!EqualMetadata(metadata1, metadata2))
+            {
+                TEST_LOG_SS(Error, "Motion::Detector: metadata for Gray8 and " << name << " inputs are differ at frame " << f << " !");
+                return false;
+            }
+            objects += metadata1.objects.size();
+        }
+        if (objects == 0)
+        {
+            TEST_LOG_SS(Error, "Motion::Detector: moving object is not detected!");
+            return false;
+        }
+        return true;
+    }
+
+    bool MotionInputSpecialTest(const Options& options)
+    {
+        bool result = true;
+
+        Simd::Motion::Options standard, intervals;
+        intervals.CalibrationScaleLevelMin = 1;
+        intervals.DifferenceGradientFrameInterval = 2;
+        intervals.BackgroundUpdateFrameInterval = 3;
+
+        result = result && MotionInputSpecialTest(standard, Frame::Bgr24, "Bgr24", "default");
+        result = result && MotionInputSpecialTest(standard, Frame::Yuv420p, "Yuv420p", "default");
+        result = result && MotionInputSpecialTest(intervals, Frame::Bgr24, "Bgr24", "intervals");
+        result = result && MotionInputSpecialTest(intervals, Frame::Nv12, "Nv12", "intervals");
+
+        return result;
+    }
 }
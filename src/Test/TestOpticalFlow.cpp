@@ -0,0 +1,183 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+
+#include "Simd/SimdOpticalFlow.h"
+
+namespace Test
+{
+    typedef Simd::Pyramid<Simd::Allocator> Pyramid;
+
+    namespace
+    {
+        struct FuncLK
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigen);
+
+            FuncPtr func;
+            String description;
+
+            FuncLK(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t levels, size_t radius)
+            {
+                std::stringstream ss;
+                ss << description << "[" << levels << "-" << radius << "]";
+                description = ss.str();
+            }
+
+            void Call(const Pyramid& prev, const Pyramid& next, size_t radius, const Buffer32f& prevPoints, Buffer32f& nextPoints, Buffer8u & status, Buffer32f& errors) const
+            {
+                size_t levels = prev.Size();
+                std::vector<const uint8_t*> prevData(levels), nextData(levels);
+                std::vector<size_t> prevStrides(levels), nextStrides(levels);
+                for (size_t level = 0; level < levels; ++level)
+                {
+                    prevData[level] = prev[level].data;
+                    prevStrides[level] = prev[level].stride;
+                    nextData[level] = next[level].data;
+                    nextStrides[level] = next[level].stride;
+                }
+                void* context = func(prev[0].width, prev[0].height, levels, radius, 20, 0.01f, 0.1f);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdOpticalFlowPyrLkRun(context, prevData.data(), prevStrides.data(), nextData.data(), nextStrides.data(),
+                        prevPoints.data(), status.size(), nextPoints.data(), status.data(), errors.data());
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_LK(function) FuncLK(function, #function)
+
+    static bool CheckShift(const Buffer32f& prevPoints, const Buffer32f& nextPoints, const Buffer8u& status,
+        size_t width, size_t height, float margin, float dx, float dy, const String& desc)
+    {
+        size_t count = 0, tracked = 0, exact = 0;
+        for (size_t i = 0; i < status.size(); ++i)
+        {
+            float x = prevPoints[2 * i + 0], y = prevPoints[2 * i + 1];
+            if (x < margin || y < margin || x >= float(width) - margin || y >= float(height) - margin)
+                continue;
+            count++;
+            if (status[i] == 0)
+                continue;
+            tracked++;
+            if (::fabs(nextPoints[2 * i + 0] - prevPoints[2 * i + 0] - dx) <= 0.1f && ::fabs(nextPoints[2 * i + 1] - prevPoints[2 * i + 1] - dy) <= 0.1f)
+                exact++;
+        }
+        if (tracked * 10 < count * 9 || exact * 4 < tracked * 3)
+        {
+            TEST_LOG_SS(Error, desc << " : shift (" << dx << ", " << dy << ") is found for " << exact << " of " << tracked << " tracked inner points (total " << count << ") !");
+            return false;
+        }
+        return true;
+    }
+
+    bool OpticalFlowPyrLkAutoTest(size_t width, size_t height, size_t levels, size_t radius, size_t count, FuncLK f1, FuncLK f2)
+    {
+        bool result = true;
+
+        f1.Update(levels, radius);
+        f2.Update(levels, radius);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View noise(width + 16, height + 16, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise);
+        View blur(noise.width, noise.height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::GaussianBlur3x3(noise, blur);
+        Simd::GaussianBlur3x3(blur, noise);
+
+        Pyramid prev(width, height, levels), next(width, height, levels);
+        Simd::Copy(noise.Region(8, 8, 8 + width, 8 + height), prev[0]);
+        Simd::Copy(noise.Region(5, 11, 5 + width, 11 + height), next[0]);
+        Simd::Build(prev, SimdReduce2x2);
+        Simd::Build(next, SimdReduce2x2);
+
+        Buffer32f prevPoints(count * 2), nextPoints1(count * 2, 0.0f), nextPoints2(count * 2, 0.0f), errors1(count, 0.0f), errors2(count, 0.0f);
+        Buffer8u status1(count, 0), status2(count, 0);
+        for (size_t i = 0; i < count; ++i)
+        {
+            prevPoints[2 * i + 0] = float(Random() * width);
+            prevPoints[2 * i + 1] = float(Random() * height);
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(prev, next, radius, prevPoints, nextPoints1, status1, errors1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(prev, next, radius, prevPoints, nextPoints2, status2, errors2));
+
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            if (status1[i] != status2[i])
+            {
+                TEST_LOG_SS(Error, "There is difference in status of point " << i << ": " << (int)status1[i] << " != " << (int)status2[i] << " !");
+                result = false;
+            }
+        }
+        result = result && Compare(nextPoints1, nextPoints2, EPS, true, 64, DifferenceBoth, "nextPoints");
+        result = result && Compare(errors1, errors2, EPS, true, 64, DifferenceBoth, "errors");
+
+        float margin = float(radius + 4);
+        result = result && CheckShift(prevPoints, nextPoints1, status1, width, height, margin, 3.0f, -3.0f, f1.description);
+        result = result && CheckShift(prevPoints, nextPoints2, status2, width, height, margin, 3.0f, -3.0f, f2.description);
+
+        return result;
+    }
+
+    bool OpticalFlowPyrLkAutoTest(const FuncLK& f1, const FuncLK& f2)
+    {
+        bool result = true;
+
+        result = result && OpticalFlowPyrLkAutoTest(W, H, 4, 7, 1000, f1, f2);
+        result = result && OpticalFlowPyrLkAutoTest(W + O, H - O, 3, 10, 1000, f1, f2);
+        result = result && OpticalFlowPyrLkAutoTest(W - O, H + O, 2, 2, 1000, f1, f2);
+
+        return result;
+    }
+
+    bool OpticalFlowPyrLkAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && OpticalFlowPyrLkAutoTest(FUNC_LK(Simd::Base::OpticalFlowPyrLkInit), FUNC_LK(SimdOpticalFlowPyrLkInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && OpticalFlowPyrLkAutoTest(FUNC_LK(Simd::Sse41::OpticalFlowPyrLkInit), FUNC_LK(SimdOpticalFlowPyrLkInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && OpticalFlowPyrLkAutoTest(FUNC_LK(Simd::Avx2::OpticalFlowPyrLkInit), FUNC_LK(SimdOpticalFlowPyrLkInit));
+#endif 
+
+        return result;
+    }
+}
@@ -988,4 +988,96 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncTM
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t* tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight,
+                SimdTemplateMatchMethodType method, float* dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncTM(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(const View& tmpl, SimdTemplateMatchMethodType method)
+            {
+                description = description + "[" + ToString(tmpl.width) + "x" + ToString(tmpl.height) + "-" + ToString(method) + "]";
+            }
+
+            void Call(const View& src, const View& tmpl, SimdTemplateMatchMethodType method, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, tmpl.data, tmpl.stride, tmpl.width, tmpl.height, method, (float*)dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_TM(function) FuncTM(function, #function)
+
+    bool TemplateMatchAutoTest(int width, int height, int tmplWidth, int tmplHeight, SimdTemplateMatchMethodType method, FuncTM f1, FuncTM f2)
+    {
+        bool result = true;
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+        View tmpl(tmplWidth, tmplHeight, View::Gray8, NULL, TEST_ALIGN(tmplWidth));
+        Simd::Copy(src.Region(width / 3, height / 4, width / 3 + tmplWidth, height / 4 + tmplHeight), tmpl);
+
+        f1.Update(tmpl, method);
+        f2.Update(tmpl, method);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View dst1(width - tmplWidth + 1, height - tmplHeight + 1, View::Float, NULL, TEST_ALIGN(width));
+        View dst2(width - tmplWidth + 1, height - tmplHeight + 1, View::Float, NULL, TEST_ALIGN(width));
+        Simd::Fill(dst1, 1);
+        Simd::Fill(dst2, 2);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, tmpl, method, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, tmpl, method, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool TemplateMatchAutoTest(const FuncTM& f1, const FuncTM& f2)
+    {
+        bool result = true;
+
+        result = result && TemplateMatchAutoTest(W, H, 16, 16, SimdTemplateMatchCCoeffNormed, f1, f2);
+        result = result && TemplateMatchAutoTest(W + O, H - O, 31, 17, SimdTemplateMatchCCoeffNormed, f1, f2);
+        result = result && TemplateMatchAutoTest(W - O, H + O, 7, 5, SimdTemplateMatchSqDiff, f1, f2);
+        result = result && TemplateMatchAutoTest(W, H, 9, 12, SimdTemplateMatchSqDiffNormed, f1, f2);
+        result = result && TemplateMatchAutoTest(W, H, 24, 3, SimdTemplateMatchCCorr, f1, f2);
+        result = result && TemplateMatchAutoTest(W, H, 13, 13, SimdTemplateMatchCCorrNormed, f1, f2);
+        result = result && TemplateMatchAutoTest(W, H, 20, 10, SimdTemplateMatchCCoeff, f1, f2);
+
+        return result;
+    }
+
+    bool TemplateMatchAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && TemplateMatchAutoTest(FUNC_TM(Simd::Base::TemplateMatch), FUNC_TM(SimdTemplateMatch));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && TemplateMatchAutoTest(FUNC_TM(Simd::Sse41::TemplateMatch), FUNC_TM(SimdTemplateMatch));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && TemplateMatchAutoTest(FUNC_TM(Simd::Avx2::TemplateMatch), FUNC_TM(SimdTemplateMatch));
+#endif 
+
+        return result;
+    }
 }
@@ -88,6 +88,12 @@ namespace Test
         case View::Rgba32:    return "Rgba32";
         case View::Uyvy16:    return "Uyvy16";
         case View::Argb32:    return "Argb32";
+        case View::Lab24:     return "Lab24";
+        case View::Gray16:    return "Gray16";
+        case View::Bgr48:     return "Bgr48";
+        case View::Bgra64:    return "Bgra64";
+        case View::Rgb48:     return "Rgb48";
+        case View::Rgba64:    return "Rgba64";
         default: assert(0);  return "";
         }
     }
@@ -104,6 +110,7 @@ namespace Test
         case SimdImageFilePng:          return "Png";
         case SimdImageFileJpeg:         return "Jpeg";
         case SimdImageFileBmp:          return "Bmp";
+        case SimdImageFileQoi:          return "Qoi";
         default: assert(0);  return "";
         }
     }
@@ -171,6 +178,7 @@ namespace Test
         case SimdImageFilePng:    return "png";
         case SimdImageFileJpeg:   return "jpg";
         case SimdImageFileBmp:    return "bmp";
+        case SimdImageFileQoi:    return "qoi";
         default: assert(0);  return "";
         }
     }
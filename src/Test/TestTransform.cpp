@@ -66,6 +66,12 @@ namespace Test
                 TEST_PERFORMANCE_TEST(desc);
                 func(src.data, src.stride, src.width, src.height, src.PixelSize(), transform, dst.data, dst.stride);
             }
+
+            void Call(const View& src, size_t pixelSize, SimdTransformType transform, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.data, src.stride, src.width / pixelSize, src.height, pixelSize, transform, dst.data, dst.stride);
+            }
         };
     }
 
@@ -120,6 +126,31 @@ namespace Test
         return result;
     }
 
+    bool TransformImageAutoTest(::SimdTransformType transform, size_t pixelSize, int width, int height, FuncTI f1, FuncTI f2)
+    {
+        bool result = true;
+
+        f1.Update(transform, pixelSize);
+        f2.Update(transform, pixelSize);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        View s(width * pixelSize, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        Size ds = Simd::TransformSize(Size(width, height), transform);
+        View d1(ds.x * pixelSize, ds.y, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(ds.x * pixelSize, ds.y, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, pixelSize, transform, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, pixelSize, transform, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
     bool TransformImageAutoTest(const FuncTI & f1, const FuncTI & f2)
     {
         bool result = true;
@@ -133,6 +164,12 @@ namespace Test
                 result = result && TransformImageAutoTest(transform, format, W, H, f1, f2);
                 result = result && TransformImageAutoTest(transform, format, W + O, H - O, f1, f2);
             }
+            const size_t sizes[] = { 6, 8, 12, 16 };
+            for (size_t size : sizes)
+            {
+                result = result && TransformImageAutoTest(transform, size, W, H, f1, f2);
+                result = result && TransformImageAutoTest(transform, size, W + O, H - O, f1, f2);
+            }
         }
 
         return result;
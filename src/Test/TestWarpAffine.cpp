@@ -269,6 +269,186 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncWAB
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border,
+                SimdTensorFormatType format, SimdTensorDataType type, const float* lower, const float* upper);
+
+            FuncPtr func;
+            String description;
+
+            FuncWAB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, SimdTensorFormatType format, SimdTensorDataType type, size_t count)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels;
+                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
+                ss << "-" << (format == SimdTensorFormatNchw ? "nchw" : "nhwc");
+                ss << "-" << (type == SimdTensorData8u ? "8u" : (type == SimdTensorData32f ? "32f" : "16b"));
+                ss << "-" << count << "x" << dstW << "x" << dstH << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorFormatType format,
+                SimdTensorDataType type, const float* lower, const float* upper, const Buffer32f & mats, size_t count, View & dst) const
+            {
+                void * context = func(src.width, src.height, src.stride, src.ChannelCount(), dstW, dstH, flags, border, format, type, lower, upper);
+                if (context)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdWarpAffineBatchRun(context, src.data, mats.data(), count, dst.data);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_WAB(function) \
+    FuncWAB(function, std::string(#function))
+
+    static void WarpAffineBatchReference(const View& src, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorFormatType format,
+        SimdTensorDataType type, const float* lower, const float* upper, const Buffer32f& mats, size_t count, View& dst)
+    {
+        size_t channels = src.ChannelCount(), dstC = type == SimdTensorData8u ? channels : (channels == 1 ? 1 : 3), size = dstW * dstH;
+        View crop(dstW, dstH, src.format, NULL, 1);
+        Buffer32f buf(size * dstC);
+        for (size_t i = 0; i < count; ++i)
+        {
+            void* context = SimdWarpAffineInit(src.width, src.height, src.stride, dstW, dstH, crop.stride, channels, mats.data() + i * 6, flags, border);
+            if (context)
+            {
+                SimdWarpAffineRun(context, src.data, crop.data);
+                SimdRelease(context);
+            }
+            else
+                SimdFillPixel(crop.data, crop.stride, crop.width, crop.height, border, channels);
+            uint8_t* out = dst.Row<uint8_t>(i);
+            for (size_t c = 0; c < dstC; ++c)
+            {
+                float scale = ((upper ? upper[c] : 1.0f) - (lower ? lower[c] : 0.0f)) / 255.0f, shift = lower ? lower[c] : 0.0f;
+                for (size_t p = 0; p < size; ++p)
+                {
+                    uint8_t value = crop.data[p * channels + c];
+                    size_t offset = format == SimdTensorFormatNchw ? c * size + p : p * dstC + c;
+                    if (type == SimdTensorData8u)
+                        out[offset] = value;
+                    else
+                        buf[offset] = float(value) * scale + shift;
+                }
+            }
+            if (type == SimdTensorData32f)
+                memcpy(out, buf.data(), size * dstC * sizeof(float));
+            if (type == SimdTensorData16b)
+                SimdFloat32ToBFloat16(buf.data(), size * dstC, (uint16_t*)out);
+        }
+    }
+
+    bool WarpAffineBatchAutoTest(size_t channels, size_t dstW, size_t dstH, SimdWarpAffineFlags flags, SimdTensorFormatType format, SimdTensorDataType type, FuncWAB f1, FuncWAB f2)
+    {
+        bool result = true;
+
+        const size_t count = 17;
+        f1.Update(channels, dstW, dstH, flags, format, type, count);
+        f2.Update(channels, dstW, dstH, flags, format, type, count);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
+
+        View::Format pixel = channels == 1 ? View::Gray8 : (channels == 2 ? View::Uv16 : (channels == 3 ? View::Bgr24 : View::Bgra32));
+        View src(W, H, pixel, NULL, TEST_ALIGN(W));
+        ::srand(0);
+        FillPicture(src);
+
+        Buffer32f mats(count * 6);
+        for (size_t i = 0; i < count; ++i)
+        {
+            float x0 = float(W * (Random() * 0.9 - 0.2)), y0 = float(H * (Random() * 0.9 - 0.2));
+            float w = float(W * (0.1 + Random() * 0.5)), h = float(H * (0.1 + Random() * 0.5)), a = float(Random() * 0.6 - 0.3);
+            float m00 = w / dstW * ::cos(a), m01 = -h / dstH * ::sin(a), m10 = w / dstW * ::sin(a), m11 = h / dstH * ::cos(a), det = m00 * m11 - m01 * m10;
+            float* mat = mats.data() + i * 6;
+            mat[0] = m11 / det, mat[1] = -m01 / det, mat[2] = (m01 * y0 - m11 * x0) / det;
+            mat[3] = -m10 / det, mat[4] = m00 / det, mat[5] = (m10 * x0 - m00 * y0) / det;
+        }
+        memset(mats.data() + 5 * 6, 0, 6 * sizeof(float));
+
+        size_t dstC = type == SimdTensorData8u ? channels : (channels == 1 ? 1 : 3);
+        size_t dstSize = dstW * dstH * dstC * (type == SimdTensorData8u ? 1 : (type == SimdTensorData16b ? 2 : 4));
+        View dst1(dstSize, count, View::Gray8, NULL, 1);
+        View dst2(dstSize, count, View::Gray8, NULL, 1);
+        View dst3(dstSize, count, View::Gray8, NULL, 1);
+        Simd::Fill(dst1, 0x11);
+        Simd::Fill(dst2, 0x22);
+        Simd::Fill(dst3, 0x33);
+
+        uint8_t border[4] = { 11, 33, 55, 77 };
+        float lower[3] = { -1.0f, 0.0f, -0.5f }, upper[3] = { 1.0f, 1.0f, 2.0f };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dstW, dstH, flags, border, format, type, lower, upper, mats, count, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dstW, dstH, flags, border, format, type, lower, upper, mats, count, dst2));
+
+        WarpAffineBatchReference(src, dstW, dstH, flags, border, format, type, lower, upper, mats, count, dst3);
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+        result = result && Compare(dst2, dst3, 0, true, 64, 0, "dst2 & reference");
+
+        return result;
+    }
+
+    bool WarpAffineBatchAutoTest(const FuncWAB & f1, const FuncWAB & f2)
+    {
+        bool result = true;
+
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        for (size_t i = 0; i < interp.size(); ++i)
+        {
+            SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | interp[i] | SimdWarpAffineBorderConstant);
+            for (size_t c = 1; c <= 4; ++c)
+            {
+                result = result && WarpAffineBatchAutoTest(c, 64, 48, flags, SimdTensorFormatNhwc, SimdTensorData8u, f1, f2);
+                result = result && WarpAffineBatchAutoTest(c, 64, 48, flags, SimdTensorFormatNchw, SimdTensorData8u, f1, f2);
+                if (c == 2)
+                    continue;
+                result = result && WarpAffineBatchAutoTest(c, 57, 63, flags, SimdTensorFormatNchw, SimdTensorData32f, f1, f2);
+                result = result && WarpAffineBatchAutoTest(c, 57, 63, flags, SimdTensorFormatNhwc, SimdTensorData32f, f1, f2);
+                result = result && WarpAffineBatchAutoTest(c, 64, 48, flags, SimdTensorFormatNchw, SimdTensorData16b, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool WarpAffineBatchAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Base::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Sse41::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Avx2::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Avx512bw::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+        return result;
+    }
 }
 
 //-------------------------------------------------------------------------------------------------
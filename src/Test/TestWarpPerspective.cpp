@@ -0,0 +1,223 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+
+#include "Simd/SimdRemap.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncRM
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+                size_t channels, const float* param, SimdWarpAffineFlags flags, const uint8_t* border);
+            typedef void(*RunPtr)(const void* context, const uint8_t* src, uint8_t* dst);
+
+            FuncPtr func;
+            RunPtr run;
+            String description;
+
+            FuncRM(const FuncPtr & f, const RunPtr & r, const String & d) : func(f), run(r), description(d) {}
+
+            void Update(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels;
+                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
+                ss << "-" << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant ? "c" : "t");
+                ss << "-" << srcW << "x" << srcH << "->" << dstW << "x" << dstH << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t channels, const float* param, SimdWarpAffineFlags flags, const uint8_t* border, const View & buf) const
+            {
+                void * context = func(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, channels, param, flags, border);
+                if (context)
+                {
+                    Simd::Copy(buf, dst);
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        run(context, src.data, dst.data);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_RM(function, run) \
+    FuncRM(function, run, std::string(#function))
+
+    static View::Format ChannelsToFormat(size_t channels)
+    {
+        switch (channels)
+        {
+        case 1: return View::Gray8;
+        case 2: return View::Uv16;
+        case 3: return View::Bgr24;
+        case 4: return View::Bgra32;
+        default:
+            assert(0); return View::None;
+        }
+    }
+
+    bool RemapAutoTest(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float* param, SimdWarpAffineFlags flags, FuncRM f1, FuncRM f2)
+    {
+        bool result = true;
+
+        f1.Update(srcW, srcH, dstW, dstH, channels, flags);
+        f2.Update(srcW, srcH, dstW, dstH, channels, flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
+
+        View::Format format = ChannelsToFormat(channels);
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        ::srand(0);
+        FillPicture(src);
+
+        View buf(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        Simd::Fill(buf, 0x33);
+        uint8_t border[4] = { 11, 33, 55, 77 };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, param, flags, border, buf));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, param, flags, border, buf));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool RemapAutoTest(const FuncRM& f1, const FuncRM& f2, bool perspective)
+    {
+        bool result = true;
+
+        size_t srcW = W, srcH = H, dstW = W + O, dstH = H - O;
+        Buffer32f param;
+        if (perspective)
+        {
+            float w = float(srcW), h = float(srcH);
+            param = Buffer32f({ 0.9f, -0.2f, 0.1f * w, 0.1f, 0.8f, -0.05f * h, 0.0004f * 480.0f / w, 0.0002f * 480.0f / h, 1.0f });
+        }
+        else
+        {
+            param.resize(dstW * dstH * 2);
+            float cx = float(dstW) * 0.5f, cy = float(dstH) * 0.5f, r2 = cx * cx + cy * cy;
+            for (size_t y = 0, i = 0; y < dstH; ++y)
+            {
+                for (size_t x = 0; x < dstW; ++x, i += 2)
+                {
+                    float dx = float(x) - cx, dy = float(y) - cy, k = 1.0f + 0.4f * (dx * dx + dy * dy) / r2;
+                    param[i + 0] = cx + dx * k - float(O);
+                    param[i + 1] = cy + dy * k + 0.3f;
+                }
+            }
+        }
+
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        std::vector<SimdWarpAffineFlags> border = { SimdWarpAffineBorderConstant, SimdWarpAffineBorderTransparent };
+        for (size_t i = 0; i < interp.size(); ++i)
+        {
+            for (size_t b = 0; b < border.size(); ++b)
+            {
+                SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | interp[i] | border[b]);
+                for (size_t c = 1; c <= 4; ++c)
+                    result = result && RemapAutoTest(srcW, srcH, dstW, dstH, c, param.data(), flags, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && RemapAutoTest(FUNC_RM(Simd::Base::WarpPerspectiveInit, SimdWarpPerspectiveRun), FUNC_RM(SimdWarpPerspectiveInit, SimdWarpPerspectiveRun), true);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && RemapAutoTest(FUNC_RM(Simd::Sse41::WarpPerspectiveInit, SimdWarpPerspectiveRun), FUNC_RM(SimdWarpPerspectiveInit, SimdWarpPerspectiveRun), true);
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && RemapAutoTest(FUNC_RM(Simd::Avx2::WarpPerspectiveInit, SimdWarpPerspectiveRun), FUNC_RM(SimdWarpPerspectiveInit, SimdWarpPerspectiveRun), true);
+#endif
+
+        return result;
+    }
+
+    bool RemapAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && RemapAutoTest(FUNC_RM(Simd::Base::RemapInit, SimdRemapRun), FUNC_RM(SimdRemapInit, SimdRemapRun), false);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && RemapAutoTest(FUNC_RM(Simd::Sse41::RemapInit, SimdRemapRun), FUNC_RM(SimdRemapInit, SimdRemapRun), false);
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && RemapAutoTest(FUNC_RM(Simd::Avx2::RemapInit, SimdRemapRun), FUNC_RM(SimdRemapInit, SimdRemapRun), false);
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool WarpPerspectiveAffineSpecialTest(const Options& options)
+    {
+        bool result = true;
+
+        const size_t srcW = 320, srcH = 240;
+        const float aff[6] = { 0.9f, -0.3f, 40.0f, 0.3f, 0.9f, -20.0f };
+        const float per[9] = { aff[0], aff[1], aff[2], aff[3], aff[4], aff[5], 0.0f, 0.0f, 1.0f };
+        for (size_t channels = 1; channels <= 4; ++channels)
+        {
+            View src(srcW, srcH, ChannelsToFormat(channels), NULL, TEST_ALIGN(srcW));
+            ::srand(0);
+            FillPicture(src);
+            View dst1(srcW, srcH, src.format, NULL, TEST_ALIGN(srcW));
+            View dst2(srcW, srcH, src.format, NULL, TEST_ALIGN(srcW));
+            Simd::WarpAffine(src, aff, dst1, SimdWarpAffineInterpBilinear);
+            Simd::WarpPerspective(src, per, dst2, SimdWarpAffineInterpBilinear);
+            result = result && Compare(dst1, dst2, 1, true, 64, 0, "perspective vs affine");
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+
+#include "Simd/SimdYuvOverlay.hpp"
+
+namespace Test
+{
+    bool YuvOverlaySpecialTest(const Options & options)
+    {
+        typedef Simd::YuvOverlay Overlay;
+        typedef Overlay::Color Color;
+        typedef Overlay::Frame Frame;
+
+        bool result = true;
+
+        View bgra(W, H, View::Bgra32);
+        for (size_t y = 0; y < bgra.height; ++y)
+        {
+            Color * row = bgra.Row<Color>(y);
+            for (size_t x = 0; x < bgra.width; ++x)
+                row[x] = Color(255, (uint8_t)x, (uint8_t)y);
+        }
+        Frame yuv420p(W, H, Frame::Yuv420p, false, 0, SimdYuvBt709), nv12(W, H, Frame::Nv12, false, 0, SimdYuvBt709);
+        Simd::BgraToYuv420p(bgra, yuv420p.planes[0], yuv420p.planes[1], yuv420p.planes[2]);
+        Simd::Copy(yuv420p.planes[0], nv12.planes[0]);
+        Simd::InterleaveUv(yuv420p.planes[1], yuv420p.planes[2], nv12.planes[1]);
+
+        View sprite(64, 48, View::Bgra32);
+        for (size_t y = 0; y < sprite.height; ++y)
+        {
+            Color * row = sprite.Row<Color>(y);
+            for (size_t x = 0; x < sprite.width; ++x)
+                row[x] = Color((uint8_t)(x * 4), 0, (uint8_t)(y * 5), (uint8_t)(x * 255 / sprite.width));
+        }
+
+        Simd::Font font(24);
+        Overlay overlay;
+        Overlay::Rect opaque(W / 4 + 1, H / 4 + 1, W / 2 + 1, H / 2 + 1);
+        overlay.AddFilledRectangle(opaque, Color(0, 0, 255));
+        overlay.AddFilledRectangle(Overlay::Rect(W / 3, H / 3, W * 3 / 4, H * 3 / 4), Color(0, 255, 0, 96));
+        overlay.AddRectangle(Overlay::Rect(-10, 5, W / 2, H - 7), Color(255, 255, 255), 3);
+        Overlay::Points points;
+        points.push_back(Point(-W / 8, H / 8));
+        points.push_back(Point(W / 2, -H / 10));
+        points.push_back(Point(W * 9 / 8, H / 6));
+        points.push_back(Point(W * 7 / 8, H * 9 / 8));
+        points.push_back(Point(W / 2, H * 7 / 8));
+        overlay.AddPolyline(points, Color(255, 0, 255, 200), 2, true);
+        overlay.AddText(font, "Overlay text,\nsecond line.", Point(W / 8 + 1, H - 50), Color(255, 255, 0, 220));
+        overlay.AddSprite(sprite, Point(W - sprite.width / 2 - 1, 3));
+        overlay.AddSprite(sprite, Point(W / 3 + 1, H / 5 + 1));
+
+        result = result && overlay.Render(yuv420p);
+        result = result && overlay.Render(nv12);
+
+        View u(W / 2, H / 2, View::Gray8), v(W / 2, H / 2, View::Gray8);
+        Simd::DeinterleaveUv(nv12.planes[1], u, v);
+        result = result && Compare(yuv420p.planes[0], nv12.planes[0], 1, true, 64, 0, "y");
+        result = result && Compare(yuv420p.planes[1], u, 2, true, 64, 0, "u");
+        result = result && Compare(yuv420p.planes[2], v, 2, true, 64, 0, "v");
+
+        uint8_t expected[3];
+        Color red(0, 0, 255, 255);
+        SimdBgraToYuv444pV2((uint8_t*)&red, 4, 1, 1, expected + 0, 1, expected + 1, 1, expected + 2, 1, SimdYuvBt709);
+        Point inner(W / 4 + 8, H / 4 + 8);
+        if (yuv420p.planes[0].At<uint8_t>(inner) != expected[0] || yuv420p.planes[1].At<uint8_t>(inner / 2) != expected[1] 
+            || yuv420p.planes[2].At<uint8_t>(inner / 2) != expected[2])
+        {
+            TEST_LOG_SS(Error, "Opaque filled rectangle has wrong color!");
+            result = false;
+        }
+
+        Simd::Yuv420pToBgra(yuv420p.planes[0], yuv420p.planes[1], yuv420p.planes[2], bgra, 0xFF, SimdYuvBt709);
+        bgra.Save("yuv_overlay.ppm");
+
+        return result;
+    }
+}
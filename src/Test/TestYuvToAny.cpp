@@ -454,6 +454,510 @@ namespace Test
 
     //-------------------------------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncYuv16
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height,
+                SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, uint8_t* dst, size_t dstStride, SimdYuv16OutputType output, SimdBool dither);
+
+            FuncPtr func;
+            String description;
+
+            FuncYuv16(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, SimdYuv16OutputType output, bool dither)
+            {
+                const char* layouts[5] = { "420p", "422p", "444p", "P420", "P422" };
+                const char* outputs[11] = { "Gray8", "Bgr24", "Bgra32", "Rgb24", "Rgba32", "Bgr48", "Rgb48", "Bgr32f", "Rgb32f", "Bgr16b", "Rgb16b" };
+                description = description + "[" + layouts[layout] + "-" + ToString(bitDepth) + "-" + ToString(yuvType) + "-" + outputs[output] + (dither ? "-d" : "") + "]";
+            }
+
+            void Call(const View& y, const View& u, const View& v, SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, View& dst, SimdYuv16OutputType output, bool dither) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, layout, bitDepth, yuvType, dst.data, dst.stride, output, dither ? SimdTrue : SimdFalse);
+            }
+        };
+    }
+
+#define FUNC_YUV16(function) FuncYuv16(function, #function)
+
+    bool Yuv16ToBgrAutoTest(int width, int height, SimdYuv16LayoutType layout, size_t bitDepth, SimdYuvType yuvType, SimdYuv16OutputType output, bool dither, FuncYuv16 f1, FuncYuv16 f2)
+    {
+        bool result = true;
+
+        f1.Update(layout, bitDepth, yuvType, output, dither);
+        f2.Update(layout, bitDepth, yuvType, output, dither);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const bool semi = layout == SimdYuv16LayoutP420 || layout == SimdYuv16LayoutP422;
+        const int uvWidth = layout == SimdYuv16Layout444p ? width : width / 2;
+        const int uvHeight = layout == SimdYuv16Layout420p || layout == SimdYuv16LayoutP420 ? height / 2 : height;
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(y);
+        View u(semi ? uvWidth * 2 : uvWidth, uvHeight, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(u);
+        View v(uvWidth, uvHeight, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(v);
+
+        View dst1, dst2;
+        switch (output)
+        {
+        case SimdYuv16OutputGray8: dst1.Recreate(width, height, View::Gray8); break;
+        case SimdYuv16OutputBgr24: dst1.Recreate(width, height, View::Bgr24); break;
+        case SimdYuv16OutputBgra32: dst1.Recreate(width, height, View::Bgra32); break;
+        case SimdYuv16OutputRgb24: dst1.Recreate(width, height, View::Rgb24); break;
+        case SimdYuv16OutputRgba32: dst1.Recreate(width, height, View::Rgba32); break;
+        case SimdYuv16OutputBgr48:
+        case SimdYuv16OutputRgb48: dst1.Recreate(width * 3, height, View::Int16); break;
+        case SimdYuv16OutputBgr32f:
+        case SimdYuv16OutputRgb32f: dst1.Recreate(width, height * 3, View::Float); break;
+        case SimdYuv16OutputBgr16b:
+        case SimdYuv16OutputRgb16b: dst1.Recreate(width, height * 3, View::Int16); break;
+        default:
+            assert(0);
+        }
+        dst2.Recreate(dst1.width, dst1.height, dst1.format);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, layout, bitDepth, yuvType, dst1, output, dither));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, layout, bitDepth, yuvType, dst2, output, dither));
+
+        if (dst1.format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else if (output == SimdYuv16OutputBgr16b || output == SimdYuv16OutputRgb16b)
+        {
+            View f1(dst1.width, dst1.height, View::Float), f2(dst2.width, dst2.height, View::Float);
+            for (size_t row = 0; row < dst1.height; ++row)
+            {
+                SimdBFloat16ToFloat32(dst1.Row<uint16_t>(row), dst1.width, f1.Row<float>(row));
+                SimdBFloat16ToFloat32(dst2.Row<uint16_t>(row), dst2.width, f2.Row<float>(row));
+            }
+            result = result && Compare(f1, f2, 0.01f, true, 64, DifferenceBoth);
+        }
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool Yuv16ToBgrAutoTest(const FuncYuv16& f1, const FuncYuv16& f2)
+    {
+        bool result = true;
+
+        result = result && Yuv16ToBgrAutoTest(W, H, SimdYuv16Layout420p, 10, SimdYuvBt709, SimdYuv16OutputBgr24, false, f1, f2);
+        result = result && Yuv16ToBgrAutoTest(W + O * 2, H - O * 2, SimdYuv16Layout420p, 12, SimdYuvBt2020, SimdYuv16OutputRgba32, true, f1, f2);
+        result = result && Yuv16ToBgrAutoTest(W - O * 2, H + O, SimdYuv16Layout422p, 10, SimdYuvBt601, SimdYuv16OutputBgra32, false, f1, f2);
+        result = result && Yuv16ToBgrAutoTest(W, H, SimdYuv16Layout444p, 12, SimdYuvTrect871, SimdYuv16OutputRgb24, true, f1, f2);
+        result = result && Yuv16ToBgrAutoTest(W + O * 2, H - O * 2, SimdYuv16LayoutP420, 10, SimdYuvBt2020, SimdYuv16OutputBgr48, false, f1, f2);
+        result = result && Yuv16ToBgrAutoTest(W - O * 2, H + O * 2, SimdYuv16LayoutP420, 16, SimdYuvBt709, SimdYuv16OutputGray8, true, f1, f2);
+        result = result && Yuv16ToBgrAutoTest(W, H, SimdYuv16LayoutP422, 12, SimdYuvBt709, SimdYuv16OutputRgb32f, false, f1, f2);
+        result = result && Yuv16ToBgrAutoTest(W + O * 2, H - O * 2, SimdYuv16Layout420p, 16, SimdYuvBt2020, SimdYuv16OutputBgr32f, false, f1, f2);
+        result = result && Yuv16ToBgrAutoTest(W - O, H + O, SimdYuv16Layout444p, 10, SimdYuvBt709, SimdYuv16OutputBgr16b, false, f1, f2);
+
+        return result;
+    }
+
+    bool Yuv16ToBgrAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && Yuv16ToBgrAutoTest(FUNC_YUV16(Simd::Base::Yuv16ToBgr), FUNC_YUV16(SimdYuv16ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && Yuv16ToBgrAutoTest(FUNC_YUV16(Simd::Sse41::Yuv16ToBgr), FUNC_YUV16(SimdYuv16ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && Yuv16ToBgrAutoTest(FUNC_YUV16(Simd::Avx2::Yuv16ToBgr), FUNC_YUV16(SimdYuv16ToBgr));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncNv
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, SimdYuvType yuvType);
+            typedef void(*FuncAlphaPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            FuncAlphaPtr funcAlpha;
+            String description;
+
+            FuncNv(const FuncPtr& f, const String& d) : func(f), funcAlpha(NULL), description(d) {}
+            FuncNv(const FuncAlphaPtr& f, const String& d) : func(NULL), funcAlpha(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (func)
+                    func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+                else
+                    funcAlpha(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, alpha, yuvType);
+            }
+        };
+    }
+
+#define FUNC_NV(function) FuncNv(FuncNv::FuncPtr(function), #function)
+#define FUNC_NVA(function) FuncNv(FuncNv::FuncAlphaPtr(function), #function)
+
+    bool NvToAnyAutoTest(int width, int height, const FuncNv& f1, const FuncNv& f2, View::Format format, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+
+        const uint8_t alpha = Random(256);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1, alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2, alpha, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool NvToAnyAutoTest(const FuncNv& f1, const FuncNv& f2, View::Format format)
+    {
+        bool result = true;
+
+        result = result && NvToAnyAutoTest(W, H, f1, f2, format, SimdYuvBt601);
+        result = result && NvToAnyAutoTest(W + O * 2, H - O * 2, f1, f2, format, SimdYuvBt709);
+        result = result && NvToAnyAutoTest(W - O * 2, H + O * 2, f1, f2, format, SimdYuvBt2020);
+        result = result && NvToAnyAutoTest(W, H, f1, f2, format, SimdYuvTrect871);
+
+        return result;
+    }
+
+    bool Nv12ToBgrV2AutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Base::Nv12ToBgrV2), FUNC_NV(SimdNv12ToBgrV2), View::Bgr24);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Sse41::Nv12ToBgrV2), FUNC_NV(SimdNv12ToBgrV2), View::Bgr24);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Avx2::Nv12ToBgrV2), FUNC_NV(SimdNv12ToBgrV2), View::Bgr24);
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToBgraV2AutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Base::Nv12ToBgraV2), FUNC_NVA(SimdNv12ToBgraV2), View::Bgra32);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Sse41::Nv12ToBgraV2), FUNC_NVA(SimdNv12ToBgraV2), View::Bgra32);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Avx2::Nv12ToBgraV2), FUNC_NVA(SimdNv12ToBgraV2), View::Bgra32);
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToRgbV2AutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Base::Nv12ToRgbV2), FUNC_NV(SimdNv12ToRgbV2), View::Rgb24);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Sse41::Nv12ToRgbV2), FUNC_NV(SimdNv12ToRgbV2), View::Rgb24);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Avx2::Nv12ToRgbV2), FUNC_NV(SimdNv12ToRgbV2), View::Rgb24);
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToRgbaV2AutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Base::Nv12ToRgbaV2), FUNC_NVA(SimdNv12ToRgbaV2), View::Rgba32);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Sse41::Nv12ToRgbaV2), FUNC_NVA(SimdNv12ToRgbaV2), View::Rgba32);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Avx2::Nv12ToRgbaV2), FUNC_NVA(SimdNv12ToRgbaV2), View::Rgba32);
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgrV2AutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Base::Nv21ToBgrV2), FUNC_NV(SimdNv21ToBgrV2), View::Bgr24);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Sse41::Nv21ToBgrV2), FUNC_NV(SimdNv21ToBgrV2), View::Bgr24);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Avx2::Nv21ToBgrV2), FUNC_NV(SimdNv21ToBgrV2), View::Bgr24);
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgraV2AutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Base::Nv21ToBgraV2), FUNC_NVA(SimdNv21ToBgraV2), View::Bgra32);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Sse41::Nv21ToBgraV2), FUNC_NVA(SimdNv21ToBgraV2), View::Bgra32);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Avx2::Nv21ToBgraV2), FUNC_NVA(SimdNv21ToBgraV2), View::Bgra32);
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToRgbV2AutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Base::Nv21ToRgbV2), FUNC_NV(SimdNv21ToRgbV2), View::Rgb24);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Sse41::Nv21ToRgbV2), FUNC_NV(SimdNv21ToRgbV2), View::Rgb24);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NvToAnyAutoTest(FUNC_NV(Simd::Avx2::Nv21ToRgbV2), FUNC_NV(SimdNv21ToRgbV2), View::Rgb24);
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToRgbaV2AutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Base::Nv21ToRgbaV2), FUNC_NVA(SimdNv21ToRgbaV2), View::Rgba32);
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Sse41::Nv21ToRgbaV2), FUNC_NVA(SimdNv21ToRgbaV2), View::Rgba32);
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NvToAnyAutoTest(FUNC_NVA(Simd::Avx2::Nv21ToRgbaV2), FUNC_NVA(SimdNv21ToRgbaV2), View::Rgba32);
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncNvR
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t srcWidth, size_t srcHeight,
+                uint8_t* bgr, size_t bgrStride, size_t dstWidth, size_t dstHeight, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncNvR(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& bgr, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, bgr.width, bgr.height, yuvType);
+            }
+        };
+    }
+
+#define FUNC_NVR(function) FuncNvR(function, #function)
+
+    bool Nv12ToBgrResizedAutoTest(int srcWidth, int srcHeight, int dstWidth, int dstHeight, const FuncNvR& f1, const FuncNvR& f2, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcWidth << ", " << srcHeight << "] -> [" << dstWidth << ", " << dstHeight << "].");
+
+        View y(srcWidth, srcHeight, View::Gray8, NULL, TEST_ALIGN(srcWidth));
+        FillRandom(y);
+        View uv(srcWidth / 2, srcHeight / 2, View::Uv16, NULL, TEST_ALIGN(srcWidth));
+        FillRandom(uv);
+
+        View bgr1(dstWidth, dstHeight, View::Bgr24, NULL, TEST_ALIGN(dstWidth));
+        View bgr2(dstWidth, dstHeight, View::Bgr24, NULL, TEST_ALIGN(dstWidth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, bgr1, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, bgr2, yuvType));
+
+        result = result && Compare(bgr1, bgr2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Nv12ToBgrResizedAutoTest(const FuncNvR& f1, const FuncNvR& f2)
+    {
+        bool result = true;
+
+        result = result && Nv12ToBgrResizedAutoTest(W, H, W / 3, H / 3, f1, f2, SimdYuvBt601);
+        result = result && Nv12ToBgrResizedAutoTest(W + O * 2, H - O * 2, W / 2 + O, H / 2 - O, f1, f2, SimdYuvBt709);
+        result = result && Nv12ToBgrResizedAutoTest(W / 2 & ~1, H / 2 & ~1, W + O, H - O, f1, f2, SimdYuvBt2020);
+        result = result && Nv12ToBgrResizedAutoTest(W, H, 7, 5, f1, f2, SimdYuvTrect871);
+
+        return result;
+    }
+
+    bool Nv12ToBgrResizedAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && Nv12ToBgrResizedAutoTest(FUNC_NVR(Simd::Base::Nv12ToBgrResized), FUNC_NVR(SimdNv12ToBgrResized));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && Nv12ToBgrResizedAutoTest(FUNC_NVR(Simd::Sse41::Nv12ToBgrResized), FUNC_NVR(SimdNv12ToBgrResized));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && Nv12ToBgrResizedAutoTest(FUNC_NVR(Simd::Avx2::Nv12ToBgrResized), FUNC_NVR(SimdNv12ToBgrResized));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    typedef Simd::Frame<Simd::Allocator> Frame;
+    typedef Simd::FrameConverter<Simd::Allocator> FrameConverter;
+
+    bool FrameConverterAutoTest(int width, int height, Frame::Format srcFormat, SimdYuvType srcYuvType, Frame::Format dstFormat, SimdYuvType dstYuvType)
+    {
+        bool result = true;
+
+        Frame src(width, height, srcFormat, false, 0, srcYuvType);
+        for (size_t i = 0; i < src.PlaneCount(); ++i)
+        {
+            if (src.planes[i].format == View::Int16)
+                FillRandom16u(src.planes[i], 0, 1023);
+            else
+                FillRandom(src.planes[i]);
+        }
+        Frame dst1(width, height, dstFormat, false, 0, dstYuvType);
+        Frame dst2(width, height, dstFormat, false, 0, dstYuvType);
+        for (size_t i = 0; i < dst1.PlaneCount(); ++i)
+        {
+            Simd::Fill(dst1.planes[i], 0x00);
+            Simd::Fill(dst2.planes[i], 0xFF);
+        }
+
+        FrameConverter c1, c2;
+        result = result && c1.Init(width, height, src.format, dst1.format, src.yuvType, dst1.yuvType, height);
+        result = result && c2.Init(width, height, src.format, dst2.format, src.yuvType, dst2.yuvType, 2);
+        if (!result)
+        {
+            TEST_LOG_SS(Error, "There is no conversion " << srcFormat << " -> " << dstFormat << " !");
+            return result;
+        }
+
+        TEST_LOG_SS(Info, "Test FrameConverter " << srcFormat << " -> " << dstFormat << " (" << c2.Hops() << " hops) [" << width << ", " << height << "].");
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(c1.Convert(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(c2.Convert(src, dst2));
+
+        for (size_t i = 0; i < dst1.PlaneCount(); ++i)
+            result = result && Compare(dst1.planes[i], dst2.planes[i], 0, true, 64);
+
+        return result;
+    }
+
+    bool FrameConverterAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        for (int s = Frame::Nv12; s <= Frame::Yuv422p16; ++s)
+        {
+            Frame::Format srcFormat = (Frame::Format)s;
+            if (srcFormat == Frame::Lab24)
+                continue;
+            for (int d = Frame::Nv12; d <= Frame::Yuv422p16; ++d)
+            {
+                Frame::Format dstFormat = (Frame::Format)d;
+                if (dstFormat > Frame::Lab24 && dstFormat != Frame::Nv21)
+                    continue;
+                result = result && FrameConverterAutoTest(W, H, srcFormat, SimdYuvBt601, dstFormat, SimdYuvBt601);
+                if (Frame::PlaneCount(srcFormat) > 1 && Frame::PlaneCount(dstFormat) > 1)
+                    result = result && FrameConverterAutoTest(W, H, srcFormat, SimdYuvBt601, dstFormat, SimdYuvBt709);
+            }
+        }
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
     bool Yuv420pToRgbV2SpecialTest(const Options & options)
     {
         bool result = true;